@@ -72,6 +72,30 @@ class WorkerControllerAppBase : public hypernet::IApplication
         runtime_.onSessionEnd(session);
     }
 
+    void onSendBackpressure(hypernet::SessionHandle session, bool congested) override
+    {
+        if (auto c = getController(session.ownerWorkerId()); c)
+            c->onSendBackpressure(session, congested);
+    }
+
+    // 워커 간 세션 이관: 양쪽 워커 컨트롤러가 있고 owner 컨트롤러가 동의할 때만 registry 레코드를 넘김
+    bool onSessionMigrateOut(hypernet::SessionHandle session, int targetWorker, std::shared_ptr<void> &context) override
+    {
+        auto c = getController(session.ownerWorkerId());
+        if (!c || !getController(targetWorker) || !c->canMigrateSession(session))
+            return false;
+
+        context = runtime_.detachSession(session.id());
+        return context != nullptr;
+    }
+
+    void onSessionMigrateIn(hypernet::SessionHandle session, std::shared_ptr<void> context) override
+    {
+        runtime_.attachSession(session, std::move(context));
+        if (auto c = getController(session.ownerWorkerId()); c)
+            c->onSessionMigrated(session);
+    }
+
   protected:
     [[nodiscard]] std::shared_ptr<trading::IController> getController(int wid) const noexcept
     {
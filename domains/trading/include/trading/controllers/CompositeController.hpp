@@ -21,6 +21,11 @@ class CompositeController final : public trading::IController
 
     void onSessionStart(hypernet::SessionHandle session) override;
     void onSessionEnd(hypernet::SessionHandle session) override;
+    void onSendBackpressure(hypernet::SessionHandle session, bool congested) override;
+
+    // 모든 자식이 동의해야 이관
+    bool canMigrateSession(hypernet::SessionHandle session) override;
+    void onSessionMigrated(hypernet::SessionHandle session) override;
 
   private:
     std::vector<std::shared_ptr<trading::IController>> children_;
@@ -21,5 +21,11 @@ struct IController
 
     virtual void onSessionStart(hypernet::SessionHandle /*session*/) {}
     virtual void onSessionEnd(hypernet::SessionHandle /*session*/) {}
+    virtual void onSendBackpressure(hypernet::SessionHandle /*session*/, bool /*congested*/) {}
+
+    // 워커 간 세션 이관: 이 워커에 세션별 상태를 두지 않는 컨트롤러만 true (기본: 옮기지 않음)
+    virtual bool canMigrateSession(hypernet::SessionHandle /*session*/) { return false; }
+    // 옮겨 온 세션이 새 owner 워커에 등록된 뒤 (새 핸들)
+    virtual void onSessionMigrated(hypernet::SessionHandle /*session*/) {}
 };
 } // namespace trading
\ No newline at end of file
@@ -20,9 +20,11 @@
 #include <utility>
 
 // Legacy wrappers
-#define BIND_PACKET(PacketType, HandlerFunc) trading::bind::bindPackets(dispatcher, runtime, self).allowStates(hyperapp::ConnState::Connected).on<PacketType>(&HandlerFunc, nullptr, true)
-#define BIND_PACKET_WITH_STATE(PacketType, State, HandlerFunc) trading::bind::bindPackets(dispatcher, runtime, self).allowStates(State).on<PacketType>(&HandlerFunc, nullptr, true)
-#define BIND_PACKET_WITH_STATES(PacketType, HandlerFunc, ...) trading::bind::bindPackets(dispatcher, runtime, self).allowStates(__VA_ARGS__).on<PacketType>(&HandlerFunc, nullptr, true)
+#define BIND_PACKET(PacketType, HandlerFunc) trading::bind::bindPackets(dispatcher, runtime, self).allowStates(hyperapp::ConnState::Connected).on<PacketType, &HandlerFunc>(nullptr, true)
+#define BIND_PACKET_WITH_STATE(PacketType, State, HandlerFunc) trading::bind::bindPackets(dispatcher, runtime, self).allowStates(State).on<PacketType, &HandlerFunc>(nullptr, true)
+#define BIND_PACKET_WITH_STATES(PacketType, HandlerFunc, ...) trading::bind::bindPackets(dispatcher, runtime, self).allowStates(__VA_ARGS__).on<PacketType, &HandlerFunc>(nullptr, true)
+// Relay: 디코드 없이 수신 body 를 그대로 받음 (핸들러: Self&, AppRuntime&, SessionHandle, const MessageView&, const SessionContext&)
+#define BIND_RAW_WITH_STATES(PacketType, HandlerFunc, ...) trading::bind::bindPackets(dispatcher, runtime, self).allowStates(__VA_ARGS__).onRaw<PacketType, &HandlerFunc>()
 
 namespace trading::bind
 {
@@ -79,6 +81,17 @@ inline constexpr bool is_supported_handler_v =
     std::is_invocable_v<Handler, Self &, hypernet::SessionHandle, const Packet &, const hyperapp::SessionContext &> ||
     std::is_invocable_v<Handler, Self &, hyperapp::AppRuntime &, hypernet::SessionHandle, const Packet &> || std::is_invocable_v<Handler, Self &, hypernet::SessionHandle, const Packet &>;
 
+// 컴파일 타임에 고정된 핸들러 (멤버 함수 포인터를 값으로 들고 다니지 않음)
+// - 빈 타입이라 캡처 비용이 없고, 호출은 Fn 으로의 직접 호출로 inline 된다.
+template <auto Fn> struct StaticHandler
+{
+    template <typename... Args>
+    constexpr auto operator()(Args &&...args) const -> decltype(std::invoke(Fn, std::forward<Args>(args)...))
+    {
+        return std::invoke(Fn, std::forward<Args>(args)...);
+    }
+};
+
 // [기존 코드 유지] Invoke Helper
 template <typename Handler, typename Self, typename Packet>
 constexpr void invoke_handler(Self &self, hyperapp::AppRuntime &rt, hypernet::SessionHandle s, const Packet &pkt, const hyperapp::SessionContext &ctx, Handler &&h)
@@ -142,6 +155,27 @@ void registerPacketCtx(hypernet::protocol::Dispatcher &dispatcher, hyperapp::App
     registerPacketCtx<PacketType>(dispatcher, runtime, PacketType::kOpcode, allowedMask, self, std::forward<Handler>(handler), std::forward<BadHandler>(bad), strict);
 }
 
+// -----------------------------------------------------------
+// 3. Raw (relay) Registration: 디코드 없이 수신 body 를 그대로 핸들러에 넘김
+// -----------------------------------------------------------
+template <typename PacketType, typename Self, typename Handler>
+void registerRawCtx(hypernet::protocol::Dispatcher &dispatcher, hyperapp::AppRuntime &runtime, std::uint32_t allowedMask, const std::shared_ptr<Self> &self, Handler &&handler)
+{
+    static_assert(trading::protocol::isValidTradingOpcode(PacketType::kOpcode), "OpcodePolicy violation");
+    static_assert(std::is_invocable_v<Handler, Self &, hyperapp::AppRuntime &, hypernet::SessionHandle, const hypernet::protocol::MessageView &, const hyperapp::SessionContext &>,
+                  "Unsupported raw handler signature. Please use (Self&, Runtime&, Session, const MessageView&, Ctx).");
+
+    if (allowedMask == 0)
+    {
+        reportViolation("EmptyAllowedMask", PacketType::kOpcode);
+    }
+
+    runtime.registerRawHandlerCtx(dispatcher, PacketType::kOpcode, allowedMask,
+                                  [self, &runtime, handler = std::forward<Handler>(handler)](hypernet::SessionHandle s, const hypernet::protocol::MessageView &raw,
+                                                                                             const hyperapp::SessionContext &ctx) mutable
+                                  { std::invoke(handler, *self, runtime, s, raw, ctx); });
+}
+
 // -----------------------------------------------------------
 // Type-safe Binder API
 // -----------------------------------------------------------
@@ -183,6 +217,19 @@ template <typename Self> class PacketBinder final
             registerPacketCtx<PacketType>(dispatcher_, runtime_, allowedMask_, self_, std::forward<Handler>(handler), std::forward<BadHandler>(bad), strict);
         }
 
+        // 정적 바인딩: 핸들러를 템플릿 인자로 고정한다. (BIND_PACKET* 매크로가 사용)
+        template <typename PacketType, auto Handler, typename BadHandler = std::nullptr_t> void on(BadHandler &&bad = nullptr, bool strict = true)
+        {
+            on<PacketType>(detail::StaticHandler<Handler>{}, std::forward<BadHandler>(bad), strict);
+        }
+
+        // 정적 raw 바인딩: 핸들러가 수신 body(view) 를 그대로 받는다. (BIND_RAW_WITH_STATES 가 사용, 길이 검사는 핸들러 몫)
+        template <typename PacketType, auto Handler> void onRaw()
+        {
+            bound_ = true;
+            registerRawCtx<PacketType>(dispatcher_, runtime_, allowedMask_, self_, detail::StaticHandler<Handler>{});
+        }
+
       private:
         hypernet::protocol::Dispatcher &dispatcher_;
         hyperapp::AppRuntime &runtime_;
@@ -3,6 +3,7 @@
 #include <hyperapp/core/AppRuntime.hpp>
 #include <hyperapp/core/UpstreamGateway.hpp>
 #include <hypernet/SessionHandle.hpp>
+#include <hypernet/protocol/MessageView.hpp>
 #include <trading/controllers/IController.hpp>
 #include <trading/protocol/FepPackets.hpp>
 
@@ -22,9 +23,12 @@ class BenchmarkGatewayController final : public trading::IController, public std
     explicit BenchmarkGatewayController(std::shared_ptr<hyperapp::UpstreamGateway> upstream, bool handoff_mode = false);
 
     void install(hypernet::protocol::Dispatcher &dispatcher, hyperapp::AppRuntime &runtime) override;
+    // 세션별 상태 없음 (ping 은 현재 워커 upstream 으로, pong 은 client_sid 로 라우팅)
+    bool canMigrateSession(hypernet::SessionHandle) override { return true; }
 
-    void onPerfPing(hyperapp::AppRuntime &rt, hypernet::SessionHandle session, const trading::protocol::PerfPingPkt &pkt, const hyperapp::SessionContext &ctx);
-    void onPerfPong(hyperapp::AppRuntime &rt, hypernet::SessionHandle session, const trading::protocol::PerfPongPkt &pkt, const hyperapp::SessionContext &ctx);
+    // cut-through relay: 수신 body 를 디코드 없이 넘기고 client_sid/t2(t4) 만 패치
+    void onPerfPing(hyperapp::AppRuntime &rt, hypernet::SessionHandle session, const hypernet::protocol::MessageView &raw, const hyperapp::SessionContext &ctx);
+    void onPerfPong(hyperapp::AppRuntime &rt, hypernet::SessionHandle session, const hypernet::protocol::MessageView &raw, const hyperapp::SessionContext &ctx);
 
   private:
     std::shared_ptr<hyperapp::UpstreamGateway> upstream_;
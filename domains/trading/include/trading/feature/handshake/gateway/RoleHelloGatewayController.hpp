@@ -23,6 +23,8 @@ class RoleHelloGatewayController final : public trading::IController, public std
 
     void install(hypernet::protocol::Dispatcher &dispatcher, hyperapp::AppRuntime &runtime) override;
     void onSessionEnd(hypernet::SessionHandle session) override;
+    // 워커별 upstream 세션은 그 워커에 묶여 있으므로 클라이언트 세션만 이관 허용
+    bool canMigrateSession(hypernet::SessionHandle session) override;
 
   private:
     void onRoleHello_(hyperapp::AppRuntime &rt, hypernet::SessionHandle session, const trading::protocol::RoleHelloReqPkt &pkt, const hyperapp::SessionContext &ctx);
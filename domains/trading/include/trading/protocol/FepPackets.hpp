@@ -6,6 +6,7 @@
 #include <hyperapp/protocol/PacketWriter.hpp>
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <string_view>
@@ -103,6 +104,11 @@ struct PerfPingPkt
 {
     static constexpr std::uint16_t kOpcode = kOpcodePerfPing; // 20050
 
+    // relay 패치 위치 (write() 순서 그대로, body 기준 바이트 offset)
+    static constexpr std::size_t kWireBytes = 48;
+    static constexpr std::uint32_t kClientSidOffset = 0;
+    static constexpr std::uint32_t kT2Offset = 24;
+
     std::uint64_t client_sid{0};
     std::uint64_t seq{0};
     std::uint64_t t1{0};
@@ -144,6 +150,11 @@ struct PerfPongPkt
 {
     static constexpr std::uint16_t kOpcode = kOpcodePerfPong; // 20051
 
+    // relay 패치 위치 (write() 순서 그대로, body 기준 바이트 offset)
+    static constexpr std::size_t kWireBytes = 48;
+    static constexpr std::uint32_t kClientSidOffset = 0;
+    static constexpr std::uint32_t kT4Offset = 40;
+
     std::uint64_t client_sid{0};
     std::uint64_t seq{0};
     std::uint64_t t1{0};
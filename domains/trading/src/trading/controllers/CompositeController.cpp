@@ -38,4 +38,28 @@ void CompositeController::onSessionEnd(hypernet::SessionHandle session)
     for (auto &c : children_)
         c->onSessionEnd(session);
 }
+
+void CompositeController::onSendBackpressure(hypernet::SessionHandle session, bool congested)
+{
+    for (auto &c : children_)
+        c->onSendBackpressure(session, congested);
+}
+
+bool CompositeController::canMigrateSession(hypernet::SessionHandle session)
+{
+    if (children_.empty())
+        return false;
+    for (auto &c : children_)
+    {
+        if (!c->canMigrateSession(session))
+            return false;
+    }
+    return true;
+}
+
+void CompositeController::onSessionMigrated(hypernet::SessionHandle session)
+{
+    for (auto &c : children_)
+        c->onSessionMigrated(session);
+}
 } // namespace trading::controllers
@@ -5,6 +5,8 @@
 
 #include <hypernet/core/ThreadContext.hpp>
 #include <hypernet/monitoring/Metrics.hpp>
+#include <hypernet/protocol/Endian.hpp>
+#include <hypernet/protocol/FieldPatch.hpp>
 #include <chrono>
 
 namespace
@@ -25,17 +27,23 @@ void BenchmarkGatewayController::install(hypernet::protocol::Dispatcher &dispatc
 {
     (void)runtime;
     auto self = shared_from_this();
-    BIND_PACKET_WITH_STATES(trading::protocol::PerfPingPkt, BenchmarkGatewayController::onPerfPing, hyperapp::ConnState::Handshaked);
-    BIND_PACKET_WITH_STATES(trading::protocol::PerfPongPkt, BenchmarkGatewayController::onPerfPong, hyperapp::ConnState::Handshaked);
+    BIND_RAW_WITH_STATES(trading::protocol::PerfPingPkt, BenchmarkGatewayController::onPerfPing, hyperapp::ConnState::Handshaked);
+    BIND_RAW_WITH_STATES(trading::protocol::PerfPongPkt, BenchmarkGatewayController::onPerfPong, hyperapp::ConnState::Handshaked);
 }
 
-void BenchmarkGatewayController::onPerfPing(hyperapp::AppRuntime &rt, hypernet::SessionHandle session, const trading::protocol::PerfPingPkt &pkt, const hyperapp::SessionContext &)
+void BenchmarkGatewayController::onPerfPing(hyperapp::AppRuntime &rt, hypernet::SessionHandle session, const hypernet::protocol::MessageView &raw, const hyperapp::SessionContext &ctx)
 {
-    if (!upstream_ || upstream_->workerCount() <= 0)
+    using trading::protocol::PerfPingPkt;
+
+    // strict 디코드와 같은 기준: 길이가 정확히 맞아야 함
+    if (raw.size() != PerfPingPkt::kWireBytes)
+    {
+        trading::bind::defaultBadPacket(PerfPingPkt::kOpcode, session, raw, ctx);
         return;
+    }
 
-    trading::protocol::PerfPingPkt fwd = pkt;
-    fwd.client_sid = session.id();
+    if (!upstream_ || upstream_->workerCount() <= 0)
+        return;
 
     const int wc = upstream_->workerCount();
 
@@ -48,22 +56,35 @@ void BenchmarkGatewayController::onPerfPing(hyperapp::AppRuntime &rt, hypernet::
     if (upstreamSid == 0)
         return;
 
-    fwd.t2 = nowNs();
+    const hypernet::protocol::FieldPatch patches[] = {
+        {PerfPingPkt::kClientSidOffset, 8, session.id()},
+        {PerfPingPkt::kT2Offset, 8, nowNs()},
+    };
 
-    (void)rt.service().sendTo(upstreamSid, fwd);
+    (void)rt.service().relayTo(upstreamSid, PerfPingPkt::kOpcode, raw, patches);
     hypernet::monitoring::engineMetrics().onTxMessage();
 }
 
-void BenchmarkGatewayController::onPerfPong(hyperapp::AppRuntime &rt, hypernet::SessionHandle /*session*/, const trading::protocol::PerfPongPkt &pkt, const hyperapp::SessionContext &)
+void BenchmarkGatewayController::onPerfPong(hyperapp::AppRuntime &rt, hypernet::SessionHandle session, const hypernet::protocol::MessageView &raw, const hyperapp::SessionContext &ctx)
 {
-    const auto clientSid = static_cast<hypernet::SessionHandle::Id>(pkt.client_sid);
+    using trading::protocol::PerfPongPkt;
+
+    if (raw.size() != PerfPongPkt::kWireBytes)
+    {
+        trading::bind::defaultBadPacket(PerfPongPkt::kOpcode, session, raw, ctx);
+        return;
+    }
+
+    const auto *body = static_cast<const std::uint8_t *>(raw.data());
+    const auto clientSid = static_cast<hypernet::SessionHandle::Id>(hypernet::protocol::loadU64Be(body + PerfPongPkt::kClientSidOffset));
     if (clientSid == 0)
         return;
 
-    trading::protocol::PerfPongPkt fwd = pkt;
-    fwd.t4 = nowNs();
+    const hypernet::protocol::FieldPatch patches[] = {
+        {PerfPongPkt::kT4Offset, 8, nowNs()},
+    };
 
-    (void)rt.service().sendTo(clientSid, fwd);
+    (void)rt.service().relayTo(clientSid, PerfPongPkt::kOpcode, raw, patches);
     hypernet::monitoring::engineMetrics().onTxMessage();
 }
 
@@ -71,6 +71,11 @@ void RoleHelloGatewayController::onRoleHello_(hyperapp::AppRuntime &rt, hypernet
     SLOG_INFO("RoleHelloGateway", "ReqRecv", "sid={} role={} localUp={} wid={} sent={}", session.id(), static_cast<int>(pkt.role), localUp, wid, sent ? 1 : 0);
 }
 
+bool RoleHelloGatewayController::canMigrateSession(hypernet::SessionHandle session)
+{
+    return !upstream_ || upstream_->getForWorker(hypernet::core::wid()) != session.id();
+}
+
 void RoleHelloGatewayController::onSessionEnd(hypernet::SessionHandle session)
 {
     const int wid = hypernet::core::wid();
@@ -58,12 +58,14 @@ class Engine : private util::NonCopyable
     using Workers = std::vector<std::unique_ptr<core::WorkerContext>>;
 
     void resetForRun_() noexcept;
-    void startMetrics_();
+    void lockMemory_(const core::EngineOptions &opt) noexcept;
+    void placeLoggerThread_(const core::EngineOptions &opt) noexcept;
+    void startMetrics_(const core::EngineOptions &opt);
     void stopMetrics_() noexcept;
 
     [[nodiscard]] Workers createWorkers_(const core::EngineOptions &opt);
     [[nodiscard]] std::shared_ptr<core::AppCallbackInvoker> setupAppCallbacks_(Workers &workers);
-    void setupRouting_(Workers &workers);
+    void setupRouting_(Workers &workers, const core::EngineOptions &opt);
     void startWorkers_(Workers &workers);
 
     void logStarted_(const core::EngineOptions &opt) const;
@@ -4,7 +4,12 @@
 #include <cstdint>
 #include <string>
 
+#include <hypernet/buffer/PageMemory.hpp>
+#include <hypernet/core/Defaults.hpp>
 #include <hypernet/core/Logger.hpp>
+#include <hypernet/net/IoBackend.hpp>
+#include <hypernet/net/PollMode.hpp>
+#include <hypernet/net/SteeringMode.hpp>
 
 namespace hypernet
 {
@@ -27,9 +32,64 @@ struct EngineConfig
     /// - 0이면 std::thread::hardware_concurrency() 기반으로 자동 결정됩니다.
     unsigned int workerThreads = 0;
 
+    /// 워커 스레드 CPU 고정 방식입니다.
+    /// - "" 또는 "none": 고정하지 않습니다. (OS 스케줄링)
+    /// - "auto": 허용된 CPU 의 코어/NUMA 배치를 읽어 물리 코어마다 워커 1개씩 놓습니다.
+    ///   코어가 남으면 가장 낮은 CPU 의 코어를 logger/metrics 스레드용으로 비워 둡니다.
+    /// - "0,2,4-7": 워커 id 순서대로 목록의 CPU 에 고정합니다. (워커가 더 많으면 목록을 반복)
+    /// - 워커는 고정한 뒤 자기 스레드에서 EventLoop/버퍼 풀/SessionManager 를 만들므로 first-touch 가 그 노드에 붙습니다.
+    std::string workerCpuAffinity;
+
+    /// 워커 스레드 SCHED_FIFO 우선순위(1~99). 0이면 SCHED_OTHER 그대로입니다.
+    /// - CAP_SYS_NICE(또는 RLIMIT_RTPRIO) 가 없으면 경고만 남기고 SCHED_OTHER 로 돕니다.
+    /// - busy/spin pollMode 와 함께 쓰면 같은 CPU 의 다른 스레드를 굶길 수 있으니 전용 코어에서만 쓰세요.
+    std::uint32_t workerSchedFifoPriority = 0;
+
+    /// CPU 에 고정된 워커가 메모리를 그 CPU 의 NUMA 노드에서 우선 할당받도록 할지 여부 (set_mempolicy)
+    bool workerNumaBind = false;
+
+    /// 로거 consumer 스레드를 고정할 CPU 입니다. -1이면 고정하지 않습니다. (auto 모드면 housekeeping CPU)
+    int loggerCpu = -1;
+
+    /// 메트릭 HTTP 스레드를 고정할 CPU 입니다. -1이면 고정하지 않습니다. (auto 모드면 housekeeping CPU)
+    int metricsCpu = -1;
+
+    /// 워커 링(세션/staging)과 버퍼 풀 저장소의 페이지 종류 ("off" | "thp" | "hugetlb")
+    /// - thp: madvise(MADV_HUGEPAGE) 힌트. 2 MiB 이상 영역은 2 MiB 경계에 맞춰 잡습니다.
+    /// - hugetlb: MAP_HUGETLB / MFD_HUGETLB. vm.nr_hugepages 예약이 없으면 WARN 1회 후 thp 로 폴백합니다.
+    ///            2 MiB 미만 영역(기본 크기 세션 링 등)은 일반 페이지로 잡습니다.
+    buffer::HugePageMode hugePages = buffer::HugePageMode::Off;
+
+    /// 워커 시작 시 링/풀/framer scratch 페이지를 미리 써서 올릴지 여부
+    /// - 첫 burst 의 minor page fault 를 시작 시점으로 옮깁니다. (메모리는 설정한 용량만큼 바로 상주)
+    bool prefaultMemory = false;
+
+    /// 워커 생성 전에 mlockall(MCL_CURRENT | MCL_FUTURE | MCL_ONFAULT) 로 프로세스 메모리를 잠글지 여부
+    /// - CAP_IPC_LOCK 또는 충분한 RLIMIT_MEMLOCK 이 없으면 WARN 후 잠그지 않고 계속합니다.
+    bool lockMemory = false;
+
     /// SO_REUSEPORT 사용 여부(정책 옵션)
     bool reusePort = true;
 
+    /// 새 연결을 워커에 나누는 방식 ("kernel" | "cpu" | "weighted" | "least_loaded")
+    /// - kernel: 커널 reuseport 해시 (기본값)
+    /// - cpu: SYN 을 받은 CPU(SO_INCOMING_CPU)에 고정된 워커로. workerCpuAffinity 와 NIC IRQ 배치를 맞춰 쓰세요.
+    /// - weighted: 워커별 세션 수로 steeringUpdateMs 마다 가중치를 다시 매겨 덜 찬 워커로 더 보냅니다.
+    /// - least_loaded: 워커 0 만 accept 하고 세션이 가장 적은 워커에 fd 를 넘깁니다. (reusePort 불필요)
+    net::SteeringMode connectionSteering = net::SteeringMode::Kernel;
+
+    /// weighted steering 가중치 갱신 주기(ms). 0이면 엔진 기본값(defaults::kSteeringUpdateMs)
+    std::uint32_t steeringUpdateMs = 0;
+
+    /// 워커 간 세션 rebalance 주기(ms). 0이면 끔 (기본값)
+    /// - 주기마다 워커별 사용률(poll idle 시간 기준)을 보고, 가장 바쁜 워커와 가장 한가한 워커의 차가
+    ///   sessionRebalanceThresholdPct 이상이면 바쁜 워커의 세션 하나를 한가한 워커로 옮깁니다.
+    /// - 앱이 IApplication::onSessionMigrateOut 으로 동의한 세션만 옮겨집니다. (epoll 백엔드 전용)
+    std::uint32_t sessionRebalanceMs = 0;
+
+    /// rebalance 를 시작하는 사용률 차(%). 0이면 엔진 기본값(defaults::kRebalanceThresholdPct)
+    std::uint32_t sessionRebalanceThresholdPct = 0;
+
     /// 로그를 기록할 파일 경로입니다.
     /// - 빈 문자열("")이면 std::clog 또는 프로세스 전역 Logger의 기본 출력만 사용합니다.
     /// - 로깅 설정 반영은 Engine 시작 시점에 수행됩니다.
@@ -38,6 +98,10 @@ struct EngineConfig
     /// 기본 로그 레벨입니다.
     core::LogLevel logLevel = core::LogLevel::Info;
 
+    /// 로그를 남기는 스레드마다 두는 레코드 링 크기(bytes)입니다. 0이면 기본값, 2의 거듭제곱으로 올림
+    /// - 로거 스레드가 따라가지 못해 링이 차면 그 스레드의 로그는 기다리지 않고 버려집니다. (RecordsDropped)
+    std::size_t logThreadRingBytes = 0;
+
     /// 메트릭 HTTP 서버가 바인딩될 주소입니다.
     /// - 보안상 기본은 localhost("127.0.0.1") 입니다.
     /// - 외부 노출이 필요하면 "0.0.0.0" 등으로 변경하세요.
@@ -70,12 +134,36 @@ struct EngineConfig
     /// 워커 타이머 tick 해상도(ms)
     std::uint32_t tickResolutionMs = 0;
 
+    /// 워커 타이머 tick 해상도(us). 0 이 아니면 tickResolutionMs 대신 사용 (sub-ms 타이머)
+    std::uint32_t tickResolutionUs = 0;
+
     /// 타이머 슬롯 수(휠 크기)
     std::size_t timerSlots = 0;
 
-    /// epoll_wait 1회당 최대 이벤트 수
+    /// epoll_wait 1회당 최대 이벤트 수 (io_uring 백엔드에서는 wait 1회당 최대 CQE 변환 수)
     std::uint32_t maxEpollEvents = 0;
 
+    /// 워커 I/O 백엔드 ("epoll" | "io_uring")
+    /// - io_uring 초기화에 실패하면 워커별로 epoll 로 폴백합니다(WARN 로그).
+    net::IoBackend ioBackend = net::IoBackend::Epoll;
+
+    /// io_uring provided buffer 1개 크기(bytes)
+    std::size_t uringRecvBufferSize = 0;
+
+    /// io_uring provided buffer 개수(워커당, 2의 거듭제곱)
+    std::size_t uringRecvBufferCount = 0;
+
+    /// 워커 polling 정책 ("block" | "busy" | "spin" | "adaptive")
+    /// - block 외 모드는 유휴 시에도 CPU 를 소모하므로 전용 코어에서만 권장합니다.
+    net::PollMode pollMode = net::PollMode::Block;
+
+    /// spin/adaptive 모드에서 블로킹 전 최대 spin 시간(us)
+    std::uint32_t pollSpinUs = 0;
+
+    /// 세션 소켓 SO_BUSY_POLL 값(us). 0이면 설정하지 않습니다.
+    /// - net.core.busy_read 보다 큰 값은 CAP_NET_ADMIN 이 필요합니다(실패 시 WARN 후 계속).
+    std::uint32_t sessionBusyPollUs = 0;
+
     /// BufferPool 블록 크기(bytes)
     std::size_t bufferBlockSize = 0;
 
@@ -88,8 +176,70 @@ struct EngineConfig
     /// 세션 송신 링버퍼 용량(bytes)
     std::size_t sendRingCapacity = 0;
 
+    /// 세션 링버퍼를 memfd 이중 매핑(mirrored)으로 만들지 여부
+    /// - true 이면 링 끝을 넘는 프레임도 연속 메모리로 보여 framer 가 scratch 복사를 하지 않습니다.
+    /// - 용량은 페이지 크기 이상의 2의 거듭제곱으로 올림됩니다. (예: 200000 → 262144)
+    /// - 링당 VMA 2개를 쓰며, 매핑에 실패한 세션은 일반 링으로 폴백합니다.
+    bool mirroredRings = true;
+
+    /// 세션 링 idle 회수 시간(ms). 0이면 회수하지 않음
+    /// - 링은 처음 데이터가 오갈 때 만들고, 이 시간 동안 비어 있던 링은 워커 풀로 돌려보냅니다.
+    /// - 완성 프레임만 담긴 수신(heartbeat 등)은 워커 공용 staging 링에서 처리되어 세션 링을 만들지 않습니다.
+    /// - 세션 메모리가 연결 수가 아니라 활성 세션 수에 비례하게 됩니다.
+    std::uint32_t ringIdleReclaimMs = core::defaults::kRingIdleReclaimMs;
+
+    /// 워커 시작 시 세션 풀에 미리 만들어 둘 세션 수 (세션 슬롯 + 송수신 링, 페이지 prefault 포함)
+    /// - 장 시작 같은 connect 폭주 때 accept 경로가 할당/페이지 폴트 없이 풀에서 꺼내 씁니다.
+    /// - 워커당 메모리 = prewarm * (recvRingCapacity + sendRingCapacity) 정도입니다.
+    std::size_t sessionPoolPrewarm = core::defaults::kSessionPoolPrewarm;
+
+    /// 워커 세션 풀 보관 상한 (세션 슬롯/링 종류별). 0이면 기본값
+    /// - 닫힌 세션의 슬롯과 링은 이 수까지 지우지 않고 보관했다가 다음 accept 에 재사용합니다.
+    std::size_t sessionPoolMaxIdle = 0;
+
+    /// deferred flush(쓰기 배칭) 사용 여부
+    /// - true 이면 send 는 링 적재만 하고, 워커 loop 1회가 끝날 때 세션당 writev 1회로 송신합니다.
+    /// - 한 iteration 안에서 같은 세션에 여러 패킷을 보내는 fan-out 에서 syscall 수가 줄어듭니다.
+    bool deferredFlush = false;
+
+    /// deferred flush 를 TCP_CORK 로 감쌀지 여부 (deferredFlush == true 일 때만 의미)
+    bool deferredFlushCork = false;
+
+    /// MSG_ZEROCOPY 송신 임계값(bytes). 0이면 사용하지 않습니다.
+    /// - body 가 이 크기 이상인 패킷은 송신 링에 복사하지 않고 워커 전용 블록 풀에서
+    ///   MSG_ZEROCOPY 로 송신하며, 커널 완료 통지(error queue) 이후에 블록을 반납합니다.
+    /// - 복사 비용이 페이지 pin/통지 비용보다 커지는 구간(대략 10KB 이상)에서만 이득입니다.
+    /// - epoll 백엔드 전용입니다. (io_uring 백엔드는 기존 복사 경로 사용)
+    std::size_t zeroCopyThreshold = 0;
+
+    /// MSG_ZEROCOPY 블록 풀 크기(워커당 블록 개수). 블록 1개 = 6 + maxPayloadLen bytes
+    /// - 풀이 고갈되면 해당 패킷은 복사 경로로 송신합니다.
+    std::size_t zeroCopyBufferCount = 0;
+
+    /// 세션당 송신 대기 상한(bytes, 송신 링 + overflow 큐). 0이면 overflow 큐를 쓰지 않습니다.
+    /// - 0 이면 기존처럼 송신 링이 가득 찰 때 세션을 닫습니다. (send_overflow)
+    /// - 0 이 아니면 링에 못 들어간 바이트를 워커 블록 풀의 overflow 큐에 잇고, 이 상한을 넘을 때만 닫습니다.
+    std::size_t sendQueueLimitBytes = 0;
+
+    /// 송신 대기량이 이 값 이상이 되면 IApplication::onSendBackpressure(session, true) 를 호출합니다.
+    /// - 0이면 sendQueueLimitBytes 의 3/4
+    std::size_t sendQueueHighWatermark = 0;
+
+    /// 혼잡 상태에서 송신 대기량이 이 값 이하로 내려오면 onSendBackpressure(session, false) 를 호출합니다.
+    /// - 0이면 sendQueueLimitBytes 의 1/4 (high watermark 를 그보다 작게 잡았으면 high 의 1/2)
+    std::size_t sendQueueLowWatermark = 0;
+
     /// 프레이밍 payload 최대 길이(bytes)
     std::uint32_t maxPayloadLen = 0;
+
+    /// 워커 쌍(src→dst)마다 전용 SPSC 채널을 두는 handoff mesh 사용 여부
+    /// - true 이면 워커 스레드에서의 cross-worker post/send 가 공유 TaskQueue 대신
+    ///   고정 크기 descriptor 를 전용 채널로 넘깁니다. false 이면 기존 TaskQueue 경로만 씁니다.
+    bool workerHandoff = true;
+
+    /// handoff 채널당 슬롯 수(descriptor 128 bytes). 0이면 기본값, 2의 거듭제곱으로 올림
+    /// - 채널이 꽉 차면 보내는 워커 쪽 backlog 에 순서대로 쌓입니다. (유실 없음)
+    std::size_t handoffRingSlots = 0;
 };
 
 /// EngineConfig 필드 값에 대한 기본 검증을 수행합니다.
@@ -27,6 +27,38 @@ class IApplication
     virtual void onSessionStart(SessionHandle session) = 0;
     virtual void onSessionEnd(SessionHandle session) = 0;
 
+    /// 세션 송신 대기량이 high watermark 를 넘으면 congested=true, low watermark 아래로 내려오면 false 로
+    /// 한 번씩 호출됩니다. (세션 owner 워커 스레드, send_queue_limit_bytes 설정 시에만)
+    /// - 앱은 이 구간에서 송신을 줄이거나(throttle) 최신 값만 남기거나(conflate) 버릴 수 있습니다.
+    /// - 상한(send_queue_limit_bytes)을 넘는 송신은 세션을 닫습니다.
+    virtual void onSendBackpressure(SessionHandle session, bool congested) { (void)session; (void)congested; }
+
+    /// 세션을 targetWorker 로 옮기기 직전에 호출됩니다. (현재 owner 워커 스레드)
+    /// - 동의하면 이 워커에 둔 세션 상태를 떼어 context 에 담고 true 를 반환합니다.
+    ///   false 면 세션은 옮겨지지 않습니다. (기본값: 옮기지 않음)
+    /// - 이후 같은 id 의 송신/close 는 엔진이 새 owner 로 넘겨 주지만, 앱이 저장한 핸들은
+    ///   onSessionMigrateIn 에서 받은 것으로 바꿔야 새 owner 에서 직접 송신됩니다.
+    virtual bool onSessionMigrateOut(SessionHandle session, int targetWorker, std::shared_ptr<void> &context)
+    {
+        (void)session;
+        (void)targetWorker;
+        (void)context;
+        return false;
+    }
+
+    /// 옮겨 온 세션이 이 워커에 등록된 직후 호출됩니다. (새 owner 워커 스레드, 같은 id 의 새 핸들)
+    /// - context 는 onSessionMigrateOut 이 담은 값입니다.
+    /// - 순서 주의: 예전 경로(id 또는 옛 핸들)로 보낸 송신은 옛 owner 의 task 큐를 한 번 더 거쳐 옵니다.
+    ///   같은 생산자가 도중에 새 핸들로 바꾸면 새 핸들로 보낸 송신이 아직 넘어오는 중인 송신을 앞지를 수
+    ///   있습니다. 엔진은 두 경로 사이의 순서를 맞추지 않으므로, 순서가 필요한 생산자는 한 경로를 유지하거나
+    ///   이전 송신이 모두 나간 것을 확인한 시점(예: 세션의 응답을 받은 뒤)에 바꿔야 합니다.
+    /// - 핸들을 바꾸지 않은 id 송신은 세션이 끝날 때까지 매번 옛 owner 를 거칩니다. (스레드 hop 1회 + 복사)
+    virtual void onSessionMigrateIn(SessionHandle session, std::shared_ptr<void> context)
+    {
+        (void)session;
+        (void)context;
+    }
+
     // Engine -> App 주입 포인트 (Option A)
     virtual void setSessionRouter(std::shared_ptr<ISessionRouter> router) noexcept { (void)router; }
     virtual void setWorkerScheduler(std::shared_ptr<IWorkerScheduler> s) noexcept { (void)s; }
@@ -1,46 +1,34 @@
 #pragma once
 
 #include <cstdint>
-#include <cstring>
-#include <memory>
 #include <vector>
 
 #include <hypernet/SessionHandle.hpp>
+#include <hypernet/buffer/PacketBuffer.hpp>
 #include <hypernet/protocol/MessageView.hpp>
 
 namespace hypernet
 {
 
 /// 다른 스레드로 payload를 넘길 수 있도록 수명을 보장하는 패킷(opcode=U16).
+/// - body 는 워커별 슬랩에서 온 refcount 버퍼입니다. 복사/fan-out 은 refcount 증가뿐입니다.
 struct RoutedPacketU16
 {
     std::uint16_t opcode{0};
-    std::shared_ptr<std::vector<std::uint8_t>> body; // nullptr/empty 가능
+    buffer::PacketBuffer body; // 비어 있을 수 있음
 
     [[nodiscard]] protocol::MessageView view() const noexcept
     {
-        if (!body || body->empty())
+        if (body.empty())
             return protocol::MessageView{nullptr, 0};
-        return protocol::MessageView{body->data(), body->size()};
+        return protocol::MessageView{body.data(), body.size()};
     }
 
     static RoutedPacketU16 copy(std::uint16_t opcode, const protocol::MessageView &src)
     {
         RoutedPacketU16 p;
         p.opcode = opcode;
-
-        if (src.size() == 0)
-        {
-            p.body.reset();
-            return p;
-        }
-
-        auto v = std::make_shared<std::vector<std::uint8_t>>();
-        v->resize(src.size());
-        if (src.data() != nullptr)
-            std::memcpy(v->data(), src.data(), src.size());
-
-        p.body = std::move(v);
+        p.body = buffer::PacketBuffer::copyOf(src.data(), src.size());
         return p;
     }
 };
@@ -16,6 +16,13 @@ class ISessionSender
 
     virtual bool sendPacketU16(SessionId id, std::uint16_t opcode, const void *body,
                                std::size_t bodyLen) noexcept = 0;
+
+    /// 세션의 송신 대기 바이트(송신 링 + overflow 큐)입니다. 세션이 없으면 0
+    [[nodiscard]] virtual std::size_t queuedSendBytes(SessionId id) const noexcept
+    {
+        (void)id;
+        return 0;
+    }
 };
 
 } // namespace hypernet
@@ -1,7 +1,13 @@
 #pragma once
 
-#include <functional>
+#include <cstdint>
 #include <memory>
+#include <span>
+
+#include <hypernet/SessionHandle.hpp>
+#include <hypernet/core/Task.hpp>
+#include <hypernet/protocol/FieldPatch.hpp>
+#include <hypernet/protocol/MessageView.hpp>
 
 namespace hypernet
 {
@@ -9,7 +15,48 @@ class IWorkerScheduler
 {
   public:
     virtual ~IWorkerScheduler() = default;
-    virtual bool postToWorker(int workerId, std::function<void()> task) noexcept = 0;
+    /// task 는 move-only 입니다. (capture 가 core::kTaskInlineBytes 안이면 할당 없음)
+    virtual bool postToWorker(int workerId, core::Task task) noexcept = 0;
     virtual int workerCount() const noexcept = 0;
+
+    /// [fast path] sid 의 owner 워커로 패킷을 고정 크기 descriptor 로 넘깁니다.
+    /// - 워커 스레드에서, 워커 쌍 전용 SPSC 채널로 body 를 inline 복사합니다. (std::function/힙 할당 없음)
+    /// - owner 워커에서 sid 세션을 찾아 송신합니다. (세션이 없으면 조용히 버림)
+    /// @return false 면 처리하지 않은 것입니다. (비워커 스레드, 같은 워커, body 가 inline 용량 초과,
+    ///         mesh 비활성) 호출자는 postToWorker 경로로 폴백해야 합니다.
+    virtual bool handoffPacket(SessionHandle::Id sid, std::uint16_t opcode,
+                               const protocol::MessageView &body) noexcept
+    {
+        (void)sid;
+        (void)opcode;
+        (void)body;
+        return false;
+    }
+
+    /// [relay] handoffPacket 과 같은 경로로 넘기되, descriptor 에 복사한 body 에 patches 를 덮어씁니다.
+    /// - patches 는 호출자가 validFieldPatches 로 확인한 목록이어야 합니다.
+    /// @return false 면 처리하지 않은 것입니다. (handoffPacket 과 같은 조건)
+    virtual bool handoffRelay(SessionHandle::Id sid, std::uint16_t opcode, const protocol::MessageView &body,
+                              std::span<const protocol::FieldPatch> patches) noexcept
+    {
+        (void)sid;
+        (void)opcode;
+        (void)body;
+        (void)patches;
+        return false;
+    }
+
+    /// sid 세션을 targetWorker 로 옮기도록 요청합니다. (아무 스레드, 비동기)
+    /// - 원래 owner 가 fd 와 송수신 링, 앱 상태를 넘기고 targetWorker 가 같은 id 로 이어받습니다.
+    ///   이전 owner 로 온 송신/close 는 forward 엔트리를 따라 새 owner 로 넘어갑니다.
+    /// - 세션 상태(송신 대기, io_uring 백엔드)나 앱(IApplication::onSessionMigrateOut)이 거절하면
+    ///   옮겨지지 않습니다.
+    /// @return 요청을 넘겼는지 여부 (이관 경로가 없거나 대상이 범위 밖이면 false)
+    virtual bool migrateSession(SessionHandle::Id sid, int targetWorker) noexcept
+    {
+        (void)sid;
+        (void)targetWorker;
+        return false;
+    }
 };
-} // namespace hypernet
\ No newline at end of file
+} // namespace hypernet
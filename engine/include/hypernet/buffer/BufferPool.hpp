@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 
+#include <hypernet/buffer/PageMemory.hpp>
 #include <hypernet/util/NonCopyable.hpp>
 
 namespace hypernet::buffer {
@@ -57,8 +58,11 @@ class BufferPool : private hypernet::util::NonCopyable {
     std::size_t blockCount_{0};
 
     // 실제 메모리 블록을 보관하는 연속 버퍼입니다.
-    // - 각 블록은 storage_.get() + i * blockSize_ 위치에 존재합니다.
+    // - 각 블록은 base_ + i * blockSize_ 위치에 존재합니다.
+    // - 생성 스레드에 페이지 정책(threadPagePolicy)이 있으면 pages_, 없으면 storage_ 가 소유합니다.
     std::unique_ptr<std::byte[]> storage_;
+    PageMemory pages_;
+    std::byte *base_{nullptr};
 
     // free list: 현재 사용 가능 블록들의 포인터를 스택처럼 관리합니다.
     std::vector<void *> freeList_;
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <hypernet/buffer/BufferPool.hpp>
+#include <hypernet/util/NonCopyable.hpp>
+
+namespace hypernet::buffer {
+
+class PacketBufferPool;
+
+namespace detail {
+
+/// 패킷 payload 블록 헤더입니다. 데이터는 헤더 바로 뒤에 이어집니다.
+struct PacketBlock {
+    std::atomic<std::uint32_t> refs{1};
+    std::uint32_t size{0};
+    std::uint32_t capacity{0};
+    std::uint8_t sizeClass{0};
+    PacketBufferPool *pool{nullptr}; ///< nullptr 이면 전역 힙에서 할당된 블록
+    PacketBlock *next{nullptr};      ///< free list / remote 반환 스택 링크
+
+    [[nodiscard]] unsigned char *data() noexcept { return reinterpret_cast<unsigned char *>(this + 1); }
+};
+static_assert(sizeof(PacketBlock) % 16 == 0, "PacketBlock header must keep payload 16-byte aligned");
+
+} // namespace detail
+
+/// 여러 스레드가 공유하는 불변 패킷 payload 핸들입니다. (intrusive refcount)
+///
+/// - copyOf() 는 현재 스레드에 붙은 PacketBufferPool 의 size class 슬랩에서 블록을 꺼냅니다.
+///   풀이 없거나(비워커 스레드) 가장 큰 class 보다 크거나 슬랩 상한에 닿으면 힙으로 폴백합니다.
+/// - 복사는 refcount 증가뿐이고, 마지막 참조가 놓이면 블록은 주인 풀로 돌아갑니다.
+///   (주인 워커면 로컬 free list, 다른 스레드면 lock-free 반환 스택)
+/// - shared_ptr<vector<uint8_t>> 와 달리 control block/vector 저장소 두 번의 할당이 없습니다.
+class PacketBuffer {
+  public:
+    PacketBuffer() noexcept = default;
+
+    PacketBuffer(const PacketBuffer &other) noexcept : block_(other.block_) {
+        if (block_) {
+            block_->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    PacketBuffer(PacketBuffer &&other) noexcept : block_(std::exchange(other.block_, nullptr)) {}
+
+    PacketBuffer &operator=(const PacketBuffer &other) noexcept {
+        PacketBuffer(other).swap(*this);
+        return *this;
+    }
+
+    PacketBuffer &operator=(PacketBuffer &&other) noexcept {
+        PacketBuffer(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    ~PacketBuffer() { reset(); }
+
+    /// data[0..len) 를 복사한 버퍼를 만듭니다. len == 0 이면 빈 핸들
+    /// - data == nullptr 이면 복사를 생략합니다. (내용은 정의되지 않음)
+    [[nodiscard]] static PacketBuffer copyOf(const void *data, std::size_t len);
+
+    void reset() noexcept {
+        if (detail::PacketBlock *b = std::exchange(block_, nullptr)) {
+            // 단독 소유면 RMW 없이 바로 반환한다.
+            if (b->refs.load(std::memory_order_acquire) == 1 ||
+                b->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                release_(b);
+            }
+        }
+    }
+
+    void swap(PacketBuffer &other) noexcept { std::swap(block_, other.block_); }
+
+    [[nodiscard]] const unsigned char *data() const noexcept { return block_ ? block_->data() : nullptr; }
+    [[nodiscard]] std::size_t size() const noexcept { return block_ ? block_->size : 0; }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+    explicit operator bool() const noexcept { return block_ != nullptr; }
+
+    /// 단독 소유일 때만 쓰기 가능한 포인터를 줍니다. (공유 전에 내용을 고치는 용도, 아니면 nullptr)
+    [[nodiscard]] unsigned char *exclusiveData() noexcept {
+        return (block_ && block_->refs.load(std::memory_order_acquire) == 1) ? block_->data() : nullptr;
+    }
+
+    /// 디버깅/테스트용 참조 수
+    [[nodiscard]] std::uint32_t useCount() const noexcept {
+        return block_ ? block_->refs.load(std::memory_order_relaxed) : 0;
+    }
+
+    /// 풀 슬랩에서 온 블록인지 (false 면 힙 폴백)
+    [[nodiscard]] bool isPooled() const noexcept { return block_ && block_->pool != nullptr; }
+
+  private:
+    explicit PacketBuffer(detail::PacketBlock *block) noexcept : block_(block) {}
+
+    /// 마지막 참조가 놓인 블록을 주인 풀(또는 힙)로 돌려보냅니다. (아무 스레드)
+    static void release_(detail::PacketBlock *block) noexcept;
+
+    detail::PacketBlock *block_{nullptr};
+};
+
+/// 워커 스레드 전용 PacketBuffer 슬랩입니다.
+///
+/// - size class 별로 BufferPool 청크(kChunkBytes)를 필요할 때 하나씩 붙여 블록을 잘라 씁니다.
+///   class 당 kMaxBytesPerClass 를 넘으면 더 늘리지 않고 힙으로 폴백합니다.
+/// - 할당/로컬 반환은 주인 스레드에서만 일어나므로 동기화가 없습니다.
+/// - 다른 스레드에서 반환된 블록은 lock-free 스택(push 만 CAS)에 쌓이고, 주인이 free list 가
+///   빌 때 한 번에 exchange 로 가져갑니다. (consumer 가 하나라 ABA 없음)
+/// - 풀은 프로세스 수명 동안 유지되고, 워커가 끝나면 반납되어 다음 워커가 재사용합니다.
+///   (워커보다 오래 사는 payload 가 돌아올 곳이 항상 남아 있도록)
+class PacketBufferPool : private hypernet::util::NonCopyable {
+  public:
+    static constexpr std::size_t kClassCount = 4;
+    /// 헤더 포함 블록 크기 (payload 용량 = 블록 크기 - sizeof(PacketBlock))
+    static constexpr std::array<std::size_t, kClassCount> kBlockBytes{256, 1024, 4096, 16384};
+    static constexpr std::size_t kChunkBytes = 64 * 1024;
+    static constexpr std::size_t kMaxBytesPerClass = 4 * 1024 * 1024;
+
+    struct Stats {
+        std::uint64_t pooledAllocs{0};
+        std::uint64_t heapFallbacks{0};
+        std::uint64_t remoteReturns{0};
+        std::size_t chunks{0};
+    };
+
+    /// 현재 스레드에 풀을 붙입니다. (워커 스레드 시작 시, 이미 붙어 있으면 그대로)
+    static void bindCurrentThread();
+
+    /// 현재 스레드의 풀을 반납합니다. (워커 스레드 종료 직전) 나가 있는 블록은 나중에 돌아옵니다.
+    static void unbindCurrentThread() noexcept;
+
+    /// 현재 스레드에 붙은 풀 (없으면 nullptr)
+    [[nodiscard]] static PacketBufferPool *current() noexcept { return current_(); }
+
+    /// 통계 (주인 스레드에서 읽기)
+    [[nodiscard]] const Stats &stats() const noexcept { return stats_; }
+
+  private:
+    friend class PacketBuffer;
+
+    struct SizeClass {
+        std::size_t blockBytes{0};
+        std::vector<std::unique_ptr<BufferPool>> chunks;
+        detail::PacketBlock *freeList{nullptr};
+    };
+
+    PacketBufferPool();
+
+    /// len 바이트를 담을 블록을 꺼냅니다. (주인 스레드) 슬랩으로 안 되면 nullptr
+    [[nodiscard]] detail::PacketBlock *allocate_(std::size_t len) noexcept;
+
+    /// refcount 가 0 이 된 블록을 돌려받습니다. (아무 스레드)
+    void recycle_(detail::PacketBlock *block) noexcept;
+
+    /// remote 반환 스택을 통째로 가져와 class 별 free list 에 돌려놓습니다. (주인 스레드)
+    void reclaimRemote_() noexcept;
+
+    [[nodiscard]] detail::PacketBlock *carve_(SizeClass &cls) noexcept;
+
+    static PacketBufferPool *&current_() noexcept {
+        thread_local PacketBufferPool *p = nullptr;
+        return p;
+    }
+
+    std::array<SizeClass, kClassCount> classes_{};
+    Stats stats_{};
+
+    alignas(64) std::atomic<detail::PacketBlock *> remoteFree_{nullptr};
+};
+
+} // namespace hypernet::buffer
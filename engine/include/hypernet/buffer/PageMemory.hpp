@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef> // std::size_t, std::byte
+#include <cstdint>
+
+#include <hypernet/util/NonCopyable.hpp>
+
+namespace hypernet::buffer
+{
+
+/// 링/풀 저장소를 어떤 페이지로 받을지 정합니다.
+///
+/// - Off        : 일반 4 KiB 페이지 (기본값, 기존 동작)
+/// - Transparent: THP 힌트(madvise MADV_HUGEPAGE). 2 MiB 이상인 영역은 2 MiB 경계에 맞춰 잡습니다.
+/// - Explicit   : hugetlbfs 페이지(MAP_HUGETLB / MFD_HUGETLB, 2 MiB 단위로 올림).
+///                2 MiB 미만 영역은 일반 페이지로 잡습니다. (64 KiB 세션 링이 2 MiB 씩 먹지 않도록)
+///                예약된 huge page 가 없으면 Transparent 로 폴백합니다. (프로세스당 1회 WARN)
+enum class HugePageMode : std::uint8_t
+{
+    Off = 0,
+    Transparent,
+    Explicit,
+};
+
+[[nodiscard]] constexpr const char *toString(HugePageMode m) noexcept
+{
+    switch (m)
+    {
+    case HugePageMode::Off:
+        return "off";
+    case HugePageMode::Transparent:
+        return "thp";
+    case HugePageMode::Explicit:
+        return "hugetlb";
+    }
+    return "unknown";
+}
+
+/// 워커가 만드는 RingBuffer / BufferPool 저장소의 할당 정책입니다.
+struct PageAllocPolicy
+{
+    HugePageMode hugePages{HugePageMode::Off};
+    bool prefault{false}; ///< 할당 직후 모든 페이지를 써서 올림 (첫 burst 의 page fault 제거, first-touch NUMA)
+
+    [[nodiscard]] bool enabled() const noexcept { return hugePages != HugePageMode::Off || prefault; }
+};
+
+/// 호출 스레드가 이후 만드는 RingBuffer / BufferPool 에 적용할 정책을 정합니다. (워커 스레드 시작 시 1회)
+/// - 정책을 정하지 않은 스레드(테스트/main)는 기존처럼 일반 힙/페이지를 씁니다.
+void setThreadPagePolicy(const PageAllocPolicy &policy) noexcept;
+[[nodiscard]] const PageAllocPolicy &threadPagePolicy() noexcept;
+
+/// huge page 크기 (x86_64 기본 2 MiB)
+inline constexpr std::size_t kHugePageSize = std::size_t{2} << 20;
+
+/// [p, p + len) 의 페이지를 호출 스레드에서 써서 올립니다. (MADV_POPULATE_WRITE, 없으면 페이지마다 1 byte 씀)
+void prefaultPages(void *p, std::size_t len) noexcept;
+
+/// 프로세스 메모리를 잠급니다. (mlockall MCL_CURRENT | MCL_FUTURE | MCL_ONFAULT)
+/// - MCL_ONFAULT 라 예약만 된 주소 공간(스레드 스택, mirrored 링 예약 등)은 건드린 페이지만 잠깁니다.
+///   → prefault 와 함께 쓰면 워커 링/풀은 시작 시 올라와서 swap 되지 않습니다.
+/// @return 0 이면 성공, 아니면 errno (보통 EPERM/ENOMEM: CAP_IPC_LOCK 또는 RLIMIT_MEMLOCK)
+[[nodiscard]] int lockProcessMemory() noexcept;
+
+/// 익명 mmap 으로 잡은 연속 메모리입니다. (PageAllocPolicy 적용)
+class PageMemory : private hypernet::util::NonCopyable
+{
+  public:
+    PageMemory() noexcept = default;
+    PageMemory(PageMemory &&other) noexcept;
+    PageMemory &operator=(PageMemory &&other) noexcept;
+    ~PageMemory();
+
+    /// bytes 이상을 정책대로 매핑합니다. 실패하면 빈 객체 (errno 보존)
+    [[nodiscard]] static PageMemory allocate(std::size_t bytes, const PageAllocPolicy &policy) noexcept;
+
+    [[nodiscard]] std::byte *data() const noexcept { return base_; }
+    [[nodiscard]] std::size_t size() const noexcept { return length_; }
+    [[nodiscard]] bool hugeTlb() const noexcept { return hugeTlb_; }
+    [[nodiscard]] explicit operator bool() const noexcept { return base_ != nullptr; }
+
+  private:
+    void release_() noexcept;
+
+    std::byte *base_{nullptr};
+    std::size_t length_{0}; ///< 매핑 길이 (munmap 단위)
+    bool hugeTlb_{false};
+};
+
+} // namespace hypernet::buffer
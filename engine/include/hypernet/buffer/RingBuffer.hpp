@@ -1,10 +1,13 @@
 #pragma once
 
 #include <cstddef> // std::size_t, std::byte
+#include <cstdint>
+#include <memory>
 #include <span>
-#include <vector>
 #include <sys/uio.h> // struct iovec
 #include <hypernet/buffer/BufferView.hpp>
+#include <hypernet/buffer/PageMemory.hpp>
+#include <hypernet/util/NonCopyable.hpp>
 
 namespace hypernet::buffer
 {
@@ -16,13 +19,34 @@ namespace hypernet::buffer
 ///   -> 전체 쓰기 보장이 필요하면 호출 전에 freeSpace()를 먼저 확인해야 합니다.
 /// - read()는 현재 들어있는 데이터까지만 읽어 옵니다.
 /// - 단일 스레드용이므로 내부에 락은 없습니다. 다른 스레드에서 동시에 접근하지 않아야 합니다.
-class RingBuffer
+/// - Layout::Mirrored 는 같은 memfd 를 가상 주소에 두 번 연달아 매핑합니다.
+///   → head 에서 시작하는 capacity 이하의 어떤 구간도 연속 메모리이므로 peekView/readView 는
+///     항상 요청 길이 전체를, peekIov/writeIov 는 항상 iovec 1개를 돌려줍니다.
+///   → 용량은 페이지 크기 이상의 2의 거듭제곱으로 올림되고, index 는 mask 로 감습니다.
+///   → 매핑에 실패하면(memfd/mmap 불가, VMA 한도 등) Flat 으로 폴백합니다. layout() 으로 확인
+/// - 저장소는 생성 스레드의 threadPagePolicy() 를 따릅니다. (huge page / prefault, 정책이 없으면 일반 힙)
+class RingBuffer : private hypernet::util::NonCopyable
 {
   public:
+    enum class Layout : std::uint8_t
+    {
+        Flat = 0, ///< 일반 배열 (끝에서 랩어라운드하면 구간이 둘로 나뉨)
+        Mirrored, ///< memfd 이중 매핑 (모든 구간이 연속)
+    };
+
     /// 주어진 용량(capacity) 만큼의 바이트를 저장할 수 있는 링 버퍼를 생성합니다.
     ///
     /// @param capacity 바이트 단위 용량 (0이면 std::invalid_argument 예외가 발생합니다)
-    explicit RingBuffer(std::size_t capacity);
+    /// @param layout Mirrored 이면 capacity 를 mirroredCapacityFor(capacity) 로 올림합니다.
+    explicit RingBuffer(std::size_t capacity, Layout layout = Layout::Flat);
+
+    ~RingBuffer();
+
+    /// Mirrored 레이아웃에서 실제로 잡히는 용량 (페이지 크기 이상 2의 거듭제곱)
+    [[nodiscard]] static std::size_t mirroredCapacityFor(std::size_t capacity) noexcept;
+
+    /// 실제로 적용된 레이아웃 (Mirrored 요청이 실패하면 Flat)
+    [[nodiscard]] Layout layout() const noexcept { return mask_ != 0 ? Layout::Mirrored : Layout::Flat; }
 
     /// 버퍼의 총 용량(바이트)을 반환합니다.
     [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
@@ -101,13 +125,13 @@ class RingBuffer
 
     /// ====== (NEW) read-side: head 기준으로 최대 maxLen을 1~2 iovec로 노출 (consume 없음)
     /// - writev/sendmsg에 바로 넘기기 위한 용도
-    /// - 반환값: iov 개수(0/1/2)
+    /// - 반환값: iov 개수(0/1/2, Mirrored 면 0/1)
     [[nodiscard]] int peekIov(::iovec out[2], std::size_t maxLen) const noexcept;
 
     /// ====== (NEW) write-side: tail 기준 freeSpace 내에서 최대 maxLen을 1~2 iovec로 노출
     /// - recvmsg/readv로 "버퍼에 직접 수신"하기 위한 용도
     /// - 주의: 이 함수 호출 후 반드시 commitWrite(n)으로 tail/size를 반영해야 한다.
-    /// - 반환값: iov 개수(0/1/2)
+    /// - 반환값: iov 개수(0/1/2, Mirrored 면 0/1)
     [[nodiscard]] int writeIov(::iovec out[2], std::size_t maxLen) const noexcept;
 
     /// ====== (NEW) writeIov로 받은 버퍼에 n바이트를 실제로 썼음을 반영
@@ -117,8 +141,27 @@ class RingBuffer
     void clear() noexcept;
 
   private:
-    std::vector<std::byte> buffer_; ///< 실제 데이터를 저장하는 순환 배열
-    std::size_t capacity_;          ///< 버퍼 용량 (buffer_.size()와 동일)
+    /// idx + n (n <= capacity) 을 [0, capacity) 로 감습니다. (나눗셈 없음)
+    [[nodiscard]] std::size_t wrap_(std::size_t idx) const noexcept
+    {
+        if (mask_ != 0)
+        {
+            return idx & mask_;
+        }
+        return idx >= capacity_ ? idx - capacity_ : idx;
+    }
+
+    /// idx 에서 시작해 주소상 연속으로 접근할 수 있는 최대 바이트 수
+    [[nodiscard]] std::size_t contiguousFrom_(std::size_t idx) const noexcept
+    {
+        return mask_ != 0 ? capacity_ : capacity_ - idx;
+    }
+
+    std::unique_ptr<std::byte[]> flat_; ///< Flat 레이아웃 저장소 (Mirrored 또는 pages_ 면 nullptr)
+    PageMemory pages_;                  ///< 페이지 정책이 있는 Flat 레이아웃 저장소
+    std::byte *data_{nullptr};          ///< 순환 배열 시작 (Mirrored 면 2 * capacity_ 매핑의 시작)
+    std::size_t capacity_;              ///< 버퍼 용량
+    std::size_t mask_{0};               ///< Mirrored 면 capacity_ - 1, Flat 이면 0
     std::size_t head_{0};           ///< 다음 read()/peek()가 시작될 위치
     std::size_t tail_{0};           ///< 다음 write()가 기록할 위치
     std::size_t size_{0};           ///< 현재 저장된 데이터 크기 (바이트)
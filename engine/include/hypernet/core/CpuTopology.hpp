@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <pthread.h>
+#include <string_view>
+#include <vector>
+
+namespace hypernet::core
+{
+
+/// 이 프로세스가 쓸 수 있는 논리 CPU 1개의 배치 정보입니다.
+struct CpuInfo
+{
+    int cpu{-1};
+    int core{-1};    ///< /sys .../topology/core_id (같은 물리 코어의 SMT 형제는 같은 값)
+    int package{-1}; ///< /sys .../topology/physical_package_id
+    int node{0};     ///< NUMA 노드 (NUMA 정보가 없으면 0)
+};
+
+/// worker_cpu_affinity = "auto" 해석 결과입니다.
+struct CpuPlacementPlan
+{
+    std::vector<int> workerCpus; ///< 워커 id 순서대로 고정할 CPU
+    int housekeepingCpu{-1};     ///< 워커가 쓰지 않는 코어의 CPU (없으면 -1). logger/metrics 스레드용
+};
+
+/// "0,2,4-7" 형식의 CPU 목록을 적힌 순서대로 펼칩니다. 형식이 틀리면 nullopt
+[[nodiscard]] std::optional<std::vector<int>> parseCpuList(std::string_view text);
+
+/// sched_getaffinity 로 허용된 CPU 들의 코어/소켓/NUMA 노드를 /sys 에서 읽습니다. (cpu 오름차순)
+/// - /sys 를 읽을 수 없으면 core=cpu, package=0, node=0 으로 채웁니다.
+[[nodiscard]] std::vector<CpuInfo> scanCpuTopology();
+
+/// 워커 count 개를 놓을 CPU 를 고릅니다.
+/// - 물리 코어마다 CPU 1개씩 먼저 쓰고(SMT 형제 회피), 모자라면 SMT 형제, 그래도 모자라면 처음부터 반복합니다.
+/// - 코어가 워커보다 많으면 가장 낮은 CPU 의 코어(보통 IRQ/커널 작업이 몰리는 곳)를 housekeeping 으로 남깁니다.
+/// - 같은 NUMA 노드의 코어가 이어서 배정되도록 (node, cpu) 순으로 정렬합니다.
+[[nodiscard]] CpuPlacementPlan planWorkerCpus(const std::vector<CpuInfo> &topology, unsigned int count);
+
+/// cpu 가 속한 NUMA 노드입니다. (모르면 -1)
+[[nodiscard]] int numaNodeOfCpu(int cpu) noexcept;
+
+/// 스레드를 cpu 1개에 고정합니다. 실패 시 errno 값(0이면 성공)
+[[nodiscard]] int pinThreadToCpu(pthread_t thread, int cpu) noexcept;
+[[nodiscard]] int pinCurrentThreadToCpu(int cpu) noexcept;
+
+/// 호출 스레드를 SCHED_FIFO(priority) 로 바꿉니다. 실패 시 errno 값 (보통 EPERM: CAP_SYS_NICE 필요)
+[[nodiscard]] int setCurrentThreadFifo(std::uint32_t priority) noexcept;
+
+/// 호출 스레드의 이후 페이지 할당이 node 를 우선 쓰도록 합니다. (set_mempolicy MPOL_PREFERRED, 실패 시 errno)
+[[nodiscard]] int preferNumaNode(int node) noexcept;
+
+} // namespace hypernet::core
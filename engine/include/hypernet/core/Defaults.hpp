@@ -10,6 +10,14 @@ inline constexpr std::uint32_t kTickResolutionMs = 10;
 inline constexpr std::size_t kTimerSlots = 1024;
 inline constexpr int kMaxEpollEvents = 64;
 
+// ===== io_uring backend =====
+inline constexpr unsigned int kUringEntries = 1024;
+inline constexpr std::size_t kUringRecvBufferSize = 16 * 1024;
+inline constexpr std::size_t kUringRecvBufferCount = 256; // 2의 거듭제곱
+
+// ===== Poll policy =====
+inline constexpr std::uint32_t kPollSpinUs = 50; // spin/adaptive 모드의 spin 예산
+
 // ===== Buffer pool =====
 inline constexpr std::size_t kBufferBlockSize = 4096;
 inline constexpr std::size_t kBufferBlockCount = 1024;
@@ -17,11 +25,35 @@ inline constexpr std::size_t kBufferBlockCount = 1024;
 // ===== Per-session rings =====
 inline constexpr std::size_t kRecvRingCapacity = 64 * 1024;
 inline constexpr std::size_t kSendRingCapacity = 64 * 1024;
+inline constexpr std::uint32_t kRingIdleReclaimMs = 5'000; // 이 시간 동안 빈 세션 링은 워커 풀로 반납
+
+// ===== Per-worker session pool =====
+inline constexpr std::size_t kSessionPoolPrewarm = 64;  // 워커 시작 시 미리 만들어 둘 세션(+링 2개) 수
+inline constexpr std::size_t kSessionPoolMaxIdle = 256; // 워커당 보관 상한 (세션 슬롯/링 종류별)
+
+// ===== Zero-copy send (MSG_ZEROCOPY) =====
+inline constexpr std::size_t kZeroCopyBufferCount = 16;
+inline constexpr std::uint32_t kZeroCopyQuarantineMs = 10'000; // close 후 in-flight 블록 보류 시간
+
+// ===== Send overflow queue =====
+inline constexpr std::size_t kSendQueueBlockBytes = 16 * 1024; // 송신 링 뒤에 잇는 overflow 블록 크기
+inline constexpr std::size_t kSendQueuePoolBlocks = 256;       // 워커당 미리 만들어 둘 블록 수 (넘치면 힙)
 
 // ===== Protocol policy =====
 inline constexpr std::uint32_t kMaxPayloadLen = 1024U * 1024U; // 1 MiB
 
+// ===== Cross-worker handoff mesh =====
+inline constexpr std::size_t kHandoffRingSlots = 512; // 채널당 descriptor(128B) 수 → 64 KiB
+
+// ===== Async logger =====
+inline constexpr std::size_t kLogThreadRingBytes = 1024 * 1024; // 로그 남기는 스레드당 레코드 링
+
 // ===== Listener =====
 inline constexpr int kListenBacklog = 128;
+inline constexpr std::uint32_t kSteeringUpdateMs = 1000; // weighted steering 가중치 갱신 주기
+
+// ===== Session rebalance =====
+inline constexpr std::uint32_t kRebalanceThresholdPct = 25; // 이 이상 사용률이 벌어지면 세션 1개를 옮김
+inline constexpr std::uint32_t kRebalanceResidencyTicks = 4; // 옮겨 온 세션은 주기 x 이 값 동안 다시 옮기지 않음
 
 } // namespace hypernet::core::defaults
@@ -4,6 +4,7 @@
 #include <limits>
 
 #include <hypernet/EngineConfig.hpp>
+#include <hypernet/core/CpuTopology.hpp>
 #include <hypernet/core/Options.hpp>
 
 namespace hypernet::core
@@ -31,10 +32,14 @@ inline EngineOptions makeEffectiveEngineOptions(const hypernet::EngineConfig &cf
         const std::uint32_t v = (cfg.listenBacklog > lim) ? lim : cfg.listenBacklog;
         opt.listenBacklog = static_cast<int>(v);
     }
-    if (cfg.tickResolutionMs != 0)
+    // tick_resolution_us 가 있으면 우선 (sub-ms 타이머), 없으면 기존 tick_resolution_ms
+    if (cfg.tickResolutionUs != 0)
     {
-        opt.workerDefaults.timer.tickResolution =
-            TimerWheel::Duration{static_cast<TimerWheel::Duration::rep>(cfg.tickResolutionMs)};
+        opt.workerDefaults.timer.tickResolution = std::chrono::microseconds{cfg.tickResolutionUs};
+    }
+    else if (cfg.tickResolutionMs != 0)
+    {
+        opt.workerDefaults.timer.tickResolution = std::chrono::milliseconds{cfg.tickResolutionMs};
     }
     if (cfg.timerSlots != 0)
     {
@@ -46,6 +51,21 @@ inline EngineOptions makeEffectiveEngineOptions(const hypernet::EngineConfig &cf
         const std::uint32_t v = (cfg.maxEpollEvents > lim) ? lim : cfg.maxEpollEvents;
         opt.workerDefaults.eventLoop.maxEpollEvents = static_cast<int>(v);
     }
+    opt.workerDefaults.eventLoop.backend = cfg.ioBackend;
+    if (cfg.uringRecvBufferSize != 0)
+    {
+        opt.workerDefaults.eventLoop.uringRecvBufferSize = cfg.uringRecvBufferSize;
+    }
+    if (cfg.uringRecvBufferCount != 0)
+    {
+        opt.workerDefaults.eventLoop.uringRecvBufferCount = cfg.uringRecvBufferCount;
+    }
+    opt.workerDefaults.eventLoop.pollMode = cfg.pollMode;
+    if (cfg.pollSpinUs != 0)
+    {
+        opt.workerDefaults.eventLoop.pollSpinUs = cfg.pollSpinUs;
+    }
+    opt.workerDefaults.sessionBusyPollUs = cfg.sessionBusyPollUs;
     if (cfg.bufferBlockSize != 0)
     {
         opt.workerDefaults.bufferPool.blockSize = cfg.bufferBlockSize;
@@ -62,16 +82,84 @@ inline EngineOptions makeEffectiveEngineOptions(const hypernet::EngineConfig &cf
     {
         opt.workerDefaults.rings.sendCapacity = cfg.sendRingCapacity;
     }
+    opt.workerDefaults.rings.mirrored = cfg.mirroredRings;
+    opt.workerDefaults.rings.idleReclaimMs = cfg.ringIdleReclaimMs;
+    opt.workerDefaults.sessionPool.prewarm = cfg.sessionPoolPrewarm;
+    if (cfg.sessionPoolMaxIdle != 0)
+    {
+        opt.workerDefaults.sessionPool.maxIdle = cfg.sessionPoolMaxIdle;
+    }
+    opt.workerDefaults.sendPath.deferredFlush = cfg.deferredFlush;
+    opt.workerDefaults.sendPath.cork = cfg.deferredFlush && cfg.deferredFlushCork;
+    opt.workerDefaults.sendPath.zeroCopyThreshold = cfg.zeroCopyThreshold;
+    opt.workerDefaults.sendPath.sendQueueLimit = cfg.sendQueueLimitBytes;
+    opt.workerDefaults.sendPath.sendQueueHighWatermark = cfg.sendQueueHighWatermark;
+    opt.workerDefaults.sendPath.sendQueueLowWatermark = cfg.sendQueueLowWatermark;
+    if (cfg.zeroCopyBufferCount != 0)
+    {
+        opt.workerDefaults.sendPath.zeroCopyBufferCount = cfg.zeroCopyBufferCount;
+    }
     if (cfg.maxPayloadLen != 0)
     {
         opt.workerDefaults.protocol.maxPayloadLen = cfg.maxPayloadLen;
     }
+    opt.workerHandoff = cfg.workerHandoff;
+    if (cfg.handoffRingSlots != 0)
+    {
+        opt.handoffRingSlots = cfg.handoffRingSlots;
+    }
+
+    // ===== 스레드 배치 ("auto" 는 여기서 실제 CPU 목록으로 푼다) =====
+    opt.loggerCpu = cfg.loggerCpu;
+    opt.metricsCpu = cfg.metricsCpu;
+    if (cfg.workerCpuAffinity == "auto")
+    {
+        const CpuPlacementPlan plan = planWorkerCpus(scanCpuTopology(), opt.workerCount);
+        opt.workerCpus = plan.workerCpus;
+        if (opt.loggerCpu < 0)
+        {
+            opt.loggerCpu = plan.housekeepingCpu;
+        }
+        if (opt.metricsCpu < 0)
+        {
+            opt.metricsCpu = plan.housekeepingCpu;
+        }
+    }
+    else if (!cfg.workerCpuAffinity.empty() && cfg.workerCpuAffinity != "none")
+    {
+        opt.workerCpus = parseCpuList(cfg.workerCpuAffinity).value_or(std::vector<int>{});
+    }
+    opt.workerDefaults.placement.numaBind = cfg.workerNumaBind;
+    opt.workerDefaults.placement.schedFifoPriority = cfg.workerSchedFifoPriority;
+
+    // ===== 연결 분배 (리스너 index = 워커 id) =====
+    opt.workerDefaults.steering.mode = cfg.connectionSteering;
+    if (cfg.steeringUpdateMs != 0)
+    {
+        opt.workerDefaults.steering.updateMs = cfg.steeringUpdateMs;
+    }
+    opt.workerDefaults.steering.listenerCpus.assign(opt.workerCount, -1);
+    for (unsigned int i = 0; i < opt.workerCount && !opt.workerCpus.empty(); ++i)
+    {
+        opt.workerDefaults.steering.listenerCpus[i] = opt.workerCpus[i % opt.workerCpus.size()];
+    }
+
+    // ===== 세션 rebalance (워커 0 이 판단) =====
+    opt.workerDefaults.rebalance.intervalMs = cfg.sessionRebalanceMs;
+    if (cfg.sessionRebalanceThresholdPct != 0)
+    {
+        opt.workerDefaults.rebalance.thresholdPct = cfg.sessionRebalanceThresholdPct;
+    }
+
+    // ===== 워커 메모리 =====
+    opt.workerDefaults.pages.hugePages = cfg.hugePages;
+    opt.workerDefaults.pages.prefault = cfg.prefaultMemory;
+    opt.lockMemory = cfg.lockMemory;
 
     // 기본값 방어 (0/음수일 경우 Default 적용)
     if (opt.workerDefaults.timer.tickResolution <= TimerWheel::Duration::zero())
     {
-        opt.workerDefaults.timer.tickResolution = TimerWheel::Duration{
-            static_cast<TimerWheel::Duration::rep>(defaults::kTickResolutionMs)};
+        opt.workerDefaults.timer.tickResolution = std::chrono::milliseconds{defaults::kTickResolutionMs};
     }
     if (opt.workerDefaults.timer.slotCount == 0)
     {
@@ -81,6 +169,18 @@ inline EngineOptions makeEffectiveEngineOptions(const hypernet::EngineConfig &cf
     {
         opt.workerDefaults.eventLoop.maxEpollEvents = defaults::kMaxEpollEvents;
     }
+    if (opt.workerDefaults.eventLoop.uringRecvBufferSize == 0)
+    {
+        opt.workerDefaults.eventLoop.uringRecvBufferSize = defaults::kUringRecvBufferSize;
+    }
+    if (opt.workerDefaults.eventLoop.uringRecvBufferCount == 0)
+    {
+        opt.workerDefaults.eventLoop.uringRecvBufferCount = defaults::kUringRecvBufferCount;
+    }
+    if (opt.workerDefaults.eventLoop.pollSpinUs == 0)
+    {
+        opt.workerDefaults.eventLoop.pollSpinUs = defaults::kPollSpinUs;
+    }
     if (opt.workerDefaults.bufferPool.blockSize == 0)
     {
         opt.workerDefaults.bufferPool.blockSize = defaults::kBufferBlockSize;
@@ -97,10 +197,33 @@ inline EngineOptions makeEffectiveEngineOptions(const hypernet::EngineConfig &cf
     {
         opt.workerDefaults.rings.sendCapacity = defaults::kSendRingCapacity;
     }
+    if (opt.workerDefaults.sessionPool.maxIdle == 0)
+    {
+        opt.workerDefaults.sessionPool.maxIdle = defaults::kSessionPoolMaxIdle;
+    }
+    if (opt.workerDefaults.sendPath.zeroCopyBufferCount == 0)
+    {
+        opt.workerDefaults.sendPath.zeroCopyBufferCount = defaults::kZeroCopyBufferCount;
+    }
+    if (auto &sp = opt.workerDefaults.sendPath; sp.sendQueueLimit != 0)
+    {
+        // watermark 기본값은 여기서만 정한다. (SessionManager::configureSendQueue 는 범위만 자름)
+        // - high: limit 의 3/4, low: limit 의 1/4 (high 를 작게 잡았으면 high 의 1/2 까지 낮춤)
+        // - 명시한 high/low 쌍은 validate 에서 low < high <= limit 를 확인한다.
+        //   high 만 기본값인데 low 가 그 이상이면 low 도 같은 규칙으로 낮춘다.
+        if (sp.sendQueueHighWatermark == 0)
+            sp.sendQueueHighWatermark = sp.sendQueueLimit / 4 * 3;
+        if (sp.sendQueueLowWatermark == 0 || sp.sendQueueLowWatermark >= sp.sendQueueHighWatermark)
+            sp.sendQueueLowWatermark = std::min(sp.sendQueueLimit / 4, sp.sendQueueHighWatermark / 2);
+    }
     if (opt.workerDefaults.protocol.maxPayloadLen == 0)
     {
         opt.workerDefaults.protocol.maxPayloadLen = defaults::kMaxPayloadLen;
     }
+    if (opt.handoffRingSlots == 0)
+    {
+        opt.handoffRingSlots = defaults::kHandoffRingSlots;
+    }
 
     // ===== 파생/정책 정리 =====
     const std::size_t recvCap = opt.workerDefaults.rings.recvCapacity;
@@ -0,0 +1,406 @@
+#pragma once
+
+#include <hypernet/util/NonCopyable.hpp>
+
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h> // __rdtsc
+#endif
+
+namespace hypernet::core::detail
+{
+
+// =============================================================================
+// 비동기 로거의 바이너리 레코드 / 스레드별 SPSC 바이트 링
+//   - 호출 스레드는 [헤더 | comp | evt | 인자 raw bytes] 만 링에 복사합니다.
+//   - 포맷팅(std::vformat)과 I/O 는 로거 스레드가 합니다.
+// =============================================================================
+
+/// 레코드 타임스탬프 (x86: TSC, 그 외: steady_clock ns). 로거 스레드가 벽시계로 환산합니다.
+[[nodiscard]] inline std::uint64_t logStamp() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/// payload 를 읽어 out 에 포맷 결과를 덧붙입니다. (로거 스레드에서만 호출)
+using LogDecodeFn = void (*)(std::string_view fmt, const std::byte *payload, std::size_t len, std::string &out);
+
+enum class LogRecordKind : std::uint8_t
+{
+    Pad = 0, ///< 링 끝 남는 구간 (건너뜀)
+    Format,  ///< fmt + raw 인자 → decode 로 포맷
+    Text,    ///< 호출 스레드에서 이미 만든 details 문자열 (raw 로 못 싣는 인자)
+    Message, ///< ILogger::log 로 들어온 완성 메시지 ("comp | evt | ..." 그대로)
+};
+
+struct LogRecordHeader
+{
+    std::uint32_t size{0}; ///< 헤더 포함 전체 크기 (8 정렬)
+    LogRecordKind kind{LogRecordKind::Pad};
+    std::uint8_t level{0};
+    std::uint16_t compLen{0};
+    std::uint16_t evtLen{0};
+    std::int16_t workerId{-1};
+    std::uint32_t payloadLen{0};
+    std::uint64_t stamp{0};
+    long tid{0};
+    LogDecodeFn decode{nullptr};
+    const char *fmt{nullptr}; ///< format_string 은 상수식이므로 정적 저장소를 가리킴
+    std::size_t fmtLen{0};
+
+    [[nodiscard]] const std::byte *body() const noexcept { return reinterpret_cast<const std::byte *>(this + 1); }
+    [[nodiscard]] std::string_view comp() const noexcept
+    {
+        return {reinterpret_cast<const char *>(body()), compLen};
+    }
+    [[nodiscard]] std::string_view evt() const noexcept
+    {
+        return {reinterpret_cast<const char *>(body()) + compLen, evtLen};
+    }
+    [[nodiscard]] const std::byte *payload() const noexcept { return body() + compLen + evtLen; }
+};
+
+static_assert(sizeof(LogRecordHeader) % 8 == 0, "LogRecordHeader must keep 8-byte record alignment");
+
+/// 레코드 하나의 상한 (넘는 Text/Message 는 잘라냄)
+inline constexpr std::size_t kMaxLogRecordBytes = 4096;
+
+[[nodiscard]] constexpr std::size_t alignLogRecord(std::size_t n) noexcept
+{
+    return (n + 7) & ~std::size_t{7};
+}
+
+/// 스레드 하나(producer)와 로거 스레드(consumer) 사이의 가변 길이 레코드 링입니다.
+///
+/// - 용량은 2의 거듭제곱으로 올림합니다. 레코드는 링 끝을 넘지 않고, 끝에 남는 구간은 Pad 로 채웁니다.
+/// - producer 는 절대 기다리지 않습니다. 자리가 없으면 reserve 가 nullptr 를 주고 drop 으로 셉니다.
+/// - consumer 는 front()/pop() 으로 제자리에서 읽고, release() 때 한꺼번에 공간을 돌려줍니다.
+/// - reserve()/commit()/noteDropped() 는 producer 스레드에서만, front()/pop()/release() 는
+///   consumer 스레드에서만 호출해야 합니다.
+class LogRing : private hypernet::util::NonCopyable
+{
+  public:
+    explicit LogRing(std::size_t capacity)
+        : capacity_(std::bit_ceil(capacity < 2 * kMaxLogRecordBytes ? 2 * kMaxLogRecordBytes : capacity)),
+          mask_(capacity_ - 1), storage_(new std::byte[capacity_])
+    {
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+    /// 연속 bytes 를 예약합니다. (producer 전용, bytes 는 8 정렬 + kMaxLogRecordBytes 이하)
+    [[nodiscard]] std::byte *reserve(std::size_t bytes) noexcept
+    {
+        std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+        const std::size_t offset = static_cast<std::size_t>(tail & mask_);
+        const std::size_t toEnd = capacity_ - offset;
+        const std::size_t need = (bytes <= toEnd) ? bytes : toEnd + bytes;
+
+        if (tail + need - cachedHead_ > capacity_)
+        {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail + need - cachedHead_ > capacity_)
+            {
+                return nullptr;
+            }
+        }
+
+        if (bytes > toEnd)
+        {
+            auto *pad = reinterpret_cast<LogRecordHeader *>(storage_.get() + offset);
+            pad->size = static_cast<std::uint32_t>(toEnd);
+            pad->kind = LogRecordKind::Pad;
+            tail += toEnd;
+        }
+        pendingTail_ = tail + bytes;
+        return storage_.get() + static_cast<std::size_t>(tail & mask_);
+    }
+
+    /// 직전 reserve 분을 consumer 에게 게시합니다. (producer 전용)
+    void commit() noexcept { tail_.store(pendingTail_, std::memory_order_release); }
+
+    void noteDropped() noexcept { dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); }
+
+    [[nodiscard]] std::uint64_t dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+    /// 지금까지 게시된 위치 (producer 가 flush 대기에 씀)
+    [[nodiscard]] std::uint64_t published() const noexcept { return tail_.load(std::memory_order_acquire); }
+
+    /// consumer 가 돌려준 위치
+    [[nodiscard]] std::uint64_t released() const noexcept { return head_.load(std::memory_order_acquire); }
+
+    /// 다음 레코드 (consumer 전용, Pad 는 건너뜀). 없으면 nullptr
+    [[nodiscard]] const LogRecordHeader *front() noexcept
+    {
+        while (true)
+        {
+            if (cursor_ == cachedTail_)
+            {
+                cachedTail_ = tail_.load(std::memory_order_acquire);
+                if (cursor_ == cachedTail_)
+                {
+                    return nullptr;
+                }
+            }
+            const auto *h = reinterpret_cast<const LogRecordHeader *>(storage_.get() + static_cast<std::size_t>(cursor_ & mask_));
+            if (h->kind != LogRecordKind::Pad)
+            {
+                return h;
+            }
+            cursor_ += h->size;
+        }
+    }
+
+    /// front() 레코드를 건너뜁니다. (consumer 전용, 공간은 release() 때 반환)
+    void pop() noexcept
+    {
+        const auto *h = reinterpret_cast<const LogRecordHeader *>(storage_.get() + static_cast<std::size_t>(cursor_ & mask_));
+        cursor_ += h->size;
+    }
+
+    /// 읽은 레코드의 공간을 producer 에게 돌려줍니다. (consumer 전용)
+    void release() noexcept
+    {
+        if (head_.load(std::memory_order_relaxed) != cursor_)
+        {
+            head_.store(cursor_, std::memory_order_release);
+        }
+    }
+
+    /// producer 스레드가 끝났음을 표시합니다. (비워지면 consumer 가 목록에서 뺌)
+    void retire() noexcept { retired_.store(true, std::memory_order_release); }
+    void revive() noexcept { retired_.store(false, std::memory_order_release); }
+    [[nodiscard]] bool retired() const noexcept { return retired_.load(std::memory_order_acquire); }
+
+  private:
+    static constexpr std::size_t kCacheLine = 64;
+
+    // consumer 가 쓰는 line
+    alignas(kCacheLine) std::atomic<std::uint64_t> head_{0};
+    std::uint64_t cursor_{0};
+    std::uint64_t cachedTail_{0};
+
+    // producer 가 쓰는 line
+    alignas(kCacheLine) std::atomic<std::uint64_t> tail_{0};
+    std::uint64_t cachedHead_{0};
+    std::uint64_t pendingTail_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+
+    alignas(kCacheLine) std::size_t capacity_;
+    std::size_t mask_;
+    std::unique_ptr<std::byte[]> storage_;
+    std::atomic<bool> retired_{false};
+};
+
+// =============================================================================
+// 인자 codec: 정수/실수/bool/char/void*/문자열만 raw 로 싣습니다.
+//   - 문자열은 [u32 길이 | bytes] 로 복사하고, decode 쪽에서는 링 안을 가리키는 string_view 가 됩니다.
+//   - 그 밖의 타입(사용자 formatter 등)이 하나라도 있으면 레코드 전체를 호출 스레드에서 포맷합니다.
+// =============================================================================
+
+template <typename T, typename = void> struct LogArg
+{
+    static constexpr bool kRaw = false;
+};
+
+template <typename T> struct LogArg<T, std::enable_if_t<std::is_arithmetic_v<T>>>
+{
+    static constexpr bool kRaw = true;
+    using Stored = T;
+
+    static std::size_t size(T) noexcept { return sizeof(T); }
+    static std::byte *encode(std::byte *p, T v) noexcept
+    {
+        std::memcpy(p, &v, sizeof(T));
+        return p + sizeof(T);
+    }
+    static const std::byte *decode(const std::byte *p, Stored &out) noexcept
+    {
+        std::memcpy(&out, p, sizeof(T));
+        return p + sizeof(T);
+    }
+};
+
+template <typename T>
+struct LogArg<T, std::enable_if_t<std::is_same_v<T, void *> || std::is_same_v<T, const void *> || std::is_same_v<T, std::nullptr_t>>>
+{
+    static constexpr bool kRaw = true;
+    using Stored = const void *;
+
+    static std::size_t size(T) noexcept { return sizeof(Stored); }
+    static std::byte *encode(std::byte *p, T v) noexcept
+    {
+        const Stored s = v;
+        std::memcpy(p, &s, sizeof(s));
+        return p + sizeof(s);
+    }
+    static const std::byte *decode(const std::byte *p, Stored &out) noexcept
+    {
+        std::memcpy(&out, p, sizeof(out));
+        return p + sizeof(out);
+    }
+};
+
+struct LogStringArg
+{
+    static constexpr bool kRaw = true;
+    using Stored = std::string_view;
+
+    static std::size_t size(std::string_view s) noexcept { return sizeof(std::uint32_t) + s.size(); }
+    static std::byte *encode(std::byte *p, std::string_view s) noexcept
+    {
+        const auto n = static_cast<std::uint32_t>(s.size());
+        std::memcpy(p, &n, sizeof(n));
+        if (n != 0)
+        {
+            std::memcpy(p + sizeof(n), s.data(), n);
+        }
+        return p + sizeof(n) + n;
+    }
+    static const std::byte *decode(const std::byte *p, Stored &out) noexcept
+    {
+        std::uint32_t n = 0;
+        std::memcpy(&n, p, sizeof(n));
+        out = std::string_view{reinterpret_cast<const char *>(p + sizeof(n)), n};
+        return p + sizeof(n) + n;
+    }
+};
+
+template <> struct LogArg<std::string_view> : LogStringArg
+{
+};
+template <> struct LogArg<std::string> : LogStringArg
+{
+};
+template <> struct LogArg<const char *> : LogStringArg
+{
+    static std::size_t size(const char *s) noexcept { return LogStringArg::size(view(s)); }
+    static std::byte *encode(std::byte *p, const char *s) noexcept { return LogStringArg::encode(p, view(s)); }
+    static std::string_view view(const char *s) noexcept { return s ? std::string_view{s} : std::string_view{"(null)"}; }
+};
+template <> struct LogArg<char *> : LogArg<const char *>
+{
+};
+
+template <typename... Args> inline constexpr bool kAllLogArgsRaw = (LogArg<std::decay_t<Args>>::kRaw && ...);
+
+/// Stored... 를 payload 에서 꺼내 std::vformat 으로 포맷합니다. (레코드 형식별 "format id" 역할)
+template <typename... Stored>
+void decodeLogRecord(std::string_view fmt, const std::byte *payload, std::size_t len, std::string &out)
+{
+    (void)len;
+    std::tuple<Stored...> values{};
+    std::apply(
+        [&payload](Stored &...v)
+        {
+            ((payload = LogArg<Stored>::decode(payload, v)), ...);
+        },
+        values);
+    std::apply([&out, fmt](Stored &...v) { std::vformat_to(std::back_inserter(out), fmt, std::make_format_args(v...)); },
+               values);
+}
+
+/// 헤더 공통 필드를 채웁니다.
+inline void fillLogHeader(LogRecordHeader &h, std::size_t size, LogRecordKind kind, int level, std::string_view comp,
+                          std::string_view evt, int workerId, long tid) noexcept
+{
+    h.size = static_cast<std::uint32_t>(size);
+    h.kind = kind;
+    h.level = static_cast<std::uint8_t>(level);
+    h.compLen = static_cast<std::uint16_t>(comp.size());
+    h.evtLen = static_cast<std::uint16_t>(evt.size());
+    h.workerId = static_cast<std::int16_t>(workerId);
+    h.tid = tid;
+    h.stamp = logStamp();
+    auto *p = reinterpret_cast<std::byte *>(&h + 1);
+    if (!comp.empty())
+    {
+        std::memcpy(p, comp.data(), comp.size());
+    }
+    if (!evt.empty())
+    {
+        std::memcpy(p + comp.size(), evt.data(), evt.size());
+    }
+}
+
+/// 완성된 문자열 레코드(Text/Message)를 싣습니다. 길면 잘라냅니다. 자리가 없으면 false
+inline bool pushLogText(LogRing &ring, LogRecordKind kind, int level, std::string_view comp, std::string_view evt,
+                        std::string_view text, int workerId, long tid) noexcept
+{
+    comp = comp.substr(0, 64);
+    evt = evt.substr(0, 128);
+    const std::size_t fixed = sizeof(LogRecordHeader) + comp.size() + evt.size();
+    if (text.size() > kMaxLogRecordBytes - fixed)
+    {
+        text = text.substr(0, kMaxLogRecordBytes - fixed);
+    }
+    const std::size_t size = alignLogRecord(fixed + text.size());
+    std::byte *mem = ring.reserve(size);
+    if (!mem)
+    {
+        ring.noteDropped();
+        return false;
+    }
+    auto *h = new (mem) LogRecordHeader{};
+    fillLogHeader(*h, size, kind, level, comp, evt, workerId, tid);
+    h->payloadLen = static_cast<std::uint32_t>(text.size());
+    if (!text.empty())
+    {
+        std::memcpy(mem + fixed, text.data(), text.size());
+    }
+    ring.commit();
+    return true;
+}
+
+/// fmt + raw 인자 레코드를 싣습니다. (kAllLogArgsRaw<Args...> 일 때만)
+/// @return 0 = 실음, 1 = 링이 꽉 참(drop), 2 = 레코드 상한 초과 (호출자가 Text 로 다시 시도)
+template <typename... Args>
+int pushLogFormat(LogRing &ring, int level, std::string_view comp, std::string_view evt, std::string_view fmt,
+                  int workerId, long tid, const Args &...args) noexcept
+{
+    comp = comp.substr(0, 64);
+    evt = evt.substr(0, 128);
+    const std::size_t fixed = sizeof(LogRecordHeader) + comp.size() + evt.size();
+    const std::size_t payloadLen = (std::size_t{0} + ... + LogArg<std::decay_t<Args>>::size(args));
+    if (fixed + payloadLen > kMaxLogRecordBytes)
+    {
+        return 2;
+    }
+    const std::size_t size = alignLogRecord(fixed + payloadLen);
+    std::byte *mem = ring.reserve(size);
+    if (!mem)
+    {
+        ring.noteDropped();
+        return 1;
+    }
+    auto *h = new (mem) LogRecordHeader{};
+    fillLogHeader(*h, size, LogRecordKind::Format, level, comp, evt, workerId, tid);
+    h->payloadLen = static_cast<std::uint32_t>(payloadLen);
+    h->decode = &decodeLogRecord<typename LogArg<std::decay_t<Args>>::Stored...>;
+    h->fmt = fmt.data();
+    h->fmtLen = fmt.size();
+    [[maybe_unused]] std::byte *p = mem + fixed; // 인자 0개면 fold 가 비어 쓰이지 않음
+    ((p = LogArg<std::decay_t<Args>>::encode(p, args)), ...);
+    ring.commit();
+    return 0;
+}
+
+} // namespace hypernet::core::detail
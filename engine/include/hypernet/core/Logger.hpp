@@ -1,8 +1,13 @@
 #pragma once
 
+#include <hypernet/core/Defaults.hpp>
+#include <hypernet/core/LogRing.hpp>
+#include <hypernet/core/ThreadContext.hpp>
 #include <hypernet/util/NonCopyable.hpp>
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <format>
 #include <iostream>
 #include <memory>
@@ -10,6 +15,12 @@
 #include <string_view>
 #include <utility>
 
+// 이 레벨 미만의 SLOG_* 호출은 컴파일 단계에서 사라집니다. (0=TRACE .. 5=FATAL)
+// - 인자 식도 평가되지 않습니다. CMake 의 FEP_LOG_COMPILED_LEVEL 로 지정합니다.
+#ifndef HYPERNET_LOG_COMPILED_LEVEL
+#define HYPERNET_LOG_COMPILED_LEVEL 0
+#endif
+
 namespace hypernet::core
 {
 
@@ -27,8 +38,21 @@ namespace detail
 {
 // 로그 필터링 최적화를 위한 전역 atomic 변수 (Logger.cpp에서 정의)
 std::atomic<int> &fastMinLevel();
+
+// 현재 스레드가 활성 Logger 에 레코드를 싣는 링입니다.
+// - 활성 Logger 가 없거나(사용자 ILogger) 스레드가 끝나는 중이면 nullptr → 문자열 경로로 내려갑니다.
+LogRing *threadLogRing() noexcept;
+
+// FATAL 직후 호출: 현재 스레드 링이 로거 스레드에 의해 비워질 때까지 잠깐(상한 있음) 기다립니다.
+void flushThreadLog() noexcept;
 } // namespace detail
 
+// 컴파일 단계 레벨 컷 (SLOG_* 매크로가 if constexpr 로 사용)
+[[nodiscard]] constexpr bool compiledIn(LogLevel level) noexcept
+{
+    return static_cast<int>(level) >= HYPERNET_LOG_COMPILED_LEVEL;
+}
+
 // Hot path용 빠른 레벨 체크
 inline bool fastEnabled(LogLevel level) noexcept
 {
@@ -49,10 +73,18 @@ class ILogger : private hypernet::util::NonCopyable
 };
 
 // 기본 Logger 구현체 (Console/Stream 기반, 비동기)
+// - 로그를 남기는 스레드마다 SPSC 링(threadRingBytes)을 하나씩 두고 바이너리 레코드만 싣습니다.
+//   포맷팅/타임스탬프 환산/I/O 는 로거 스레드 1개가 하고, 호출 스레드는 락/할당/대기 없이 돌아옵니다.
+// - 링이 꽉 차면 레코드를 버리고 센 뒤, 로거 스레드가 "Logger | RecordsDropped" 로 알립니다.
+// - 로거 스레드는 여러 링을 타임스탬프 순으로 합쳐서 씁니다.
 class Logger final : public ILogger
 {
   public:
-    explicit Logger(std::ostream &os = std::clog);
+    explicit Logger(std::ostream &os = std::clog,
+                    std::size_t threadRingBytes = defaults::kLogThreadRingBytes);
+
+    // 스트림 수명을 함께 소유합니다. (파일 로그)
+    Logger(std::shared_ptr<std::ostream> os, std::size_t threadRingBytes);
     ~Logger() override;
 
     void log(LogLevel level, std::string_view message) override;
@@ -64,6 +96,16 @@ class Logger final : public ILogger
     void stopAndJoin();
     void shutdown() noexcept override { stopAndJoin(); }
 
+    // 링이 꽉 차 버린 레코드 누적 수
+    [[nodiscard]] std::uint64_t droppedRecords() const noexcept;
+
+    // 로거 스레드(링 consumer)를 cpu 에 고정합니다. 실패 시 errno 값 (0이면 성공)
+    [[nodiscard]] int pinConsumerThread(int cpu) noexcept;
+
+    // SLOG 바이너리 경로의 대상이 되도록 전역에 등록/해제합니다. (setLogger/shutdownLogger 가 호출)
+    void activate() noexcept;
+    void deactivate() noexcept;
+
   private:
     class Impl;
     std::unique_ptr<Impl> impl_;
@@ -93,39 +135,71 @@ inline void emit(LogLevel lvl, std::string_view comp, std::string_view evt)
 {
     if (!fastEnabled(lvl))
         return;
+    if (detail::LogRing *ring = detail::threadLogRing())
+    {
+        detail::pushLogText(*ring, detail::LogRecordKind::Text, static_cast<int>(lvl), comp, evt, {},
+                            ThreadContext::currentWorkerId(), ThreadContext::currentTid());
+        if (lvl == LogLevel::Fatal)
+            detail::flushThreadLog();
+        return;
+    }
     getLogger().log(lvl, build(comp, evt, {}));
 }
 
+// 활성 Logger 가 있으면 fmt 와 인자 raw bytes 만 현재 스레드 링에 싣습니다. (포맷은 로거 스레드)
+// - raw 로 못 싣는 인자(사용자 formatter 등)가 있거나 레코드 상한을 넘으면 여기서 포맷해 Text 로 싣습니다.
 template <typename... Args>
 inline void emit(LogLevel lvl, std::string_view comp, std::string_view evt,
                  std::format_string<Args...> fmt, Args &&...args)
 {
     if (!fastEnabled(lvl))
         return;
+    if (detail::LogRing *ring = detail::threadLogRing())
+    {
+        const int wid = ThreadContext::currentWorkerId();
+        const long tid = ThreadContext::currentTid();
+        bool pushed = false;
+        if constexpr (detail::kAllLogArgsRaw<Args...>)
+        {
+            pushed = detail::pushLogFormat(*ring, static_cast<int>(lvl), comp, evt, fmt.get(), wid, tid,
+                                           args...) != 2;
+        }
+        if (!pushed)
+        {
+            const std::string details = std::format(fmt, std::forward<Args>(args)...);
+            detail::pushLogText(*ring, detail::LogRecordKind::Text, static_cast<int>(lvl), comp, evt,
+                                details, wid, tid);
+        }
+        if (lvl == LogLevel::Fatal)
+            detail::flushThreadLog();
+        return;
+    }
     std::string details = std::format(fmt, std::forward<Args>(args)...);
     getLogger().log(lvl, build(comp, evt, details));
 }
 } // namespace slog
 
 // C++20: __VA_OPT__로 fmt 유무 둘 다 지원
+// - compiledIn(level) 이 false 인 레벨은 if constexpr 로 호출 자체가 빠집니다.
+#define HYPERNET_SLOG_AT_(lvl, comp, evt, ...)                                                     \
+    do                                                                                             \
+    {                                                                                              \
+        if constexpr (::hypernet::core::compiledIn(lvl))                                           \
+            ::hypernet::core::slog::emit((lvl), (comp), (evt)__VA_OPT__(, ) __VA_ARGS__);          \
+    } while (0)
+
 #define SLOG_TRACE(comp, evt, ...)                                                                 \
-    ::hypernet::core::slog::emit(::hypernet::core::LogLevel::Trace, (comp),                        \
-                                 (evt)__VA_OPT__(, ) __VA_ARGS__)
+    HYPERNET_SLOG_AT_(::hypernet::core::LogLevel::Trace, comp, evt __VA_OPT__(, ) __VA_ARGS__)
 #define SLOG_DEBUG(comp, evt, ...)                                                                 \
-    ::hypernet::core::slog::emit(::hypernet::core::LogLevel::Debug, (comp),                        \
-                                 (evt)__VA_OPT__(, ) __VA_ARGS__)
+    HYPERNET_SLOG_AT_(::hypernet::core::LogLevel::Debug, comp, evt __VA_OPT__(, ) __VA_ARGS__)
 #define SLOG_INFO(comp, evt, ...)                                                                  \
-    ::hypernet::core::slog::emit(::hypernet::core::LogLevel::Info, (comp),                         \
-                                 (evt)__VA_OPT__(, ) __VA_ARGS__)
+    HYPERNET_SLOG_AT_(::hypernet::core::LogLevel::Info, comp, evt __VA_OPT__(, ) __VA_ARGS__)
 #define SLOG_WARN(comp, evt, ...)                                                                  \
-    ::hypernet::core::slog::emit(::hypernet::core::LogLevel::Warn, (comp),                         \
-                                 (evt)__VA_OPT__(, ) __VA_ARGS__)
+    HYPERNET_SLOG_AT_(::hypernet::core::LogLevel::Warn, comp, evt __VA_OPT__(, ) __VA_ARGS__)
 #define SLOG_ERROR(comp, evt, ...)                                                                 \
-    ::hypernet::core::slog::emit(::hypernet::core::LogLevel::Error, (comp),                        \
-                                 (evt)__VA_OPT__(, ) __VA_ARGS__)
+    HYPERNET_SLOG_AT_(::hypernet::core::LogLevel::Error, comp, evt __VA_OPT__(, ) __VA_ARGS__)
 #define SLOG_FATAL(comp, evt, ...)                                                                 \
-    ::hypernet::core::slog::emit(::hypernet::core::LogLevel::Fatal, (comp),                        \
-                                 (evt)__VA_OPT__(, ) __VA_ARGS__)
+    HYPERNET_SLOG_AT_(::hypernet::core::LogLevel::Fatal, comp, evt __VA_OPT__(, ) __VA_ARGS__)
 
 // =============================================================================
 // Legacy Kill Switch
@@ -2,17 +2,21 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
+#include <hypernet/buffer/PageMemory.hpp>
 #include <hypernet/core/Defaults.hpp>
 #include <hypernet/core/TimerWheel.hpp>
+#include <hypernet/net/IoBackend.hpp>
+#include <hypernet/net/PollMode.hpp>
+#include <hypernet/net/SteeringMode.hpp>
 
 namespace hypernet::core
 {
 
 struct TimerOptions
 {
-    TimerWheel::Duration tickResolution{
-        TimerWheel::Duration{static_cast<TimerWheel::Duration::rep>(defaults::kTickResolutionMs)}};
+    TimerWheel::Duration tickResolution{std::chrono::milliseconds{defaults::kTickResolutionMs}};
     std::size_t slotCount{defaults::kTimerSlots};
 };
 
@@ -25,12 +29,37 @@ struct BufferPoolOptions
 struct EventLoopOptions
 {
     int maxEpollEvents{defaults::kMaxEpollEvents};
+    net::IoBackend backend{net::IoBackend::Epoll};
+    unsigned int uringEntries{defaults::kUringEntries};
+    std::size_t uringRecvBufferSize{defaults::kUringRecvBufferSize};
+    std::size_t uringRecvBufferCount{defaults::kUringRecvBufferCount};
+    net::PollMode pollMode{net::PollMode::Block};
+    std::uint32_t pollSpinUs{defaults::kPollSpinUs};
 };
 
 struct RingBufferOptions
 {
     std::size_t recvCapacity{defaults::kRecvRingCapacity};
     std::size_t sendCapacity{defaults::kSendRingCapacity};
+    bool mirrored{true}; ///< memfd 이중 매핑 링 (모든 구간 연속)
+    std::uint32_t idleReclaimMs{defaults::kRingIdleReclaimMs}; ///< 0이면 빈 링을 회수하지 않음
+};
+
+struct SessionPoolOptions
+{
+    std::size_t prewarm{defaults::kSessionPoolPrewarm};
+    std::size_t maxIdle{defaults::kSessionPoolMaxIdle}; ///< 0이면 풀 미사용
+};
+
+struct SendPathOptions
+{
+    bool deferredFlush{false}; ///< iteration 끝에 dirty 세션을 일괄 flush
+    bool cork{false};          ///< deferred flush 를 TCP_CORK 로 감쌈
+    std::size_t zeroCopyThreshold{0}; ///< body 가 이 크기 이상이면 MSG_ZEROCOPY (0이면 미사용)
+    std::size_t zeroCopyBufferCount{defaults::kZeroCopyBufferCount};
+    std::size_t sendQueueLimit{0};         ///< 세션당 송신 대기 상한(링 + overflow). 0이면 링이 차면 close
+    std::size_t sendQueueHighWatermark{0}; ///< 이 이상이면 onSendBackpressure(true)
+    std::size_t sendQueueLowWatermark{0};  ///< 이 이하로 내려오면 onSendBackpressure(false)
 };
 
 struct ProtocolOptions
@@ -38,6 +67,29 @@ struct ProtocolOptions
     std::uint32_t maxPayloadLen{defaults::kMaxPayloadLen};
 };
 
+/// 스레드 1개의 CPU/NUMA/스케줄링 배치입니다. (스레드가 자기 자신에게 적용)
+struct ThreadPlacementOptions
+{
+    int cpu{-1};                        ///< 고정할 CPU (-1이면 OS 스케줄링)
+    bool numaBind{false};               ///< cpu 의 NUMA 노드를 메모리 할당 우선 노드로 지정
+    std::uint32_t schedFifoPriority{0}; ///< 0이면 SCHED_OTHER 유지, 1~99 이면 SCHED_FIFO
+};
+
+/// 새 연결을 워커에 나누는 방식입니다. (리스너 index = 워커 id)
+struct SteeringOptions
+{
+    net::SteeringMode mode{net::SteeringMode::Kernel};
+    std::vector<int> listenerCpus; ///< 워커 id 순서의 고정 CPU (IncomingCpu 용, -1 이면 고정 안 됨)
+    std::uint32_t updateMs{defaults::kSteeringUpdateMs}; ///< Weighted 가중치 갱신 주기
+};
+
+/// 워커 간 세션 rebalance 입니다. (워커 0 의 타이머가 판단, intervalMs == 0 이면 끔)
+struct RebalanceOptions
+{
+    std::uint32_t intervalMs{0};
+    std::uint32_t thresholdPct{defaults::kRebalanceThresholdPct}; ///< 가장 바쁜/한가한 워커 사용률 차 (%)
+};
+
 struct WorkerOptions
 {
     unsigned int id{0};
@@ -45,9 +97,16 @@ struct WorkerOptions
     BufferPoolOptions bufferPool{};
     EventLoopOptions eventLoop{};
     RingBufferOptions rings{};
+    SessionPoolOptions sessionPool{};
+    SendPathOptions sendPath{};
     ProtocolOptions protocol{};
     std::uint32_t idleTimeoutMs{0};
     std::uint32_t heartbeatIntervalMs{0};
+    std::uint32_t sessionBusyPollUs{0}; ///< 0이면 SO_BUSY_POLL 미설정
+    ThreadPlacementOptions placement{};
+    buffer::PageAllocPolicy pages{}; ///< 워커 링/풀 저장소의 huge page / prefault 정책
+    SteeringOptions steering{};
+    RebalanceOptions rebalance{};
 };
 
 struct EngineOptions
@@ -55,14 +114,24 @@ struct EngineOptions
     unsigned int workerCount{1};
     int listenBacklog{defaults::kListenBacklog};
     WorkerOptions workerDefaults{};
+    bool workerHandoff{true}; ///< 워커 쌍 전용 SPSC handoff mesh 사용
+    std::size_t handoffRingSlots{defaults::kHandoffRingSlots};
     std::chrono::milliseconds shutdownDrainTimeout;
     std::chrono::milliseconds shutdownPollInterval;
+    std::vector<int> workerCpus; ///< 워커 id 순서의 고정 CPU (비면 고정 안 함, 모자라면 반복)
+    int loggerCpu{-1};           ///< 로거 consumer 스레드 CPU (-1이면 고정 안 함)
+    int metricsCpu{-1};          ///< 메트릭 HTTP 스레드 CPU (-1이면 고정 안 함)
+    bool lockMemory{false};      ///< 워커 생성 전에 mlockall (실패해도 계속)
 };
 
 inline WorkerOptions makeWorkerOptions(const EngineOptions &opt, unsigned int workerId)
 {
     WorkerOptions w = opt.workerDefaults;
     w.id = workerId;
+    if (!opt.workerCpus.empty())
+    {
+        w.placement.cpu = opt.workerCpus[workerId % opt.workerCpus.size()];
+    }
     return w;
 }
 
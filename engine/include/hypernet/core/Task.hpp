@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <hypernet/util/InlineFunction.hpp>
+
+namespace hypernet::core
+{
+
+/// Task 의 inline capture 용량(bytes)입니다.
+/// - RoutedPacketU16 + SessionHandle(weak_ptr 포함) + this 정도의 capture 가 들어가는 크기입니다.
+inline constexpr std::size_t kTaskInlineBytes = 96;
+
+/// 이벤트 루프 / 워커로 넘기는 작업 타입입니다. (EventLoop::post, IWorkerScheduler::postToWorker 등)
+///
+/// - move-only 이고, capture 가 kTaskInlineBytes 안이면 생성/이동에 힙 할당이 없습니다.
+/// - 더 큰 capture 는 힙에 저장됩니다(opt-out). FEP_STRICT_INLINE_TASKS 로 빌드하면
+///   힙 폴백 대신 컴파일 에러가 나므로, hot path 의 capture 크기를 빌드 시점에 고정할 수 있습니다.
+#if defined(FEP_STRICT_INLINE_TASKS) && FEP_STRICT_INLINE_TASKS
+using Task = hypernet::util::InlineFunction<void(), kTaskInlineBytes, hypernet::util::InlineOverflow::Reject>;
+#else
+using Task = hypernet::util::InlineFunction<void(), kTaskInlineBytes, hypernet::util::InlineOverflow::Heap>;
+#endif
+
+/// capture 가 큰 cold path 작업을 명시적으로 힙에 두는 Task 를 만듭니다. (strict 빌드에서도 허용)
+template <typename F>
+[[nodiscard]] Task makeHeapTask(F &&f)
+{
+    using Fn = std::decay_t<F>;
+    return Task([p = std::make_unique<Fn>(std::forward<F>(f))]() mutable { (*p)(); });
+}
+
+} // namespace hypernet::core
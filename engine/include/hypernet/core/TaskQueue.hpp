@@ -1,35 +1,120 @@
 #pragma once
 
-#include <functional>
-#include <queue> // std::mutex 제거
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
 
+#include <hypernet/core/Task.hpp>
 #include <hypernet/util/NonCopyable.hpp>
-#include <hypernet/util/SpinLock.hpp> // 스핀락 헤더 포함
 
 namespace hypernet::core
 {
 
+/// 여러 producer / 단일 consumer(이벤트 루프 owner thread) 용 lock-free 작업 큐입니다.
+///
+/// - push 는 intrusive 노드를 head 에 CAS 로 얹습니다. (Treiber stack, 락/스핀 없음)
+/// - consumer 는 exchange 한 번으로 쌓인 목록 전체를 떼어 와서 뒤집어(FIFO) 실행합니다.
+///   (작업마다 락을 잡지 않음)
+/// - 같은 producer 가 넣은 작업끼리는 FIFO 가 보장됩니다.
+/// - tryPop()/drain() 은 consumer 스레드 하나에서만 호출해야 합니다.
+/// - 실행이 끝난 노드는 consumer 쪽 free list 로 돌아가고, consumer 스레드 자신의 push
+///   (pushLocal) 가 재사용합니다. → 루프 안에서 자기 자신에게 post 하는 경로는 할당이 없습니다.
+/// - push 는 노드에 post 시각(steady ns)을 남깁니다. drain 의 fn 이 (Task&, std::int64_t) 를 받으면
+///   함께 넘기므로 consumer 가 post → 실행 지연을 잴 수 있습니다. (pushLocal 은 0)
 class TaskQueue : private hypernet::util::NonCopyable
 {
   public:
-    using Task = std::function<void()>;
+    using Task = core::Task;
 
     TaskQueue() = default;
-    ~TaskQueue() = default;
+    ~TaskQueue();
 
     TaskQueue(TaskQueue &&) = delete;
     TaskQueue &operator=(TaskQueue &&) = delete;
 
-    /// 작업을 큐에 추가합니다. (Thread-Safe: SpinLock 사용)
+    /// 작업을 큐에 추가합니다. (Thread-Safe, lock-free)
     void push(Task &&task);
 
-    /// 큐에서 작업을 꺼냅니다. (Thread-Safe: SpinLock 사용)
+    /// consumer 스레드에서 작업을 추가합니다. (free list 의 노드를 재사용)
+    void pushLocal(Task &&task);
+
+    /// 큐에서 작업을 하나 꺼냅니다. (consumer 전용)
     bool tryPop(Task &outTask);
 
+    /// 지금까지 쌓인 작업을 한 번에 떼어 와 순서대로 fn(Task&) 를 호출합니다. (consumer 전용)
+    ///
+    /// - 실행 중에 새로 push 된 작업은 이번 배치에 포함되지 않습니다. (다음 drain 에서 처리)
+    /// - fn 은 예외를 밖으로 던지지 않아야 합니다. (남은 노드가 누수됨)
+    /// - fn 이 fn(Task&, std::int64_t postedNs) 꼴이면 push 시각을 함께 받습니다. (pushLocal 작업은 0)
+    /// @return 실행한 작업 수
+    template <typename Fn>
+    std::size_t drain(Fn &&fn)
+    {
+        std::size_t count = 0;
+        Node *node = takeBatch_();
+        while (node)
+        {
+            Node *next = node->next;
+            if constexpr (std::is_invocable_v<Fn &, Task &, std::int64_t>)
+            {
+                fn(node->task, node->postedNs);
+            }
+            else
+            {
+                fn(node->task);
+            }
+            recycle_(node);
+            node = next;
+            ++count;
+        }
+        return count;
+    }
+
+    /// 비어 있는지 확인합니다. (consumer 전용. producer 의 push 와 동시에 보면 순간 값)
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return pending_ == nullptr && head_.load(std::memory_order_seq_cst) == nullptr;
+    }
+
   private:
-    // std::mutex mutex_; // 뮤텍스 제거
-    hypernet::util::SpinLock lock_; // 스핀락 사용
-    std::queue<Task> queue_;
+    struct Node
+    {
+        Task task;
+        Node *next{nullptr};
+        std::int64_t postedNs{0}; ///< push 시각(steady ns), pushLocal 이면 0
+    };
+
+    /// producer 들이 push 하는 LIFO 목록의 head
+    std::atomic<Node *> head_{nullptr};
+
+    /// tryPop 이 떼어 와서 아직 다 꺼내지 않은 FIFO 목록 (consumer 전용)
+    Node *pending_{nullptr};
+
+    /// 재사용할 빈 노드 목록 (consumer 전용, 최대 kMaxFreeNodes 개)
+    static constexpr std::size_t kMaxFreeNodes = 1024;
+    Node *freeList_{nullptr};
+    std::size_t freeCount_{0};
+
+    void link_(Node *node) noexcept;
+
+    /// 실행이 끝난 노드를 비우고 free list 로 돌려 보냅니다. (가득 차면 해제)
+    void recycle_(Node *node) noexcept
+    {
+        node->task.reset();
+        if (freeCount_ >= kMaxFreeNodes)
+        {
+            delete node;
+            return;
+        }
+        node->next = freeList_;
+        freeList_ = node;
+        ++freeCount_;
+    }
+
+    /// pending_ 이 있으면 그것을, 없으면 head_ 를 통째로 떼어 FIFO 로 뒤집어 반환합니다.
+    Node *takeBatch_() noexcept;
 };
 
 } // namespace hypernet::core
@@ -3,42 +3,56 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
+#include <memory>
 #include <vector>
 
+#include <hypernet/util/InlineFunction.hpp>
 #include <hypernet/util/NonCopyable.hpp>
 
 namespace hypernet::core {
 
-/// coarse-grained 타이머 휠 구현입니다.
+/// coarse-grained 계층형(hierarchical) 타이머 휠 구현입니다.
 ///
 /// - 단일 스레드에서 사용된다는 가정 하에 설계되었습니다.
 ///   (보통 하나의 워커 스레드 / 이벤트 루프가 전담해서 tick()을 호출)
-/// - 시간은 고정된 tick 해상도(예: 10ms, 100ms)로 양자화되어 관리됩니다.
+/// - 시간은 고정된 tick 해상도(예: 100us, 10ms)로 양자화되어 관리됩니다. (Duration = µs)
 ///   - addTimer() 에 전달된 duration 은 tick 단위로 올림(ceil)되어 스케줄됩니다.
 ///   - 실제 콜백 실행 시점은 (요청한 duration) ~ (duration + tickResolution) 사이가 됩니다.
-/// - 현재 버전은 **one-shot 타이머**만 지원하며, cancel API 는 제공하지 않습니다.
-///   (TimerId 를 미리 도입하여 추후 cancelTimer(id) 를 추가할 수 있도록 설계)
+///
+/// ===== 구조 =====
+/// - level 0 : slotCount 개 슬롯(2의 거듭제곱으로 올림), 슬롯 1개 = 1 tick
+/// - level 1+: 64 슬롯씩, 슬롯 1개 = 아래 level 전체 범위. 해당 구간에 진입할 때 한 번만
+///   아래 level 로 내려보냅니다(cascade). 먼 미래 타이머를 wrap 마다 다시 훑지 않습니다.
+/// - 타이머 노드는 index 기반 intrusive 이중 연결 리스트로 슬롯에 매달리며,
+///   청크 단위로 할당해 재사용합니다. (주소 고정 → 콜백 실행 중 add 가 와도 안전)
+/// - 콜백은 노드 안에 inline 저장(InlineFunction)되므로 add/reschedule/cancel 이
+///   steady-state 에서 할당을 하지 않습니다.
+///
+/// ===== TimerId 규약 =====
+/// - TimerId = (generation << 32) | nodeIndex. 노드가 해제될 때 generation 이 올라가므로,
+///   이미 실행/취소된 id 로 cancelTimer()/reschedule() 을 호출하면 false 를 반환합니다.
+/// - 콜백 실행 중에 자기 자신의 id 로 reschedule() 하면 같은 노드(같은 콜백)가 다시
+///   예약됩니다. (주기 타이머를 할당 없이 구현하는 방법)
 class TimerWheel : private hypernet::util::NonCopyable {
   public:
     using Clock = std::chrono::steady_clock;
-    using Duration = std::chrono::milliseconds;
-    using Callback = std::function<void()>;
+    using Duration = std::chrono::microseconds; ///< ms 값은 암시적으로 변환됩니다.
+    using Callback = hypernet::util::InlineFunction<void(), 48>;
     using TimerId = std::uint64_t;
 
-    /// @param tickResolution 각 tick 이 의미하는 시간 (예: 10ms, 100ms). 0보다 커야 합니다.
-    /// @param slotCount 타이머 휠 슬롯 개수입니다. 0이면 std::invalid_argument 예외가 발생합니다.
-    ///
-    /// - slotCount 가 클수록 wheel wrap-around 주기가 길어지고, 매우 먼 미래 타이머가
-    ///   같은 슬롯에서 여러 번 검사를 덜 받게 됩니다(대신 메모리 사용량 증가).
+    static constexpr TimerId kInvalidTimerId = 0;
+
+    /// @param tickResolution 각 tick 이 의미하는 시간 (예: 100us, 10ms). 0보다 커야 합니다.
+    /// @param slotCount level 0 슬롯 개수입니다. 2의 거듭제곱으로 올림합니다.
+    ///        0이면 std::invalid_argument 예외가 발생합니다.
     explicit TimerWheel(Duration tickResolution, std::size_t slotCount);
 
-    ~TimerWheel() = default;
+    ~TimerWheel();
 
-    /// tick 해상도(ms 단위)를 반환합니다.
+    /// tick 해상도(µs 단위)를 반환합니다.
     [[nodiscard]] Duration tickResolution() const noexcept { return tickResolution_; }
 
-    /// 휠의 슬롯 개수를 반환합니다.
+    /// level 0 슬롯 개수를 반환합니다. (2의 거듭제곱)
     [[nodiscard]] std::size_t slotCount() const noexcept { return slotCount_; }
 
     /// 현재까지 진행된 tick 인덱스를 반환합니다.
@@ -49,6 +63,19 @@ class TimerWheel : private hypernet::util::NonCopyable {
     /// 현재 스케줄된(아직 실행되지 않은) 타이머 개수를 반환합니다.
     [[nodiscard]] std::size_t pendingTimers() const noexcept { return activeTimers_; }
 
+    /// 다음에 처리할 일이 있는 tick 까지 남은 tick 수를 반환합니다. (타이머가 없으면 0)
+    ///
+    /// - level 0 은 실제 만료 tick, level 1+ 는 해당 슬롯이 cascade 되는 tick(만료의 하한)입니다.
+    ///   하한에서 깨어나 cascade 한 뒤 다시 물으면 정확한 값이 나옵니다.
+    /// - 슬롯 점유 비트맵을 훑으므로 슬롯 수와 무관하게 level 당 몇 word 만 봅니다.
+    [[nodiscard]] std::uint64_t ticksUntilNextExpiry() const noexcept;
+
+    /// 다음 만료(또는 cascade) 시각을 반환합니다. (타이머가 없으면 Clock::time_point::max())
+    ///
+    /// - tick(now) 의 기준 시각(마지막으로 처리한 tick 경계)에서 계산하므로,
+    ///   이벤트 루프는 이 시각까지만 잠들면 tick 을 놓치지 않습니다.
+    [[nodiscard]] Clock::time_point nextDeadline() const noexcept;
+
     /// 지연 시간(delay) 이후에 한 번 실행될 타이머를 등록합니다.
     ///
     /// - delay 는 0 이상이어야 하며, tickResolution 보다 작더라도 최소 1 tick 뒤에 실행됩니다.
@@ -56,9 +83,21 @@ class TimerWheel : private hypernet::util::NonCopyable {
     /// - 콜백이 예외를 던지면 std::terminate 로 이어질 수 있으므로,
     ///   콜백 내부에서 예외를 처리하는 것을 권장합니다.
     ///
-    /// @return TimerId 예약된 타이머의 식별자입니다. (현재 버전에서는 cancel 등에 사용되지 않음)
+    /// @return TimerId 예약된 타이머의 식별자입니다. (cancelTimer/reschedule 에 사용)
     TimerId addTimer(Duration delay, Callback callback);
 
+    /// 예약된 타이머를 취소합니다. O(1)
+    ///
+    /// - 콜백 실행 중인 타이머를 취소하면 실행 후 재예약되지 않고 해제됩니다.
+    /// @return 해당 id 가 아직 살아 있었으면 true (이미 실행/취소됐으면 false)
+    bool cancelTimer(TimerId id) noexcept;
+
+    /// 타이머를 지금부터 delay 뒤로 다시 예약합니다. O(1), 할당 없음
+    ///
+    /// - 대기 중인 타이머는 만료 시점만 옮기고, 콜백 실행 중인 타이머는 다시 예약합니다.
+    /// @return 해당 id 가 아직 살아 있었으면 true (이미 실행/취소됐으면 false)
+    bool reschedule(TimerId id, Duration delay) noexcept;
+
     /// 한 tick 만큼 타이머 휠을 전진시키고, 만료된 타이머들의 콜백을 실행합니다.
     ///
     /// - 호출 시점이 실제 시간과 정확히 tickResolution 만큼 떨어져 있지 않아도 상관없고,
@@ -71,45 +110,96 @@ class TimerWheel : private hypernet::util::NonCopyable {
     ///
     /// - now 가 이전보다 tickResolution * N 만큼 증가했다면,
     ///   내부적으로 tick()을 N번 호출하는 것과 동일한 효과를 냅니다.
+    ///   (만료/cascade 할 슬롯이 없는 tick 구간은 슬롯을 훑지 않고 한 번에 건너뜁니다.
+    ///    µs 해상도에서 오래 잠들었다 깨어나도 비용이 경과 tick 수에 비례하지 않습니다)
     /// - 실제 이벤트 루프에서는 대략 다음과 같이 사용할 수 있습니다:
     ///   @code
     ///   TimerWheel wheel(10ms, 1024);
     ///   for (;;) {
     ///       auto now = TimerWheel::Clock::now();
     ///       wheel.tick(now);
-    ///       // epoll_wait(..., timeout=wheel.tickResolution());
+    ///       // epoll_pwait2(..., timeout=wheel.nextDeadline() - now); // max() 면 무한 대기
     ///   }
     ///   @endcode
     void tick(Clock::time_point now);
 
   private:
-    struct Timer {
-        TimerId id{};
-        std::uint64_t expirationTick{};
+    static constexpr std::uint32_t kNil = 0xFFFF'FFFFu;
+    static constexpr unsigned kUpperBits = 6; ///< level 1+ 슬롯 수 = 64
+    static constexpr std::size_t kUpperSlots = std::size_t{1} << kUpperBits;
+    static constexpr std::size_t kChunkBits = 8; ///< 노드 청크 = 256개
+    static constexpr std::size_t kChunkSize = std::size_t{1} << kChunkBits;
+
+    enum class NodeState : std::uint8_t {
+        Free = 0,
+        Pending,   ///< 슬롯에 연결되어 만료 대기
+        Firing,    ///< 콜백 실행 중 (실행 후 해제 예정)
+        Cancelled, ///< 콜백 실행 중 취소됨 (실행 후 해제)
+    };
+
+    struct Node {
+        std::uint64_t expirationTick{0};
+        std::uint32_t prev{kNil};
+        std::uint32_t next{kNil}; ///< Free 상태에서는 free list 링크
+        std::uint32_t bucket{kNil};
+        std::uint32_t generation{1};
+        NodeState state{NodeState::Free};
         Callback callback;
     };
 
     Duration tickResolution_;
     std::size_t slotCount_{0};
-    std::vector<std::vector<Timer>> slots_;
+    unsigned level0Bits_{0};
+    unsigned levels_{0};
+
+    /// level 0 (slotCount_) + level 1.. (64씩) 슬롯의 리스트 head (node index)
+    std::vector<std::uint32_t> buckets_;
+
+    /// 슬롯 점유 비트맵 (buckets_ 와 같은 순서, bit = 슬롯이 비어 있지 않음)
+    /// - level 0 이 64 미만이어도 word 1개, level 1+ 는 level 당 정확히 word 1개
+    std::vector<std::uint64_t> level0Occupied_;
+    std::vector<std::uint64_t> upperOccupied_;
+
+    std::vector<std::unique_ptr<Node[]>> chunks_;
+    std::uint32_t nodeCount_{0};
+    std::uint32_t freeHead_{kNil};
+    std::uint32_t firingIndex_{kNil}; ///< 콜백 실행 중인 노드
 
     Clock::time_point lastTickTime_{};
     std::uint64_t currentTick_{0};
-    TimerId nextId_{1};
     std::size_t activeTimers_{0};
 
-    // tick 처리 시 현재 슬롯의 타이머를 안전하게 옮겨 담기 위한 임시 버퍼입니다.
-    // - 콜백 실행 도중 addTimer()를 호출해도, 이미 가져온 타이머 목록이 깨지지 않도록
-    //   슬롯 벡터와 분리된 별도 컨테이너를 사용합니다.
-    std::vector<Timer> scratch_;
+    [[nodiscard]] Node &node_(std::uint32_t index) noexcept {
+        return chunks_[index >> kChunkBits][index & (kChunkSize - 1)];
+    }
 
-    /// Duration 을 tick 개수로 변환합니다. (올림(ceil) 처리)
-    [[nodiscard]] std::uint64_t durationToTicks(Duration delay) const noexcept;
+    /// id 가 가리키는 살아 있는 노드를 찾습니다. (없으면 nullptr)
+    [[nodiscard]] Node *lookup_(TimerId id, std::uint32_t &index) noexcept;
 
-    /// 새로운 TimerId 를 생성합니다. 0은 유효하지 않은 값으로 예약합니다.
-    [[nodiscard]] TimerId nextTimerId() noexcept;
+    [[nodiscard]] std::uint32_t allocNode_();
+    void freeNode_(std::uint32_t index) noexcept;
+
+    /// expirationTick 과 currentTick_ 의 차이로 level/slot 을 골라 연결합니다.
+    void link_(std::uint32_t index) noexcept;
+    void unlink_(std::uint32_t index) noexcept;
+
+    /// bucket 에 해당하는 점유 비트맵 word 를 반환합니다.
+    [[nodiscard]] std::uint64_t &occupiedWord_(std::size_t bucket) noexcept {
+        return bucket < slotCount_ ? level0Occupied_[bucket >> 6]
+                                   : upperOccupied_[(bucket - slotCount_) >> kUpperBits];
+    }
+    [[nodiscard]] std::uint64_t occupiedBit_(std::size_t bucket) const noexcept {
+        const std::size_t bit = bucket < slotCount_ ? bucket : bucket - slotCount_;
+        return std::uint64_t{1} << (bit & 63);
+    }
+
+    /// level 의 slot 에 매달린 노드를 모두 떼어 다시 배치합니다. (아래 level 로 내려감)
+    void cascade_(unsigned level, std::size_t slot) noexcept;
+
+    /// Duration 을 tick 개수로 변환합니다. (올림(ceil) 처리, 최소 1)
+    [[nodiscard]] std::uint64_t durationToTicks(Duration delay) const noexcept;
 
-    /// 하나의 tick 을 처리하면서, 만료된 타이머를 실행하고 나머지를 재배치합니다.
+    /// 하나의 tick 을 처리하면서, 만료된 타이머를 실행합니다.
     void processCurrentTick();
 };
 
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 #include <hypernet/core/Options.hpp>
 #include <hypernet/buffer/BufferPool.hpp>
 #include <hypernet/net/EventLoop.hpp>
@@ -19,7 +22,10 @@ class IApplication; // forward (앱 콜백 연결용)
 namespace hypernet::net
 {
 class Acceptor;
+class AcceptHandoff;
 class SessionManager;
+class SessionMigrator;
+class WorkerMesh;
 } // namespace hypernet::net
 
 namespace hypernet::core
@@ -36,6 +42,12 @@ class AppCallbackInvoker;
 /// - 다른 스레드가 워커에게 일을 시키려면 fd를 넘기지 말고 EventLoop::post로 "고수준 작업"만 전달.
 /// - onSessionStart/onSessionEnd 는 "세션 owner 워커 스레드"에서 직접 호출되어야 한다.
 /// - Engine main thread는 콜백을 호출하지 않고, 앱 포인터를 워커 컨텍스트로 주입만 한다.
+///
+/// ===== 스레드 수명 =====
+/// - initialize() 가 워커 스레드를 띄운다. 스레드는 WorkerOptions::placement(CPU 고정/NUMA/SCHED_FIFO)를
+///   먼저 적용하고 EventLoop/BufferPool/SessionManager 를 직접 만든 뒤 start() 를 기다린다.
+/// - start() 가 gate 를 열면 루프를 바인딩하고 리스너를 설치한 뒤 run 에 들어간다.
+/// - start() 없이 stop()/소멸되면 gate 를 false 로 열어 스레드를 그냥 끝낸다.
 class WorkerContext : private hypernet::util::NonCopyable
 {
   public:
@@ -61,6 +73,18 @@ class WorkerContext : private hypernet::util::NonCopyable
     {
         return appCallbacks_;
     }
+
+    /// 워커 간 handoff mesh 에 이 워커의 루프/SessionManager 를 연결합니다. (start() 전, main thread)
+    /// - inbound Packet descriptor 는 이 워커의 SessionManager::sendPacketU16 으로 송신됩니다.
+    void attachHandoffMesh(std::shared_ptr<hypernet::net::WorkerMesh> mesh) noexcept;
+
+    /// least_loaded steering 의 fd 전달 경로를 연결합니다. (start() 전, main thread)
+    /// - 워커 0 만 리스너를 열고 accept 한 fd 를 이 경로로 넘깁니다. 다른 워커는 리스너를 열지 않습니다.
+    void attachAcceptHandoff(std::shared_ptr<hypernet::net::AcceptHandoff> handoff) noexcept;
+
+    /// 워커 간 세션 이관 경로를 연결합니다. (start() 전, main thread)
+    /// - WorkerOptions::rebalance 가 켜져 있으면 워커 0 이 주기적으로 rebalance 를 판단합니다.
+    void attachSessionMigrator(std::shared_ptr<hypernet::net::SessionMigrator> migrator) noexcept;
     // Engine(main) thread에서 호출해도 안전 (실제 fd 작업은 owner worker에서 수행)
     void requestStopAccepting() noexcept;
     [[nodiscard]] std::size_t querySessionCountBlocking() noexcept;
@@ -112,6 +136,18 @@ class WorkerContext : private hypernet::util::NonCopyable
     std::uint32_t heartbeatIntervalMs{0};
     std::unique_ptr<hypernet::net::Acceptor> acceptor_;
     std::shared_ptr<AppCallbackInvoker> appCallbacks_;
+    std::shared_ptr<hypernet::net::WorkerMesh> handoffMesh_; ///< 루프가 참조하므로 수명 공유
+    std::shared_ptr<hypernet::net::AcceptHandoff> acceptHandoff_; ///< least_loaded steering (nullptr 이면 직접 accept)
+
+    // ===== reuseport steering (워커 0 의 리스너 스레드 전용) =====
+    std::vector<std::uint32_t> steeringWeights_; ///< 마지막으로 붙인 weighted 가중치
+    std::uint64_t steeringTimerId_{0};
+
+    // ===== 세션 rebalance (워커 0 전용) =====
+    std::shared_ptr<hypernet::net::SessionMigrator> migrator_; ///< nullptr 이면 이관 없음
+    std::uint64_t rebalanceTimerId_{0};
+    std::vector<std::uint64_t> rebalanceIdleNs_; ///< 직전 샘플의 워커별 idle(spin + block) 누적
+    std::chrono::steady_clock::time_point rebalanceSampledAt_{};
 
     // - 실제 콜백 호출은 SessionManager(owner thread)에서만 수행한다.
     std::shared_ptr<hypernet::IApplication> app_;
@@ -120,9 +156,24 @@ class WorkerContext : private hypernet::util::NonCopyable
     std::thread thread_;
     bool initialized_{false};
 
+    std::promise<bool> startGate_;  ///< start() 가 true 로 연다. (stop() 이 먼저면 false)
+    bool startGateReleased_{false}; ///< main thread 에서만 접근
+    std::future<bool> ready_;       ///< 리스너 설치 결과
+
+    void threadMain_(std::promise<void> built, std::future<bool> gate, std::promise<bool> ready) noexcept;
+    void applyPlacementInWorkerThread_() noexcept;
+
     // 1.리스닝 소켓 생성 및 EpollReactor에 등록
     [[nodiscard]] bool installListenerInWorkerThread_() noexcept;
     void cleanupListenerInWorkerThread_() noexcept;
+
+    /// 워커 0: reuseport 그룹에 steering cBPF 를 붙입니다. (cpu / weighted)
+    void applySteeringInWorkerThread_() noexcept;
+    /// 워커 0: 워커별 세션 수로 weighted 가중치를 다시 매기고, 바뀌었으면 프로그램을 교체합니다.
+    void refreshSteeringWeights_() noexcept;
+
+    /// 워커 0: 워커별 사용률을 샘플링해 차가 크면 바쁜 워커의 세션 하나를 한가한 워커로 옮깁니다.
+    void rebalanceSessions_() noexcept;
 };
 
 } // namespace hypernet::core
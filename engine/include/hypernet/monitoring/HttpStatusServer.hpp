@@ -13,12 +13,13 @@ namespace hypernet::monitoring
 {
 
 /// 별도 스레드에서 동작하는 초경량 HTTP 서버.
-/// - GET /metrics 만 지원 (Prometheus text exposition)
+/// - GET /metrics (Prometheus text exposition), GET /metrics/latency (지연 분위수 JSON) 만 지원
 /// - stop() 호출 시 wakeup pipe로 즉시 poll을 깨워 안전 종료
 class HttpStatusServer final : private hypernet::util::NonCopyable
 {
   public:
-    HttpStatusServer(std::string bindIp, std::uint16_t port) noexcept;
+    /// cpu >= 0 이면 서버 스레드를 그 CPU 에 고정합니다. (워커 코어를 피해 housekeeping 코어로)
+    HttpStatusServer(std::string bindIp, std::uint16_t port, int cpu = -1) noexcept;
     ~HttpStatusServer() noexcept;
 
     /// 서버 스레드 시작. 실패 시 false.
@@ -47,6 +48,7 @@ class HttpStatusServer final : private hypernet::util::NonCopyable
   private:
     std::string bindIp_;
     std::uint16_t port_{0};
+    int cpu_{-1};
 
     std::atomic_bool started_{false};
     std::atomic_bool stopRequested_{false};
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace hypernet::monitoring
+{
+
+/// 지연 측정에 쓰는 단조 시각(ns)입니다. (steady_clock: EventLoop::now() / TaskQueue 의 post 시각과 같은 시간축)
+[[nodiscard]] inline std::int64_t latencyNowNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/// 워커 1개가 기록하는 고정 메모리 log-linear 히스토그램입니다. (HDR histogram 과 같은 bucket 구조)
+///
+/// - 값(ns)을 2의 거듭제곱 구간으로 나누고 구간마다 kSubBuckets 개의 등간격 bucket 을 둡니다.
+///   → 상대 오차 1/kSubBuckets(6.25%) 이내로 0 ~ 2^36 ns(약 68초)를 528 개 bucket(약 4 KiB)에 담습니다.
+/// - writer 는 owner 워커 스레드 1개뿐이므로 RMW 없이 relaxed load/store 로 누적합니다.
+///   (x86 에서는 일반 mov 와 같음) 읽는 쪽(HTTP 스레드)은 언제든 snapshot 으로 복사해 갑니다.
+/// - 범위를 넘는 값은 마지막 bucket 에 세고, max 는 실제 값을 그대로 둡니다.
+class LatencyHistogram
+{
+  public:
+    static constexpr unsigned kSubBucketBits = 4;
+    static constexpr std::size_t kSubBuckets = std::size_t{1} << kSubBucketBits;
+    static constexpr unsigned kMaxValueBits = 36;
+    static constexpr std::size_t kBucketCount = kSubBuckets * (kMaxValueBits - kSubBucketBits + 1);
+
+    /// 읽는 쪽에서 쓰는 복사본입니다. (워커 합산은 merge)
+    struct Snapshot
+    {
+        std::array<std::uint64_t, kBucketCount> counts{};
+        std::uint64_t count{0}; ///< bucket 합 (백분위 계산 기준)
+        std::uint64_t sumNs{0};
+        std::uint64_t maxNs{0};
+
+        void merge(const Snapshot &other) noexcept
+        {
+            for (std::size_t i = 0; i < kBucketCount; ++i)
+            {
+                counts[i] += other.counts[i];
+            }
+            count += other.count;
+            sumNs += other.sumNs;
+            maxNs = std::max(maxNs, other.maxNs);
+        }
+
+        /// q(0~1) 분위수(ns)입니다. 해당 bucket 의 상한으로 보고하되 max 를 넘지 않습니다. (비어 있으면 0)
+        [[nodiscard]] std::uint64_t percentile(double q) const noexcept
+        {
+            if (count == 0)
+            {
+                return 0;
+            }
+            const double clamped = std::clamp(q, 0.0, 1.0);
+            const auto rank = std::max<std::uint64_t>(
+                1, static_cast<std::uint64_t>(std::ceil(clamped * static_cast<double>(count))));
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i < kBucketCount; ++i)
+            {
+                seen += counts[i];
+                if (seen >= rank)
+                {
+                    return std::min(bucketUpperBound(i), maxNs);
+                }
+            }
+            return maxNs;
+        }
+
+        /// bound(ns) 미만으로 기록된 개수입니다. (bound 가 bucket 경계일 때 정확: 2의 거듭제곱 등)
+        [[nodiscard]] std::uint64_t countBelow(std::uint64_t bound) const noexcept
+        {
+            const std::size_t end = bound >= (std::uint64_t{1} << kMaxValueBits) ? kBucketCount : bucketIndex(bound);
+            std::uint64_t n = 0;
+            for (std::size_t i = 0; i < end; ++i)
+            {
+                n += counts[i];
+            }
+            return n;
+        }
+    };
+
+    /// 값 하나를 기록합니다. (owner 워커 전용, 음수는 0 으로)
+    void record(std::int64_t ns) noexcept
+    {
+        const std::uint64_t v = ns > 0 ? static_cast<std::uint64_t>(ns) : 0;
+        bump_(counts_[bucketIndex(v)], 1);
+        bump_(count_, 1);
+        bump_(sum_, v);
+        if (v > max_.load(std::memory_order_relaxed))
+        {
+            max_.store(v, std::memory_order_relaxed);
+        }
+    }
+
+    /// 현재 값을 out 에 복사합니다. (아무 스레드, writer 와 동시에 읽으면 bucket 간 순간 불일치는 허용)
+    void snapshotInto(Snapshot &out) const noexcept
+    {
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < kBucketCount; ++i)
+        {
+            out.counts[i] = counts_[i].load(std::memory_order_relaxed);
+            total += out.counts[i];
+        }
+        out.count = total;
+        out.sumNs = sum_.load(std::memory_order_relaxed);
+        out.maxNs = max_.load(std::memory_order_relaxed);
+    }
+
+    /// 기록한 개수입니다. (bucket 합과 순간적으로 다를 수 있음)
+    [[nodiscard]] std::uint64_t count() const noexcept { return count_.load(std::memory_order_relaxed); }
+
+    void reset() noexcept
+    {
+        for (auto &c : counts_)
+        {
+            c.store(0, std::memory_order_relaxed);
+        }
+        count_.store(0, std::memory_order_relaxed);
+        sum_.store(0, std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+    /// v 가 들어갈 bucket 번호입니다.
+    /// - v < kSubBuckets: v 그대로 (1ns 단위)
+    /// - 그 밖: 최상위 비트 위치로 구간을, 그 아래 kSubBucketBits 비트로 구간 안 bucket 을 고릅니다.
+    [[nodiscard]] static constexpr std::size_t bucketIndex(std::uint64_t v) noexcept
+    {
+        if (v < kSubBuckets)
+        {
+            return static_cast<std::size_t>(v);
+        }
+        const unsigned msb = 63u - static_cast<unsigned>(std::countl_zero(v));
+        if (msb >= kMaxValueBits)
+        {
+            return kBucketCount - 1;
+        }
+        const unsigned shift = msb - kSubBucketBits;
+        return (shift + 1) * kSubBuckets + static_cast<std::size_t>((v >> shift) & (kSubBuckets - 1));
+    }
+
+    /// bucket 에 들어가는 가장 작은 값입니다.
+    [[nodiscard]] static constexpr std::uint64_t bucketLowerBound(std::size_t idx) noexcept
+    {
+        if (idx < kSubBuckets)
+        {
+            return idx;
+        }
+        const std::size_t shift = idx / kSubBuckets - 1;
+        return static_cast<std::uint64_t>(kSubBuckets + idx % kSubBuckets) << shift;
+    }
+
+    /// bucket 에 들어가는 가장 큰 값입니다. (마지막 bucket 은 범위 밖 값도 받지만 표시는 구간 상한)
+    [[nodiscard]] static constexpr std::uint64_t bucketUpperBound(std::size_t idx) noexcept
+    {
+        if (idx < kSubBuckets)
+        {
+            return idx;
+        }
+        const std::size_t shift = idx / kSubBuckets - 1;
+        return bucketLowerBound(idx) + (std::uint64_t{1} << shift) - 1;
+    }
+
+  private:
+    static void bump_(std::atomic<std::uint64_t> &c, std::uint64_t v) noexcept
+    {
+        c.store(c.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<std::uint64_t>, kBucketCount> counts_{};
+    std::atomic<std::uint64_t> count_{0};
+    std::atomic<std::uint64_t> sum_{0};
+    std::atomic<std::uint64_t> max_{0};
+};
+
+static_assert(LatencyHistogram::bucketIndex(LatencyHistogram::kSubBuckets) == LatencyHistogram::kSubBuckets);
+static_assert(LatencyHistogram::bucketLowerBound(LatencyHistogram::bucketIndex(1000)) <= 1000 &&
+              LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(1000)) >= 1000);
+static_assert(LatencyHistogram::bucketIndex((std::uint64_t{1} << LatencyHistogram::kMaxValueBits) - 1) ==
+              LatencyHistogram::kBucketCount - 1);
+
+} // namespace hypernet::monitoring
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <hypernet/core/ThreadContext.hpp>
+#include <hypernet/monitoring/LatencyHistogram.hpp>
+
+#include <array>
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -20,38 +25,179 @@ struct EngineMetricsSnapshot
     std::uint64_t connectorFailureTotal = 0;
 };
 
+/// 워커별 메시지/연결/오류 카운터입니다. (엔진 합계는 읽을 때 워커 shard 를 더해서 만듦)
+/// - writer 는 해당 워커 스레드 1개뿐이므로 RMW 대신 relaxed load/store 로 누적합니다.
+/// - 워커마다 cache line 을 따로 써서, 메시지 경로에서 코어 간 line 이동(false sharing)이 없습니다.
+/// - 워커가 아닌 스레드의 갱신은 EngineMetrics 의 공용 shard 에 fetch_add 로 들어갑니다.
+struct alignas(64) WorkerCoreMetrics
+{
+    std::atomic<std::int64_t> connections{0}; ///< 이 워커가 연 세션 - 닫은 세션
+    std::atomic<std::uint64_t> rxMessagesTotal{0};
+    std::atomic<std::uint64_t> txMessagesTotal{0};
+    std::atomic<std::uint64_t> errorsTotal{0};
+    std::atomic<std::uint64_t> acceptedTotal{0}; ///< 리스너로 받아 이 워커에서 연 세션 (connector 제외)
+    std::atomic<std::uint64_t> migratedInTotal{0}; ///< 다른 워커에서 옮겨 온 세션
+};
+
+/// 워커 EventLoop 의 polling 시간 통계입니다.
+/// - writer 는 해당 워커 스레드 1개뿐이므로 RMW 대신 relaxed load/store 로 누적합니다.
+/// - spin/(spin+block) 비율로 "CPU 를 얼마나 태워 지연을 샀는지"를 판단합니다.
+struct alignas(64) WorkerLoopMetrics
+{
+    std::atomic<bool> active{false};
+    std::atomic<std::uint64_t> spinNsTotal{0};  ///< timeout=0 폴링이 이벤트 없이 돌아온 시간
+    std::atomic<std::uint64_t> blockNsTotal{0}; ///< 블로킹 대기(timeout>0)에 머문 시간
+    std::atomic<long> tid{0};                   ///< 워커 스레드의 커널 tid (scrape 때 page fault 수를 /proc 에서 읽음)
+
+    static void add(std::atomic<std::uint64_t> &c, std::uint64_t v) noexcept
+    {
+        c.store(c.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+    }
+};
+
+/// 워커 SessionPool 점유 통계입니다. (writer 는 해당 워커 스레드 1개, 값은 스냅샷으로 덮어씀)
+/// - ringsInUse 만 예외: 세션이 다른 스레드에서 파괴될 수 있어 fetch_add/fetch_sub 로 갱신합니다.
+struct alignas(64) WorkerSessionPoolMetrics
+{
+    std::atomic<std::uint64_t> idleSessions{0};       ///< 보관 중인 세션 슬롯
+    std::atomic<std::uint64_t> idleRings{0};          ///< 보관 중인 송수신 링
+    std::atomic<std::uint64_t> sessionHitsTotal{0};   ///< 풀에서 꺼낸 세션 슬롯 누적
+    std::atomic<std::uint64_t> sessionMissesTotal{0}; ///< 풀이 비어 새로 할당한 세션 슬롯 누적
+    std::atomic<std::uint64_t> ringHitsTotal{0};
+    std::atomic<std::uint64_t> ringMissesTotal{0};
+    std::atomic<std::uint64_t> ringsInUse{0};         ///< 세션이 들고 있는 송수신 링 (증감 갱신)
+    std::atomic<std::uint64_t> ringReclaimsTotal{0};  ///< idle 회수로 풀에 돌아간 링 누적
+
+    static void set(std::atomic<std::uint64_t> &c, std::uint64_t v) noexcept
+    {
+        c.store(v, std::memory_order_relaxed);
+    }
+};
+
+/// 워커 송신 overflow 큐 통계입니다. (writer 는 해당 워커 스레드 1개)
+struct alignas(64) WorkerSendQueueMetrics
+{
+    std::atomic<std::uint64_t> overflowBytes{0};          ///< 송신 링을 넘어 overflow 큐에 대기 중인 바이트
+    std::atomic<std::uint64_t> congestedSessions{0};      ///< high watermark 를 넘은 세션 수
+    std::atomic<std::uint64_t> backpressureEventsTotal{0}; ///< high watermark 도달 누적
+    std::atomic<std::uint64_t> limitClosesTotal{0};       ///< 송신 대기 상한 초과로 닫힌 세션 누적
+    std::atomic<std::uint64_t> heapBlocksTotal{0};        ///< 블록 풀 고갈로 힙에서 꺼낸 overflow 블록 누적
+};
+
+/// 워커 엔진 내부 지연 히스토그램입니다. (writer 는 해당 워커 스레드 1개, 단위 ns)
+/// - 히스토그램 4개(약 17 KiB)라 고정 배열 대신 워커가 처음 쓸 때 할당합니다.
+struct alignas(64) WorkerLatencyMetrics
+{
+    LatencyHistogram dispatchDelay;  ///< reactor wait 반환 → fd handler 호출
+    LatencyHistogram taskQueueDelay; ///< 다른 스레드의 post → 이 워커에서 실행
+    LatencyHistogram sendCompletion; ///< 메시지 dispatch 시작 → 응답 바이트를 커널에 넘김 (sendmsg/SEND 완료)
+    LatencyHistogram loopIteration;  ///< 일을 한 runOnce 1회에서 reactor 대기를 뺀 시간
+
+    void reset() noexcept
+    {
+        dispatchDelay.reset();
+        taskQueueDelay.reset();
+        sendCompletion.reset();
+        loopIteration.reset();
+    }
+};
+
 class EngineMetrics
 {
   public:
     EngineMetrics() = default;
+    ~EngineMetrics();
     EngineMetrics(const EngineMetrics &) = delete;
     EngineMetrics &operator=(const EngineMetrics &) = delete;
 
+    static constexpr std::size_t kMaxWorkerSlots = 256;
+
     void reset() noexcept
     {
-        currentConnections_.store(0, std::memory_order_relaxed);
-        rxMessagesTotal_.store(0, std::memory_order_relaxed);
-        txMessagesTotal_.store(0, std::memory_order_relaxed);
-        errorsTotal_.store(0, std::memory_order_relaxed);
+        resetCore_(sharedCore_);
+        for (auto &c : workerCores_)
+        {
+            resetCore_(c);
+        }
 
         connectorPending_.store(0, std::memory_order_relaxed);
         connectorTotal_.store(0, std::memory_order_relaxed);
         connectorSuccessTotal_.store(0, std::memory_order_relaxed);
         connectorTimeoutTotal_.store(0, std::memory_order_relaxed);
         connectorFailureTotal_.store(0, std::memory_order_relaxed);
+
+        for (auto &w : workerLoops_)
+        {
+            w.active.store(false, std::memory_order_relaxed);
+            w.tid.store(0, std::memory_order_relaxed);
+            w.spinNsTotal.store(0, std::memory_order_relaxed);
+            w.blockNsTotal.store(0, std::memory_order_relaxed);
+        }
+        for (auto &p : sessionPools_)
+        {
+            p.idleSessions.store(0, std::memory_order_relaxed);
+            p.idleRings.store(0, std::memory_order_relaxed);
+            p.sessionHitsTotal.store(0, std::memory_order_relaxed);
+            p.sessionMissesTotal.store(0, std::memory_order_relaxed);
+            p.ringHitsTotal.store(0, std::memory_order_relaxed);
+            p.ringMissesTotal.store(0, std::memory_order_relaxed);
+            p.ringsInUse.store(0, std::memory_order_relaxed);
+            p.ringReclaimsTotal.store(0, std::memory_order_relaxed);
+        }
+        for (auto &q : sendQueues_)
+        {
+            q.overflowBytes.store(0, std::memory_order_relaxed);
+            q.congestedSessions.store(0, std::memory_order_relaxed);
+            q.backpressureEventsTotal.store(0, std::memory_order_relaxed);
+            q.limitClosesTotal.store(0, std::memory_order_relaxed);
+            q.heapBlocksTotal.store(0, std::memory_order_relaxed);
+        }
+        for (auto &l : latencies_)
+        {
+            if (WorkerLatencyMetrics *m = l.load(std::memory_order_acquire))
+            {
+                m->reset();
+            }
+        }
+    }
+
+    /// 워커별 메시지/연결 카운터 슬롯입니다. (범위를 벗어나면 nullptr)
+    const WorkerCoreMetrics *workerCore(unsigned int workerId) const noexcept
+    {
+        return workerId < kMaxWorkerSlots ? &workerCores_[workerId] : nullptr;
+    }
+
+    /// 워커별 polling 통계 슬롯입니다. (범위를 벗어나면 nullptr)
+    WorkerLoopMetrics *workerLoop(unsigned int workerId) noexcept
+    {
+        return workerId < kMaxWorkerSlots ? &workerLoops_[workerId] : nullptr;
     }
 
-    void onConnectionOpened() noexcept
+    /// 워커별 SessionPool 통계 슬롯입니다. (범위를 벗어나면 nullptr, 출력은 workerLoop 가 active 인 워커만)
+    WorkerSessionPoolMetrics *workerSessionPool(unsigned int workerId) noexcept
     {
-        currentConnections_.fetch_add(1, std::memory_order_relaxed);
+        return workerId < kMaxWorkerSlots ? &sessionPools_[workerId] : nullptr;
     }
-    void onConnectionClosed() noexcept
+
+    /// 워커별 송신 overflow 큐 통계 슬롯입니다. (범위를 벗어나면 nullptr)
+    WorkerSendQueueMetrics *workerSendQueue(unsigned int workerId) noexcept
     {
-        currentConnections_.fetch_sub(1, std::memory_order_relaxed);
+        return workerId < kMaxWorkerSlots ? &sendQueues_[workerId] : nullptr;
     }
-    void onRxMessage() noexcept { rxMessagesTotal_.fetch_add(1, std::memory_order_relaxed); }
-    void onTxMessage() noexcept { txMessagesTotal_.fetch_add(1, std::memory_order_relaxed); }
-    void onError() noexcept { errorsTotal_.fetch_add(1, std::memory_order_relaxed); }
+
+    /// 워커별 지연 히스토그램입니다. 처음 호출할 때 할당하고 프로세스 끝까지 유지합니다.
+    /// (범위를 벗어나거나 할당에 실패하면 nullptr → 호출자는 기록하지 않음)
+    WorkerLatencyMetrics *workerLatency(unsigned int workerId) noexcept;
+
+    // 호출 스레드의 워커 shard 에 누적합니다. (워커가 아니면 공용 shard)
+    void onConnectionOpened() noexcept { count_(&WorkerCoreMetrics::connections, std::int64_t{1}); }
+    void onConnectionClosed() noexcept { count_(&WorkerCoreMetrics::connections, std::int64_t{-1}); }
+    void onRxMessage() noexcept { count_(&WorkerCoreMetrics::rxMessagesTotal, std::uint64_t{1}); }
+    void onRxMessages(std::uint64_t n) noexcept { count_(&WorkerCoreMetrics::rxMessagesTotal, n); }
+    void onTxMessage() noexcept { count_(&WorkerCoreMetrics::txMessagesTotal, std::uint64_t{1}); }
+    void onError() noexcept { count_(&WorkerCoreMetrics::errorsTotal, std::uint64_t{1}); }
+    void onSessionAccepted() noexcept { count_(&WorkerCoreMetrics::acceptedTotal, std::uint64_t{1}); }
+    void onSessionMigratedIn() noexcept { count_(&WorkerCoreMetrics::migratedInTotal, std::uint64_t{1}); }
 
     void onConnectorTotal() noexcept { connectorTotal_.fetch_add(1, std::memory_order_relaxed); }
     void onConnectorPendingInc() noexcept
@@ -78,11 +224,35 @@ class EngineMetrics
     EngineMetricsSnapshot snapshot() const noexcept;
     std::string toPrometheusText() const;
 
+    /// 워커별/전체 지연 분위수(p50/p99/p99.9/max, ns)를 JSON 으로 만듭니다.
+    std::string toLatencyJson() const;
+
   private:
-    std::atomic<std::int64_t> currentConnections_{0};
-    std::atomic<std::uint64_t> rxMessagesTotal_{0};
-    std::atomic<std::uint64_t> txMessagesTotal_{0};
-    std::atomic<std::uint64_t> errorsTotal_{0};
+    template <typename T> void count_(std::atomic<T> WorkerCoreMetrics::*field, T n) noexcept
+    {
+        const int wid = hypernet::core::ThreadContext::currentWorkerId();
+        if (wid >= 0 && static_cast<std::size_t>(wid) < kMaxWorkerSlots)
+        {
+            std::atomic<T> &c = workerCores_[static_cast<std::size_t>(wid)].*field;
+            c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+            return;
+        }
+        (sharedCore_.*field).fetch_add(n, std::memory_order_relaxed);
+    }
+
+    static void resetCore_(WorkerCoreMetrics &c) noexcept
+    {
+        c.connections.store(0, std::memory_order_relaxed);
+        c.rxMessagesTotal.store(0, std::memory_order_relaxed);
+        c.txMessagesTotal.store(0, std::memory_order_relaxed);
+        c.errorsTotal.store(0, std::memory_order_relaxed);
+        c.acceptedTotal.store(0, std::memory_order_relaxed);
+        c.migratedInTotal.store(0, std::memory_order_relaxed);
+    }
+
+    // message path (워커 shard + 비워커 스레드용 공용 shard)
+    std::array<WorkerCoreMetrics, kMaxWorkerSlots> workerCores_{};
+    WorkerCoreMetrics sharedCore_{};
 
     // connector
     std::atomic<std::int64_t> connectorPending_{0};
@@ -90,6 +260,11 @@ class EngineMetrics
     std::atomic<std::uint64_t> connectorSuccessTotal_{0};
     std::atomic<std::uint64_t> connectorTimeoutTotal_{0};
     std::atomic<std::uint64_t> connectorFailureTotal_{0};
+
+    std::array<WorkerLoopMetrics, kMaxWorkerSlots> workerLoops_{};
+    std::array<WorkerSessionPoolMetrics, kMaxWorkerSlots> sessionPools_{};
+    std::array<WorkerSendQueueMetrics, kMaxWorkerSlots> sendQueues_{};
+    std::array<std::atomic<WorkerLatencyMetrics *>, kMaxWorkerSlots> latencies_{};
 };
 
 EngineMetrics &engineMetrics() noexcept;
@@ -76,6 +76,8 @@ class Acceptor final : private hypernet::util::NonCopyable, public IFdHandler {
                                  PeerEndpoint &out) noexcept;
 
     void onReadable_();
+    void onAcceptCompleted_(EventLoop &loop, const EpollReactor::ReadyEvent &ev) noexcept;
+    void deliverAccepted_(Socket &&client, const PeerEndpoint &peer) noexcept;
     void onError_(EventLoop &loop, const EpollReactor::ReadyEvent &ev) noexcept;
 };
 
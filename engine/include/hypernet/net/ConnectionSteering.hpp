@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <linux/filter.h>
+
+#include <hypernet/net/Acceptor.hpp>
+#include <hypernet/net/Socket.hpp>
+#include <hypernet/util/NonCopyable.hpp>
+
+namespace hypernet::net
+{
+
+class EventLoop;
+class SessionManager;
+
+/// reuseport 그룹에 붙이는 classic BPF 프로그램입니다.
+/// - 반환값은 그룹 안 리스너 index(= bind 순서 = 워커 id)이고, 범위를 벗어나면 커널 해시 선택으로 폴백합니다.
+using ReuseportProgram = std::vector<::sock_filter>;
+
+/// SYN 을 받은 CPU 에 고정된 워커의 리스너를 고르는 프로그램을 만듭니다.
+/// @param listenerCpus 리스너 index 순서의 고정 CPU (-1 이면 고정 안 됨)
+/// - 고정된 워커가 하나도 없으면 cpu % listenerCpus.size() 로 고릅니다.
+/// - 어느 워커에도 고정되지 않은 CPU 에서 온 SYN 은 커널 해시로 갑니다.
+[[nodiscard]] ReuseportProgram buildIncomingCpuProgram(const std::vector<int> &listenerCpus);
+
+/// weights[i] 비율로 리스너 i 를 무작위로 고르는 프로그램을 만듭니다. (합이 0 이면 균등)
+[[nodiscard]] ReuseportProgram buildWeightedProgram(const std::vector<std::uint32_t> &weights);
+
+/// 워커별 현재 세션 수로 가중치를 만듭니다. w_i = 1 + (max - load_i)
+/// - 고르게 차 있으면 균등, 덜 찬 워커일수록 그 차이만큼 새 연결을 더 받습니다.
+[[nodiscard]] std::vector<std::uint32_t> steeringWeights(const std::vector<std::int64_t> &loads);
+
+/// fd 가 속한 reuseport 그룹의 프로그램을 붙이거나 교체합니다. (SO_ATTACH_REUSEPORT_CBPF, 실패 시 errno)
+[[nodiscard]] int attachReuseportProgram(int fd, const ReuseportProgram &prog) noexcept;
+
+/// SteeringMode::LeastLoaded 에서 accept 워커가 client fd 를 다른 워커로 넘기는 경로입니다.
+///
+/// - 대상은 "세션 수 + 넘기는 중인 fd 수" 가 가장 적은 워커입니다. (동률이면 돌아가며)
+/// - 다른 워커로는 EventLoop::post(task) 로 넘기고, 대상 워커 스레드가 SessionManager::onAccepted 를 부릅니다.
+///   → fd 의 epoll/io_uring 등록과 이후 I/O 는 전부 대상 워커에서 일어나므로 소유 규약은 그대로입니다.
+class AcceptHandoff : private hypernet::util::NonCopyable
+{
+  public:
+    explicit AcceptHandoff(std::size_t workerCount);
+
+    [[nodiscard]] std::size_t workerCount() const noexcept { return count_; }
+
+    /// 워커의 루프/SessionManager 를 연결합니다. (워커 스레드 시작 전, main thread)
+    void attach(unsigned int wid, EventLoop *loop, SessionManager *sessions) noexcept;
+
+    /// 다음 연결을 받을 워커입니다. (accept 워커 스레드 전용)
+    [[nodiscard]] unsigned int pick() noexcept;
+
+    /// client 를 pick() 한 워커의 SessionManager::onAccepted 로 넘깁니다. (accept 워커 스레드 전용)
+    /// - 대상이 자기 자신이면 accept 워커에서 바로 처리합니다. post 에 실패하면(할당 실패) 연결을 닫습니다.
+    void dispatch(unsigned int fromWid, Socket &&client, const Acceptor::PeerEndpoint &peer) noexcept;
+
+  private:
+    struct alignas(64) Target
+    {
+        EventLoop *loop{nullptr};
+        SessionManager *sessions{nullptr};
+        std::atomic<std::int64_t> inFlight{0}; ///< post 했지만 아직 onAccepted 전인 fd 수
+    };
+
+    /// 대상 워커 스레드에서 세션을 엽니다.
+    static void deliver_(Target &t, Socket &&client, const Acceptor::PeerEndpoint &peer) noexcept;
+
+    std::size_t count_{0};
+    std::unique_ptr<Target[]> targets_;
+    std::size_t cursor_{0}; ///< 동률일 때 다음 탐색 시작점 (accept 워커 전용)
+};
+
+} // namespace hypernet::net
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <span>
 #include <unordered_map>
@@ -34,12 +35,29 @@ class EpollReactor : private hypernet::util::NonCopyable
         OneShot = EPOLLONESHOT,
     };
 
+    /// completion 기반 백엔드(io_uring)에서 ReadyEvent 가 담고 있는 완료 종류입니다.
+    /// - epoll 백엔드는 항상 None(readiness 이벤트)만 전달합니다.
+    enum class Completion : std::uint8_t
+    {
+        None = 0,
+        Accept,
+        Recv,
+        Send,
+    };
+
     /// epoll_wait 결과를 엔진 코드에 전달하기 위한 구조체입니다.
     struct ReadyEvent
     {
         Fd fd{-1};
         std::uint32_t events{0}; ///< EPOLLIN | EPOLLOUT | EPOLLET ... 의 비트 OR
         void *userData{nullptr}; ///< registerFd/modifyFd 에서 등록한 포인터 (nullable)
+
+        // ===== completion 필드 (io_uring 백엔드 전용, epoll 에서는 기본값) =====
+        Completion completion{Completion::None};
+        bool more{false};        ///< multishot 요청이 계속 유효한지(IORING_CQE_F_MORE)
+        std::int32_t result{0};  ///< CQE res (Accept: 새 fd, Recv/Send: 바이트 수, 음수면 -errno)
+        const std::byte *data{nullptr}; ///< Recv: 수신 데이터. 다음 wait() 호출 전까지만 유효
+        std::uint32_t generation{0};    ///< 등록 세대(같은 배치 안에서 fd 재사용 판별용)
     };
 
     /// @param maxEvents 한 번의 wait() 에서 처리할 최대 이벤트 개수 힌트입니다.
@@ -68,8 +86,12 @@ class EpollReactor : private hypernet::util::NonCopyable
         return mask;
     }
 
-    bool registerFd(Fd fd, std::uint32_t events) noexcept;
-    bool modifyFd(Fd fd, std::uint32_t events) noexcept;
+    /// fd 를 epoll 에 등록합니다. (EPOLL_CTL_ADD)
+    ///
+    /// - generation 은 epoll_event.data 의 상위 32bit 에 실려 ReadyEvent::generation 으로
+    ///   그대로 돌아옵니다. (같은 fd 의 이전 등록에서 온 지연 이벤트 판별용)
+    bool registerFd(Fd fd, std::uint32_t events, std::uint32_t generation = 0) noexcept;
+    bool modifyFd(Fd fd, std::uint32_t events, std::uint32_t generation = 0) noexcept;
 
     /// fd 를 epoll 인스턴스에서 제거합니다. (EPOLL_CTL_DEL)
     ///
@@ -85,7 +107,18 @@ class EpollReactor : private hypernet::util::NonCopyable
     /// @return
     ///   - >= 0 : 준비된 이벤트 개수 (0 이면 타임아웃)
     ///   - -1   : 오류 (errno 확인). EINTR 인 경우 DEBUG 로그만 남기고 -1 반환.
-    int wait(ReadyEvent *outEvents, int maxEvents, int timeoutMs) noexcept;
+    int wait(ReadyEvent *outEvents, int maxEvents, int timeoutMs) noexcept
+    {
+        return waitNs(outEvents, maxEvents,
+                      timeoutMs < 0 ? -1 : static_cast<std::int64_t>(timeoutMs) * 1'000'000);
+    }
+
+    /// ns 단위 타임아웃 버전입니다. (-1 무한 대기, 0 폴링)
+    ///
+    /// - 양수 타임아웃은 epoll_pwait2 로 µs 정밀도까지 기다립니다.
+    /// - epoll_pwait2 를 못 쓰는 커널(ENOSYS)/seccomp(EPERM) 이면 한 번 경고 후 ms 로
+    ///   올림(ceil)해서 epoll_wait 을 씁니다. (일찍 깨어 헛도는 것을 막기 위해 올림)
+    int waitNs(ReadyEvent *outEvents, int maxEvents, std::int64_t timeoutNs) noexcept;
 
     /// std::span 버전의 wait 헬퍼입니다.
     int wait(std::span<ReadyEvent> events, int timeoutMs) noexcept
@@ -104,6 +137,7 @@ class EpollReactor : private hypernet::util::NonCopyable
     Fd epollFd_{-1};
     int maxEvents_{0};
     std::vector<::epoll_event> eventBuffer_; ///< epoll_wait 용 임시 버퍼 (재사용)
+    bool pwait2Unsupported_{false};          ///< epoll_pwait2 실패 후 ms 폴백 중
 };
 
 /// Event 비트 OR 연산자.
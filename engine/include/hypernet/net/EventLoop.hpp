@@ -1,5 +1,6 @@
 #pragma once
 
+#include <hypernet/core/Options.hpp>
 #include <hypernet/core/TaskQueue.hpp>
 #include <hypernet/core/TimerWheel.hpp>
 #include <hypernet/net/EpollReactor.hpp>
@@ -9,20 +10,36 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <thread>
-#include <unordered_map>
 #include <vector>
 
+#include <sys/uio.h>
+
+namespace hypernet::monitoring
+{
+struct WorkerLoopMetrics;
+struct WorkerLatencyMetrics;
+}
+
 namespace hypernet::net
 {
 
+class IoUringReactor;
+class WorkerMesh;
+
 class EventLoop : private hypernet::util::NonCopyable
 {
   public:
     using Duration = core::TimerWheel::Duration;
 
     EventLoop(Duration tickResolution, std::size_t timerSlots, int maxEpollEvents = 64);
+
+    /// 백엔드 선택을 포함한 생성자입니다.
+    /// - options.backend == IoUring 이면 IoUringReactor 를 시도하고, 실패 시 epoll 로 폴백합니다.
+    EventLoop(Duration tickResolution, std::size_t timerSlots,
+              const core::EventLoopOptions &options);
     ~EventLoop();
 
     // 1.새로 생성되는 워커스레드가 해당 이벤트 루프 소유자로 등록됨
@@ -36,9 +53,75 @@ class EventLoop : private hypernet::util::NonCopyable
     bool updateFd(int fd, std::uint32_t events) noexcept;
     bool removeFd(int fd) noexcept;
 
+    /// 작업을 이 루프(owner thread)에서 실행하도록 넘깁니다. (Thread-Safe)
+    /// - mesh 가 연결되어 있고 호출자가 다른 워커 스레드이면 그 워커→이 워커 전용 SPSC 채널로,
+    ///   그 밖(메인/외부 스레드, 자기 자신)은 공유 TaskQueue 로 넣습니다.
+    /// - task 는 move-only 입니다. capture 가 core::kTaskInlineBytes 안이면 owner thread 자신과
+    ///   다른 워커에서의 post 는 steady-state 에서 할당이 없습니다.
     void post(core::TaskQueue::Task task);
 
+    /// 다른 스레드에서 루프를 즉시 깨웁니다. (runningFlag 변경 등, 태스크 없이 깨워야 할 때)
+    /// - 루프는 타이머가 없으면 무한 대기하므로, 종료 요청 후 반드시 호출해야 합니다.
+    void wakeup() noexcept { signalWakeup_(); }
+
+    /// 워커 간 handoff mesh 를 연결합니다. (워커 스레드 시작 전, nullptr 이면 해제)
+    /// - 루프는 매 drainTasks 마다 mesh 의 inbound 채널을 poll 하고, 잠들기 전에 다시 확인합니다.
+    void attachMesh(WorkerMesh *mesh, int workerId) noexcept
+    {
+        mesh_ = mesh;
+        meshWorkerId_ = workerId;
+    }
+
+    /// 다른 워커가 inbound 채널에 descriptor 를 넣은 뒤 호출합니다. (잠들어 있을 때만 eventfd 를 씀)
+    void notifyInbound() noexcept;
+
+    /// 이번 iteration 에서 poll 이 끝난 시각(캐시)입니다. (owner thread 전용)
+    /// - handler/타이머 콜백은 clock 을 다시 읽지 말고 이 값을 씁니다. (idle 판정, RX 시각 등)
+    [[nodiscard]] core::TimerWheel::Clock::time_point now() const noexcept { return now_; }
+
     core::TimerWheel::TimerId addTimer(Duration delay, core::TimerWheel::Callback cb);
+    /// 예약된 타이머 취소 / 재예약 (O(1), 할당 없음). 이미 실행·취소된 id 면 false
+    bool cancelTimer(core::TimerWheel::TimerId id) noexcept;
+    bool rescheduleTimer(core::TimerWheel::TimerId id, Duration delay) noexcept;
+
+    // ===== completion I/O (io_uring 백엔드 전용) =====
+    // - completionIoEnabled() == false 이면 아래 API 는 모두 false 를 반환합니다(호출자는
+    //   기존 readiness 경로를 사용).
+    // - fd 는 addFd() 로 먼저 등록되어 있어야 하며, 완료 이벤트는 같은 handler 의 handleEvent()
+    //   로 ReadyEvent::completion 이 채워진 채 전달됩니다.
+
+    /// io_uring 백엔드가 실제로 활성화되었는지 여부
+    [[nodiscard]] bool completionIoEnabled() const noexcept { return uring_ != nullptr; }
+    [[nodiscard]] IoBackend backend() const noexcept
+    {
+        return uring_ ? IoBackend::IoUring : IoBackend::Epoll;
+    }
+
+    /// multishot accept 를 겁니다. (ReadyEvent::more == false 이면 재호출 필요)
+    bool armAccept(int fd) noexcept;
+
+    /// multishot recv(provided buffer) 를 겁니다. (ReadyEvent::more == false 이면 재호출 필요)
+    bool armRecv(int fd) noexcept;
+
+    /// iovec 조각들을 SENDMSG 1개로 제출합니다. (Send 완료 이벤트 1개, result = 보낸 바이트 합)
+    /// - short send 면 result 가 iovec 합보다 작습니다. 나머지는 완료 후 다시 제출해야 합니다.
+    /// - keepAlive 는 완료가 도착할 때까지 유지됩니다(iov 메모리 수명 보장용).
+    bool submitSend(int fd, const ::iovec *iov, int iovcnt, std::shared_ptr<void> keepAlive) noexcept;
+
+    /// polling 정책입니다. (EventLoopOptions::pollMode/pollSpinUs 로 초기화)
+    [[nodiscard]] PollMode pollMode() const noexcept { return pollMode_; }
+
+    /// spin/block 시간을 누적할 워커별 메트릭 슬롯을 연결합니다. (nullptr 이면 미집계)
+    void setLoopMetrics(monitoring::WorkerLoopMetrics *metrics) noexcept;
+
+    /// dispatch 지연 / task 지연 / iteration 시간을 기록할 워커별 히스토그램을 연결합니다. (nullptr 이면 미집계)
+    void setLatencyMetrics(monitoring::WorkerLatencyMetrics *metrics) noexcept { latencyMetrics_ = metrics; }
+
+    /// runOnce() 에서 reactor 대기 직전(task/타이머 처리 후)과 마지막(이벤트 처리 후)에 호출될 hook 입니다.
+    /// - SessionManager 의 deferred flush 가 사용합니다. (owner thread 전용, 1개만 보관)
+    /// - 할 일이 없으면 바로 돌아와야 합니다. (iteration 마다 2회 호출)
+    using IterationEndHook = std::function<void()>;
+    void setIterationEndHook(IterationEndHook hook) noexcept;
 
     void runOnce() noexcept;
     void run(std::atomic_bool &runningFlag) noexcept;
@@ -49,21 +132,75 @@ class EventLoop : private hypernet::util::NonCopyable
 
   private:
     EpollReactor reactor_;
+    std::unique_ptr<IoUringReactor> uring_; ///< nullptr 이면 epoll 백엔드
     core::TaskQueue taskQueue_;
     core::TimerWheel timerWheel_;
 
     std::vector<EpollReactor::ReadyEvent> readyEvents_;
 
-    // fd → {handler, tag, debugId, ownerPtr, events} 단일 레지스트리
-    std::unordered_map<int, FdContext> fdContexts_;
+    // fd → {handler, tag, debugId, ownerPtr, events, generation} 단일 레지스트리
+    // - fd 를 index 로 쓰는 dense vector (fd 는 커널이 가장 작은 번호부터 재사용하므로 조밀함)
+    std::vector<FdContext> fdContexts_;
+
+    /// 등록된 fd 의 컨텍스트를 반환합니다. (범위 밖/미등록이면 nullptr)
+    [[nodiscard]] FdContext *findContext_(int fd) noexcept
+    {
+        if (fd < 0 || static_cast<std::size_t>(fd) >= fdContexts_.size())
+        {
+            return nullptr;
+        }
+        FdContext &ctx = fdContexts_[static_cast<std::size_t>(fd)];
+        return ctx.handler ? &ctx : nullptr;
+    }
+
+    /// 이번 배치의 index 번째 이벤트가 가리킬 컨텍스트/handler 를 미리 캐시로 당겨 옵니다.
+    void prefetchDispatch_(int index, int count) const noexcept;
 
     std::atomic_bool ownerBound_{false};
     std::thread::id ownerThread_{};
 
     void assertInOwnerThread_(const char *apiName) const noexcept;
 
-    void drainTasks() noexcept;
-    [[nodiscard]] int computePollTimeoutMs() const noexcept;
+    /// @return 실행한 task + mesh descriptor 수
+    std::size_t drainTasks() noexcept;
+
+    /// 다음 타이머 만료까지 남은 시간(ns)을 poll timeout 으로 씁니다. (타이머가 없으면 -1)
+    [[nodiscard]] std::int64_t computePollTimeoutNs_(std::int64_t nowNs) const noexcept;
+
+    core::TimerWheel::Clock::time_point now_{};
+
+    WorkerMesh *mesh_{nullptr};
+    int meshWorkerId_{-1};
+
+    /// owner thread 가 reactor 에서 잠들어 있는(또는 잠들려는) 동안만 true
+    /// - post() 는 이 값이 true 일 때만 eventfd 를 씁니다. (깨어 있는 루프는 어차피 drain 함)
+    /// - 첫 producer 가 exchange(false) 로 가져가므로 잠든 동안 write 는 1회로 합쳐집니다.
+    alignas(64) std::atomic_bool sleeping_{false};
+
+    /// sleeping_ 이 true 이면 한 producer 만 false 로 바꾸고 eventfd 를 씁니다.
+    void wakeIfSleeping_() noexcept
+    {
+        if (sleeping_.load(std::memory_order_seq_cst) &&
+            sleeping_.exchange(false, std::memory_order_acq_rel))
+        {
+            signalWakeup_();
+        }
+    }
+
+    // ===== polling 정책 =====
+    PollMode pollMode_{PollMode::Block};
+    std::int64_t spinBudgetNs_{0};
+    std::int64_t lastActivityNs_{0}; ///< 마지막으로 이벤트를 받은 시각(steady ns, 0 이면 아직 없음)
+    std::int64_t ewmaGapNs_{0};      ///< 이벤트 간격 EWMA (Adaptive)
+    monitoring::WorkerLoopMetrics *loopMetrics_{nullptr};
+    monitoring::WorkerLatencyMetrics *latencyMetrics_{nullptr};
+    std::int64_t pollWaitNs_{0}; ///< 직전 pollReady_ 가 reactor 에서 보낸 시간 (iteration 시간에서 뺌)
+
+    IterationEndHook iterationEndHook_;
+
+    /// 정책에 따라 timeout 을 정하고 reactor 를 기다립니다. (spin/block 시간 집계 포함)
+    int pollReady_(int maxEvents) noexcept;
+    [[nodiscard]] bool shouldSpin_(std::int64_t nowNs) const noexcept;
 
     // ===== wakeup(eventfd) =====
     struct WakeupHandler;
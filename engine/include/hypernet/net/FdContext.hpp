@@ -14,8 +14,10 @@ class IFdHandler;
 ///
 /// 수명/스레딩 규약(중요):
 /// - FdContext는 EventLoop(owner thread)에서만 생성/수정/삭제한다.
+/// - EventLoop 는 fd 를 index 로 하는 dense vector 에 보관한다. (해시 조회 없음)
 /// - handler 포인터는 non-owning 이며, "fd가 EventLoop에 등록되어 있는 동안" 유효해야 한다.
-/// - 디스패치 시점에는 fd로 컨텍스트를 다시 조회하여, unregister 이후의 지연 이벤트(close race)를
+/// - epoll_event.data 에는 (generation << 32 | fd) 를 넣는다. 디스패치 시점에 슬롯의 generation 과
+///   비교하여, unregister 이후의 지연 이벤트(close race, 같은 배치 안 fd 재사용)를
 ///   안전하게 무시할 수 있도록 한다(UAF 방지).
 struct FdContext {
     int fd{-1};
@@ -24,6 +26,7 @@ struct FdContext {
     std::uint64_t debugId{0};          ///< handler->fdDebugId() (예: session id)
     std::uintptr_t ownerPtr{0};        ///< 디버깅용 포인터(보통 handler 주소)
     std::uint32_t registeredEvents{0}; ///< epoll_ctl에 등록된 events mask
+    std::uint32_t generation{0};       ///< removeFd 마다 증가 (슬롯 재사용 시에도 유지)
 };
 
 } // namespace hypernet::net
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+namespace hypernet::net
+{
+
+/// 워커 EventLoop 가 사용할 I/O 백엔드입니다.
+///
+/// - Epoll  : readiness 기반(epoll_wait + recvmsg/writev). 기본값.
+/// - IoUring: completion 기반(multishot accept/recv + provided buffer ring + linked send).
+///            커널이 지원하지 않거나 setup 이 실패하면 EventLoop 가 epoll 로 폴백합니다.
+enum class IoBackend : std::uint8_t
+{
+    Epoll = 0,
+    IoUring,
+};
+
+[[nodiscard]] constexpr const char *toString(IoBackend b) noexcept
+{
+    switch (b)
+    {
+    case IoBackend::Epoll:
+        return "epoll";
+    case IoBackend::IoUring:
+        return "io_uring";
+    }
+    return "unknown";
+}
+
+} // namespace hypernet::net
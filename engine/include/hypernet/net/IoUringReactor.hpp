@@ -0,0 +1,186 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <hypernet/net/EpollReactor.hpp>
+#include <hypernet/util/NonCopyable.hpp>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct io_uring_buf_ring;
+
+namespace hypernet::net
+{
+
+/// io_uring 기반 reactor 입니다. (liburing 없이 raw syscall 로 구동)
+///
+/// ===== 역할 =====
+/// - EpollReactor 와 같은 registerFd/modifyFd/unregisterFd/wait 인터페이스를 제공합니다.
+///   (readiness 는 multishot POLL_ADD 로 구현: eventfd/dial fd 등 completion 경로가 없는 fd 용)
+/// - completion 경로를 추가로 제공합니다.
+///   - armAccept : multishot accept (CQE 1개 = 새 client fd 1개)
+///   - armRecv   : multishot recv + provided buffer ring (커널이 버퍼를 골라 채움)
+///   - submitSend: iovec 조각들을 SENDMSG 1개로 제출 (CQE 1개, res = 실제로 보낸 바이트 합)
+///
+/// ===== 배칭 규약 =====
+/// - arm/submit/register 계열 호출은 SQE 를 채우기만 하고 syscall 을 하지 않습니다.
+/// - wait() 한 번이 "누적 SQE submit + CQE 대기"를 io_uring_enter 1회로 처리합니다.
+///   (SQ 가 가득 찬 경우에만 중간 submit 이 발생)
+///
+/// ===== 수명/안전 규약 =====
+/// - user_data = fd | kind | per-fd generation. unregisterFd() 이후 도착한 CQE 는
+///   generation 불일치로 버려집니다(provided buffer 는 회수).
+/// - Recv 이벤트의 data 는 provided buffer 를 가리키며 다음 wait() 호출 시 ring 에 반납됩니다.
+/// - SEND 는 커널이 완료 시점까지 메모리를 읽으므로, submitSend() 의 keepAlive 와 msghdr/iovec 을
+///   CQE 가 도착할 때까지 보관합니다(fd 가 먼저 해제되어도 유지).
+/// - owner thread(EventLoop)에서만 사용합니다.
+class IoUringReactor : private hypernet::util::NonCopyable
+{
+  public:
+    using Fd = int;
+    using ReadyEvent = EpollReactor::ReadyEvent;
+    using Completion = EpollReactor::Completion;
+
+    /// @param entries           SQ 크기(2의 거듭제곱으로 커널이 올림). CQ 는 4배로 잡습니다.
+    /// @param recvBufferCount   provided buffer 개수(2의 거듭제곱, <= 32768)
+    /// @param recvBufferSize    provided buffer 1개 크기(bytes)
+    /// @throws std::system_error io_uring_setup/mmap/버퍼 링 등록 실패 시
+    IoUringReactor(unsigned int entries, std::size_t recvBufferCount, std::size_t recvBufferSize);
+
+    ~IoUringReactor() noexcept;
+
+    IoUringReactor(IoUringReactor &&) = delete;
+    IoUringReactor &operator=(IoUringReactor &&) = delete;
+
+    /// readiness 감시를 등록합니다. (EPOLLIN/EPOLLOUT/EPOLLPRI 가 있으면 multishot poll)
+    /// - events 에 위 비트가 없으면 fd 만 등록하고 completion 경로(armRecv 등)로만 구동합니다.
+    bool registerFd(Fd fd, std::uint32_t events) noexcept;
+    bool modifyFd(Fd fd, std::uint32_t events) noexcept;
+
+    /// fd 에 걸린 poll/accept/recv 요청을 취소하고 generation 을 올립니다.
+    /// - 진행 중 SEND 는 취소하지 않고 완료될 때까지 keepAlive 를 보관합니다.
+    bool unregisterFd(Fd fd) noexcept;
+
+    bool armAccept(Fd fd) noexcept;
+    bool armRecv(Fd fd) noexcept;
+    /// iovec 조각들을 SENDMSG 1개로 제출합니다. (fd 당 1개만 진행, iovcnt <= kMaxSendIov)
+    /// - linked SEND 체인은 앞 조각이 short send 로 끝나도 링크가 끊기지 않아 뒤 조각이 먼저 나갈 수 있으므로 쓰지 않습니다.
+    /// - short send 면 CQE res 가 보낸 만큼만 오고, 나머지는 호출자가 다시 제출합니다.
+    bool submitSend(Fd fd, const ::iovec *iov, int iovcnt,
+                    std::shared_ptr<void> keepAlive) noexcept;
+
+    static constexpr int kMaxSendIov = 8;
+
+    /// 누적 SQE 를 submit 하고 CQE 를 기다려 ReadyEvent 로 변환합니다.
+    /// @return >= 0 : 변환된 이벤트 수, -1 : 오류(errno)
+    int wait(ReadyEvent *outEvents, int maxEvents, int timeoutMs) noexcept
+    {
+        return waitNs(outEvents, maxEvents,
+                      timeoutMs < 0 ? -1 : static_cast<std::int64_t>(timeoutMs) * 1'000'000);
+    }
+
+    /// ns 단위 타임아웃 버전입니다. (-1 무한 대기, 0 폴링. EXT_ARG timespec 으로 그대로 전달)
+    int waitNs(ReadyEvent *outEvents, int maxEvents, std::int64_t timeoutNs) noexcept;
+
+    /// wait() 가 돌려준 이벤트가 아직 현재 등록 세대의 것인지 확인합니다.
+    /// - 같은 배치 안에서 handler 가 fd 를 해제/재사용한 경우 남은 이벤트를 걸러냅니다.
+    [[nodiscard]] bool isCurrent(Fd fd, std::uint32_t generation) const noexcept
+    {
+        return fd >= 0 && static_cast<std::size_t>(fd) < slots_.size() &&
+               slots_[static_cast<std::size_t>(fd)].registered &&
+               slots_[static_cast<std::size_t>(fd)].gen == generation;
+    }
+
+    [[nodiscard]] Fd nativeHandle() const noexcept { return ringFd_; }
+
+  private:
+    enum class OpKind : std::uint8_t
+    {
+        Poll = 1,
+        Accept = 2,
+        Recv = 3,
+        Send = 4,
+        Cancel = 5,
+    };
+
+    /// SENDMSG 가 완료될 때까지 커널이 읽는 msghdr/iovec (fd 당 1개, 처음 송신할 때 만들어 재사용)
+    struct SendMsg
+    {
+        ::msghdr hdr{};
+        ::iovec iov[kMaxSendIov]{};
+    };
+
+    struct FdSlot
+    {
+        std::uint32_t gen{0};
+        std::uint32_t pollEvents{0};
+        std::uint8_t armed{0}; ///< OpKind 비트(1 << kind)
+        bool registered{false};
+        bool sendInFlight{false};
+        std::shared_ptr<void> sendKeepAlive;
+        std::unique_ptr<SendMsg> sendMsg;
+    };
+
+    /// unregisterFd() 이후에도 완료되지 않은 SENDMSG 의 keepAlive/msghdr 보관소
+    struct OrphanSend
+    {
+        std::uint64_t key{0}; ///< (fd, gen)
+        std::shared_ptr<void> keepAlive;
+        std::unique_ptr<SendMsg> msg;
+    };
+
+    [[nodiscard]] FdSlot *slot_(Fd fd, bool create) noexcept;
+    [[nodiscard]] static std::uint64_t makeUserData_(Fd fd, OpKind kind,
+                                                      std::uint32_t gen) noexcept;
+
+    [[nodiscard]] ::io_uring_sqe *getSqe_() noexcept;
+    int submitPending_(unsigned int minComplete, unsigned int flags, const void *arg) noexcept;
+
+    bool armPoll_(Fd fd, FdSlot &s) noexcept;
+    void prepCancel_(std::uint64_t target) noexcept;
+    void onSendCompleted_(Fd fd, std::uint32_t gen, FdSlot *s) noexcept;
+
+    void recycleBuffers_() noexcept;
+    void release_() noexcept;
+
+    int ringFd_{-1};
+
+    // SQ/CQ ring (mmap)
+    void *ringMem_{nullptr};
+    std::size_t ringMemSize_{0};
+    ::io_uring_sqe *sqes_{nullptr};
+    std::size_t sqesSize_{0};
+
+    unsigned int *sqHead_{nullptr};
+    unsigned int *sqTail_{nullptr};
+    unsigned int *sqFlags_{nullptr}; ///< IORING_SQ_TASKRUN / IORING_SQ_CQ_OVERFLOW
+    unsigned int sqMask_{0};
+    unsigned int sqEntries_{0};
+    unsigned int sqLocalTail_{0};
+    unsigned int sqSubmitted_{0};
+
+    unsigned int *cqHead_{nullptr};
+    unsigned int *cqTail_{nullptr};
+    unsigned int cqMask_{0};
+    ::io_uring_cqe *cqes_{nullptr};
+
+    // provided buffer ring
+    ::io_uring_buf_ring *bufRing_{nullptr};
+    std::size_t bufRingSize_{0};
+    std::vector<std::byte> recvBuffers_;
+    std::size_t recvBufferSize_{0};
+    std::uint16_t bufCount_{0};
+    std::uint16_t bufTail_{0};
+    std::vector<std::uint16_t> pendingRecycle_;
+
+    std::vector<FdSlot> slots_;
+    std::vector<OrphanSend> orphanSends_;
+};
+
+} // namespace hypernet::net
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+
+namespace hypernet::net
+{
+
+/// 워커 EventLoop 가 준비 이벤트를 기다리는 방식입니다.
+///
+/// - Block        : 항상 타이머 tick 만큼 블로킹 대기. (기본값, CPU 사용 최소)
+/// - BusyPoll     : 항상 timeout=0 으로 폴링. (코어 1개를 전용으로 소모, 지연 최소)
+/// - SpinThenBlock: 마지막 활동 이후 spin 예산(us) 동안은 폴링, 이후 블로킹.
+/// - Adaptive     : 최근 이벤트 간격(EWMA)이 spin 예산 안이면 간격의 2배까지만 폴링, 아니면 블로킹.
+enum class PollMode : std::uint8_t
+{
+    Block = 0,
+    BusyPoll,
+    SpinThenBlock,
+    Adaptive,
+};
+
+[[nodiscard]] constexpr const char *toString(PollMode m) noexcept
+{
+    switch (m)
+    {
+    case PollMode::Block:
+        return "block";
+    case PollMode::BusyPoll:
+        return "busy";
+    case PollMode::SpinThenBlock:
+        return "spin";
+    case PollMode::Adaptive:
+        return "adaptive";
+    }
+    return "unknown";
+}
+
+} // namespace hypernet::net
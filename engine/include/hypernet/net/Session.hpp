@@ -3,11 +3,13 @@
 #include <hypernet/SessionHandle.hpp>
 #include <hypernet/net/FdHandler.hpp>
 #include <hypernet/net/Socket.hpp>
+#include <hypernet/protocol/FieldPatch.hpp>
 #include <hypernet/util/NonCopyable.hpp>
 #include <chrono>
 #include <cstddef> // std::size_t
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace hypernet::buffer
 {
@@ -19,6 +21,22 @@ namespace hypernet::net
 
 class EventLoop;
 class SessionManager;
+class SessionPool;
+struct MigratingSession;
+
+/// MSG_ZEROCOPY 완료 통지 구간 [lo, hi] 가 firstSeq 부터 count 개의 통지 번호 중 몇 개를 덮는지 셉니다.
+/// - 통지는 여러 sendmsg 를 합친 구간으로, 블록 순서와 무관하게 올 수 있습니다. (번호는 uint32 wrap)
+[[nodiscard]] constexpr std::uint32_t zeroCopyCredits(std::uint32_t firstSeq, std::uint32_t count, std::uint32_t lo,
+                                                      std::uint32_t hi) noexcept
+{
+    std::uint32_t n = 0;
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        if (static_cast<std::uint32_t>(firstSeq + i - lo) <= static_cast<std::uint32_t>(hi - lo))
+            ++n;
+    }
+    return n;
+}
 
 /// 세션 상태머신(최소 고정)
 enum class SessionState : std::uint8_t
@@ -43,9 +61,15 @@ class Session final : private hypernet::util::NonCopyable,
     [[nodiscard]] int nativeHandle() const noexcept { return socket_.nativeHandle(); }
     [[nodiscard]] bool isOpen() const noexcept { return socket_.isValid(); }
 
+    /// 송신 대기 바이트 (송신 링 + overflow 큐)
+    [[nodiscard]] std::size_t queuedSendBytes() const noexcept;
+
+    /// pool 이 있으면 세션 메모리와 송수신 링을 워커 SessionPool 에서 꺼냅니다. (파괴 시 반납)
+    /// - 링은 생성 시점이 아니라 처음 데이터가 오갈 때 만듭니다. (acquireRecvRing_/acquireSendRing_)
     [[nodiscard]] static std::shared_ptr<Session>
     create(SessionHandle handle, int ownerWorkerId, Socket &&socket, SessionManager *ownerManager,
-           std::size_t recvRingCapacity, std::size_t sendRingCapacity);
+           std::size_t recvRingCapacity, std::size_t sendRingCapacity, bool mirroredRings = false,
+           const std::shared_ptr<SessionPool> &pool = {});
 
     // ===== IFdHandler =====
     [[nodiscard]] const char *fdTag() const noexcept override { return "session"; }
@@ -56,9 +80,25 @@ class Session final : private hypernet::util::NonCopyable,
                                    const std::uint8_t opHdr2[2], const void *body,
                                    std::size_t bodyLen) noexcept;
 
+    /// deferred flush 모드: 링에 적재만 하고 syscall 은 하지 않습니다.
+    /// - 실제 송신은 SessionManager 가 iteration 끝에 flushDeferred_() 로 1회 수행합니다.
+    bool enqueuePacketU16Deferred(EventLoop &loop, const std::uint8_t lenHdr4[4],
+                                  const std::uint8_t opHdr2[2], const void *body,
+                                  std::size_t bodyLen) noexcept;
+
+    /// 프레임 1개를 조각 목록으로 받는 송신 경로입니다. (relay: 헤더 + 원본 body 조각 + 패치 바이트)
+    /// - Coalesced 는 조각을 iovec 으로 바로 sendmsg 하고, 못 보낸 나머지만 송신 링에 적재합니다.
+    /// - segs[0..cnt) 는 호출 동안만 유효하면 됩니다. (cnt ≤ kMaxFrameSegs)
+    static constexpr int kMaxFrameSegs = 2 + static_cast<int>(hypernet::protocol::PatchedBody::kMaxPieces);
+    bool enqueueFrameCoalesced(EventLoop &loop, const hypernet::protocol::BodyPiece *segs, int cnt) noexcept;
+    bool enqueueFrameDeferred(EventLoop &loop, const hypernet::protocol::BodyPiece *segs, int cnt) noexcept;
+
   private:
     friend class SessionManager;
 
+    /// 길이가 있는데 포인터가 null 인 조각이 있으면 세션을 닫고 false
+    [[nodiscard]] bool validSegs_(EventLoop &loop, const hypernet::protocol::BodyPiece *segs, int cnt) noexcept;
+
     struct PrivateTag
     {
         explicit PrivateTag() = default;
@@ -71,10 +111,33 @@ class Session final : private hypernet::util::NonCopyable,
 
   private:
     void onReadable_(EventLoop &loop) noexcept;
-    bool processRecvFrames_(EventLoop &loop) noexcept;
+    bool processRecvFrames_(EventLoop &loop, hypernet::buffer::RingBuffer &ring) noexcept;
+
+    // ===== lazy ring / idle 회수 =====
+    /// 세션 링이 없으면 풀(없으면 힙)에서 꺼냅니다. 실패 시 로그 후 false (close 는 호출자 몫)
+    [[nodiscard]] bool acquireRecvRing_() noexcept;
+    [[nodiscard]] bool acquireSendRing_() noexcept;
+    void releaseRing_(std::unique_ptr<hypernet::buffer::RingBuffer> &ring, std::size_t capacity) noexcept;
+
+    /// 이번 recv 를 받을 링: 세션 링이 있으면 그것, 없으면 워커 공용 staging 링(비어 있을 때만)
+    [[nodiscard]] hypernet::buffer::RingBuffer *recvTarget_() noexcept;
+
+    /// recv 직후 프레이밍/dispatch 합니다. staging 에 남은 부분 프레임은 세션 링으로 옮깁니다.
+    /// - 반환 시 staging 은 항상 비어 있습니다. false 이면 세션이 닫혔습니다.
+    [[nodiscard]] bool consumeRecv_(EventLoop &loop, hypernet::buffer::RingBuffer &ring) noexcept;
+
+    /// idle 시간 이상 비어 있던 링을 풀로 돌려보냅니다. (반환: 돌려보낸 링 수)
+    /// - io_uring SEND 진행 중이거나 zero-copy 블록이 링 prefix 를 기다리면 송신 링은 유지합니다.
+    std::size_t reclaimIdleRings_(std::chrono::steady_clock::time_point now,
+                                  std::chrono::milliseconds idle) noexcept;
     void onWritable_(EventLoop &loop) noexcept;
     void onError_(EventLoop &loop, const EpollReactor::ReadyEvent &ev) noexcept;
 
+    // ===== io_uring completion 경로 =====
+    void onRecvCompleted_(EventLoop &loop, const EpollReactor::ReadyEvent &ev) noexcept;
+    void onSendCompleted_(EventLoop &loop, const EpollReactor::ReadyEvent &ev) noexcept;
+    [[nodiscard]] bool submitSend_(EventLoop &loop) noexcept;
+
     void beginClose_(EventLoop &loop, const char *reason, int err) noexcept;
 
     /// 워커 종료 시 SessionManager가 강제로 정리할 때 사용합니다.
@@ -85,8 +148,75 @@ class Session final : private hypernet::util::NonCopyable,
 
     [[nodiscard]] bool flushSend_(EventLoop &loop) noexcept;
 
+    /// iteration 끝의 일괄 flush (cork == true 이면 TCP_CORK 로 감싸서 송신)
+    bool flushDeferred_(EventLoop &loop, bool cork) noexcept;
+
     void setWriteInterest_(EventLoop &loop, bool enable) noexcept;
 
+    /// 송신 대기 데이터(링, overflow 큐 또는 zero-copy 블록)가 남아 있는지 여부
+    [[nodiscard]] bool hasPendingSend_() const noexcept;
+
+    // ===== 워커 간 이관 =====
+    /// 소켓/링/수신 통계를 out 으로 넘기고 Closed 로 둡니다. (fd 등록/타이머 해제는 SessionManager 몫)
+    void moveOutTo_(MigratingSession &out) noexcept;
+    /// 넘어온 링/수신 통계를 이어받습니다. (소켓은 create 에서 받음)
+    void adoptFrom_(MigratingSession &in) noexcept;
+
+    // ===== 송신 overflow 큐 (SessionManager::configureSendQueue) =====
+    /// 링 뒤에 잇는 블록 하나. [begin, end) 가 아직 링으로 옮기지 않은 바이트입니다.
+    struct SendQueueBlock
+    {
+        std::byte *mem{nullptr};
+        std::uint32_t begin{0};
+        std::uint32_t end{0};
+        bool pooled{false}; ///< false 이면 힙 블록
+    };
+
+    /// 링에 못 들어간 바이트를 overflow 큐 끝에 붙입니다. (블록 할당 실패 시 false)
+    [[nodiscard]] bool appendSendQueue_(const std::byte *data, std::size_t len) noexcept;
+
+    /// 송신 링에서 n 바이트를 소비하고, 비는 만큼 overflow 큐 앞부분을 링으로 옮깁니다.
+    void consumeSendRing_(std::size_t n) noexcept;
+
+    /// 송신 대기(링 + overflow 큐)가 모두 비었으면 sendMarkNs_ 부터의 송신 완료 지연을 기록합니다.
+    void noteSendDrained_() noexcept;
+
+    /// 송신 대기량으로 혼잡 상태를 갱신합니다. (앱 통지는 notifySendBackpressure_ 에서)
+    void updateSendBackpressure_() noexcept;
+
+    /// 혼잡 상태가 마지막 통지와 다르면 앱에 알립니다.
+    /// - 패킷 조각 적재 도중 앱이 재진입해 송신하지 않도록 송신/flush 가 끝난 지점에서만 호출합니다.
+    void notifySendBackpressure_() noexcept;
+
+    /// overflow 큐 블록을 모두 반납하고 혼잡 상태를 해제합니다. (close 경로)
+    void releaseSendQueue_() noexcept;
+
+    // ===== MSG_ZEROCOPY 송신 경로 (epoll 전용) =====
+    struct ZeroCopyBlock
+    {
+        void *mem{nullptr};          ///< SessionManager 풀 블록 (프레임 전체: len+opcode+body)
+        std::size_t len{0};
+        std::size_t sent{0};
+        std::size_t ringPrefix{0};   ///< 이 블록보다 먼저 나가야 하는 sendRing_ 바이트 수
+        std::uint32_t firstSeq{0};   ///< 이 블록의 첫 MSG_ZEROCOPY sendmsg 통지 번호
+        std::uint32_t seqCount{0};   ///< 이 블록에 쓰인 MSG_ZEROCOPY sendmsg 횟수
+        std::uint32_t notified{0};   ///< 완료 통지를 받은 횟수 (== seqCount 이면 반납 가능)
+    };
+
+    /// 프레임이 담긴 풀 블록을 송신 큐에 넣습니다. (소유권 이전, 실패 시에도 블록은 반납됨)
+    /// - flush == false 이면 적재만 합니다. (deferred flush 모드)
+    bool enqueueZeroCopy_(EventLoop &loop, void *block, std::size_t len, bool flush) noexcept;
+
+    /// zcQueue_ 가 빌 때까지 "링 prefix → 블록" 순서로 송신합니다. (EAGAIN 이면 중단)
+    [[nodiscard]] bool flushZeroCopy_(EventLoop &loop) noexcept;
+
+    /// error queue 의 완료 통지를 모두 수거하고, 통지가 끝난 블록을 풀에 반납합니다.
+    void reapZeroCopy_() noexcept;
+    void onZeroCopyNotified_(std::uint32_t lo, std::uint32_t hi) noexcept;
+
+    /// close 시점에 남은 블록을 정리합니다. (커널이 참조 중일 수 있는 블록은 quarantine)
+    void releaseZeroCopyBlocks_() noexcept;
+
     [[nodiscard]] static constexpr std::uint32_t baseEpollMask_() noexcept
     {
         return EpollReactor::makeEventMask({
@@ -101,7 +231,8 @@ class Session final : private hypernet::util::NonCopyable,
     void startTimeouts_(EventLoop &loop, std::uint32_t idleTimeoutMs,
                         std::uint32_t heartbeatIntervalMs) noexcept;
 
-    void touchRx_() noexcept;
+    /// 마지막 RX 시각을 루프의 iteration 캐시 시각으로 갱신합니다. (clock 재조회 없음)
+    void touchRx_(const EventLoop &loop) noexcept;
 
     void armIdleTimerAfter_(EventLoop &loop, std::chrono::milliseconds delay) noexcept;
     void onIdleTimer_(EventLoop &loop) noexcept;
@@ -109,19 +240,51 @@ class Session final : private hypernet::util::NonCopyable,
     void armHeartbeatTimerAfter_(EventLoop &loop, std::chrono::milliseconds delay) noexcept;
     void onHeartbeatTimer_(EventLoop &loop) noexcept;
 
+    /// close 경로에서 idle/heartbeat 타이머 노드를 반납합니다.
+    void cancelTimers_(EventLoop &loop) noexcept;
+
     std::uint32_t idleTimeoutMs_{0};
     std::uint32_t heartbeatIntervalMs_{0};
 
     std::chrono::steady_clock::time_point lastRxAt_{};
-    bool idleTimerArmed_{false};
-    bool heartbeatTimerArmed_{false};
+    std::chrono::steady_clock::time_point lastTxAt_{}; ///< 마지막 송신 링 적재 시각 (idle 회수 판단)
+    std::chrono::steady_clock::time_point residentSince_{}; ///< 이 워커에서 열리거나 이관되어 온 시각
+
+    // ===== 워커 간 이관 (SessionManager::migrateOut / adoptMigrated) =====
+    std::uint64_t rxBytes_{0};             ///< 누적 수신 바이트
+    std::uint64_t rxBytesMark_{0};         ///< 직전 rebalance 샘플 때의 rxBytes_
+    std::vector<unsigned int> forwarders_; ///< 이 세션의 forward 엔트리를 가진 이전 owner 워커들
+    // 세션당 타이머 노드는 1개씩만 만들고 이후에는 reschedule 로 재사용한다(할당 없음).
+    std::uint64_t idleTimerId_{0};
+    std::uint64_t heartbeatTimerId_{0};
 
-    std::unique_ptr<hypernet::buffer::RingBuffer> recvRing_; // 생성 실패 시 close 정책 적용
-    std::unique_ptr<hypernet::buffer::RingBuffer> sendRing_; // 생성 실패 시 close 정책 적용
+    std::unique_ptr<hypernet::buffer::RingBuffer> recvRing_; // 부분 프레임이 남을 때만 생성 (lazy)
+    std::unique_ptr<hypernet::buffer::RingBuffer> sendRing_; // 첫 송신 적재 시 생성 (lazy)
     std::size_t recvRingCapacity_{0};
     std::size_t sendRingCapacity_{0};
+    bool ringsMirrored_{false};         ///< 요청한 링 레이아웃 (풀 반납 key)
+    std::shared_ptr<SessionPool> pool_; ///< 링 반납처 (nullptr 이면 풀 미사용)
     // 현재 epoll에 등록된 이벤트 마스크(디버깅/토글 중복 호출 방지용)
     std::uint32_t currentEpollMask_{baseEpollMask_()};
+    // io_uring: 완료 대기 중인 linked SEND 개수 (0일 때만 sendRing_ 에서 새 체인을 제출)
+    std::uint16_t sendOpsInFlight_{0};
+    // deferred flush: SessionManager dirty 목록에 올라가 있는지 여부
+    bool flushPending_{false};
+
+    // MSG_ZEROCOPY: SO_ZEROCOPY 설정 성공 시 true (큰 body 는 풀 블록 경로로 송신)
+    bool zeroCopy_{false};
+    // 커널이 복사로 폴백(SO_EE_CODE_ZEROCOPY_COPIED)했으면 이후 블록은 MSG_ZEROCOPY 없이 송신
+    bool zcCopied_{false};
+    std::uint32_t zcNextSeq_{0};          ///< 다음 MSG_ZEROCOPY sendmsg 의 통지 번호(소켓별 0부터)
+    std::vector<ZeroCopyBlock> zcQueue_;    ///< 아직 다 보내지 못한 블록 (FIFO)
+    std::vector<ZeroCopyBlock> zcInFlight_; ///< 다 보냈지만 완료 통지를 기다리는 블록
+
+    // overflow 큐: 송신 링이 가득 찼을 때만 쓰인다. (비어 있지 않으면 링도 가득 차 있음)
+    std::vector<SendQueueBlock> sendQueue_;
+    std::size_t sendQueueBytes_{0};
+    std::int64_t sendMarkNs_{0};        ///< 아직 커널에 넘기지 못한 응답 중 가장 이른 dispatch 시작 시각 (0 이면 없음)
+    bool sendCongested_{false};         ///< 송신 대기량이 high watermark 를 넘은 상태
+    bool sendCongestionNotified_{false}; ///< 앱에 마지막으로 알린 혼잡 상태
 
     SessionHandle handle_{};
     int ownerWorkerId_{-1};
@@ -8,10 +8,13 @@
 #include <hypernet/protocol/LengthPrefixFramer.hpp>
 #include <hypernet/protocol/MessageView.hpp>
 #include <hypernet/protocol/Dispatcher.hpp>
+#include <hypernet/protocol/FieldPatch.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -21,15 +24,30 @@ namespace hypernet
 class IApplication; // forward
 }
 
+namespace hypernet::buffer
+{
+class BufferPool; // forward
+class RingBuffer; // forward
+}
+
 namespace hypernet::connector
 {
 class ConnectorManager; // forward
 }
 
+namespace hypernet::monitoring
+{
+struct WorkerSendQueueMetrics; // forward
+struct WorkerLatencyMetrics;   // forward
+}
+
 namespace hypernet::net
 {
 
 class EventLoop;
+class SessionPool;
+class SessionMigrator;
+struct MigratingSession;
 
 class SessionManager final : private hypernet::util::NonCopyable
 {
@@ -52,17 +70,111 @@ class SessionManager final : private hypernet::util::NonCopyable
 
     [[nodiscard]] std::size_t sessionCount() const noexcept { return sessions_.size(); }
 
+    /// 디버깅/테스트용: 이 워커에 남아 있는 forward 엔트리 수 (옮겨 간 세션 id → 넘겨받은 워커)
+    [[nodiscard]] std::size_t forwardCount() const noexcept { return forwards_.size(); }
+
     [[nodiscard]] hypernet::protocol::IFramer &framer() noexcept { return framer_; }
     [[nodiscard]] const char *lastFramerErrorReason() const noexcept { return framer_.lastErrorReason(); }
 
     void dispatchOnMessage(SessionHandle session, const hypernet::protocol::MessageView &message) noexcept;
 
+    /// 한 세션의 recv burst 에서 추출한 프레임들을 순서대로 dispatch 합니다.
+    /// - owner 확인/rx 메트릭은 배치당 1회입니다.
+    /// - 같은 opcode 가 연속된 구간(run)은 Dispatcher::dispatchBatch 로 한 번에 넘깁니다.
+    ///   (배치 핸들러면 1회 호출, 단건 핸들러면 body 마다 호출)
+    /// - 핸들러가 세션을 닫으면 남은 프레임은 버립니다.
+    void dispatchBatch(const Session &session, std::span<const hypernet::protocol::MessageView> frames) noexcept;
+
     void configureTimeouts(std::uint32_t idleTimeoutMs, std::uint32_t heartbeatIntervalMs) noexcept;
 
+    /// 새 세션 소켓에 적용할 SO_BUSY_POLL(us) 값입니다. (0이면 미설정)
+    void configureBusyPoll(std::uint32_t busyPollUs) noexcept;
+
+    /// 새 세션의 송수신 링을 memfd 이중 매핑(mirrored)으로 만들지 설정합니다.
+    /// - 링 끝을 넘는 프레임도 연속으로 보이므로 framer 가 scratch 복사 없이 뷰를 냅니다.
+    void configureMirroredRings(bool enable) noexcept;
+
+    /// 워커 세션 풀(세션 슬롯 + 송수신 링)을 설정합니다. (maxIdle == 0 이면 풀 미사용)
+    /// - prewarm 개 세션 분량을 미리 만들어 두고 링 페이지를 미리 올립니다. (maxIdle 이 상한)
+    /// - configureMirroredRings 이후에 호출해야 prewarm 한 링의 레이아웃이 맞습니다.
+    void configureSessionPool(std::size_t prewarm, std::size_t maxIdle) noexcept;
+
+    /// 워커가 시작 시 미리 잡을 수 있는 작업 메모리(recv staging 링, framer scratch)를 만들고 페이지를 올립니다.
+    /// - 첫 burst 가 page fault 없이 처리되도록 워커 prefault 정책일 때 configure* 이후 1회 부릅니다.
+    void prefaultWorkingSet() noexcept;
+
+    /// 세션 링 idle 회수를 설정합니다. (idleMs == 0 이면 회수하지 않음)
+    /// - 세션 링은 처음 데이터가 오갈 때 만들어지고, idleMs 동안 비어 있으면 워커 풀로 돌아갑니다.
+    /// - 회수는 idleMs/2 주기의 워커 타이머 1개가 세션을 훑어서 합니다. (세션별 타이머 없음, 세션이 없으면 멈춤)
+    void configureRingReclaim(std::uint32_t idleMs) noexcept;
+
+    /// deferred flush 모드를 설정합니다.
+    /// - enable: sendPacketU16() 은 링에 적재 + dirty 표시만 하고, EventLoop 가 대기하기 전과
+    ///   iteration 끝에 dirty 세션마다 writev 1회로 몰아서 송신합니다. (지연 상한 = loop 1회)
+    /// - cork  : flush 를 TCP_CORK on/off 로 감쌉니다.
+    void configureDeferredFlush(bool enable, bool cork) noexcept;
+
+    /// MSG_ZEROCOPY 송신 경로를 설정합니다. (epoll 백엔드 전용, threshold == 0 이면 끔)
+    /// - body >= threshold 인 패킷은 워커 전용 블록 풀(blockCount 개, 블록 = 6 + maxPayloadLen)에
+    ///   헤더와 함께 1회 적재한 뒤 MSG_ZEROCOPY 로 송신합니다.
+    /// - 블록은 커널 완료 통지(error queue) 이후에만 풀로 돌아갑니다.
+    void configureZeroCopy(std::size_t threshold, std::size_t blockCount) noexcept;
+
+    /// 송신 overflow 큐와 backpressure watermark 를 설정합니다. (limitBytes == 0 이면 끔)
+    /// - 송신 링에 못 들어간 바이트는 워커 블록 풀(블록 = kSendQueueBlockBytes)의 체인에 이어 붙입니다.
+    /// - 세션 송신 대기량(링 + 체인)이 high 이상이면 IApplication::onSendBackpressure(true),
+    ///   이후 low 이하로 내려오면 (false) 를 호출합니다. limitBytes 를 넘는 송신은 세션을 닫습니다.
+    /// - watermark 기본값은 EffectiveOptions 가 채워서 넘깁니다. 여기서는 low < high <= limit 로 자르기만 합니다.
+    void configureSendQueue(std::size_t limitBytes, std::size_t highWatermark, std::size_t lowWatermark) noexcept;
+
+    /// 세션의 송신 대기 바이트(링 + overflow 큐)입니다. 세션이 없으면 0
+    [[nodiscard]] std::size_t queuedSendBytes(SessionHandle::Id id) const noexcept;
+
     bool sendPacketU16(SessionHandle::Id id, std::uint16_t opcode, const void *body, std::size_t bodyLen) noexcept;
+
+    /// [relay] 받은 body 를 디코드/재인코딩 없이 id 세션으로 보내며 patches 위치만 덮어씁니다.
+    /// - body 는 원본 조각과 패치 바이트 조각으로 나뉘어 sendmsg iovec(못 보낸 나머지는 송신 링)에
+    ///   바로 실립니다. 원본 body 는 수정하지 않습니다. (recv 링을 가리키는 view 그대로 전달 가능)
+    /// - 옮겨 간 세션이면 패치한 body 를 PacketBuffer 1개로 복사해 현재 owner 로 넘깁니다.
+    /// @return patches 가 잘못되었거나(validFieldPatches) 세션이 없으면 false
+    bool relayPacketU16(SessionHandle::Id id, std::uint16_t opcode, const void *body, std::size_t bodyLen,
+                        std::span<const hypernet::protocol::FieldPatch> patches) noexcept;
+
+    /// body 를 zero-copy 블록에 바로 써서 보내는 경로입니다. (owner 스레드, sendPacketU16 의 블록 복사 생략)
+    /// - acquireZeroCopyBody: 풀 블록 하나를 빌려 헤더 자리 뒤의 body 영역(최대 maxPayloadLen)을 돌려줍니다.
+    ///   zero-copy 가 꺼졌거나 풀이 비었으면 빈 span 이므로 호출자는 sendPacketU16 으로 보냅니다.
+    /// - sendZeroCopyBody: 헤더를 채우고 블록을 세션에 넘깁니다. 블록은 커널 완료 통지 뒤에 풀로 돌아갑니다.
+    ///   성공 여부와 상관없이 호출 뒤에는 body 를 건드리면 안 됩니다.
+    ///   (세션이 옮겨 갔거나 소켓이 SO_ZEROCOPY 를 못 쓰면 일반 경로로 복사해 보내고 블록은 바로 반납)
+    /// - releaseZeroCopyBody: 보내지 않기로 한 블록을 돌려줍니다.
+    [[nodiscard]] std::span<std::uint8_t> acquireZeroCopyBody() noexcept;
+    bool sendZeroCopyBody(SessionHandle::Id id, std::uint16_t opcode, std::span<std::uint8_t> body, std::size_t bodyLen) noexcept;
+    void releaseZeroCopyBody(std::span<std::uint8_t> body) noexcept;
+
+    /// 디버깅/테스트용: 풀에서 나가 있는 zero-copy 블록 수 (송신 대기 + 완료 통지 대기 + quarantine)
+    [[nodiscard]] std::size_t zeroCopyBlocksInUse() const noexcept;
     void beginClose(SessionHandle::Id id, const char *reason, int err = 0) noexcept;
     void closeAllByPolicy(const char *reason, int err = 0) noexcept;
 
+    // ===== 워커 간 세션 이관 (SessionMigrator) =====
+    /// 이관 경로를 연결합니다. (워커 스레드 시작 전, nullptr 이면 이관/forward 없음)
+    void attachMigrator(SessionMigrator *migrator) noexcept { migrator_ = migrator; }
+
+    /// id 세션을 target 워커로 넘깁니다. (owner 스레드의 task 에서, SessionMigrator::request 경유)
+    /// - 이 워커에서 이미 옮겨 간 세션이면 요청을 forward 엔트리의 워커로 넘깁니다.
+    /// - 거절: io_uring 백엔드, Connected 아님, flush 후에도 송신 대기/zero-copy 완료 대기가 남음,
+    ///   앱이 IApplication::onSessionMigrateOut 에서 동의하지 않음
+    bool migrateOut(SessionHandle::Id id, unsigned int target) noexcept;
+
+    /// 다른 워커에서 넘어온 세션을 같은 id 로 이 워커에 등록합니다. (owner 스레드)
+    /// - 실패하면 연결을 닫고 IApplication::onSessionEnd 를 부릅니다.
+    void adoptMigrated(std::unique_ptr<MigratingSession> session) noexcept;
+
+    /// 직전 호출 이후 수신이 가장 많았던 세션 하나를 target 워커로 넘깁니다. (rebalancer)
+    /// - 이 워커에 minResidency 이상 머문 세션만 고릅니다. (왕복 방지)
+    /// - 워커 수신량의 절반을 넘는 세션은 옮기면 부하가 그대로 넘어가므로 제외합니다.
+    bool migrateBusiest(unsigned int target, std::chrono::milliseconds minResidency) noexcept;
+
   private:
     [[nodiscard]] SessionHandle::Id nextSessionId_() noexcept;
     void assertInOwnerThread_(const char *apiName) const noexcept;
@@ -70,16 +182,110 @@ class SessionManager final : private hypernet::util::NonCopyable
     [[nodiscard]] SessionHandle makeHandle_(SessionHandle::Id id) const noexcept;
     void closeByPolicy_(SessionHandle::Id id, const char *reason, int err = 0) noexcept;
 
+    /// dirty 세션을 일괄 flush 합니다. (EventLoop iteration-end hook)
+    void flushDirty_() noexcept;
+
+    /// 세션 링이 없는 세션의 recv 를 받는 워커 공용 링입니다. (처음 쓸 때 생성, 실패 시 nullptr)
+    /// - 완성 프레임은 여기서 바로 dispatch 되고, 남은 부분 프레임만 세션 링으로 옮겨집니다.
+    [[nodiscard]] hypernet::buffer::RingBuffer *recvStaging_() noexcept;
+
+    /// idle 링 회수 타이머를 겁니다. (이미 걸려 있으면 주기만 다시 맞춤)
+    void armRingReclaim_() noexcept;
+    /// idle 링 회수 타이머 콜백 (세션이 없으면 타이머를 멈춤)
+    void reclaimIdleRings_() noexcept;
+
+    friend class Session;
+
+    /// 완료 통지가 끝난 zero-copy 블록을 풀로 반납합니다.
+    void releaseZeroCopyBlock_(void *block) noexcept;
+
+    /// close 시점에 커널이 아직 참조 중일 수 있는 블록을 보류했다가 일정 시간 뒤 반납합니다.
+    /// - 닫힌 소켓의 완료 통지는 더 이상 받을 수 없으므로 재전송 구간이 지나기를 기다린다.
+    void quarantineZeroCopyBlock_(void *block) noexcept;
+    void releaseQuarantined_() noexcept;
+
+    /// sendPacketU16/relayPacketU16 공통: 프레임을 적재한 뒤 watermark 전이를 앱에 알립니다.
+    bool sendFrame_(SessionHandle::Id id, const std::shared_ptr<Session> &session,
+                    const hypernet::protocol::BodyPiece *segs, int cnt, std::size_t bodyLen) noexcept;
+
+    /// 프레임 적재 본체: zero-copy/즉시/지연 flush 경로로 조각 목록(헤더 + body 조각) 하나를 적재합니다.
+    bool enqueuePacket_(const std::shared_ptr<Session> &session, const hypernet::protocol::BodyPiece *segs, int cnt,
+                        std::size_t bodyLen) noexcept;
+
+    /// 프레임이 다 채워진 zero-copy 블록을 세션에 넘깁니다. (즉시/지연 flush, 실패해도 블록은 반납됨)
+    bool enqueueZeroCopyBlock_(const std::shared_ptr<Session> &session, void *block, std::size_t frameLen) noexcept;
+
+    /// overflow 블록 하나를 꺼냅니다. 풀이 비었으면 힙에서 만들고 pooled=false 로 알려줍니다.
+    [[nodiscard]] void *acquireSendQueueBlock_(bool &pooled) noexcept;
+    void releaseSendQueueBlock_(void *block, bool pooled) noexcept;
+
+    /// 세션의 watermark 전이를 앱에 알립니다. (owner 스레드, 앱 예외는 삼킴)
+    void notifySendBackpressure_(SessionHandle handle, bool congested) noexcept;
+
+    /// 옮겨 간 세션으로 온 송신을 현재 owner 쪽으로 넘깁니다. (forward 엔트리가 없으면 false)
+    /// - 이 워커 task 큐 순서대로 넘기므로 같은 경로의 송신끼리는 순서가 유지되지만,
+    ///   새 owner 에 직접 들어간 송신과의 순서는 보장하지 않습니다. (IApplication::onSessionMigrateIn 참고)
+    bool forwardPacket_(SessionHandle::Id id, std::uint16_t opcode, const void *body, std::size_t bodyLen,
+                        std::span<const hypernet::protocol::FieldPatch> patches = {}) noexcept;
+
+    /// 세션이 끝났으므로 이전 owner 들의 forward 엔트리를 지웁니다.
+    void dropForwards_(SessionHandle::Id id, const std::vector<unsigned int> &forwarders) noexcept;
+
     unsigned int ownerWorkerId_{0};
     EventLoop *loop_{nullptr};
 
     std::size_t recvRingCapacity_{0};
     std::size_t sendRingCapacity_{0};
 
+    // ===== batch framing/dispatch (owner 전용, 재진입 없음) =====
+    std::vector<hypernet::protocol::MessageView> frameBatch_; ///< tryFrameBatch 출력
+    std::vector<hypernet::protocol::MessageView> bodyRun_;    ///< 같은 opcode run 의 body
+    bool mirroredRings_{false};
+    std::shared_ptr<SessionPool> sessionPool_; ///< nullptr 이면 세션/링을 매번 새로 할당
+    std::unique_ptr<hypernet::buffer::RingBuffer> stagingRing_; ///< recvStaging_() 저장소
+    bool stagingFailed_{false};                                 ///< 생성 실패 후 재시도/로그 억제
+    std::uint32_t ringReclaimMs_{0};
+    std::uint64_t ringReclaimTimerId_{0};
+
     std::uint64_t localCounter_{1};
 
     std::uint32_t idleTimeoutMs_{0};
     std::uint32_t heartbeatIntervalMs_{0};
+    std::uint32_t busyPollUs_{0};
+    bool busyPollWarned_{false};
+
+    // ===== deferred flush =====
+    bool deferredFlush_{false};
+    bool deferredCork_{false};
+    std::vector<std::shared_ptr<Session>> dirty_;
+    std::vector<std::shared_ptr<Session>> flushing_; ///< flushDirty_ 중 재진입(send)용 swap 버퍼
+
+    // ===== zero-copy send =====
+    std::uint32_t maxPayloadLen_{0};
+    std::size_t zeroCopyThreshold_{0};
+    std::unique_ptr<hypernet::buffer::BufferPool> zeroCopyPool_;
+    struct QuarantinedBlock
+    {
+        void *block{nullptr};
+        std::chrono::steady_clock::time_point releaseAt{};
+    };
+    std::vector<QuarantinedBlock> zcQuarantine_; ///< releaseAt 오름차순(FIFO)
+    bool zcQuarantineArmed_{false};
+    bool zeroCopyWarned_{false};
+
+    // ===== send overflow queue =====
+    std::size_t sendQueueLimit_{0}; ///< 0 이면 overflow 큐 미사용 (링이 차면 close)
+    std::size_t sendQueueHigh_{0};
+    std::size_t sendQueueLow_{0};
+    std::unique_ptr<hypernet::buffer::BufferPool> sendQueuePool_;
+    hypernet::monitoring::WorkerSendQueueMetrics *sendQueueMetrics_{nullptr};
+
+    // ===== dispatch → 송신 완료 지연 =====
+    hypernet::monitoring::WorkerLatencyMetrics *latencyMetrics_{nullptr};
+    std::int64_t dispatchStartNs_{0}; ///< 진행 중인 dispatch 의 시작 시각(steady ns), dispatch 밖이면 0
+
+    /// sinceNs(dispatch 시작)부터 지금까지를 송신 완료 지연으로 기록합니다. (sinceNs == 0 이면 무시)
+    void recordSendCompletion_(std::int64_t sinceNs) noexcept;
 
     std::shared_ptr<hypernet::IApplication> app_;
 
@@ -91,6 +297,10 @@ class SessionManager final : private hypernet::util::NonCopyable
     std::unique_ptr<hypernet::connector::ConnectorManager> connectors_;
 
     std::unordered_map<SessionHandle::Id, std::shared_ptr<Session>> sessions_;
+
+    // ===== 워커 간 세션 이관 =====
+    SessionMigrator *migrator_{nullptr};
+    std::unordered_map<SessionHandle::Id, unsigned int> forwards_; ///< 옮겨 간 세션 id → 넘겨받은 워커
 };
 
 } // namespace hypernet::net
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <hypernet/SessionHandle.hpp>
+#include <hypernet/buffer/RingBuffer.hpp>
+#include <hypernet/core/Task.hpp>
+#include <hypernet/net/Socket.hpp>
+#include <hypernet/util/NonCopyable.hpp>
+
+namespace hypernet::net
+{
+
+class EventLoop;
+class SessionManager;
+
+/// 워커 사이를 옮겨 가는 세션 1개입니다. (원래 owner → 대상 워커로 소유권째 이동)
+/// - 대상 워커에 닿지 못하고 파괴되면 소켓이 닫히고 링은 그냥 해제됩니다.
+struct MigratingSession
+{
+    SessionHandle::Id id{0}; ///< 이관 후에도 같은 id (상위 32bit 는 처음 연 워커)
+    Socket socket{};
+    std::unique_ptr<hypernet::buffer::RingBuffer> recvRing; ///< 남은 부분 프레임 (없으면 nullptr)
+    std::unique_ptr<hypernet::buffer::RingBuffer> sendRing; ///< 비어 있는 송신 링 (없으면 nullptr)
+    std::chrono::steady_clock::time_point lastRxAt{};
+    std::uint64_t rxBytes{0};
+    bool zeroCopy{false};
+    bool zcCopied{false};
+    std::uint32_t zcNextSeq{0}; ///< MSG_ZEROCOPY 통지 번호는 소켓 단위로 이어짐
+    std::vector<unsigned int> forwarders; ///< forward 엔트리를 가진 워커 (보낸 워커 포함)
+    std::shared_ptr<void> appContext;     ///< IApplication::onSessionMigrateOut 이 넘긴 앱 상태
+};
+
+/// 워커 간 세션 이관 경로입니다. (AcceptHandoff 와 같은 task 경로, mesh 가 있으면 mesh)
+///
+/// - 이관은 원래 owner 워커 스레드의 task 에서 시작합니다. (fd 이벤트 처리 도중에는 옮기지 않음)
+///   owner 가 fd 를 epoll 에서 빼고 소켓/링/앱 상태를 MigratingSession 으로 넘기면,
+///   대상 워커 스레드가 같은 id 로 세션을 다시 만들어 자기 루프에 등록합니다.
+/// - 보낸 워커는 id → 대상 워커 forward 엔트리를 남깁니다. 이전 owner 로 라우팅된 송신/close 는
+///   이 엔트리를 따라 현재 owner 로 넘어갑니다. (같은 채널 FIFO 라 이관 task 뒤에 도착)
+/// - forward 엔트리는 세션이 최종 owner 에서 끝날 때 정리됩니다.
+class SessionMigrator : private hypernet::util::NonCopyable
+{
+  public:
+    explicit SessionMigrator(std::size_t workerCount);
+
+    [[nodiscard]] std::size_t workerCount() const noexcept { return count_; }
+
+    /// 워커의 루프/SessionManager 를 연결합니다. (워커 스레드 시작 전, main thread)
+    void attach(unsigned int wid, EventLoop *loop, SessionManager *sessions) noexcept;
+
+    /// sid 세션을 target 워커로 옮기도록 요청합니다. (아무 스레드, 비동기)
+    /// - sid 를 처음 연 워커로 보내고, 이미 옮겨 간 세션이면 forward 엔트리를 따라갑니다.
+    /// @return 요청을 넘겼는지 여부. 실제 이관은 세션 상태/앱 동의에 따라 거절될 수 있습니다.
+    bool request(SessionHandle::Id sid, unsigned int target) noexcept;
+
+    /// from 워커에서 가장 바쁜 세션 하나를 to 워커로 옮기도록 요청합니다. (rebalancer)
+    bool rebalance(unsigned int from, unsigned int to, std::chrono::milliseconds minResidency) noexcept;
+
+    /// wid 워커의 SessionManager (연결 전이거나 범위 밖이면 nullptr)
+    [[nodiscard]] SessionManager *sessionsOf(unsigned int wid) const noexcept
+    {
+        return wid < count_ ? targets_[wid].sessions : nullptr;
+    }
+
+    /// wid 워커 스레드에서 task 를 실행합니다. (대상이 없거나 post 실패 시 false)
+    bool post(unsigned int wid, core::Task task) noexcept;
+
+    /// 대상 워커 스레드에서 세션을 이어받게 합니다. (실패 시 세션은 닫힘)
+    bool deliver(unsigned int target, std::unique_ptr<MigratingSession> session) noexcept;
+
+  private:
+    struct alignas(64) Target
+    {
+        EventLoop *loop{nullptr};
+        SessionManager *sessions{nullptr};
+    };
+
+    std::size_t count_{0};
+    std::unique_ptr<Target[]> targets_;
+};
+
+/// rebalancer 가 고른 이관 방향입니다. (from < 0 이면 옮기지 않음)
+struct RebalanceMove
+{
+    int from{-1};
+    int to{-1};
+};
+
+/// 샘플 구간의 idle(spin + block) 시간으로 워커 사용률(0~100)을 계산합니다.
+[[nodiscard]] std::uint32_t workerUtilizationPct(std::uint64_t idleNs, std::uint64_t elapsedNs) noexcept;
+
+/// 가장 바쁜 워커에서 가장 한가한 워커로 세션 하나를 옮길지 정합니다.
+/// - 두 워커의 사용률 차가 thresholdPct 이상이고 바쁜 워커 세션이 2개 이상일 때만 옮깁니다.
+///   (세션 1개짜리 워커는 옮겨도 부하가 그대로 따라가므로 제외)
+[[nodiscard]] RebalanceMove planRebalance(const std::vector<std::uint32_t> &utilPct,
+                                          const std::vector<std::int64_t> &sessions,
+                                          std::uint32_t thresholdPct);
+
+} // namespace hypernet::net
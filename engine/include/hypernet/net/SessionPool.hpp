@@ -0,0 +1,129 @@
+#pragma once
+
+#include <hypernet/buffer/RingBuffer.hpp>
+#include <hypernet/util/NonCopyable.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace hypernet::monitoring
+{
+struct WorkerSessionPoolMetrics; // forward
+}
+
+namespace hypernet::net
+{
+
+/// 워커 전용 세션 arena + 링 블록 풀입니다.
+///
+/// - 세션 슬롯: Session 과 shared_ptr control block 을 한 번에 담는 메모리입니다.
+///   SessionPoolAllocator 로 allocate_shared 하면 여기서 꺼내고, 마지막 참조가 놓일 때 돌아옵니다.
+/// - 링: (요청 용량, 레이아웃) 별로 RingBuffer 객체를 통째로 보관합니다. 재사용 시 clear() 만 하므로
+///   저장소를 다시 할당/0 초기화하지 않고, mirrored 링은 memfd/mmap 을 다시 하지 않습니다.
+/// - 보관 수는 종류별로 maxIdle 개까지입니다. (free list 는 미리 reserve → 반납 경로 할당 없음)
+///   넘치는 반납과 owner 워커가 아닌 스레드에서의 반납은 그냥 해제합니다. (락 없음)
+/// - prewarm 으로 accept 폭주 전에 슬롯/링을 미리 채우고 페이지를 미리 건드려 둘 수 있습니다.
+/// - 세션이 풀보다 오래 살 수 있으므로(shared_ptr 탈출) 세션/allocator 가 shared_ptr 로 풀을 붙잡습니다.
+class SessionPool final : private hypernet::util::NonCopyable
+{
+  public:
+    using Layout = hypernet::buffer::RingBuffer::Layout;
+
+    struct Stats
+    {
+        std::uint64_t sessionHits{0};   ///< 풀에서 꺼낸 세션 슬롯
+        std::uint64_t sessionMisses{0}; ///< 풀이 비어 새로 할당한 세션 슬롯
+        std::uint64_t ringHits{0};
+        std::uint64_t ringMisses{0};
+    };
+
+    /// @param ownerWorkerId 풀을 쓰는 워커 (이 워커 스레드에서만 꺼내고 돌려놓음)
+    /// @param maxIdle 종류별 보관 상한 (0이면 보관하지 않음 = 기존 동작)
+    SessionPool(int ownerWorkerId, std::size_t maxIdle,
+                hypernet::monitoring::WorkerSessionPoolMetrics *metrics = nullptr) noexcept;
+    ~SessionPool();
+
+    /// 링을 하나 꺼냅니다. 보관분이 없으면 새로 만듭니다. (생성 실패 시 RingBuffer 예외 전파)
+    [[nodiscard]] std::unique_ptr<hypernet::buffer::RingBuffer> acquireRing(std::size_t capacity, Layout layout);
+
+    /// 링을 돌려놓습니다. acquireRing 에 넘겼던 capacity/layout 을 그대로 넘겨야 합니다.
+    void releaseRing(std::size_t capacity, Layout layout, std::unique_ptr<hypernet::buffer::RingBuffer> ring) noexcept;
+
+    /// 보관 중인 링의 저장소를 한 번씩 써서 페이지를 미리 올립니다. (owner 워커, prewarm 직후)
+    void prefaultIdleRings() noexcept;
+
+    [[nodiscard]] std::size_t maxIdle() const noexcept { return maxIdle_; }
+    [[nodiscard]] std::size_t idleSessions() const noexcept { return idleSlots_.size(); }
+    [[nodiscard]] std::size_t idleRings() const noexcept;
+    [[nodiscard]] const Stats &stats() const noexcept { return stats_; }
+
+    /// hit/miss 누적을 0으로 돌립니다. (prewarm 직후: 미리 채운 할당을 miss 로 세지 않도록)
+    void resetStats() noexcept;
+
+  private:
+    template <typename T> friend class SessionPoolAllocator;
+
+    struct RingClass
+    {
+        std::size_t capacity{0};
+        Layout layout{Layout::Flat};
+        std::vector<std::unique_ptr<hypernet::buffer::RingBuffer>> idle;
+    };
+
+    [[nodiscard]] void *allocateSlot_(std::size_t bytes);
+    void deallocateSlot_(void *p, std::size_t bytes) noexcept;
+
+    [[nodiscard]] bool onOwnerThread_() const noexcept;
+    [[nodiscard]] RingClass *findClass_(std::size_t capacity, Layout layout) noexcept;
+    void publish_() noexcept;
+
+    int ownerWorkerId_{-1};
+    std::size_t maxIdle_{0};
+
+    std::size_t slotBytes_{0}; ///< 첫 allocate 크기로 고정 (다른 크기는 풀을 거치지 않음)
+    std::vector<void *> idleSlots_;
+    std::vector<RingClass> ringClasses_;
+    std::size_t idleRingCount_{0};
+
+    Stats stats_{};
+    hypernet::monitoring::WorkerSessionPoolMetrics *metrics_{nullptr};
+};
+
+/// SessionPool 슬롯에서 메모리를 꺼내는 allocator 입니다. (std::allocate_shared 용)
+/// - control block 이 allocator 사본을 들고 있으므로 마지막 weak 참조가 놓일 때까지 풀이 살아 있습니다.
+template <typename T> class SessionPoolAllocator
+{
+  public:
+    using value_type = T;
+
+    explicit SessionPoolAllocator(std::shared_ptr<SessionPool> pool) noexcept : pool_(std::move(pool)) {}
+
+    template <typename U>
+    SessionPoolAllocator(const SessionPoolAllocator<U> &other) noexcept : pool_(other.pool_)
+    {
+    }
+
+    [[nodiscard]] T *allocate(std::size_t n)
+    {
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "SessionPool slots use default new alignment");
+        return static_cast<T *>(pool_->allocateSlot_(n * sizeof(T)));
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept { pool_->deallocateSlot_(p, n * sizeof(T)); }
+
+    friend bool operator==(const SessionPoolAllocator &a, const SessionPoolAllocator &b) noexcept
+    {
+        return a.pool_ == b.pool_;
+    }
+
+  private:
+    template <typename U> friend class SessionPoolAllocator;
+
+    std::shared_ptr<SessionPool> pool_;
+};
+
+} // namespace hypernet::net
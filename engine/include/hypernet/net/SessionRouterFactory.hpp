@@ -8,8 +8,12 @@
 
 namespace hypernet::net
 {
+class WorkerMesh;
+
 /// Engine이 워커들의 EventLoop 포인터들을 모아서 넘기면,
 /// cross-thread send/broadcast를 처리하는 라우터를 만들어준다.
+/// - mesh 가 있으면 워커→워커 단건 send 는 워커 쌍 전용 채널(descriptor)을 먼저 시도한다.
 std::shared_ptr<hypernet::ISessionRouter>
-makeGlobalSessionRouter(std::vector<hypernet::net::EventLoop *> loops) noexcept;
+makeGlobalSessionRouter(std::vector<hypernet::net::EventLoop *> loops,
+                        std::shared_ptr<WorkerMesh> mesh = nullptr) noexcept;
 } // namespace hypernet::net
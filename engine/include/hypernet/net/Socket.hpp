@@ -65,6 +65,16 @@ class Socket : private hypernet::util::NonCopyable {
     /// TCP_NODELAY 옵션을 설정합니다. (Nagle 알고리즘 on/off)
     [[nodiscard]] bool setNoDelay(bool enable) noexcept;
 
+    /// SO_BUSY_POLL 옵션을 설정합니다. (수신 시 NIC 큐를 usec 동안 busy-poll)
+    /// - net.core.busy_read 보다 큰 값은 CAP_NET_ADMIN 이 필요합니다(EPERM).
+    [[nodiscard]] bool setBusyPoll(int usec) noexcept;
+
+    /// TCP_CORK 옵션을 설정합니다. (해제 시 모아 둔 부분 세그먼트를 즉시 송신)
+    [[nodiscard]] bool setCork(bool enable) noexcept;
+
+    /// SO_ZEROCOPY 옵션을 설정합니다. (MSG_ZEROCOPY 송신 허용, Linux 4.14+)
+    [[nodiscard]] bool setZeroCopy(bool enable) noexcept;
+
     /// 지정된 주소로 bind 합니다.
     [[nodiscard]] bool bind(const ::sockaddr *addr, ::socklen_t len) noexcept;
 
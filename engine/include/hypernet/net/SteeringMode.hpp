@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+
+namespace hypernet::net
+{
+
+/// 새 연결을 어느 워커가 받을지 정하는 방식입니다.
+///
+/// - Kernel     : 워커마다 SO_REUSEPORT 리스너, 커널 4-tuple 해시로 분배. (기본값, 기존 동작)
+/// - IncomingCpu: reuseport 그룹에 cBPF 를 붙여 SYN 을 받은 CPU(SO_INCOMING_CPU)에 고정된 워커로 보냅니다.
+///                NIC 큐 IRQ 를 워커 CPU 에 맞춰 두면 연결이 처음부터 끝까지 같은 코어에 머뭅니다.
+/// - Weighted   : reuseport 그룹의 cBPF 가 가중치 비율로 무작위 선택. 워커 0 이 주기마다
+///                워커별 세션 수로 가중치를 다시 계산해 프로그램을 교체합니다.
+/// - LeastLoaded: 워커 0 만 리스너를 열고, accept 한 fd 를 세션이 가장 적은 워커에 task 로 넘깁니다.
+enum class SteeringMode : std::uint8_t
+{
+    Kernel = 0,
+    IncomingCpu,
+    Weighted,
+    LeastLoaded,
+};
+
+[[nodiscard]] constexpr const char *toString(SteeringMode m) noexcept
+{
+    switch (m)
+    {
+    case SteeringMode::Kernel:
+        return "kernel";
+    case SteeringMode::IncomingCpu:
+        return "cpu";
+    case SteeringMode::Weighted:
+        return "weighted";
+    case SteeringMode::LeastLoaded:
+        return "least_loaded";
+    }
+    return "unknown";
+}
+
+} // namespace hypernet::net
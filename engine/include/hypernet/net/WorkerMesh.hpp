@@ -0,0 +1,168 @@
+#pragma once
+
+#include <hypernet/SessionHandle.hpp>
+#include <hypernet/core/Task.hpp>
+#include <hypernet/protocol/FieldPatch.hpp>
+#include <hypernet/util/NonCopyable.hpp>
+#include <hypernet/util/SpscRing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace hypernet::monitoring
+{
+class LatencyHistogram;
+}
+
+namespace hypernet::net
+{
+
+class EventLoop;
+
+/// 워커 간 handoff 에 쓰이는 고정 크기(2 cache line) descriptor 입니다.
+///
+/// - Packet: sid 세션으로 [opcode|body] 를 보냅니다. body 는 inline 으로 복사됩니다.
+/// - Task  : EventLoop::post 의 cross-worker 경로. core::Task 객체가 body 안에 직접 생성되고,
+///           수신 워커가 제자리에서 실행/파괴합니다. (슬롯을 바이트 복사하지 않음 → 할당 없음)
+///           sid 자리에는 post 시각(steady ns)을 실어 수신 쪽이 post → 실행 지연을 잽니다.
+struct alignas(64) HandoffDescriptor
+{
+    static constexpr std::size_t kInlineBytes = 112;
+
+    enum class Kind : std::uint8_t
+    {
+        Packet = 0,
+        Task,
+    };
+
+    Kind kind{Kind::Packet};
+    std::uint16_t opcode{0};
+    std::uint32_t len{0};
+    SessionHandle::Id sid{0}; ///< Packet: 대상 세션 / Task: post 시각(steady ns)
+    alignas(16) unsigned char body[kInlineBytes];
+};
+static_assert(sizeof(HandoffDescriptor) == 128, "HandoffDescriptor must span exactly two cache lines");
+static_assert(sizeof(core::Task) <= HandoffDescriptor::kInlineBytes && alignof(core::Task) <= 16,
+              "core::Task must fit in HandoffDescriptor::body");
+
+/// 워커 쌍(src→dst)마다 전용 SPSC 링을 두는 N×N handoff mesh 입니다.
+///
+/// - 채널 (src, dst) 의 producer 는 src 워커 스레드, consumer 는 dst 워커 스레드뿐이므로
+///   공유 MPSC 큐의 CAS 경합 / 작업당 힙 할당 없이 cache line 몇 개만 오갑니다.
+/// - dst 이벤트 루프는 매 iteration(drainTasks)마다 poll() 로 inbound 링을 비우고,
+///   잠들기 직전 hasInbound() 를 다시 봅니다. producer 는 push 뒤 dst 가 잠들어 있을 때만 깨웁니다.
+/// - 링이 꽉 차면 descriptor 는 src 쪽 backlog 에 순서대로 쌓이고(유실/블로킹 없음), src 의 다음
+///   poll() 에서 밀어 넣습니다. dst 는 링을 비운 뒤 backlog 가 있는 src 를 깨웁니다.
+/// - 채널 안에서는 FIFO 가 보장됩니다. (Packet/Task 구분 없이 같은 링을 씀)
+class WorkerMesh : private hypernet::util::NonCopyable
+{
+  public:
+    using Task = core::Task;
+
+    /// dst 워커 스레드에서 Packet descriptor 를 세션으로 내보내는 함수입니다.
+    /// (보통 SessionManager::sendPacketU16)
+    using PacketSink = std::function<bool(SessionHandle::Id, std::uint16_t, const void *, std::size_t)>;
+
+    /// @param workerCount 워커 수 (채널 수 = workerCount²)
+    /// @param ringSlots 채널당 슬롯 수 (2의 거듭제곱으로 올림)
+    WorkerMesh(int workerCount, std::size_t ringSlots);
+    ~WorkerMesh();
+
+    [[nodiscard]] int workerCount() const noexcept { return workerCount_; }
+    [[nodiscard]] std::size_t ringSlots() const noexcept { return ringSlots_; }
+
+    /// 워커의 루프/송신 sink 를 연결합니다. (워커 스레드 시작 전, 메인 스레드)
+    void attach(int wid, EventLoop *loop, PacketSink sink);
+
+    /// 워커를 mesh 에서 떼어 냅니다. (EventLoop 파괴 전) 이후 이 워커로의 handoff 는 false
+    void detach(int wid) noexcept;
+
+    /// 현재 스레드가 src 워커 루프의 owner thread 인지 확인합니다.
+    [[nodiscard]] bool isProducerThread(int src) const noexcept;
+
+    /// dst 워커의 sid 세션으로 패킷을 넘깁니다. (src 워커 스레드 전용)
+    /// - patches 가 있으면 descriptor 에 복사한 body 위에 덮어씁니다. (relay, 복사는 그대로 1회)
+    /// @return body 가 inline 용량을 넘거나, src/dst 가 유효하지 않거나, 호출 스레드가 src 워커가
+    ///         아니거나, 링이 꽉 찬 채 backlog 할당에 실패하면 false (호출자는 기존 경로를 쓴다)
+    bool sendPacket(int src, int dst, SessionHandle::Id sid, std::uint16_t opcode, const void *body,
+                    std::size_t len, std::span<const protocol::FieldPatch> patches = {}) noexcept;
+
+    /// dst 워커에서 task 를 실행하도록 넘깁니다. (src 워커 스레드 전용)
+    /// - 성공했을 때만 task 를 move 해 갑니다. 실패하면 task 는 그대로 남습니다.
+    bool post(int src, int dst, Task &task) noexcept;
+
+    /// wid 워커의 inbound 채널을 비우고, wid 가 보낸 backlog 를 링으로 밀어 넣습니다. (wid 워커 스레드 전용)
+    /// @param taskDelay Task 의 post → 실행 지연을 기록할 히스토그램 (nullptr 이면 미집계)
+    /// @return 처리한 inbound descriptor 수
+    std::size_t poll(int wid, monitoring::LatencyHistogram *taskDelay = nullptr) noexcept;
+
+    /// wid 워커로 들어온 descriptor 가 남아 있는지 확인합니다. (wid 워커 스레드 전용, 잠들기 직전)
+    [[nodiscard]] bool hasInbound(int wid) const noexcept;
+
+  private:
+    /// 한 번의 poll 에서 채널당 최대로 처리할 descriptor 수 (다른 채널/I/O 기아 방지)
+    static constexpr std::size_t kPollBudgetPerChannel = 256;
+
+    struct Channel
+    {
+        explicit Channel(std::size_t slots) : ring(slots) {}
+
+        util::SpscRing<HandoffDescriptor> ring;
+
+        /// 링이 꽉 찼을 때 src 가 쌓아 두는 descriptor (src 스레드 전용)
+        /// - deque 는 push_back/pop_front 에서 원소를 옮기지 않으므로 body 안의 Task 가 안전합니다.
+        std::deque<HandoffDescriptor> backlog;
+
+        /// backlog 가 남아 있어 dst 가 링을 비운 뒤 src 를 깨워야 하는지
+        alignas(64) std::atomic_bool backlogged{false};
+    };
+
+    struct Endpoint
+    {
+        std::atomic<EventLoop *> loop{nullptr};
+        PacketSink sink;
+        std::size_t backlogChannels{0}; ///< backlog 가 비어 있지 않은 outbound 채널 수 (owner 전용)
+    };
+
+    int workerCount_{0};
+    std::size_t ringSlots_{0};
+    std::vector<std::unique_ptr<Channel>> channels_; ///< index = src * workerCount_ + dst
+    std::unique_ptr<Endpoint[]> endpoints_;
+
+    [[nodiscard]] Channel &channel_(int src, int dst) noexcept
+    {
+        return *channels_[static_cast<std::size_t>(src * workerCount_ + dst)];
+    }
+    [[nodiscard]] const Channel &channel_(int src, int dst) const noexcept
+    {
+        return *channels_[static_cast<std::size_t>(src * workerCount_ + dst)];
+    }
+
+    /// src/dst 범위, 호출 스레드, dst 연결 상태를 확인합니다.
+    [[nodiscard]] bool canSend_(int src, int dst) const noexcept;
+
+    /// fill(HandoffDescriptor&) 로 채널 슬롯(또는 backlog 끝)을 제자리에서 채우고 dst 를 깨웁니다.
+    /// (backlog 가 있으면 순서 유지를 위해 backlog 뒤에 붙임)
+    /// @return backlog 노드를 할당하지 못하면 fill 을 부르지 않고 false
+    template <typename Fill>
+    bool enqueue_(int src, int dst, Fill &&fill) noexcept;
+
+    /// src 의 내용을 dst 로 옮깁니다. (Task 는 move 후 src 쪽을 파괴)
+    static void relocate_(HandoffDescriptor &dst, HandoffDescriptor &src) noexcept;
+
+    /// Task descriptor 의 body 안에 있는 Task 를 파괴합니다. (Packet 이면 아무것도 안 함)
+    static void destroy_(HandoffDescriptor &desc) noexcept;
+
+    /// backlog 를 링이 받는 만큼 밀어 넣습니다. @return 넣은 개수
+    std::size_t flushBacklog_(Channel &ch) noexcept;
+
+    void dispatch_(int wid, HandoffDescriptor &desc, monitoring::LatencyHistogram *taskDelay) noexcept;
+};
+
+} // namespace hypernet::net
@@ -8,6 +8,13 @@
 
 namespace hypernet::net
 {
+class WorkerMesh;
+class SessionMigrator;
+
+/// mesh 가 있으면 워커 스레드에서의 handoffPacket 이 워커 쌍 전용 채널을 탄다. (nullptr 이면 비활성)
+/// migrator 가 있으면 migrateSession 이 동작한다. (nullptr 이면 항상 false)
 std::shared_ptr<hypernet::IWorkerScheduler>
-makeGlobalWorkerScheduler(std::vector<hypernet::net::EventLoop *> loops) noexcept;
-}
\ No newline at end of file
+makeGlobalWorkerScheduler(std::vector<hypernet::net::EventLoop *> loops,
+                          std::shared_ptr<WorkerMesh> mesh = nullptr,
+                          std::shared_ptr<SessionMigrator> migrator = nullptr) noexcept;
+} // namespace hypernet::net
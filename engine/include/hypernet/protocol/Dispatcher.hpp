@@ -1,13 +1,19 @@
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
-#include <unordered_map>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <hypernet/SessionHandle.hpp>
 #include <hypernet/protocol/MessageView.hpp>
 #include <hypernet/protocol/Endian.hpp>
+#include <hypernet/util/OpcodeTable.hpp>
 
 namespace hypernet::protocol
 {
@@ -40,46 +46,336 @@ struct MessageHeader
     }
 };
 
+/// opcode -> 핸들러 테이블입니다. (워커 스레드 전용, 등록은 워커 시작 시)
+///
+/// - 저장소는 opcode 로 바로 인덱싱하는 OpcodeTable 이고, 엔트리는 함수 포인터 + ctx + 허용 상태 마스크입니다.
+///   dispatch 는 테이블 조회 뒤 간접 호출 한 번이며 std::function 을 거치지 않습니다.
+/// - registerHandler(opcode, callable) 은 callable 을 Dispatcher 가 소유하는 상자에 옮겨 담고,
+///   그 타입 전용 thunk 를 함수 포인터로 씁니다. (호출 경로에서 callable 은 inline 됨)
+/// - bind<Fn>(opcode, ctx) / bindRoutes<Route...>(ctx) 는 컴파일 타임에 정해진 함수를 thunk 로 직접 부릅니다.
+///   (상자 할당도 없음)
+/// - allowedMask 는 엔진이 해석하지 않습니다. 엔트리에 저장해 두었다가, 핸들러가
+///   (..., std::uint32_t allowedMask) 형태를 받으면 함께 넘겨줍니다. (앱 상태 가드용)
 class Dispatcher
 {
   public:
     using OpCode = std::uint16_t;
+
+    /// 등록 시 마스크를 주지 않으면 모든 상태 허용으로 저장합니다.
+    static constexpr std::uint32_t kAnyState = ~std::uint32_t{0};
+
+    /// [호환] 기존 std::function 타입 별칭 (registerHandler 에 그대로 넘겨도 됩니다)
     using Handler =
         std::function<void(hypernet::SessionHandle, const hypernet::protocol::MessageView &)>;
 
+    /// 같은 세션의 한 recv burst 안에서 연속으로 들어온 같은 opcode body 들을 한 번에 받는 핸들러입니다.
+    /// - span 의 MessageView 는 호출 동안만 유효합니다. (MessageView 수명 규약과 동일)
+    /// - 순서는 wire 순서 그대로입니다. 다른 opcode 가 끼면 run 이 끊겨 여러 번 호출됩니다.
+    using BatchHandler =
+        std::function<void(hypernet::SessionHandle, std::span<const hypernet::protocol::MessageView>)>;
+
+    using InvokeFn = void (*)(void *ctx, std::uint32_t allowedMask, hypernet::SessionHandle,
+                              const hypernet::protocol::MessageView &);
+    using BatchFn = void (*)(void *ctx, std::uint32_t allowedMask, hypernet::SessionHandle,
+                             std::span<const hypernet::protocol::MessageView>);
+
+    /// 정적 등록 한 줄: opcode, 호출할 함수(자유 함수 또는 멤버 함수 포인터), 허용 상태 마스크
+    /// - Fn 은 (Ctx&, SessionHandle, const MessageView&[, std::uint32_t allowedMask]) 로 호출 가능해야 합니다.
+    template <OpCode Op, auto Fn, std::uint32_t Mask = kAnyState>
+    struct Route
+    {
+        static constexpr OpCode opcode = Op;
+        static constexpr auto fn = Fn;
+        static constexpr std::uint32_t mask = Mask;
+    };
+
+    Dispatcher() = default;
+    Dispatcher(const Dispatcher &) = delete;
+    Dispatcher &operator=(const Dispatcher &) = delete;
+
     /// 핸들러 등록(중복 opcode는 거부)
+    /// - fn 은 (SessionHandle, const MessageView&[, std::uint32_t allowedMask]) 로 호출 가능해야 합니다.
     /// @return true if inserted, false if opcode already exists or handler invalid
-    bool registerHandler(OpCode opcode, Handler handler) noexcept
+    template <typename Fn>
+    bool registerHandler(OpCode opcode, Fn &&fn, std::uint32_t allowedMask = kAnyState)
+    {
+        using Box = std::decay_t<Fn>;
+        static_assert(std::is_invocable_v<Box &, hypernet::SessionHandle, const MessageView &> ||
+                          std::is_invocable_v<Box &, hypernet::SessionHandle, const MessageView &, std::uint32_t>,
+                      "handler must be callable as (SessionHandle, const MessageView&[, uint32_t allowedMask])");
+
+        if (isNull_(fn) || isTaken_(opcode))
+        {
+            return false;
+        }
+        Entry e{};
+        e.invoke = &invokeBox_<Box>;
+        e.ctx = adopt_<Box>(std::forward<Fn>(fn));
+        e.allowedMask = allowedMask;
+        return insert_(opcode, e);
+    }
+
+    /// [opt-in] 배치 핸들러 등록 (중복 opcode는 거부, 단건 핸들러와 같은 opcode 공유 불가)
+    /// - 단건 dispatch() 로 들어온 메시지도 길이 1 span 으로 이 핸들러에 전달됩니다.
+    /// - fn 은 (SessionHandle, span<const MessageView>[, std::uint32_t allowedMask]) 로 호출 가능해야 합니다.
+    /// @return true if inserted, false if opcode already exists or handler invalid
+    template <typename Fn>
+    bool registerBatchHandler(OpCode opcode, Fn &&fn, std::uint32_t allowedMask = kAnyState)
+    {
+        using Box = std::decay_t<Fn>;
+        if (isNull_(fn) || isTaken_(opcode))
+        {
+            return false;
+        }
+        Entry e{};
+        e.batch = &invokeBatchBox_<Box>;
+        e.ctx = adopt_<Box>(std::forward<Fn>(fn));
+        e.allowedMask = allowedMask;
+        return insert_(opcode, e);
+    }
+
+    /// [static] 컴파일 타임에 정해진 Fn 을 ctx 와 묶어 등록합니다. (상자/할당 없음, ctx 수명은 호출자 책임)
+    /// @return true if inserted, false if opcode already exists or ctx == nullptr
+    template <auto Fn, typename Ctx>
+    bool bind(OpCode opcode, Ctx *ctx, std::uint32_t allowedMask = kAnyState) noexcept
+    {
+        static_assert(std::is_invocable_v<decltype(Fn), Ctx &, hypernet::SessionHandle, const MessageView &> ||
+                          std::is_invocable_v<decltype(Fn), Ctx &, hypernet::SessionHandle, const MessageView &,
+                                              std::uint32_t>,
+                      "Fn must be callable as (Ctx&, SessionHandle, const MessageView&[, uint32_t allowedMask])");
+
+        if (ctx == nullptr || isTaken_(opcode))
+        {
+            return false;
+        }
+        Entry e{};
+        e.invoke = &invokeStatic_<Fn, Ctx>;
+        e.ctx = const_cast<void *>(static_cast<const void *>(ctx));
+        e.allowedMask = allowedMask;
+        return insert_(opcode, e);
+    }
+
+    /// [static] Route 목록을 한 번에 등록합니다. opcode 중복은 컴파일 에러입니다.
+    /// @return 모두 등록되었으면 true (이미 있던 opcode 는 건너뛰고 false)
+    template <typename... Routes, typename Ctx>
+    bool bindRoutes(Ctx *ctx) noexcept
     {
-        if (!handler)
+        static_assert(uniqueOpcodes_<Routes::opcode...>(), "duplicate opcode in Dispatcher::bindRoutes");
+
+        bool ok = true;
+        ((ok = bind<Routes::fn>(Routes::opcode, ctx, Routes::mask) && ok), ...);
+        return ok;
+    }
+
+    bool unregisterHandler(OpCode opcode) noexcept
+    {
+        Entry *e = table_.find(opcode);
+        if (e == nullptr || !e->occupied())
         {
             return false;
         }
-        auto [it, inserted] = handlers_.emplace(opcode, std::move(handler));
-        return inserted;
+        release_(e->ctx);
+        *e = Entry{};
+        --count_;
+        return true;
     }
 
-    bool unregisterHandler(OpCode opcode) noexcept { return handlers_.erase(opcode) > 0; }
+    void clear() noexcept
+    {
+        table_.clear();
+        owned_.clear();
+        count_ = 0;
+    }
 
-    void clear() noexcept { handlers_.clear(); }
+    [[nodiscard]] std::size_t handlerCount() const noexcept { return count_; }
 
-    [[nodiscard]] std::size_t handlerCount() const noexcept { return handlers_.size(); }
+    /// 등록된 허용 상태 마스크 (없는 opcode 면 0)
+    [[nodiscard]] std::uint32_t allowedMask(OpCode opcode) const noexcept
+    {
+        const Entry *e = table_.find(opcode);
+        return (e != nullptr && e->occupied()) ? e->allowedMask : 0;
+    }
 
     /// @return true if handled, false if unknown opcode
     bool dispatch(OpCode opcode, hypernet::SessionHandle session,
                   const hypernet::protocol::MessageView &body) const
     {
-        auto it = handlers_.find(opcode);
-        if (it == handlers_.end())
+        const Entry *e = table_.find(opcode);
+        if (e == nullptr || !e->occupied())
         {
             return false;
         }
-        it->second(session, body);
+        if (e->batch != nullptr)
+        {
+            e->batch(e->ctx, e->allowedMask, session, std::span<const MessageView>{&body, 1});
+        }
+        else
+        {
+            e->invoke(e->ctx, e->allowedMask, session, body);
+        }
+        return true;
+    }
+
+    /// 같은 opcode 의 body 묶음을 전달합니다. (배치 핸들러면 1회, 단건 핸들러면 body 마다 1회)
+    /// - stop() 이 true 를 반환하면 단건 루프를 중단합니다. (예: 핸들러가 세션을 닫음)
+    /// @return true if handled, false if unknown opcode
+    template <typename StopFn>
+    bool dispatchBatch(OpCode opcode, hypernet::SessionHandle session, std::span<const MessageView> bodies,
+                       StopFn &&stop) const
+    {
+        const Entry *e = table_.find(opcode);
+        if (e == nullptr || !e->occupied())
+        {
+            return false;
+        }
+        if (e->batch != nullptr)
+        {
+            e->batch(e->ctx, e->allowedMask, session, bodies);
+            return true;
+        }
+        for (const auto &body : bodies)
+        {
+            e->invoke(e->ctx, e->allowedMask, session, body);
+            if (stop())
+            {
+                break;
+            }
+        }
         return true;
     }
 
   private:
-    std::unordered_map<OpCode, Handler> handlers_;
+    struct Entry
+    {
+        InvokeFn invoke{nullptr};
+        BatchFn batch{nullptr};
+        void *ctx{nullptr};
+        std::uint32_t allowedMask{0};
+
+        [[nodiscard]] bool occupied() const noexcept { return invoke != nullptr || batch != nullptr; }
+    };
+
+    /// registerHandler 로 넘겨받은 callable 의 소유 상자 (ctx 로 가리킴)
+    using Owned = std::unique_ptr<void, void (*)(void *)>;
+
+    template <typename Box>
+    static void invokeBox_(void *ctx, std::uint32_t allowedMask, hypernet::SessionHandle session,
+                           const MessageView &body)
+    {
+        Box &fn = *static_cast<Box *>(ctx);
+        if constexpr (std::is_invocable_v<Box &, hypernet::SessionHandle, const MessageView &, std::uint32_t>)
+        {
+            fn(session, body, allowedMask);
+        }
+        else
+        {
+            (void)allowedMask;
+            fn(session, body);
+        }
+    }
+
+    template <typename Box>
+    static void invokeBatchBox_(void *ctx, std::uint32_t allowedMask, hypernet::SessionHandle session,
+                                std::span<const MessageView> bodies)
+    {
+        Box &fn = *static_cast<Box *>(ctx);
+        if constexpr (std::is_invocable_v<Box &, hypernet::SessionHandle, std::span<const MessageView>,
+                                          std::uint32_t>)
+        {
+            fn(session, bodies, allowedMask);
+        }
+        else
+        {
+            (void)allowedMask;
+            fn(session, bodies);
+        }
+    }
+
+    template <auto Fn, typename Ctx>
+    static void invokeStatic_(void *ctx, std::uint32_t allowedMask, hypernet::SessionHandle session,
+                              const MessageView &body)
+    {
+        Ctx &c = *static_cast<Ctx *>(ctx);
+        if constexpr (std::is_invocable_v<decltype(Fn), Ctx &, hypernet::SessionHandle, const MessageView &,
+                                          std::uint32_t>)
+        {
+            std::invoke(Fn, c, session, body, allowedMask);
+        }
+        else
+        {
+            (void)allowedMask;
+            std::invoke(Fn, c, session, body);
+        }
+    }
+
+    template <OpCode... Ops>
+    static constexpr bool uniqueOpcodes_() noexcept
+    {
+        constexpr std::array<OpCode, sizeof...(Ops)> ops{Ops...};
+        for (std::size_t i = 0; i < ops.size(); ++i)
+        {
+            for (std::size_t j = i + 1; j < ops.size(); ++j)
+            {
+                if (ops[i] == ops[j])
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /// 빈 std::function / 함수 포인터 nullptr 는 등록하지 않습니다.
+    template <typename Fn>
+    [[nodiscard]] static bool isNull_(const Fn &fn) noexcept
+    {
+        if constexpr (requires { static_cast<bool>(fn); })
+        {
+            return !static_cast<bool>(fn);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    [[nodiscard]] bool isTaken_(OpCode opcode) const noexcept
+    {
+        const Entry *e = table_.find(opcode);
+        return e != nullptr && e->occupied();
+    }
+
+    template <typename Box, typename Fn>
+    void *adopt_(Fn &&fn)
+    {
+        Owned box(new Box(std::forward<Fn>(fn)), [](void *p) { delete static_cast<Box *>(p); });
+        void *raw = box.get();
+        owned_.push_back(std::move(box));
+        return raw;
+    }
+
+    void release_(void *ctx) noexcept
+    {
+        for (auto it = owned_.begin(); it != owned_.end(); ++it)
+        {
+            if (it->get() == ctx)
+            {
+                owned_.erase(it);
+                return;
+            }
+        }
+    }
+
+    bool insert_(OpCode opcode, const Entry &e)
+    {
+        table_.at(opcode) = e;
+        ++count_;
+        return true;
+    }
+
+    hypernet::util::OpcodeTable<Entry> table_;
+    std::vector<Owned> owned_;
+    std::size_t count_{0};
 };
 
 } // namespace hypernet::protocol
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include <hypernet/protocol/Endian.hpp>
+
+namespace hypernet::protocol
+{
+
+/// relay 시 body 의 고정 위치 필드 하나를 덮어쓰는 패치입니다. (wire big-endian)
+/// - offset 은 body(opcode 뒤) 기준 바이트 위치, width 는 1/2/4/8 중 하나입니다.
+struct FieldPatch
+{
+    std::uint32_t offset{0};
+    std::uint8_t width{0};
+    std::uint64_t value{0};
+};
+
+/// 메시지 하나에 줄 수 있는 패치 수 상한 (조각 수/스택 버퍼를 고정하기 위함)
+inline constexpr std::size_t kMaxFieldPatches = 4;
+
+/// 송신 경로가 iovec/링에 그대로 싣는 연속 바이트 조각입니다.
+struct BodyPiece
+{
+    const std::uint8_t *p{nullptr};
+    std::size_t n{0};
+};
+
+/// body 를 "원본 조각 / 패치 바이트" 순서의 조각으로 펼친 결과입니다.
+/// - 원본 조각은 body 를 가리키고, 패치 바이트는 bytes 에 인코딩됩니다. (body 는 건드리지 않음)
+/// - 송신 경로가 조각을 그대로 writev/링 적재하므로 body 를 따로 복사해 고칠 필요가 없습니다.
+struct PatchedBody
+{
+    static constexpr std::size_t kMaxPieces = 2 * kMaxFieldPatches + 1;
+
+    std::array<BodyPiece, kMaxPieces> pieces;
+    std::size_t count{0};
+    std::size_t total{0};
+    std::array<std::uint8_t, 8 * kMaxFieldPatches> bytes;
+};
+
+/// 패치 목록이 bodyLen 짜리 body 에 적용 가능한지 확인합니다.
+/// - 개수 ≤ kMaxFieldPatches, width ∈ {1,2,4,8}, 범위 안, offset 오름차순이며 겹치지 않아야 합니다.
+[[nodiscard]] inline bool validFieldPatches(std::span<const FieldPatch> patches, std::size_t bodyLen) noexcept
+{
+    if (patches.size() > kMaxFieldPatches)
+        return false;
+
+    std::size_t next = 0;
+    for (const auto &f : patches)
+    {
+        if (f.width != 1 && f.width != 2 && f.width != 4 && f.width != 8)
+            return false;
+        if (f.offset < next || static_cast<std::size_t>(f.offset) + f.width > bodyLen)
+            return false;
+        next = static_cast<std::size_t>(f.offset) + f.width;
+    }
+    return true;
+}
+
+/// 패치 값을 width 바이트 big-endian 으로 out 에 씁니다.
+inline void storeFieldPatch(const FieldPatch &f, std::uint8_t *out) noexcept
+{
+    switch (f.width)
+    {
+    case 1:
+        out[0] = static_cast<std::uint8_t>(f.value);
+        break;
+    case 2:
+        storeU16Be(static_cast<std::uint16_t>(f.value), out);
+        break;
+    case 4:
+        storeU32Be(static_cast<std::uint32_t>(f.value), out);
+        break;
+    default:
+        storeU64Be(f.value, out);
+        break;
+    }
+}
+
+/// 제자리 패치: body 는 호출자가 단독으로 쓰는 버퍼여야 합니다. (validFieldPatches 통과한 목록)
+inline void applyFieldPatches(void *body, std::span<const FieldPatch> patches) noexcept
+{
+    auto *p = static_cast<std::uint8_t *>(body);
+    for (const auto &f : patches)
+        storeFieldPatch(f, p + f.offset);
+}
+
+/// body + 패치를 조각 목록으로 펼칩니다. (validFieldPatches 실패 시 false)
+[[nodiscard]] inline bool splitPatched(const void *body, std::size_t bodyLen, std::span<const FieldPatch> patches,
+                                       PatchedBody &out) noexcept
+{
+    if (!validFieldPatches(patches, bodyLen) || (bodyLen != 0 && body == nullptr))
+        return false;
+
+    const auto *src = static_cast<const std::uint8_t *>(body);
+    std::size_t pos = 0;
+    std::size_t used = 0;
+    out.count = 0;
+    out.total = bodyLen;
+
+    for (const auto &f : patches)
+    {
+        if (f.offset > pos)
+            out.pieces[out.count++] = BodyPiece{src + pos, f.offset - pos};
+
+        std::uint8_t *dst = out.bytes.data() + used;
+        storeFieldPatch(f, dst);
+        out.pieces[out.count++] = BodyPiece{dst, f.width};
+
+        used += f.width;
+        pos = static_cast<std::size_t>(f.offset) + f.width;
+    }
+    if (pos < bodyLen)
+        out.pieces[out.count++] = BodyPiece{src + pos, bodyLen - pos};
+    return true;
+}
+
+} // namespace hypernet::protocol
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 #include <hypernet/protocol/MessageView.hpp>
 
@@ -39,6 +40,27 @@ class IFramer {
     /// out 수명:
     /// - out(MessageView)은 "콜백 동안만 유효" 규약을 따른다.
     virtual FrameResult tryFrame(buffer::RingBuffer &in, MessageView &out) = 0;
+
+    /// 입력 버퍼에 지금 들어 있는 완성 프레임을 모두 추출해 out 뒤에 덧붙입니다.
+    ///
+    /// 규약:
+    /// - 1개 이상 추가했으면 Framed, 하나도 없으면 NeedMore 를 반환합니다.
+    /// - 잘못된 프레임을 만나면 Invalid 를 반환하되, 그 앞에서 추출한 프레임은 out 에 남습니다.
+    ///   (호출자는 out 을 먼저 처리한 뒤 close 정책을 적용합니다.)
+    ///
+    /// out 수명:
+    /// - out 의 모든 view 는 다음 tryFrame/tryFrameBatch 호출 또는 in 에 대한 write 전까지 유효해야 합니다.
+    /// - 기본 구현은 tryFrame 1회입니다. (내부 scratch 를 프레임마다 재사용하는 framer 도 안전)
+    virtual FrameResult tryFrameBatch(buffer::RingBuffer &in, std::vector<MessageView> &out)
+    {
+        MessageView one{};
+        const FrameResult r = tryFrame(in, one);
+        if (r == FrameResult::Framed)
+        {
+            out.push_back(one);
+        }
+        return r;
+    }
 };
 
 } // namespace hypernet::protocol
@@ -23,8 +23,9 @@ namespace hypernet::protocol
  * - [0..3] : Payload Length (u32, Big-Endian) - Opcode(2) + Body(N)의 합계
  * - [4..]  : Payload (Opcode + Body)
  * * [메모리 정책]
- * - RingBuffer 내 데이터가 연속적이면 readView()를 통해 제로-카피(Zero-copy)로 추출합니다.
- * - 링버퍼 Wrap-around 발생 시에만 내부 scratch 버퍼로 복사하여 연속성을 확보합니다.
+ * - 헤더+페이로드가 연속적이면 한 번의 readView()로 제로-카피(Zero-copy) 추출합니다.
+ *   (Mirrored 링은 모든 구간이 연속이므로 항상 이 경로입니다.)
+ * - Flat 링에서 Wrap-around 발생 시에만 내부 scratch 버퍼로 복사하여 연속성을 확보합니다.
  */
 class LengthPrefixFramer final : public IFramer
 {
@@ -39,6 +40,14 @@ class LengthPrefixFramer final : public IFramer
     }
 
     [[nodiscard]] std::uint32_t maxPayloadLen() const noexcept { return maxPayloadLen_; }
+
+    /// 예약해 둔 scratch 전체를 한 번 써서 페이지를 미리 올립니다. (워커 시작 시 prefault 용)
+    /// - 첫 wrap-around 프레임이 page fault 없이 복사되도록 합니다. 용량은 그대로 유지됩니다.
+    void prefaultScratch()
+    {
+        scratch_.resize(scratch_.capacity());
+        scratch_.clear();
+    }
     [[nodiscard]] const char *lastErrorReason() const noexcept { return lastErrorReason_; }
 
     FrameResult tryFrame(buffer::RingBuffer &in, MessageView &out) override
@@ -99,7 +108,16 @@ class LengthPrefixFramer final : public IFramer
             return FrameResult::NeedMore;
         }
 
-        // 6. 헤더 소비: 실제 데이터 추출을 위해 헤더 4바이트를 버퍼에서 읽어 제거
+        // 6. 프레임 전체가 연속이면 헤더 복사 없이 한 번에 소비 (Zero-copy)
+        const auto frame = in.peekView(totalFrameBytes);
+        if (frame.size() == totalFrameBytes)
+        {
+            (void)in.readView(totalFrameBytes);
+            out = (payloadLen == 0) ? MessageView{nullptr, 0} : MessageView{frame.data() + kHeaderSize, payloadLen};
+            return FrameResult::Framed;
+        }
+
+        // 7. 헤더 소비: 실제 데이터 추출을 위해 헤더 4바이트를 버퍼에서 읽어 제거
         std::array<std::byte, kHeaderSize> tmp{};
         const std::size_t headerRead = in.read(tmp.data(), kHeaderSize);
         if (headerRead != kHeaderSize)
@@ -115,7 +133,7 @@ class LengthPrefixFramer final : public IFramer
             return FrameResult::Framed;
         }
 
-        // 7. 데이터 추출 (Zero-copy 경로 시도)
+        // 8. 데이터 추출 (Zero-copy 경로 시도)
         // [중요] 사용자 엔진 RingBuffer API(peekView)를 사용하여 연속성 확인
         const auto contiguous = in.peekView(payloadLen);
         if (contiguous.size() == payloadLen)
@@ -126,7 +144,7 @@ class LengthPrefixFramer final : public IFramer
             return FrameResult::Framed;
         }
 
-        // 8. 데이터 추출 (Fallback: Copy 경로)
+        // 9. 데이터 추출 (Fallback: Copy 경로)
         // 링버퍼 Wrap-around 발생 시에만 scratch 버퍼에 모아서 연속성 확보
         scratch_.resize(payloadLen);
         const std::size_t payloadRead = in.read(scratch_.data(), payloadLen);
@@ -140,6 +158,28 @@ class LengthPrefixFramer final : public IFramer
         return FrameResult::Framed;
     }
 
+    /// 완성 프레임을 모두 추출합니다.
+    /// - 한 번에 소비하는 양은 링 용량 이하이므로 링 끝을 넘는 지점은 최대 1번입니다.
+    ///   → scratch_ 를 쓰는 프레임도 배치당 최대 1개라, 배치 안의 모든 view 가 동시에 유효합니다.
+    FrameResult tryFrameBatch(buffer::RingBuffer &in, std::vector<MessageView> &out) override
+    {
+        const std::size_t before = out.size();
+        MessageView one{};
+        for (;;)
+        {
+            const FrameResult r = tryFrame(in, one);
+            if (r == FrameResult::Invalid)
+            {
+                return r;
+            }
+            if (r == FrameResult::NeedMore)
+            {
+                return out.size() != before ? FrameResult::Framed : FrameResult::NeedMore;
+            }
+            out.push_back(one);
+        }
+    }
+
   private:
     std::uint32_t maxPayloadLen_{kDefaultMaxPayloadLen};
     std::vector<std::byte> scratch_;
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hypernet::util {
+
+/// callable 이 내부 버퍼에 들어가지 않을 때의 정책입니다.
+enum class InlineOverflow : std::uint8_t {
+    Reject, ///< 컴파일 에러 (static_assert)
+    Heap,   ///< 힙에 할당하고 포인터만 내부 버퍼에 둠 (큰 capture 용 opt-out)
+};
+
+template <typename Signature, std::size_t Capacity, InlineOverflow Overflow = InlineOverflow::Reject>
+class InlineFunction;
+
+/// 고정 크기 내부 버퍼에 callable 을 저장하는 move-only 함수 객체입니다.
+///
+/// - std::function 과 달리 capture 가 Capacity 안이면 힙 할당을 하지 않습니다.
+///   넘으면 Overflow 정책에 따라 컴파일 에러(Reject) 또는 힙 저장(Heap)입니다.
+/// - 복사는 불가능하고 이동만 가능합니다. (unique_ptr 등 move-only capture 허용)
+/// - inline 저장되는 callable 은 nothrow move constructible 이어야 합니다.
+///   (컨테이너 재배치 중에도 예외가 나지 않도록. Heap 정책이면 아닌 것은 힙으로 감)
+/// - 호출 지점에서 할당 여부를 고정하려면 static_assert(F::storesInline<Lambda>) 를 씁니다.
+template <typename R, typename... Args, std::size_t Capacity, InlineOverflow Overflow>
+class InlineFunction<R(Args...), Capacity, Overflow> {
+    static_assert(Capacity >= sizeof(void *), "InlineFunction: Capacity must hold at least a pointer");
+
+  public:
+    static constexpr std::size_t kCapacity = Capacity;
+    static constexpr InlineOverflow kOverflow = Overflow;
+
+    /// Fn 이 내부 버퍼에 저장되는지 (= 생성 시 할당이 없는지)
+    template <typename Fn>
+    static constexpr bool storesInline = sizeof(Fn) <= Capacity &&
+                                         alignof(Fn) <= alignof(std::max_align_t) &&
+                                         std::is_nothrow_move_constructible_v<Fn>;
+
+    InlineFunction() noexcept = default;
+    InlineFunction(std::nullptr_t) noexcept {}
+
+    template <typename F,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, InlineFunction> &&
+                                          std::is_invocable_r_v<R, std::decay_t<F> &, Args...>>>
+    InlineFunction(F &&f) {
+        using Fn = std::decay_t<F>;
+        if constexpr (storesInline<Fn>) {
+            ::new (static_cast<void *>(storage_)) Fn(std::forward<F>(f));
+            ops_ = &kOpsFor<Fn>;
+        } else {
+            static_assert(Overflow == InlineOverflow::Heap || sizeof(Fn) <= Capacity,
+                          "InlineFunction: capture too large (reduce captures or raise Capacity)");
+            static_assert(Overflow == InlineOverflow::Heap || alignof(Fn) <= alignof(std::max_align_t),
+                          "InlineFunction: over-aligned callable is not supported");
+            static_assert(Overflow == InlineOverflow::Heap || std::is_nothrow_move_constructible_v<Fn>,
+                          "InlineFunction: callable must be nothrow move constructible");
+
+            ::new (static_cast<void *>(storage_)) Fn *(new Fn(std::forward<F>(f)));
+            ops_ = &kHeapOpsFor<Fn>;
+        }
+    }
+
+    InlineFunction(InlineFunction &&other) noexcept { moveFrom_(other); }
+
+    InlineFunction &operator=(InlineFunction &&other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom_(other);
+        }
+        return *this;
+    }
+
+    InlineFunction &operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    InlineFunction(const InlineFunction &) = delete;
+    InlineFunction &operator=(const InlineFunction &) = delete;
+
+    ~InlineFunction() { reset(); }
+
+    /// 저장된 callable 을 파괴하고 빈 상태로 만듭니다.
+    void reset() noexcept {
+        if (ops_) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+    /// 저장된 callable 이 힙에 있는지 (Heap 정책에서 큰 capture 였는지)
+    [[nodiscard]] bool isHeapAllocated() const noexcept { return ops_ && ops_->heap; }
+
+    /// 빈 상태에서 호출하면 UB 입니다. (호출 전에 operator bool 로 확인)
+    R operator()(Args... args) { return ops_->invoke(storage_, std::forward<Args>(args)...); }
+
+  private:
+    struct Ops {
+        R (*invoke)(void *, Args &&...);
+        void (*move)(void *dst, void *src) noexcept; ///< src 로 dst 를 생성한 뒤 src 를 파괴
+        void (*destroy)(void *) noexcept;
+        bool heap;
+    };
+
+    template <typename Fn>
+    static constexpr Ops kOpsFor{
+        [](void *p, Args &&...args) -> R {
+            return (*static_cast<Fn *>(p))(std::forward<Args>(args)...);
+        },
+        [](void *dst, void *src) noexcept {
+            ::new (dst) Fn(std::move(*static_cast<Fn *>(src)));
+            static_cast<Fn *>(src)->~Fn();
+        },
+        [](void *p) noexcept { static_cast<Fn *>(p)->~Fn(); },
+        false,
+    };
+
+    /// 내부 버퍼에는 Fn* 만 둡니다. (이동 = 포인터 복사)
+    template <typename Fn>
+    static constexpr Ops kHeapOpsFor{
+        [](void *p, Args &&...args) -> R {
+            return (**static_cast<Fn **>(p))(std::forward<Args>(args)...);
+        },
+        [](void *dst, void *src) noexcept { ::new (dst) Fn *(*static_cast<Fn **>(src)); },
+        [](void *p) noexcept { delete *static_cast<Fn **>(p); },
+        true,
+    };
+
+    void moveFrom_(InlineFunction &other) noexcept {
+        if (other.ops_) {
+            other.ops_->move(storage_, other.storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char storage_[Capacity];
+    const Ops *ops_{nullptr};
+};
+
+} // namespace hypernet::util
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <hypernet/util/NonCopyable.hpp>
+
+namespace hypernet::util {
+
+/// uint16 opcode 로 바로 인덱싱하는 2단 페이지 테이블입니다.
+///
+/// - 상위 8비트가 페이지, 하위 8비트가 슬롯입니다. (256 x 256 = 64K 슬롯)
+/// - 페이지는 처음 쓰일 때만 할당합니다. 앱 opcode 는 보통 몇 개 구간에 몰려 있어
+///   실제로는 페이지 몇 장이면 충분합니다.
+/// - 조회는 해시 없이 load 두 번입니다. 빈 슬롯은 T{} 상태이며 "없음" 판정은 호출자가 합니다.
+/// - 등록/해제는 조회와 같은 스레드에서만 하거나, 조회 시작 전에 끝내야 합니다.
+template <typename T> class OpcodeTable : private NonCopyable {
+  public:
+    static constexpr std::size_t kPageBits = 8;
+    static constexpr std::size_t kPageSlots = std::size_t{1} << kPageBits;
+    static constexpr std::size_t kPageCount = (std::size_t{1} << 16) / kPageSlots;
+
+    OpcodeTable() = default;
+
+    /// 슬롯 포인터 (페이지가 없으면 nullptr)
+    [[nodiscard]] T *find(std::uint16_t opcode) noexcept {
+        Page *p = pages_[opcode >> kPageBits].get();
+        return p ? &(*p)[opcode & (kPageSlots - 1)] : nullptr;
+    }
+
+    [[nodiscard]] const T *find(std::uint16_t opcode) const noexcept {
+        const Page *p = pages_[opcode >> kPageBits].get();
+        return p ? &(*p)[opcode & (kPageSlots - 1)] : nullptr;
+    }
+
+    /// 슬롯 참조 (페이지가 없으면 할당)
+    [[nodiscard]] T &at(std::uint16_t opcode) {
+        auto &page = pages_[opcode >> kPageBits];
+        if (!page) {
+            page = std::make_unique<Page>();
+        }
+        return (*page)[opcode & (kPageSlots - 1)];
+    }
+
+    /// 슬롯을 T{} 로 되돌립니다. (페이지는 유지)
+    void reset(std::uint16_t opcode) noexcept {
+        if (T *slot = find(opcode)) {
+            *slot = T{};
+        }
+    }
+
+    void clear() noexcept {
+        for (auto &page : pages_) {
+            page.reset();
+        }
+    }
+
+    /// 할당된 페이지 수
+    [[nodiscard]] std::size_t pageCount() const noexcept {
+        std::size_t n = 0;
+        for (const auto &page : pages_) {
+            n += page ? 1 : 0;
+        }
+        return n;
+    }
+
+  private:
+    using Page = std::array<T, kPageSlots>;
+
+    std::array<std::unique_ptr<Page>, kPageCount> pages_{};
+};
+
+} // namespace hypernet::util
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include <hypernet/util/NonCopyable.hpp>
+
+namespace hypernet::util {
+
+/// 단일 producer / 단일 consumer 전용 bounded lock-free 링입니다.
+///
+/// - 용량은 2의 거듭제곱으로 올림합니다. (index 는 단조 증가, mask 로 슬롯 선택)
+/// - head(consumer 소유)와 tail(producer 소유)을 서로 다른 cache line 에 두고, 상대 index 는
+///   각자 캐시해 두었다가 링이 꽉 찼다/비었다고 보일 때만 다시 읽습니다.
+///   → steady-state 에서 push/pop 당 공유 line 접근은 슬롯 line 과 index line 정도입니다.
+/// - T 는 trivially copyable 이어야 합니다. (슬롯은 덮어쓰기만 하고 소멸자를 부르지 않음)
+/// - tryPush()/tryPushWith()/full() 은 producer 스레드 하나에서만, tryPop()/consume()/empty() 는
+///   consumer 스레드 하나에서만 호출해야 합니다.
+template <typename T> class SpscRing : private NonCopyable {
+    static_assert(std::is_trivially_copyable_v<T>, "SpscRing<T> requires trivially copyable T");
+
+  public:
+    /// @param capacity 최소 슬롯 수 (2 미만이면 2, 2의 거듭제곱으로 올림)
+    explicit SpscRing(std::size_t capacity)
+        : capacity_(std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity)), mask_(capacity_ - 1),
+          slots_(std::make_unique<T[]>(capacity_)) {}
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+    /// 슬롯 하나를 채워 넣습니다. (producer 전용) 꽉 찼으면 false
+    bool tryPush(const T &item) noexcept {
+        return tryPushWith([&item](T &slot) noexcept { slot = item; });
+    }
+
+    /// 빈 슬롯을 fill(T&) 로 제자리에서 채운 뒤 게시합니다. (producer 전용) 꽉 찼으면 false
+    ///
+    /// - 임시 T 를 만들어 복사하지 않으므로, 큰 T 의 일부만 채울 때 씁니다.
+    /// - fill 은 예외를 밖으로 던지지 않아야 합니다.
+    template <typename Fill> bool tryPushWith(Fill &&fill) noexcept {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cachedHead_ >= capacity_) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail - cachedHead_ >= capacity_) {
+                return false;
+            }
+        }
+        fill(slots_[tail & mask_]);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// 슬롯 하나를 꺼냅니다. (consumer 전용) 비었으면 false
+    bool tryPop(T &out) noexcept {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cachedTail_) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head == cachedTail_) {
+                return false;
+            }
+        }
+        out = slots_[head & mask_];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// 지금 보이는 슬롯을 최대 maxItems 개까지 제자리에서 fn(T&) 로 처리합니다. (consumer 전용)
+    ///
+    /// - 슬롯을 복사하지 않고, head 는 배치 끝에 한 번만 전진시킵니다.
+    /// - fn 이 돌아온 뒤 슬롯은 producer 가 덮어쓸 수 있습니다.
+    /// - fn 은 예외를 밖으로 던지지 않아야 합니다.
+    /// @return 처리한 슬롯 수
+    template <typename Fn> std::size_t consume(Fn &&fn, std::size_t maxItems) noexcept {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cachedTail_) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+        }
+        std::size_t avail = cachedTail_ - head;
+        if (avail > maxItems) {
+            avail = maxItems;
+        }
+        for (std::size_t i = 0; i < avail; ++i) {
+            fn(slots_[(head + i) & mask_]);
+        }
+        if (avail != 0) {
+            head_.store(head + avail, std::memory_order_release);
+        }
+        return avail;
+    }
+
+    /// 비어 있는지 확인합니다. (consumer 전용)
+    ///
+    /// - tail 을 seq_cst 로 읽으므로, 잠들기 직전 "sleeping 플래그 → 다시 확인" 패턴에 쓸 수 있습니다.
+    [[nodiscard]] bool empty() const noexcept {
+        return head_.load(std::memory_order_relaxed) == tail_.load(std::memory_order_seq_cst);
+    }
+
+    /// 꽉 차 있는지 확인합니다. (producer 전용, head 를 seq_cst 로 다시 읽음)
+    [[nodiscard]] bool full() const noexcept {
+        return tail_.load(std::memory_order_relaxed) - head_.load(std::memory_order_seq_cst) >= capacity_;
+    }
+
+  private:
+    static constexpr std::size_t kCacheLine = 64;
+
+    // consumer 가 쓰는 line
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0};
+    std::size_t cachedTail_{0};
+
+    // producer 가 쓰는 line
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};
+    std::size_t cachedHead_{0};
+
+    // 읽기 전용 (생성 후 불변)
+    alignas(kCacheLine) std::size_t capacity_;
+    std::size_t mask_;
+    std::unique_ptr<T[]> slots_;
+};
+
+} // namespace hypernet::util
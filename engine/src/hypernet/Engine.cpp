@@ -1,5 +1,6 @@
 #include <hypernet/Engine.hpp>
 
+#include <hypernet/buffer/PageMemory.hpp>
 #include <hypernet/core/AppCallbacks.hpp>
 #include <hypernet/core/EffectiveOptions.hpp>
 #include <hypernet/core/Logger.hpp>
@@ -9,15 +10,20 @@
 #include <hypernet/monitoring/HttpStatusServer.hpp>
 #include <hypernet/monitoring/Metrics.hpp>
 
+#include <hypernet/net/ConnectionSteering.hpp>
 #include <hypernet/net/EventLoop.hpp>
+#include <hypernet/net/SessionMigration.hpp>
 #include <hypernet/net/SessionRouterFactory.hpp>
 #include <hypernet/net/WorkerSchedulerFactory.hpp>
+#include <hypernet/net/WorkerMesh.hpp>
 
 #include <algorithm>
 #include <chrono>
 #include <cstdio>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -29,6 +35,21 @@ namespace hypernet
 // (프로젝트에서 SIGUSR1을 다른 용도로 쓰면 SIGRTMIN+N 같은 걸로 바꾸는 게 안전합니다.)
 static constexpr int kWakeSignal = SIGUSR1;
 
+// 로그용 CPU 목록 ("os" = 고정 안 함)
+static std::string formatCpuList(const std::vector<int> &cpus)
+{
+    if (cpus.empty())
+        return "os";
+    std::string out;
+    for (int c : cpus)
+    {
+        if (!out.empty())
+            out += ',';
+        out += std::to_string(c);
+    }
+    return out;
+}
+
 Engine::Engine(const EngineConfig &config, std::shared_ptr<IApplication> app) : config_(config), app_(std::move(app))
 {
     validateEngineConfig(config_);
@@ -103,16 +124,19 @@ void Engine::run()
         initSignalWait_();
 
         resetForRun_();
-        startMetrics_();
+        lockMemory_(opt);
+        placeLoggerThread_(opt);
+        startMetrics_(opt);
 
         workers = createWorkers_(opt);
 
         appInvoker = setupAppCallbacks_(workers);
-        setupRouting_(workers);
+        setupRouting_(workers, opt);
 
         startWorkers_(workers);
 
-        SLOG_INFO("HyperNet", "ThreadAffinity", "Disabled (OS Scheduling Mode)");
+        SLOG_INFO("HyperNet", "ThreadAffinity", "workers={} numa_bind={} sched_fifo_priority={} logger_cpu={} metrics_cpu={}", formatCpuList(opt.workerCpus),
+                  opt.workerDefaults.placement.numaBind ? "on" : "off", opt.workerDefaults.placement.schedFifoPriority, opt.loggerCpu, opt.metricsCpu);
 
         if (appInvoker)
         {
@@ -169,12 +193,44 @@ void Engine::resetForRun_() noexcept
     hypernet::monitoring::engineMetrics().reset();
 }
 
-void Engine::startMetrics_()
+void Engine::lockMemory_(const core::EngineOptions &opt) noexcept
+{
+    if (!opt.lockMemory)
+        return;
+
+    // 워커 링/풀보다 먼저 잠가야 MCL_FUTURE 로 이후 매핑도 swap 대상에서 빠진다.
+    if (const int rc = buffer::lockProcessMemory(); rc != 0)
+    {
+        SLOG_WARN("HyperNet", "MemoryLockFailed", "errno={} msg='{}' action=ContinueUnlocked", rc, std::strerror(rc));
+        return;
+    }
+    SLOG_INFO("HyperNet", "MemoryLocked", "");
+}
+
+void Engine::placeLoggerThread_(const core::EngineOptions &opt) noexcept
+{
+    if (opt.loggerCpu < 0)
+        return;
+
+    // 앱이 setLogger 로 다른 ILogger 를 넣었으면 고정할 스레드를 모른다.
+    auto *logger = dynamic_cast<core::Logger *>(&core::getLogger());
+    if (!logger)
+    {
+        SLOG_WARN("HyperNet", "LoggerPinIgnored", "cpu={} reason=CustomLogger", opt.loggerCpu);
+        return;
+    }
+    if (const int rc = logger->pinConsumerThread(opt.loggerCpu); rc != 0)
+    {
+        SLOG_WARN("HyperNet", "LoggerPinFailed", "cpu={} errno={} msg='{}'", opt.loggerCpu, rc, std::strerror(rc));
+    }
+}
+
+void Engine::startMetrics_(const core::EngineOptions &opt)
 {
     if (config_.metricsHttpPort == 0)
         return;
 
-    metricsServer_ = std::make_unique<hypernet::monitoring::HttpStatusServer>(config_.metricsHttpAddress, config_.metricsHttpPort);
+    metricsServer_ = std::make_unique<hypernet::monitoring::HttpStatusServer>(config_.metricsHttpAddress, config_.metricsHttpPort, opt.metricsCpu);
 
     if (!metricsServer_->start())
     {
@@ -225,15 +281,41 @@ std::shared_ptr<core::AppCallbackInvoker> Engine::setupAppCallbacks_(Workers &wo
     return invoker;
 }
 
-void Engine::setupRouting_(Workers &workers)
+void Engine::setupRouting_(Workers &workers, const core::EngineOptions &opt)
 {
     std::vector<hypernet::net::EventLoop *> loops;
     loops.reserve(workers.size());
     for (auto &w : workers)
         loops.push_back(&w->eventLoop());
 
-    auto router = hypernet::net::makeGlobalSessionRouter(loops);
-    auto scheduler = hypernet::net::makeGlobalWorkerScheduler(std::move(loops));
+    // 워커가 2개 이상일 때만 의미가 있다. (채널 = 워커 수²)
+    std::shared_ptr<hypernet::net::WorkerMesh> mesh;
+    if (opt.workerHandoff && workers.size() > 1)
+    {
+        mesh = std::make_shared<hypernet::net::WorkerMesh>(static_cast<int>(workers.size()), opt.handoffRingSlots);
+        for (auto &w : workers)
+            w->attachHandoffMesh(mesh);
+    }
+
+    // least_loaded: 워커 0 이 accept 한 fd 를 task 경로(mesh 가 있으면 mesh)로 넘긴다.
+    if (opt.workerDefaults.steering.mode == hypernet::net::SteeringMode::LeastLoaded && config_.listenPort != 0 && workers.size() > 1)
+    {
+        auto handoff = std::make_shared<hypernet::net::AcceptHandoff>(workers.size());
+        for (auto &w : workers)
+            w->attachAcceptHandoff(handoff);
+    }
+
+    // 세션 이관: IWorkerScheduler::migrateSession 과 rebalancer(워커 0)가 같은 task 경로를 쓴다.
+    std::shared_ptr<hypernet::net::SessionMigrator> migrator;
+    if (workers.size() > 1)
+    {
+        migrator = std::make_shared<hypernet::net::SessionMigrator>(workers.size());
+        for (auto &w : workers)
+            w->attachSessionMigrator(migrator);
+    }
+
+    auto router = hypernet::net::makeGlobalSessionRouter(loops, mesh);
+    auto scheduler = hypernet::net::makeGlobalWorkerScheduler(std::move(loops), mesh, std::move(migrator));
 
     if (app_)
     {
@@ -269,12 +351,25 @@ void Engine::logStarted_(const core::EngineOptions &opt) const
               (config_.reusePort ? "on" : "off"), config_.metricsHttpAddress, config_.metricsHttpPort);
 
     SLOG_INFO("HyperNet", "WorkerRuntime",
-              "drain_ms={} poll_ms={} tick_ms={} timer_slots={} max_epoll_events={} "
-              "buffer_block_size={} buffer_blocks={} recv_ring_bytes={} send_ring_bytes={} "
-              "max_payload_len={}",
+              "drain_ms={} poll_ms={} tick_us={} timer_slots={} max_epoll_events={} io_backend={} "
+              "poll_mode={} poll_spin_us={} session_busy_poll_us={} "
+              "buffer_block_size={} buffer_blocks={} recv_ring_bytes={} send_ring_bytes={} mirrored_rings={} "
+              "ring_idle_reclaim_ms={} session_pool_prewarm={} session_pool_max_idle={} "
+              "deferred_flush={} cork={} zerocopy_threshold={} zerocopy_buffers={} "
+              "send_queue_limit={} send_queue_high={} send_queue_low={} max_payload_len={} "
+              "worker_handoff={} handoff_ring_slots={} huge_pages={} prefault_memory={} lock_memory={} "
+              "connection_steering={} steering_update_ms={} session_rebalance_ms={} session_rebalance_threshold_pct={}",
               opt.shutdownDrainTimeout.count(), opt.shutdownPollInterval.count(), opt.workerDefaults.timer.tickResolution.count(), opt.workerDefaults.timer.slotCount,
-              opt.workerDefaults.eventLoop.maxEpollEvents, opt.workerDefaults.bufferPool.blockSize, opt.workerDefaults.bufferPool.blockCount, opt.workerDefaults.rings.recvCapacity,
-              opt.workerDefaults.rings.sendCapacity, opt.workerDefaults.protocol.maxPayloadLen);
+              opt.workerDefaults.eventLoop.maxEpollEvents, net::toString(opt.workerDefaults.eventLoop.backend), net::toString(opt.workerDefaults.eventLoop.pollMode),
+              opt.workerDefaults.eventLoop.pollSpinUs, opt.workerDefaults.sessionBusyPollUs, opt.workerDefaults.bufferPool.blockSize, opt.workerDefaults.bufferPool.blockCount, opt.workerDefaults.rings.recvCapacity,
+              opt.workerDefaults.rings.sendCapacity, opt.workerDefaults.rings.mirrored, opt.workerDefaults.rings.idleReclaimMs, opt.workerDefaults.sessionPool.prewarm,
+              opt.workerDefaults.sessionPool.maxIdle, opt.workerDefaults.sendPath.deferredFlush, opt.workerDefaults.sendPath.cork,
+              opt.workerDefaults.sendPath.zeroCopyThreshold, opt.workerDefaults.sendPath.zeroCopyBufferCount,
+              opt.workerDefaults.sendPath.sendQueueLimit, opt.workerDefaults.sendPath.sendQueueHighWatermark, opt.workerDefaults.sendPath.sendQueueLowWatermark,
+              opt.workerDefaults.protocol.maxPayloadLen,
+              opt.workerHandoff, opt.handoffRingSlots, buffer::toString(opt.workerDefaults.pages.hugePages), opt.workerDefaults.pages.prefault, opt.lockMemory,
+              net::toString(opt.workerDefaults.steering.mode), opt.workerDefaults.steering.updateMs,
+              opt.workerDefaults.rebalance.intervalMs, opt.workerDefaults.rebalance.thresholdPct);
 }
 
 void Engine::shutdownGracefully_(Workers &workers, const core::EngineOptions &opt, const std::shared_ptr<core::AppCallbackInvoker> &appInvoker) noexcept
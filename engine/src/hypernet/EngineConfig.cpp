@@ -1,10 +1,14 @@
 #include <hypernet/EngineConfig.hpp>
 
+#include <hypernet/core/CpuTopology.hpp>
+
 #include <limits>
 #include <stdexcept>
 #include <string>
 #include <thread>
 
+#include <sched.h>
+
 namespace hypernet
 {
 
@@ -60,6 +64,24 @@ void validateEngineConfig(const EngineConfig &config)
     {
         throwConfigError("maxEpollEvents must be >= 1 when specified");
     }
+    if (config.uringRecvBufferSize != 0 && config.uringRecvBufferSize < 256)
+    {
+        throwConfigError("uringRecvBufferSize is too small (min 256 bytes when specified)");
+    }
+    if (config.uringRecvBufferCount != 0 &&
+        (config.uringRecvBufferCount > 32768 ||
+         (config.uringRecvBufferCount & (config.uringRecvBufferCount - 1)) != 0))
+    {
+        throwConfigError("uringRecvBufferCount must be a power of two <= 32768 when specified");
+    }
+    if (config.pollSpinUs > 1'000'000)
+    {
+        throwConfigError("pollSpinUs must be <= 1000000 (1s)");
+    }
+    if (config.sessionBusyPollUs > static_cast<std::uint32_t>(std::numeric_limits<int>::max()))
+    {
+        throwConfigError("sessionBusyPollUs is too large");
+    }
     if (config.bufferBlockSize != 0 && config.bufferBlockSize < 256)
     {
         throwConfigError("bufferBlockSize is too small (min 256 bytes when specified)");
@@ -76,15 +98,98 @@ void validateEngineConfig(const EngineConfig &config)
     {
         throwConfigError("sendRingCapacity is too small (min 1024 bytes when specified)");
     }
+    if (config.ringIdleReclaimMs > 3'600'000)
+    {
+        throwConfigError("ringIdleReclaimMs must be <= 3600000 (1 hour)");
+    }
+    if (config.sessionPoolPrewarm > 65536)
+    {
+        throwConfigError("sessionPoolPrewarm must be <= 65536");
+    }
+    if (config.sessionPoolMaxIdle > 65536)
+    {
+        throwConfigError("sessionPoolMaxIdle must be <= 65536");
+    }
+    if (config.zeroCopyThreshold != 0 && config.zeroCopyThreshold < 1024)
+    {
+        throwConfigError("zeroCopyThreshold is too small (min 1024 bytes when specified)");
+    }
+    if (config.zeroCopyBufferCount > 65536)
+    {
+        throwConfigError("zeroCopyBufferCount must be <= 65536");
+    }
+    if (config.sendQueueLimitBytes != 0 && config.sendQueueLimitBytes < 1024)
+    {
+        throwConfigError("sendQueueLimitBytes is too small (min 1024 bytes when specified)");
+    }
+    if (config.sendQueueLimitBytes > (std::size_t{1} << 30))
+    {
+        throwConfigError("sendQueueLimitBytes must be <= 1 GiB");
+    }
+    if (config.sendQueueLimitBytes == 0 && (config.sendQueueHighWatermark != 0 || config.sendQueueLowWatermark != 0))
+    {
+        throwConfigError("sendQueueHighWatermark/sendQueueLowWatermark require sendQueueLimitBytes");
+    }
+    if (config.sendQueueHighWatermark > config.sendQueueLimitBytes)
+    {
+        throwConfigError("sendQueueHighWatermark must be <= sendQueueLimitBytes");
+    }
+    if (config.sendQueueHighWatermark != 0 && config.sendQueueLowWatermark >= config.sendQueueHighWatermark)
+    {
+        throwConfigError("sendQueueLowWatermark must be < sendQueueHighWatermark");
+    }
     if (config.maxPayloadLen != 0 && config.maxPayloadLen < 1)
     {
         throwConfigError("maxPayloadLen must be >= 1 when specified");
     }
+    if (config.logThreadRingBytes != 0 &&
+        (config.logThreadRingBytes < 64 * 1024 || config.logThreadRingBytes > 256 * 1024 * 1024))
+    {
+        throwConfigError("logThreadRingBytes must be in [64 KiB, 256 MiB] when specified");
+    }
+
+    if (config.handoffRingSlots != 0 && (config.handoffRingSlots < 16 || config.handoffRingSlots > 65536))
+    {
+        throwConfigError("handoffRingSlots must be in [16, 65536] when specified");
+    }
+
+    if (!config.workerCpuAffinity.empty() && config.workerCpuAffinity != "none" &&
+        config.workerCpuAffinity != "auto" && !core::parseCpuList(config.workerCpuAffinity))
+    {
+        throwConfigError("workerCpuAffinity must be \"none\", \"auto\" or a cpu list like \"0,2,4-7\"");
+    }
+    if (config.workerSchedFifoPriority > 99)
+    {
+        throwConfigError("workerSchedFifoPriority must be in [0, 99]");
+    }
+    if (config.loggerCpu < -1 || config.loggerCpu >= CPU_SETSIZE)
+    {
+        throwConfigError("loggerCpu must be -1 or a valid cpu index");
+    }
+    if (config.metricsCpu < -1 || config.metricsCpu >= CPU_SETSIZE)
+    {
+        throwConfigError("metricsCpu must be -1 or a valid cpu index");
+    }
 
     const unsigned int workers = effectiveWorkerThreads(config);
 
+    if (config.steeringUpdateMs != 0 && (config.steeringUpdateMs < 10 || config.steeringUpdateMs > 60'000))
+    {
+        throwConfigError("steeringUpdateMs must be in [10, 60000] when specified");
+    }
+
+    if (config.sessionRebalanceMs != 0 && (config.sessionRebalanceMs < 100 || config.sessionRebalanceMs > 600'000))
+    {
+        throwConfigError("sessionRebalanceMs must be 0 (off) or in [100, 600000]");
+    }
+    if (config.sessionRebalanceThresholdPct > 100)
+    {
+        throwConfigError("sessionRebalanceThresholdPct must be in [0, 100]");
+    }
+
     // [변경] SO_REUSEPORT 강제는 "리스너를 실제로 켠 경우"에만 의미가 있다.
-    if (config.listenPort != 0 && workers > 1 && !config.reusePort)
+    // - least_loaded 는 워커 0 만 리스너를 열므로 예외
+    if (config.listenPort != 0 && workers > 1 && !config.reusePort && config.connectionSteering != net::SteeringMode::LeastLoaded)
     {
         throwConfigError(
             "reusePort must be enabled when effective workerThreads > 1 (SO_REUSEPORT required)");
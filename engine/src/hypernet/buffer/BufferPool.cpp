@@ -20,14 +20,27 @@ BufferPool::BufferPool(std::size_t blockSize, std::size_t blockCount)
         throw std::invalid_argument("BufferPool blockCount must be greater than 0");
     }
 
-    // 전체 블록을 한 번에 할당한다.
-    storage_ = std::make_unique<std::byte[]>(blockSize_ * blockCount_);
+    // 전체 블록을 한 번에 할당한다. (워커 스레드의 페이지 정책이 있으면 huge page / prefault 매핑)
+    const PageAllocPolicy &policy = threadPagePolicy();
+    if (policy.enabled())
+    {
+        pages_ = PageMemory::allocate(blockSize_ * blockCount_, policy);
+    }
+    if (pages_)
+    {
+        base_ = pages_.data();
+    }
+    else
+    {
+        storage_ = std::make_unique<std::byte[]>(blockSize_ * blockCount_);
+        base_ = storage_.get();
+    }
 
     // 초기에는 모든 블록이 free 상태이므로 free list 에 등록한다.
     freeList_.reserve(blockCount_);
     for (std::size_t i = 0; i < blockCount_; ++i)
     {
-        void *ptr = storage_.get() + (i * blockSize_);
+        void *ptr = base_ + (i * blockSize_);
         freeList_.push_back(ptr);
 
         // 초기화를 원하면 여기에서 std::memset(ptr, 0, blockSize_) 를 호출할 수 있지만,
@@ -60,7 +73,7 @@ void BufferPool::deallocate(void *ptr) noexcept
 #ifndef NDEBUG
     // 디버그용 방어 로직:
     // 1) 이 풀의 storage 범위 안에 있는지 확인
-    const auto base = storage_.get();
+    const auto base = base_;
     const auto end = base + (blockSize_ * blockCount_);
     auto bytePtr = static_cast<std::byte *>(ptr);
 
@@ -0,0 +1,238 @@
+#include <hypernet/buffer/PacketBuffer.hpp>
+
+#include <hypernet/core/Logger.hpp>
+
+#include <cstring> // std::memcpy
+#include <mutex>
+#include <new>
+
+namespace hypernet::buffer
+{
+
+using detail::PacketBlock;
+
+namespace
+{
+
+/// 반납된 풀 보관소 (프로세스 수명, 의도적으로 파괴하지 않음)
+/// - 워커 종료 뒤에도 다른 스레드가 들고 있던 블록이 돌아올 곳이 남아 있어야 한다.
+struct PoolRegistry
+{
+    std::mutex mu;
+    std::vector<PacketBufferPool *> all;
+    std::vector<PacketBufferPool *> idle;
+};
+
+PoolRegistry &registry()
+{
+    static auto *r = new PoolRegistry();
+    return *r;
+}
+
+PacketBlock *allocateHeapBlock(std::size_t len)
+{
+    void *mem = ::operator new(sizeof(PacketBlock) + len);
+    auto *b = ::new (mem) PacketBlock();
+    b->capacity = static_cast<std::uint32_t>(len);
+    return b;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------
+// PacketBuffer
+// ---------------------------------------------------------------------
+
+PacketBuffer PacketBuffer::copyOf(const void *data, std::size_t len)
+{
+    if (len == 0)
+    {
+        return PacketBuffer{};
+    }
+
+    PacketBlock *b = nullptr;
+    if (PacketBufferPool *pool = PacketBufferPool::current())
+    {
+        b = pool->allocate_(len);
+    }
+    if (b == nullptr)
+    {
+        b = allocateHeapBlock(len);
+    }
+
+    b->refs.store(1, std::memory_order_relaxed);
+    b->size = static_cast<std::uint32_t>(len);
+    if (data != nullptr)
+    {
+        std::memcpy(b->data(), data, len);
+    }
+    return PacketBuffer{b};
+}
+
+void PacketBuffer::release_(PacketBlock *block) noexcept
+{
+    if (block->pool != nullptr)
+    {
+        block->pool->recycle_(block);
+        return;
+    }
+    block->~PacketBlock();
+    ::operator delete(static_cast<void *>(block));
+}
+
+// ---------------------------------------------------------------------
+// PacketBufferPool
+// ---------------------------------------------------------------------
+
+PacketBufferPool::PacketBufferPool()
+{
+    for (std::size_t i = 0; i < kClassCount; ++i)
+    {
+        classes_[i].blockBytes = kBlockBytes[i];
+    }
+}
+
+void PacketBufferPool::bindCurrentThread()
+{
+    if (current_() != nullptr)
+    {
+        return;
+    }
+
+    auto &r = registry();
+    PacketBufferPool *pool = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(r.mu);
+        if (!r.idle.empty())
+        {
+            pool = r.idle.back();
+            r.idle.pop_back();
+        }
+        else
+        {
+            pool = new PacketBufferPool();
+            r.all.push_back(pool);
+        }
+    }
+    current_() = pool;
+}
+
+void PacketBufferPool::unbindCurrentThread() noexcept
+{
+    PacketBufferPool *pool = current_();
+    if (pool == nullptr)
+    {
+        return;
+    }
+    current_() = nullptr;
+
+    const Stats &s = pool->stats_;
+    SLOG_INFO("PacketBufferPool", "Unbound", "pooled_allocs={} heap_fallbacks={} remote_returns={} chunks={}",
+              s.pooledAllocs, s.heapFallbacks, s.remoteReturns, s.chunks);
+
+    auto &r = registry();
+    std::lock_guard<std::mutex> lock(r.mu);
+    r.idle.push_back(pool);
+}
+
+PacketBlock *PacketBufferPool::allocate_(std::size_t len) noexcept
+{
+    std::size_t ci = 0;
+    while (ci < kClassCount && classes_[ci].blockBytes - sizeof(PacketBlock) < len)
+    {
+        ++ci;
+    }
+    if (ci == kClassCount)
+    {
+        ++stats_.heapFallbacks;
+        return nullptr;
+    }
+
+    SizeClass &cls = classes_[ci];
+    if (cls.freeList == nullptr)
+    {
+        reclaimRemote_();
+    }
+
+    PacketBlock *b = cls.freeList;
+    if (b != nullptr)
+    {
+        cls.freeList = b->next;
+        b->next = nullptr;
+    }
+    else
+    {
+        b = carve_(cls);
+        if (b == nullptr)
+        {
+            ++stats_.heapFallbacks;
+            return nullptr;
+        }
+        b->sizeClass = static_cast<std::uint8_t>(ci);
+    }
+
+    ++stats_.pooledAllocs;
+    return b;
+}
+
+PacketBlock *PacketBufferPool::carve_(SizeClass &cls) noexcept
+{
+    void *mem = cls.chunks.empty() ? nullptr : cls.chunks.back()->allocate();
+    if (mem == nullptr)
+    {
+        const std::size_t perChunk = kChunkBytes / cls.blockBytes;
+        if ((cls.chunks.size() + 1) * perChunk * cls.blockBytes > kMaxBytesPerClass)
+        {
+            return nullptr;
+        }
+        try
+        {
+            cls.chunks.push_back(std::make_unique<BufferPool>(cls.blockBytes, perChunk));
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+        ++stats_.chunks;
+        mem = cls.chunks.back()->allocate();
+    }
+
+    auto *b = ::new (mem) PacketBlock();
+    b->capacity = static_cast<std::uint32_t>(cls.blockBytes - sizeof(PacketBlock));
+    b->pool = this;
+    return b;
+}
+
+void PacketBufferPool::recycle_(PacketBlock *block) noexcept
+{
+    if (current_() == this)
+    {
+        SizeClass &cls = classes_[block->sizeClass];
+        block->next = cls.freeList;
+        cls.freeList = block;
+        return;
+    }
+
+    // 다른 스레드: 주인의 반환 스택에 push (consumer 는 exchange 로만 가져가므로 ABA 없음)
+    PacketBlock *head = remoteFree_.load(std::memory_order_relaxed);
+    do
+    {
+        block->next = head;
+    } while (!remoteFree_.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void PacketBufferPool::reclaimRemote_() noexcept
+{
+    PacketBlock *b = remoteFree_.exchange(nullptr, std::memory_order_acquire);
+    while (b != nullptr)
+    {
+        PacketBlock *next = b->next;
+        SizeClass &cls = classes_[b->sizeClass];
+        b->next = cls.freeList;
+        cls.freeList = b;
+        ++stats_.remoteReturns;
+        b = next;
+    }
+}
+
+} // namespace hypernet::buffer
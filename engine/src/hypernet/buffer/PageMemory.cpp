@@ -0,0 +1,214 @@
+#include <hypernet/buffer/PageMemory.hpp>
+
+#include <hypernet/core/Logger.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE 23 // Linux 5.14
+#endif
+#ifndef MCL_ONFAULT
+#define MCL_ONFAULT 4 // Linux 4.4
+#endif
+
+namespace hypernet::buffer
+{
+
+namespace
+{
+
+PageAllocPolicy &threadPolicy_() noexcept
+{
+    thread_local PageAllocPolicy policy{};
+    return policy;
+}
+
+std::size_t pageSize() noexcept
+{
+    static const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return page;
+}
+
+std::size_t roundUp(std::size_t v, std::size_t unit) noexcept
+{
+    return (v + unit - 1) / unit * unit;
+}
+
+/// MAP_HUGETLB 로 잡습니다. 예약된 huge page 가 없으면 nullptr (프로세스당 1회 WARN)
+std::byte *mapHugeTlb(std::size_t len) noexcept
+{
+    void *p = ::mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (p != MAP_FAILED)
+    {
+        return static_cast<std::byte *>(p);
+    }
+    static std::atomic_bool warned{false};
+    if (!warned.exchange(true, std::memory_order_relaxed))
+    {
+        const int saved = errno;
+        SLOG_WARN("PageMemory", "HugeTlbUnavailable", "bytes={} errno={} msg='{}' action=FallbackThp", len, saved,
+                  std::strerror(saved));
+        errno = saved;
+    }
+    return nullptr;
+}
+
+/// 일반 익명 매핑. align 이 페이지보다 크면 그 경계에 맞춘 구간만 남기고 앞뒤를 돌려줍니다.
+std::byte *mapAligned(std::size_t len, std::size_t align) noexcept
+{
+    const std::size_t extra = align > pageSize() ? align : 0;
+    void *raw = ::mmap(nullptr, len + extra, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    auto *p = static_cast<std::byte *>(raw);
+    if (extra == 0)
+    {
+        return p;
+    }
+
+    const auto addr = reinterpret_cast<std::uintptr_t>(p);
+    const std::size_t head = (align - addr % align) % align;
+    if (head != 0)
+    {
+        ::munmap(p, head);
+    }
+    if (const std::size_t tail = extra - head; tail != 0)
+    {
+        ::munmap(p + head + len, tail);
+    }
+    return p + head;
+}
+
+} // namespace
+
+void setThreadPagePolicy(const PageAllocPolicy &policy) noexcept
+{
+    threadPolicy_() = policy;
+}
+
+const PageAllocPolicy &threadPagePolicy() noexcept
+{
+    return threadPolicy_();
+}
+
+void prefaultPages(void *p, std::size_t len) noexcept
+{
+    if (!p || len == 0)
+    {
+        return;
+    }
+    if (::madvise(p, len, MADV_POPULATE_WRITE) == 0)
+    {
+        return;
+    }
+    // 구형 커널: 페이지마다 같은 값을 다시 써서 쓰기 fault 를 지금 낸다. (내용은 바뀌지 않음)
+    auto *bytes = static_cast<volatile unsigned char *>(p);
+    const std::size_t page = pageSize();
+    for (std::size_t off = 0; off < len; off += page)
+    {
+        bytes[off] = bytes[off];
+    }
+}
+
+int lockProcessMemory() noexcept
+{
+    if (::mlockall(MCL_CURRENT | MCL_FUTURE | MCL_ONFAULT) == 0)
+    {
+        return 0;
+    }
+    // MCL_ONFAULT 를 모르는 커널이면 EINVAL: 그때만 전부 올려서 잠근다.
+    if (errno == EINVAL && ::mlockall(MCL_CURRENT | MCL_FUTURE) == 0)
+    {
+        return 0;
+    }
+    return errno;
+}
+
+PageMemory::PageMemory(PageMemory &&other) noexcept
+    : base_(std::exchange(other.base_, nullptr)), length_(std::exchange(other.length_, 0)),
+      hugeTlb_(std::exchange(other.hugeTlb_, false))
+{
+}
+
+PageMemory &PageMemory::operator=(PageMemory &&other) noexcept
+{
+    if (this != &other)
+    {
+        release_();
+        base_ = std::exchange(other.base_, nullptr);
+        length_ = std::exchange(other.length_, 0);
+        hugeTlb_ = std::exchange(other.hugeTlb_, false);
+    }
+    return *this;
+}
+
+PageMemory::~PageMemory()
+{
+    release_();
+}
+
+void PageMemory::release_() noexcept
+{
+    if (base_)
+    {
+        ::munmap(base_, length_);
+        base_ = nullptr;
+        length_ = 0;
+        hugeTlb_ = false;
+    }
+}
+
+PageMemory PageMemory::allocate(std::size_t bytes, const PageAllocPolicy &policy) noexcept
+{
+    PageMemory m;
+    if (bytes == 0)
+    {
+        return m;
+    }
+
+    // 2 MiB 미만(세션 링 등)은 hugetlb 로 올리면 수십 배로 불어나 예약을 금방 소진하므로 일반 페이지로 잡는다.
+    if (policy.hugePages == HugePageMode::Explicit && bytes >= kHugePageSize)
+    {
+        const std::size_t len = roundUp(bytes, kHugePageSize);
+        if (std::byte *p = mapHugeTlb(len))
+        {
+            m.base_ = p;
+            m.length_ = len;
+            m.hugeTlb_ = true;
+        }
+    }
+
+    if (!m.base_)
+    {
+        const bool thp = policy.hugePages != HugePageMode::Off && bytes >= kHugePageSize;
+        const std::size_t len = roundUp(bytes, thp ? kHugePageSize : pageSize());
+        std::byte *p = mapAligned(len, thp ? kHugePageSize : pageSize());
+        if (!p)
+        {
+            return m;
+        }
+        m.base_ = p;
+        m.length_ = len;
+        if (policy.hugePages != HugePageMode::Off)
+        {
+            (void)::madvise(p, len, MADV_HUGEPAGE); // THP 가 꺼져 있으면 EINVAL: 일반 페이지 그대로
+        }
+    }
+
+    if (policy.prefault)
+    {
+        prefaultPages(m.base_, m.length_);
+    }
+    return m;
+}
+
+} // namespace hypernet::buffer
@@ -1,19 +1,136 @@
 #include <hypernet/buffer/RingBuffer.hpp>
 
+#include <hypernet/core/Logger.hpp>
+
 #include <algorithm> // std::min
+#include <atomic>
+#include <bit>       // std::bit_ceil
+#include <cerrno>
 #include <cstring>   // std::memcpy
 #include <stdexcept> // std::invalid_argument
+#include <sys/mman.h>
 #include <sys/uio.h> // struct iovec
+#include <unistd.h>
 
 namespace hypernet::buffer
 {
 
-RingBuffer::RingBuffer(std::size_t capacity) : buffer_(capacity), capacity_(capacity)
+namespace
+{
+
+/// memfd 하나를 [base, base+cap) 와 [base+cap, base+2cap) 에 겹쳐 매핑합니다.
+/// - hugeTlb 이면 MFD_HUGETLB 로 만듭니다. (cap 이 huge page 배수일 때만 호출)
+/// @return 매핑 시작 주소, 실패 시 nullptr (errno 보존)
+std::byte *mapMirrored(std::size_t cap, bool hugeTlb) noexcept
+{
+    const int fd = ::memfd_create("hypernet-ring", MFD_CLOEXEC | (hugeTlb ? MFD_HUGETLB : 0U));
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+
+    std::byte *base = nullptr;
+    if (::ftruncate(fd, static_cast<off_t>(cap)) == 0)
+    {
+        // 2 * cap 주소 공간을 먼저 예약한 뒤, 두 절반을 같은 파일로 덮어쓴다.
+        void *reserved = ::mmap(nullptr, 2 * cap, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (reserved != MAP_FAILED)
+        {
+            auto *p = static_cast<std::byte *>(reserved);
+            if (::mmap(p, cap, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED &&
+                ::mmap(p + cap, cap, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED)
+            {
+                base = p;
+            }
+            else
+            {
+                const int saved = errno;
+                ::munmap(reserved, 2 * cap);
+                errno = saved;
+            }
+        }
+    }
+
+    const int saved = errno;
+    ::close(fd); // 매핑이 파일을 붙잡고 있으므로 fd 는 바로 닫는다.
+    errno = saved;
+    return base;
+}
+
+} // namespace
+
+std::size_t RingBuffer::mirroredCapacityFor(std::size_t capacity) noexcept
+{
+    static const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return std::bit_ceil(std::max(capacity, page));
+}
+
+RingBuffer::RingBuffer(std::size_t capacity, Layout layout) : capacity_(capacity)
 {
     if (capacity_ == 0)
     {
         throw std::invalid_argument("RingBuffer capacity must be greater than 0");
     }
+
+    const PageAllocPolicy &policy = threadPagePolicy();
+
+    if (layout == Layout::Mirrored)
+    {
+        const std::size_t cap = mirroredCapacityFor(capacity);
+        std::byte *p = nullptr;
+        if (policy.hugePages == HugePageMode::Explicit && cap % kHugePageSize == 0)
+        {
+            p = mapMirrored(cap, true); // 예약된 huge page 가 없으면 일반 memfd 로
+        }
+        if (!p)
+        {
+            p = mapMirrored(cap, false);
+            if (p && policy.hugePages != HugePageMode::Off && cap >= kHugePageSize)
+            {
+                (void)::madvise(p, 2 * cap, MADV_HUGEPAGE); // shmem THP(shmem_enabled=advise) 일 때만 효과
+            }
+        }
+        if (p)
+        {
+            data_ = p;
+            capacity_ = cap;
+            mask_ = cap - 1;
+            if (policy.prefault)
+            {
+                prefaultPages(p, 2 * cap); // 두 절반의 page table 까지 미리 채운다.
+            }
+            return;
+        }
+
+        // 세션마다 찍히지 않도록 프로세스당 한 번만 경고한다.
+        static std::atomic_bool warned{false};
+        if (!warned.exchange(true, std::memory_order_relaxed))
+        {
+            SLOG_WARN("RingBuffer", "MirrorMapFailed", "capacity={} errno={} msg='{}' action=FallbackFlat", cap, errno,
+                      std::strerror(errno));
+        }
+    }
+
+    if (policy.enabled())
+    {
+        pages_ = PageMemory::allocate(capacity_, policy);
+        if (pages_)
+        {
+            data_ = pages_.data();
+            return;
+        }
+    }
+
+    flat_ = std::make_unique_for_overwrite<std::byte[]>(capacity_);
+    data_ = flat_.get();
+}
+
+RingBuffer::~RingBuffer()
+{
+    if (mask_ != 0)
+    {
+        ::munmap(data_, 2 * capacity_);
+    }
 }
 
 std::size_t RingBuffer::write(const std::byte *data, std::size_t len) noexcept
@@ -31,20 +148,20 @@ std::size_t RingBuffer::write(const std::byte *data, std::size_t len) noexcept
     }
 
     // 버퍼의 끝까지 연속으로 쓸 수 있는 공간
-    const std::size_t endSpace = capacity_ - tail_;
+    const std::size_t endSpace = contiguousFrom_(tail_);
     const std::size_t firstPart = std::min(toWrite, endSpace);
 
     // 첫 번째 조각: tail_ ~ tail_ + firstPart
-    std::memcpy(buffer_.data() + tail_, data, firstPart);
-    tail_ = (tail_ + firstPart) % capacity_;
+    std::memcpy(data_ + tail_, data, firstPart);
+    tail_ = wrap_(tail_ + firstPart);
     size_ += firstPart;
 
     // 남은 조각이 있으면 0번 인덱스로 랩어라운드(write)
     const std::size_t remaining = toWrite - firstPart;
     if (remaining > 0)
     {
-        std::memcpy(buffer_.data() + tail_, data + firstPart, remaining);
-        tail_ = (tail_ + remaining) % capacity_;
+        std::memcpy(data_ + tail_, data + firstPart, remaining);
+        tail_ = wrap_(tail_ + remaining);
         size_ += remaining;
     }
 
@@ -66,20 +183,20 @@ std::size_t RingBuffer::read(std::byte *dest, std::size_t len) noexcept
     }
 
     // 버퍼의 끝까지 연속으로 읽을 수 있는 데이터
-    const std::size_t endData = capacity_ - head_;
+    const std::size_t endData = contiguousFrom_(head_);
     const std::size_t firstPart = std::min(toRead, endData);
 
     // 첫 번째 조각: head_ ~ head_ + firstPart
-    std::memcpy(dest, buffer_.data() + head_, firstPart);
-    head_ = (head_ + firstPart) % capacity_;
+    std::memcpy(dest, data_ + head_, firstPart);
+    head_ = wrap_(head_ + firstPart);
     size_ -= firstPart;
 
     // 남은 조각이 있으면 0번 인덱스에서부터 랩어라운드(read)
     const std::size_t remaining = toRead - firstPart;
     if (remaining > 0)
     {
-        std::memcpy(dest + firstPart, buffer_.data() + head_, remaining);
-        head_ = (head_ + remaining) % capacity_;
+        std::memcpy(dest + firstPart, data_ + head_, remaining);
+        head_ = wrap_(head_ + remaining);
         size_ -= remaining;
     }
 
@@ -99,15 +216,15 @@ std::size_t RingBuffer::peek(std::byte *dest, std::size_t len) const noexcept
         return 0;
     }
 
-    const std::size_t endData = capacity_ - head_;
+    const std::size_t endData = contiguousFrom_(head_);
     const std::size_t firstPart = std::min(toCopy, endData);
 
-    std::memcpy(dest, buffer_.data() + head_, firstPart);
+    std::memcpy(dest, data_ + head_, firstPart);
 
     const std::size_t remaining = toCopy - firstPart;
     if (remaining > 0)
     {
-        std::memcpy(dest + firstPart, buffer_.data(), remaining);
+        std::memcpy(dest + firstPart, data_, remaining);
     }
 
     return toCopy;
@@ -121,7 +238,7 @@ BufferView RingBuffer::peekView(std::size_t maxLen) const noexcept
     }
 
     // head 에서 끝까지의 "연속된" 데이터 양
-    const std::size_t contiguous = std::min(size_, capacity_ - head_);
+    const std::size_t contiguous = std::min(size_, contiguousFrom_(head_));
     const std::size_t viewSize = std::min(maxLen, contiguous);
 
     if (viewSize == 0)
@@ -129,7 +246,7 @@ BufferView RingBuffer::peekView(std::size_t maxLen) const noexcept
         return {};
     }
 
-    return BufferView{buffer_.data() + head_, viewSize};
+    return BufferView{data_ + head_, viewSize};
 }
 
 BufferView RingBuffer::readView(std::size_t maxLen) noexcept
@@ -141,7 +258,7 @@ BufferView RingBuffer::readView(std::size_t maxLen) noexcept
     }
 
     const std::size_t consumed = view.size();
-    head_ = (head_ + consumed) % capacity_;
+    head_ = wrap_(head_ + consumed);
     size_ -= consumed;
 
     return view;
@@ -156,16 +273,16 @@ int RingBuffer::peekIov(::iovec out[2], std::size_t maxLen) const noexcept
     if (toRead == 0)
         return 0;
 
-    const std::size_t endData = capacity_ - head_;
+    const std::size_t endData = contiguousFrom_(head_);
     const std::size_t firstPart = std::min(toRead, endData);
     const std::size_t remaining = toRead - firstPart;
 
-    out[0].iov_base = const_cast<std::byte *>(buffer_.data() + head_);
+    out[0].iov_base = data_ + head_;
     out[0].iov_len = firstPart;
 
     if (remaining > 0)
     {
-        out[1].iov_base = const_cast<std::byte *>(buffer_.data()); // wrap to beginning
+        out[1].iov_base = data_; // wrap to beginning
         out[1].iov_len = remaining;
         return 2;
     }
@@ -187,16 +304,16 @@ int RingBuffer::writeIov(::iovec out[2], std::size_t maxLen) const noexcept
     if (toWrite == 0)
         return 0;
 
-    const std::size_t endSpace = capacity_ - tail_;
+    const std::size_t endSpace = contiguousFrom_(tail_);
     const std::size_t firstPart = std::min(toWrite, endSpace);
     const std::size_t remaining = toWrite - firstPart;
 
-    out[0].iov_base = const_cast<std::byte *>(buffer_.data() + tail_);
+    out[0].iov_base = data_ + tail_;
     out[0].iov_len = firstPart;
 
     if (remaining > 0)
     {
-        out[1].iov_base = const_cast<std::byte *>(buffer_.data()); // wrap to beginning
+        out[1].iov_base = data_; // wrap to beginning
         out[1].iov_len = remaining;
         return 2;
     }
@@ -219,7 +336,7 @@ void RingBuffer::commitWrite(std::size_t n) noexcept
         n = free; // 안전 클램프(원하면 assert로 바꿔도 됨)
     }
 
-    tail_ = (tail_ + n) % capacity_;
+    tail_ = wrap_(tail_ + n);
     size_ += n;
 }
 void RingBuffer::clear() noexcept
@@ -124,7 +124,8 @@ void ConnectorManager::sendAsync(std::string_view name, const SendOptions &opt,
 {
     if (!loop_.isInOwnerThread())
     {
-        loop_.post([this, name = std::string(name), opt, req = std::move(request), cb = std::move(cb)]() mutable { this->sendAsync(name, opt, std::move(req), std::move(cb)); });
+        // cold path(비 owner 스레드 호출): capture 가 커서 명시적으로 힙에 둔다.
+        loop_.post(core::makeHeapTask([this, name = std::string(name), opt, req = std::move(request), cb = std::move(cb)]() mutable { this->sendAsync(name, opt, std::move(req), std::move(cb)); }));
         return;
     }
 
@@ -154,7 +155,7 @@ void ConnectorManager::sendAsyncToDispatcher(std::string_view name, const SendOp
 {
     if (!loop_.isInOwnerThread())
     {
-        loop_.post([this, name = std::string(name), opt, session, resumeOpcode, req = std::move(request)]() mutable { this->sendAsyncToDispatcher(name, opt, session, resumeOpcode, std::move(req)); });
+        loop_.post(core::makeHeapTask([this, name = std::string(name), opt, session, resumeOpcode, req = std::move(request)]() mutable { this->sendAsyncToDispatcher(name, opt, session, resumeOpcode, std::move(req)); }));
         return;
     }
 
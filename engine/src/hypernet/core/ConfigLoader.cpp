@@ -63,6 +63,72 @@ static LogLevel parseLogLevel(std::string_view s)
     throw std::invalid_argument("Invalid log_level: " + std::string(s));
 }
 
+static net::IoBackend parseIoBackend(std::string_view s)
+{
+    std::string v(s);
+    for (auto &c : v)
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+
+    if (v == "epoll")
+        return net::IoBackend::Epoll;
+    if (v == "io_uring" || v == "iouring" || v == "uring")
+        return net::IoBackend::IoUring;
+
+    throw std::invalid_argument("Invalid io_backend: " + std::string(s));
+}
+
+static net::PollMode parsePollMode(std::string_view s)
+{
+    std::string v(s);
+    for (auto &c : v)
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+
+    if (v == "block")
+        return net::PollMode::Block;
+    if (v == "busy" || v == "busy_poll")
+        return net::PollMode::BusyPoll;
+    if (v == "spin" || v == "spin_then_block")
+        return net::PollMode::SpinThenBlock;
+    if (v == "adaptive")
+        return net::PollMode::Adaptive;
+
+    throw std::invalid_argument("Invalid poll_mode: " + std::string(s));
+}
+
+static net::SteeringMode parseSteeringMode(std::string_view s)
+{
+    std::string v(s);
+    for (auto &c : v)
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+
+    if (v.empty() || v == "kernel" || v == "hash")
+        return net::SteeringMode::Kernel;
+    if (v == "cpu" || v == "incoming_cpu")
+        return net::SteeringMode::IncomingCpu;
+    if (v == "weighted")
+        return net::SteeringMode::Weighted;
+    if (v == "least_loaded" || v == "least-loaded")
+        return net::SteeringMode::LeastLoaded;
+
+    throw std::invalid_argument("Invalid connection_steering: " + std::string(s));
+}
+
+static buffer::HugePageMode parseHugePageMode(std::string_view s)
+{
+    std::string v(s);
+    for (auto &c : v)
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+
+    if (v.empty() || v == "off" || v == "none")
+        return buffer::HugePageMode::Off;
+    if (v == "thp" || v == "transparent")
+        return buffer::HugePageMode::Transparent;
+    if (v == "hugetlb" || v == "explicit")
+        return buffer::HugePageMode::Explicit;
+
+    throw std::invalid_argument("Invalid huge_pages: " + std::string(s));
+}
+
 static std::optional<std::string> scanCliForConfigPath(int argc, char **argv)
 {
     for (int i = 1; i < argc; ++i)
@@ -100,6 +166,14 @@ static std::size_t checkedSizeFromI64(std::int64_t v, const char *key)
     return static_cast<std::size_t>(v);
 }
 
+// -1 은 "고정 안 함"
+static int checkedCpuFromI64(std::int64_t v, const char *key)
+{
+    if (v < -1 || v > std::numeric_limits<int>::max())
+        throw std::invalid_argument(std::string(key) + " out of range (-1 or cpu index): " + std::to_string(v));
+    return static_cast<int>(v);
+}
+
 // [Strict Mode] Helper: Required Table
 static const toml::table &requireTable(const toml::table &root, const char *name)
 {
@@ -148,10 +222,22 @@ static void applyEngineToml(GlobalConfig &cfg, const toml::table &root)
         cfg.engine.reusePort = *b;
     else if (auto i = engineKey(engine, "reuse_port").value<std::int64_t>())
         cfg.engine.reusePort = (*i != 0);
+    if (auto s = engineKey(engine, "connection_steering").value<std::string>())
+        cfg.engine.connectionSteering = parseSteeringMode(*s);
+    if (auto v = engineKey(engine, "steering_update_ms").value<std::int64_t>())
+        cfg.engine.steeringUpdateMs = static_cast<std::uint32_t>(checkedUIntFromI64(*v, "steering_update_ms"));
+    if (auto v = engineKey(engine, "session_rebalance_ms").value<std::int64_t>())
+        cfg.engine.sessionRebalanceMs = static_cast<std::uint32_t>(checkedUIntFromI64(*v, "session_rebalance_ms"));
+    if (auto v = engineKey(engine, "session_rebalance_threshold_pct").value<std::int64_t>())
+        cfg.engine.sessionRebalanceThresholdPct =
+            static_cast<std::uint32_t>(checkedUIntFromI64(*v, "session_rebalance_threshold_pct"));
 
     if (auto s = engineKey(engine, "log_file_path").value<std::string>())
         cfg.engine.logFilePath = *s;
 
+    if (auto v = engineKey(engine, "log_thread_ring_bytes").value<std::int64_t>())
+        cfg.engine.logThreadRingBytes = checkedSizeFromI64(*v, "log_thread_ring_bytes");
+
     if (auto s = engineKey(engine, "metrics_http_address").value<std::string>())
         cfg.engine.metricsHttpAddress = *s;
 
@@ -168,11 +254,27 @@ static void applyEngineToml(GlobalConfig &cfg, const toml::table &root)
 
     if (auto v = engineKey(engine, "tick_resolution_ms").value<std::int64_t>())
         cfg.engine.tickResolutionMs = static_cast<std::uint32_t>(checkedUIntFromI64(*v, "tick_resolution_ms"));
+    if (auto v = engineKey(engine, "tick_resolution_us").value<std::int64_t>())
+        cfg.engine.tickResolutionUs = static_cast<std::uint32_t>(checkedUIntFromI64(*v, "tick_resolution_us"));
     if (auto v = engineKey(engine, "timer_slots").value<std::int64_t>())
         cfg.engine.timerSlots = checkedSizeFromI64(*v, "timer_slots");
     if (auto v = engineKey(engine, "max_epoll_events").value<std::int64_t>())
         cfg.engine.maxEpollEvents = static_cast<std::uint32_t>(checkedUIntFromI64(*v, "max_epoll_events"));
 
+    if (auto s = engineKey(engine, "io_backend").value<std::string>())
+        cfg.engine.ioBackend = parseIoBackend(*s);
+    if (auto v = engineKey(engine, "uring_recv_buffer_size").value<std::int64_t>())
+        cfg.engine.uringRecvBufferSize = checkedSizeFromI64(*v, "uring_recv_buffer_size");
+    if (auto v = engineKey(engine, "uring_recv_buffer_count").value<std::int64_t>())
+        cfg.engine.uringRecvBufferCount = checkedSizeFromI64(*v, "uring_recv_buffer_count");
+
+    if (auto s = engineKey(engine, "poll_mode").value<std::string>())
+        cfg.engine.pollMode = parsePollMode(*s);
+    if (auto v = engineKey(engine, "poll_spin_us").value<std::int64_t>())
+        cfg.engine.pollSpinUs = static_cast<std::uint32_t>(checkedUIntFromI64(*v, "poll_spin_us"));
+    if (auto v = engineKey(engine, "session_busy_poll_us").value<std::int64_t>())
+        cfg.engine.sessionBusyPollUs = static_cast<std::uint32_t>(checkedUIntFromI64(*v, "session_busy_poll_us"));
+
     if (auto v = engineKey(engine, "buffer_block_size").value<std::int64_t>())
         cfg.engine.bufferBlockSize = checkedSizeFromI64(*v, "buffer_block_size");
     if (auto v = engineKey(engine, "buffer_block_count").value<std::int64_t>())
@@ -181,9 +283,69 @@ static void applyEngineToml(GlobalConfig &cfg, const toml::table &root)
         cfg.engine.recvRingCapacity = checkedSizeFromI64(*v, "recv_ring_capacity");
     if (auto v = engineKey(engine, "send_ring_capacity").value<std::int64_t>())
         cfg.engine.sendRingCapacity = checkedSizeFromI64(*v, "send_ring_capacity");
+    if (auto b = engineKey(engine, "mirrored_rings").value<bool>())
+        cfg.engine.mirroredRings = *b;
+    else if (auto i = engineKey(engine, "mirrored_rings").value<std::int64_t>())
+        cfg.engine.mirroredRings = (*i != 0);
+    if (auto v = engineKey(engine, "ring_idle_reclaim_ms").value<std::int64_t>())
+        cfg.engine.ringIdleReclaimMs = static_cast<std::uint32_t>(checkedUIntFromI64(*v, "ring_idle_reclaim_ms"));
+    if (auto v = engineKey(engine, "session_pool_prewarm").value<std::int64_t>())
+        cfg.engine.sessionPoolPrewarm = checkedSizeFromI64(*v, "session_pool_prewarm");
+    if (auto v = engineKey(engine, "session_pool_max_idle").value<std::int64_t>())
+        cfg.engine.sessionPoolMaxIdle = checkedSizeFromI64(*v, "session_pool_max_idle");
+
+    if (auto b = engineKey(engine, "deferred_flush").value<bool>())
+        cfg.engine.deferredFlush = *b;
+    else if (auto i = engineKey(engine, "deferred_flush").value<std::int64_t>())
+        cfg.engine.deferredFlush = (*i != 0);
+    if (auto b = engineKey(engine, "deferred_flush_cork").value<bool>())
+        cfg.engine.deferredFlushCork = *b;
+    else if (auto i = engineKey(engine, "deferred_flush_cork").value<std::int64_t>())
+        cfg.engine.deferredFlushCork = (*i != 0);
+    if (auto v = engineKey(engine, "zerocopy_threshold").value<std::int64_t>())
+        cfg.engine.zeroCopyThreshold = checkedSizeFromI64(*v, "zerocopy_threshold");
+    if (auto v = engineKey(engine, "zerocopy_buffer_count").value<std::int64_t>())
+        cfg.engine.zeroCopyBufferCount = checkedSizeFromI64(*v, "zerocopy_buffer_count");
+    if (auto v = engineKey(engine, "send_queue_limit_bytes").value<std::int64_t>())
+        cfg.engine.sendQueueLimitBytes = checkedSizeFromI64(*v, "send_queue_limit_bytes");
+    if (auto v = engineKey(engine, "send_queue_high_watermark").value<std::int64_t>())
+        cfg.engine.sendQueueHighWatermark = checkedSizeFromI64(*v, "send_queue_high_watermark");
+    if (auto v = engineKey(engine, "send_queue_low_watermark").value<std::int64_t>())
+        cfg.engine.sendQueueLowWatermark = checkedSizeFromI64(*v, "send_queue_low_watermark");
 
     if (auto v = engineKey(engine, "max_payload_len").value<std::int64_t>())
         cfg.engine.maxPayloadLen = static_cast<std::uint32_t>(checkedUIntFromI64(*v, "max_payload_len"));
+
+    if (auto b = engineKey(engine, "worker_handoff").value<bool>())
+        cfg.engine.workerHandoff = *b;
+    else if (auto i = engineKey(engine, "worker_handoff").value<std::int64_t>())
+        cfg.engine.workerHandoff = (*i != 0);
+    if (auto v = engineKey(engine, "handoff_ring_slots").value<std::int64_t>())
+        cfg.engine.handoffRingSlots = checkedSizeFromI64(*v, "handoff_ring_slots");
+
+    if (auto s = engineKey(engine, "worker_cpu_affinity").value<std::string>())
+        cfg.engine.workerCpuAffinity = *s;
+    if (auto v = engineKey(engine, "worker_sched_fifo_priority").value<std::int64_t>())
+        cfg.engine.workerSchedFifoPriority = static_cast<std::uint32_t>(checkedUIntFromI64(*v, "worker_sched_fifo_priority"));
+    if (auto b = engineKey(engine, "worker_numa_bind").value<bool>())
+        cfg.engine.workerNumaBind = *b;
+    else if (auto i = engineKey(engine, "worker_numa_bind").value<std::int64_t>())
+        cfg.engine.workerNumaBind = (*i != 0);
+    if (auto v = engineKey(engine, "logger_cpu").value<std::int64_t>())
+        cfg.engine.loggerCpu = checkedCpuFromI64(*v, "logger_cpu");
+    if (auto v = engineKey(engine, "metrics_cpu").value<std::int64_t>())
+        cfg.engine.metricsCpu = checkedCpuFromI64(*v, "metrics_cpu");
+
+    if (auto s = engineKey(engine, "huge_pages").value<std::string>())
+        cfg.engine.hugePages = parseHugePageMode(*s);
+    if (auto b = engineKey(engine, "prefault_memory").value<bool>())
+        cfg.engine.prefaultMemory = *b;
+    else if (auto i = engineKey(engine, "prefault_memory").value<std::int64_t>())
+        cfg.engine.prefaultMemory = (*i != 0);
+    if (auto b = engineKey(engine, "lock_memory").value<bool>())
+        cfg.engine.lockMemory = *b;
+    else if (auto i = engineKey(engine, "lock_memory").value<std::int64_t>())
+        cfg.engine.lockMemory = (*i != 0);
 }
 
 static void applyAppToml(GlobalConfig &cfg, const toml::table &root)
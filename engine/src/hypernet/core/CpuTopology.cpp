@@ -0,0 +1,293 @@
+#include <hypernet/core/CpuTopology.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace hypernet::core
+{
+
+namespace
+{
+// <numaif.h>(libnuma) 없이 set_mempolicy 를 부르기 위한 값
+constexpr int kMpolPreferred = 1;
+constexpr int kMaxCpus = CPU_SETSIZE;
+constexpr int kMaxNumaNodes = 1024;
+
+bool parseInt(std::string_view s, int &out) noexcept
+{
+    if (s.empty())
+    {
+        return false;
+    }
+    const auto [p, ec] = std::from_chars(s.data(), s.data() + s.size(), out);
+    return ec == std::errc{} && p == s.data() + s.size() && out >= 0;
+}
+
+std::string_view trim(std::string_view s) noexcept
+{
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\t' || s.front() == '\n'))
+    {
+        s.remove_prefix(1);
+    }
+    while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\n'))
+    {
+        s.remove_suffix(1);
+    }
+    return s;
+}
+
+std::optional<std::string> readSysFile(const std::string &path)
+{
+    std::ifstream in(path);
+    if (!in)
+    {
+        return std::nullopt;
+    }
+    std::string line;
+    std::getline(in, line);
+    return line;
+}
+
+int readSysInt(const std::string &path, int fallback)
+{
+    const auto text = readSysFile(path);
+    int v = 0;
+    if (!text || !parseInt(trim(*text), v))
+    {
+        return fallback;
+    }
+    return v;
+}
+} // namespace
+
+std::optional<std::vector<int>> parseCpuList(std::string_view text)
+{
+    std::vector<int> out;
+    text = trim(text);
+    if (text.empty())
+    {
+        return std::nullopt;
+    }
+    while (!text.empty())
+    {
+        const std::size_t comma = text.find(',');
+        const std::string_view item = trim(text.substr(0, comma));
+        text = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+
+        const std::size_t dash = item.find('-');
+        int lo = 0;
+        int hi = 0;
+        if (dash == std::string_view::npos)
+        {
+            if (!parseInt(item, lo))
+            {
+                return std::nullopt;
+            }
+            hi = lo;
+        }
+        else if (!parseInt(trim(item.substr(0, dash)), lo) || !parseInt(trim(item.substr(dash + 1)), hi) || hi < lo)
+        {
+            return std::nullopt;
+        }
+        if (hi >= kMaxCpus)
+        {
+            return std::nullopt;
+        }
+        for (int c = lo; c <= hi; ++c)
+        {
+            out.push_back(c);
+        }
+        if (comma != std::string_view::npos && text.empty())
+        {
+            return std::nullopt; // "1,2," 처럼 끝이 비면 오타로 본다
+        }
+    }
+    return out;
+}
+
+std::vector<CpuInfo> scanCpuTopology()
+{
+    std::vector<CpuInfo> out;
+
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (::sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+    {
+        return out;
+    }
+
+    // cpu -> node. (node 디렉터리가 없으면 비 NUMA 로 보고 모두 0)
+    std::map<int, int> nodeOf;
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it("/sys/devices/system/node", ec), end; !ec && it != end; it.increment(ec))
+    {
+        const std::string name = it->path().filename().string();
+        int node = 0;
+        if (name.rfind("node", 0) != 0 || !parseInt(std::string_view{name}.substr(4), node))
+        {
+            continue;
+        }
+        const auto list = readSysFile(it->path().string() + "/cpulist");
+        if (!list)
+        {
+            continue;
+        }
+        if (auto cpus = parseCpuList(*list))
+        {
+            for (int c : *cpus)
+            {
+                nodeOf[c] = node;
+            }
+        }
+    }
+
+    for (int cpu = 0; cpu < kMaxCpus; ++cpu)
+    {
+        if (!CPU_ISSET(cpu, &allowed))
+        {
+            continue;
+        }
+        const std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+        CpuInfo info;
+        info.cpu = cpu;
+        info.core = readSysInt(base + "core_id", cpu);
+        info.package = readSysInt(base + "physical_package_id", 0);
+        const auto it = nodeOf.find(cpu);
+        info.node = it != nodeOf.end() ? it->second : 0;
+        out.push_back(info);
+    }
+    return out;
+}
+
+CpuPlacementPlan planWorkerCpus(const std::vector<CpuInfo> &topology, unsigned int count)
+{
+    CpuPlacementPlan plan;
+    if (topology.empty() || count == 0)
+    {
+        return plan;
+    }
+
+    // 물리 코어별로 묶는다. (core_id 는 소켓 안에서만 유일)
+    std::map<std::pair<int, int>, std::vector<CpuInfo>> cores;
+    for (const CpuInfo &c : topology)
+    {
+        cores[{c.package, c.core}].push_back(c);
+    }
+
+    const auto byNodeCpu = [](const CpuInfo &a, const CpuInfo &b)
+    { return a.node != b.node ? a.node < b.node : a.cpu < b.cpu; };
+
+    std::vector<CpuInfo> primaries;
+    std::vector<CpuInfo> siblings;
+    for (auto &[key, cpus] : cores)
+    {
+        std::sort(cpus.begin(), cpus.end(), byNodeCpu);
+        primaries.push_back(cpus.front());
+        siblings.insert(siblings.end(), cpus.begin() + 1, cpus.end());
+    }
+
+    if (cores.size() > count)
+    {
+        const auto lowest = std::min_element(topology.begin(), topology.end(),
+                                             [](const CpuInfo &a, const CpuInfo &b) { return a.cpu < b.cpu; });
+        const auto sameCore = [&](const CpuInfo &c) { return c.package == lowest->package && c.core == lowest->core; };
+        plan.housekeepingCpu = lowest->cpu;
+        primaries.erase(std::remove_if(primaries.begin(), primaries.end(), sameCore), primaries.end());
+        siblings.erase(std::remove_if(siblings.begin(), siblings.end(), sameCore), siblings.end());
+    }
+
+    std::sort(primaries.begin(), primaries.end(), byNodeCpu);
+    std::sort(siblings.begin(), siblings.end(), byNodeCpu);
+
+    std::vector<int> order;
+    order.reserve(primaries.size() + siblings.size());
+    for (const CpuInfo &c : primaries)
+    {
+        order.push_back(c.cpu);
+    }
+    for (const CpuInfo &c : siblings)
+    {
+        order.push_back(c.cpu);
+    }
+
+    plan.workerCpus.reserve(count);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        plan.workerCpus.push_back(order[i % order.size()]);
+    }
+    return plan;
+}
+
+int numaNodeOfCpu(int cpu) noexcept
+{
+    if (cpu < 0)
+    {
+        return -1;
+    }
+    try
+    {
+        for (const CpuInfo &c : scanCpuTopology())
+        {
+            if (c.cpu == cpu)
+            {
+                return c.node;
+            }
+        }
+    }
+    catch (...)
+    {
+    }
+    return -1;
+}
+
+int pinThreadToCpu(pthread_t thread, int cpu) noexcept
+{
+    if (cpu < 0 || cpu >= kMaxCpus)
+    {
+        return EINVAL;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return ::pthread_setaffinity_np(thread, sizeof(set), &set);
+}
+
+int pinCurrentThreadToCpu(int cpu) noexcept
+{
+    return pinThreadToCpu(::pthread_self(), cpu);
+}
+
+int setCurrentThreadFifo(std::uint32_t priority) noexcept
+{
+    sched_param sp{};
+    sp.sched_priority = static_cast<int>(priority);
+    return ::pthread_setschedparam(::pthread_self(), SCHED_FIFO, &sp);
+}
+
+int preferNumaNode(int node) noexcept
+{
+    if (node < 0 || node >= kMaxNumaNodes)
+    {
+        return EINVAL;
+    }
+    constexpr std::size_t kBits = 8 * sizeof(unsigned long);
+    unsigned long mask[kMaxNumaNodes / kBits]{};
+    mask[static_cast<std::size_t>(node) / kBits] = 1UL << (static_cast<std::size_t>(node) % kBits);
+    if (::syscall(SYS_set_mempolicy, kMpolPreferred, mask, static_cast<unsigned long>(kMaxNumaNodes)) != 0)
+    {
+        return errno;
+    }
+    return 0;
+}
+
+} // namespace hypernet::core
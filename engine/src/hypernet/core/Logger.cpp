@@ -1,13 +1,15 @@
 #include <hypernet/core/Logger.hpp>
+#include <hypernet/core/CpuTopology.hpp>
 #include <hypernet/core/ThreadContext.hpp> // ttag(), tid()
 
+#include <cerrno>
 #include <chrono>
 #include <condition_variable>
-#include <cstring> // strrchr (unused now, kept optional)
+#include <ctime>
 #include <format>
 #include <iostream>
+#include <iterator>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <unistd.h> // isatty, fileno
 #include <vector>
@@ -44,21 +46,161 @@ static const char *levelToStr(LogLevel lvl) noexcept
     return "INFO";
 }
 
-// 로그 항목 구조체 (레거시 file/line 완전 제거)
-struct LogEvent
+namespace
 {
-    LogLevel level{};
-    std::string message;
-    std::chrono::system_clock::time_point timestamp;
-    std::string threadTag; // e.g. "main", "w0"
-    long threadId{};
+
+constexpr std::size_t kMaxRecordsPerPass = 4096;   // 한 번에 포맷할 레코드 상한 (그 뒤 링 공간 반환)
+constexpr std::size_t kWriteChunkBytes = 64 * 1024; // 이만큼 모이면 스트림에 씀
+constexpr int kIdleWaitMaxMs = 16;                  // 링이 비었을 때 대기 상한 (1ms 부터 2배씩)
+constexpr auto kRecalibrateEvery = std::chrono::seconds(1);
+constexpr auto kFatalFlushTimeout = std::chrono::milliseconds(500);
+
+std::int64_t wallNowNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+// 레코드 stamp(TSC 등) → 벽시계 ns 환산
+// - 로거 스레드가 (stamp, 벽시계) 기준점을 주기적으로 다시 잡고, 직전 기준점과의 기울기로 tick 당 ns 를 구합니다.
+class StampClock
+{
+  public:
+    void calibrate()
+    {
+        const std::uint64_t t0 = detail::logStamp();
+        const std::int64_t w0 = wallNowNs();
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        anchorStamp_ = detail::logStamp();
+        anchorWall_ = wallNowNs();
+        nsPerTick_ = slope_(t0, w0);
+        lastRecalibrate_ = std::chrono::steady_clock::now();
+    }
+
+    void maybeRecalibrate()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now - lastRecalibrate_ < kRecalibrateEvery)
+            return;
+        const std::uint64_t t0 = anchorStamp_;
+        const std::int64_t w0 = anchorWall_;
+        anchorStamp_ = detail::logStamp();
+        anchorWall_ = wallNowNs();
+        nsPerTick_ = slope_(t0, w0);
+        lastRecalibrate_ = now;
+    }
+
+    [[nodiscard]] std::int64_t toWallNs(std::uint64_t stamp) const noexcept
+    {
+        const auto delta = static_cast<std::int64_t>(stamp - anchorStamp_);
+        return anchorWall_ + static_cast<std::int64_t>(static_cast<double>(delta) * nsPerTick_);
+    }
+
+  private:
+    [[nodiscard]] double slope_(std::uint64_t t0, std::int64_t w0) const noexcept
+    {
+        const auto dt = static_cast<std::int64_t>(anchorStamp_ - t0);
+        if (dt <= 0)
+            return nsPerTick_;
+        return static_cast<double>(anchorWall_ - w0) / static_cast<double>(dt);
+    }
+
+    std::uint64_t anchorStamp_{0};
+    std::int64_t anchorWall_{0};
+    double nsPerTick_{1.0};
+    std::chrono::steady_clock::time_point lastRecalibrate_{};
+};
+
+// 로그를 남기는 스레드들의 링 목록 (Logger::Impl 하나당 1개)
+// - 등록/제거만 mutex 를 잡고, 레코드 적재/소비는 링 자체(SPSC)로 합니다.
+struct RingRegistry
+{
+    explicit RingRegistry(std::size_t bytes) noexcept : ringBytes(bytes) {}
+
+    std::uint64_t generation{nextGeneration()};
+    std::size_t ringBytes;
+
+    std::mutex mutex;
+    std::vector<std::shared_ptr<detail::LogRing>> rings;
+    std::uint64_t version{0}; ///< rings 가 바뀔 때마다 증가 (로거 스레드가 사본을 갱신)
+
+    // 링을 쓸 수 없는 경로(스레드 종료 중, 비활성 Logger 직접 호출)용 공유 링 (producer 쪽 mutex)
+    std::mutex orphanMutex;
+    std::shared_ptr<detail::LogRing> orphan;
+
+    std::condition_variable *wake{nullptr}; ///< 로거 스레드 대기 (FATAL flush 가 깨움)
+    std::atomic<bool> wakeRequested{false};
+
+    static std::uint64_t nextGeneration() noexcept
+    {
+        static std::atomic<std::uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+};
+
+std::atomic<RingRegistry *> gActiveRegistry{nullptr};
+
+// 스레드별 링 캐시 (trivially destructible: 스레드 종료 중 로그에서도 안전하게 읽힘)
+struct ThreadRingCache
+{
+    detail::LogRing *ring{nullptr};
+    std::uint64_t generation{0};
+    bool exited{false};
+};
+
+thread_local ThreadRingCache tlsRing;
+
+// 스레드 종료 시 링을 retire 표시합니다. (이후 그 스레드의 로그는 orphan 링으로 감)
+struct ThreadRingReaper
+{
+    ~ThreadRingReaper()
+    {
+        RingRegistry *reg = gActiveRegistry.load(std::memory_order_acquire);
+        if (tlsRing.ring && reg && reg->generation == tlsRing.generation)
+        {
+            tlsRing.ring->retire();
+        }
+        tlsRing.ring = nullptr;
+        tlsRing.exited = true;
+    }
 };
 
+thread_local ThreadRingReaper tlsReaper;
+
+detail::LogRing *attachThreadRing(RingRegistry &reg) noexcept
+{
+    if (tlsRing.exited)
+        return nullptr;
+    try
+    {
+        auto ring = std::make_shared<detail::LogRing>(reg.ringBytes);
+        {
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            reg.rings.push_back(ring);
+            ++reg.version;
+        }
+        (void)&tlsReaper; // 스레드 종료 시 retire 되도록 reaper 를 만들어 둔다.
+        tlsRing.ring = ring.get();
+        tlsRing.generation = reg.generation;
+        return tlsRing.ring;
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+} // namespace
+
 class Logger::Impl
 {
   public:
-    explicit Impl(std::ostream &os) : os_(os)
+    Impl(std::ostream &os, std::shared_ptr<std::ostream> owned, std::size_t ringBytes)
+        : os_(os), ownedStream_(std::move(owned)), registry_(ringBytes)
     {
+        registry_.orphan = std::make_shared<detail::LogRing>(ringBytes);
+        registry_.wake = &cv_;
+
         // 터미널인지 확인하여 색상 사용 여부 결정 (stdout 기준)
         if (&os == &std::cout || &os == &std::clog || &os == &std::cerr)
         {
@@ -67,7 +209,11 @@ class Logger::Impl
         worker_ = std::thread([this]() { processQueue(); });
     }
 
-    ~Impl() { stop(); }
+    ~Impl()
+    {
+        deactivate();
+        stop();
+    }
 
     void stop()
     {
@@ -82,86 +228,251 @@ class Logger::Impl
         }
     }
 
+    void activate() noexcept { gActiveRegistry.store(&registry_, std::memory_order_release); }
+
+    void deactivate() noexcept
+    {
+        RingRegistry *expected = &registry_;
+        gActiveRegistry.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+    }
+
+    // ILogger::log 경로: 완성 메시지를 Message 레코드로 싣습니다.
     void log(LogLevel level, std::string_view msg)
     {
-        // capture time + thread meta at log-call time
-        auto now = std::chrono::system_clock::now();
-        std::string ttag(hypernet::core::ttag());
-        long tid = hypernet::core::tid();
+        const int wid = hypernet::core::wid();
+        const long tid = hypernet::core::tid();
 
+        if (gActiveRegistry.load(std::memory_order_acquire) == &registry_)
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            queue_.push(LogEvent{level, std::string(msg), now, std::move(ttag), tid});
+            if (detail::LogRing *ring = detail::threadLogRing())
+            {
+                detail::pushLogText(*ring, detail::LogRecordKind::Message, static_cast<int>(level), {}, {}, msg,
+                                    wid, tid);
+                return;
+            }
         }
-        cv_.notify_one();
+        pushOrphan(level, {}, {}, msg, detail::LogRecordKind::Message);
+    }
+
+    void pushOrphan(LogLevel level, std::string_view comp, std::string_view evt, std::string_view text,
+                    detail::LogRecordKind kind) noexcept
+    {
+        std::lock_guard<std::mutex> lock(registry_.orphanMutex);
+        detail::pushLogText(*registry_.orphan, kind, static_cast<int>(level), comp, evt, text,
+                            hypernet::core::wid(), hypernet::core::tid());
     }
 
     void setMinLevel(LogLevel level) noexcept
     {
-        minLevel_ = level;
+        minLevel_.store(level, std::memory_order_relaxed);
         // fast path filter도 함께 갱신
         detail::fastMinLevel().store(static_cast<int>(level), std::memory_order_relaxed);
     }
 
-    LogLevel minLevel() const noexcept { return minLevel_; }
+    LogLevel minLevel() const noexcept { return minLevel_.load(std::memory_order_relaxed); }
+
+    std::uint64_t droppedRecords() const noexcept { return droppedTotal_.load(std::memory_order_relaxed); }
+
+    int pinConsumerThread(int cpu) noexcept
+    {
+        if (!worker_.joinable())
+        {
+            return ESRCH;
+        }
+        return pinThreadToCpu(worker_.native_handle(), cpu);
+    }
 
   private:
     void processQueue()
     {
+        clock_.calibrate();
+        int idleWaitMs = 1;
+
         while (true)
         {
-            std::vector<LogEvent> batch;
+            bool stopping = false;
             {
-                std::unique_lock<std::mutex> lock(mutex_);
-                cv_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+                std::lock_guard<std::mutex> lock(mutex_);
+                stopping = stop_;
+            }
 
-                if (stop_ && queue_.empty())
-                    return;
+            refreshRings_();
+            clock_.maybeRecalibrate();
+            const std::size_t n = drainOnce_();
+            reportDrops_();
 
-                while (!queue_.empty())
-                {
-                    batch.push_back(std::move(queue_.front()));
-                    queue_.pop();
-                }
+            if (n != 0)
+            {
+                idleWaitMs = 1;
+                continue;
+            }
+            if (stopping)
+                return;
+
+            reapRetired_();
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait_for(lock, std::chrono::milliseconds(idleWaitMs),
+                         [this]() { return stop_ || registry_.wakeRequested.exchange(false); });
+            idleWaitMs = idleWaitMs < kIdleWaitMaxMs ? idleWaitMs * 2 : kIdleWaitMaxMs;
+        }
+    }
+
+    void refreshRings_()
+    {
+        std::lock_guard<std::mutex> lock(registry_.mutex);
+        if (seenVersion_ == registry_.version && !active_.empty())
+            return;
+        active_ = registry_.rings;
+        active_.push_back(registry_.orphan);
+        seenVersion_ = registry_.version;
+    }
+
+    // 비었고 주인이 끝난 링을 목록에서 뺍니다.
+    void reapRetired_()
+    {
+        bool any = false;
+        for (const auto &r : active_)
+        {
+            if (r->retired() && r->released() == r->published())
+            {
+                any = true;
+                break;
             }
+        }
+        if (!any)
+            return;
+
+        std::lock_guard<std::mutex> lock(registry_.mutex);
+        std::erase_if(registry_.rings, [](const std::shared_ptr<detail::LogRing> &r)
+                      { return r->retired() && r->released() == r->published(); });
+        ++registry_.version;
+    }
 
-            for (const auto &ev : batch)
+    // 링들의 앞 레코드를 stamp 순으로 합쳐 포맷합니다. (링 안에서 제자리로 읽음)
+    std::size_t drainOnce_()
+    {
+        std::size_t count = 0;
+        while (count < kMaxRecordsPerPass)
+        {
+            detail::LogRing *best = nullptr;
+            const detail::LogRecordHeader *bestHdr = nullptr;
+            for (const auto &r : active_)
             {
-                if (ev.level < minLevel_)
-                    continue;
-                writeLog(ev);
+                const detail::LogRecordHeader *h = r->front();
+                if (h && (!bestHdr || static_cast<std::int64_t>(h->stamp - bestHdr->stamp) < 0))
+                {
+                    best = r.get();
+                    bestHdr = h;
+                }
             }
-            os_.flush();
+            if (!bestHdr)
+                break;
+
+            if (static_cast<int>(bestHdr->level) >= static_cast<int>(minLevel()))
+                writeRecord_(*bestHdr);
+            best->pop();
+            ++count;
+
+            if (out_.size() >= kWriteChunkBytes)
+                writeOut_();
+        }
+
+        for (const auto &r : active_)
+            r->release();
+        writeOut_();
+        return count;
+    }
+
+    void reportDrops_()
+    {
+        std::uint64_t total = 0;
+        for (const auto &r : active_)
+            total += r->dropped();
+        // 목록에서 빠진 링의 drop 은 droppedTotal_ 에 이미 반영되어 있으므로 감소는 무시한다.
+        const std::uint64_t prev = droppedTotal_.load(std::memory_order_relaxed);
+        if (total <= lastDropSum_)
+        {
+            lastDropSum_ = total;
+            return;
         }
+        const std::uint64_t fresh = total - lastDropSum_;
+        lastDropSum_ = total;
+        droppedTotal_.store(prev + fresh, std::memory_order_relaxed);
+
+        writePrefix_(clock_.toWallNs(detail::logStamp()), ThreadContext::kNonWorker, hypernet::core::tid(),
+                     LogLevel::Warn);
+        std::format_to(std::back_inserter(out_), "Logger | RecordsDropped | dropped={} total={}\n", fresh,
+                       prev + fresh);
+        writeOut_();
     }
 
-    void writeLog(const LogEvent &ev)
+    void writeRecord_(const detail::LogRecordHeader &h)
     {
-        using namespace std::chrono;
+        writePrefix_(clock_.toWallNs(h.stamp), h.workerId, h.tid, static_cast<LogLevel>(h.level));
 
-        // time-of-day (HH:MM:SS.uuuuuu)
-        const auto t = system_clock::to_time_t(ev.timestamp);
-        std::tm tm{};
-        localtime_r(&t, &tm);
+        const auto *payload = h.payload();
+        if (h.kind == detail::LogRecordKind::Message)
+        {
+            out_.append(reinterpret_cast<const char *>(payload), h.payloadLen);
+            out_.push_back('\n');
+            return;
+        }
 
-        const auto us = duration_cast<microseconds>(ev.timestamp.time_since_epoch()) % seconds(1);
+        out_.append(h.comp());
+        out_.append(" | ");
+        out_.append(h.evt());
 
-        // thread column: "W0 tid=..." / "main tid=..."
-        std::string thr = ev.threadTag;
-        if (!thr.empty() && thr[0] == 'w')
-            thr[0] = 'W';
-        const std::string thrCol = std::format("{} tid={}", thr, ev.threadId);
+        if (h.kind == detail::LogRecordKind::Text)
+        {
+            if (h.payloadLen != 0)
+            {
+                out_.append(" | ");
+                out_.append(reinterpret_cast<const char *>(payload), h.payloadLen);
+            }
+            out_.push_back('\n');
+            return;
+        }
+
+        // Format: 빈 details 면 "comp | evt" 만 남긴다 (slog::build 와 동일)
+        const std::size_t mark = out_.size();
+        out_.append(" | ");
+        const std::size_t detailsAt = out_.size();
+        try
+        {
+            h.decode(std::string_view{h.fmt, h.fmtLen}, payload, h.payloadLen, out_);
+        }
+        catch (const std::exception &e)
+        {
+            out_.resize(detailsAt);
+            out_.append("<format error: ");
+            out_.append(e.what());
+            out_.push_back('>');
+        }
+        if (out_.size() == detailsAt)
+            out_.resize(mark);
+        out_.push_back('\n');
+    }
 
-        // level (fixed width)
-        const char *lvl = levelToStr(ev.level);
-        const std::string lvlCol = std::format("{:<5}", lvl);
+    // "HH:MM:SS.uuuuuu | W0 tid=123 | INFO  | "
+    void writePrefix_(std::int64_t wallNs, int workerId, long tid, LogLevel level)
+    {
+        const std::int64_t sec = wallNs / 1'000'000'000;
+        const auto us = static_cast<int>((wallNs / 1'000) % 1'000'000);
+        if (sec != cachedSec_)
+        {
+            const auto t = static_cast<std::time_t>(sec);
+            std::tm tm{};
+            localtime_r(&t, &tm);
+            cachedSec_ = sec;
+            cachedHms_ = std::format("{:02d}:{:02d}:{:02d}", tm.tm_hour, tm.tm_min, tm.tm_sec);
+        }
 
         // color only around level if tty
         const char *c1 = "";
         const char *c2 = "";
         if (useColor_)
         {
-            switch (ev.level)
+            switch (level)
             {
             case LogLevel::Trace:
                 c1 = "\x1b[90m";
@@ -187,24 +498,89 @@ class Logger::Impl
             }
         }
 
-        // FINAL: time | thread | level | message
-        os_ << std::format("{:02d}:{:02d}:{:02d}.{:06d} | {} | {}{}{} | {}\n", tm.tm_hour,
-                           tm.tm_min, tm.tm_sec, (int)us.count(), thrCol, c1, lvlCol, c2,
-                           ev.message);
+        // thread column: "W0 tid=..." / "main tid=..."
+        auto it = std::back_inserter(out_);
+        if (workerId < 0)
+            std::format_to(it, "{}.{:06d} | main tid={} | ", cachedHms_, us, tid);
+        else
+            std::format_to(it, "{}.{:06d} | W{} tid={} | ", cachedHms_, us, workerId, tid);
+        std::format_to(it, "{}{:<5}{} | ", c1, levelToStr(level), c2);
+    }
+
+    void writeOut_()
+    {
+        if (out_.empty())
+            return;
+        os_.write(out_.data(), static_cast<std::streamsize>(out_.size()));
+        os_.flush();
+        out_.clear();
     }
 
     std::ostream &os_;
+    std::shared_ptr<std::ostream> ownedStream_;
+    RingRegistry registry_;
+
     std::thread worker_;
-    std::queue<LogEvent> queue_;
-    std::mutex mutex_;
+    std::mutex mutex_; // stop_/cv_ 전용 (레코드 경로에서는 잡지 않음)
     std::condition_variable cv_;
     bool stop_{false};
-    LogLevel minLevel_{LogLevel::Info};
+    std::atomic<LogLevel> minLevel_{LogLevel::Info};
     bool useColor_{false};
+
+    // 로거 스레드 전용
+    std::vector<std::shared_ptr<detail::LogRing>> active_;
+    std::uint64_t seenVersion_{0};
+    StampClock clock_;
+    std::string out_;
+    std::int64_t cachedSec_{-1};
+    std::string cachedHms_;
+    std::uint64_t lastDropSum_{0};
+    std::atomic<std::uint64_t> droppedTotal_{0};
 };
 
-Logger::Logger(std::ostream &os) : impl_(std::make_unique<Impl>(os)) {}
-Logger::~Logger() = default;
+detail::LogRing *detail::threadLogRing() noexcept
+{
+    RingRegistry *reg = gActiveRegistry.load(std::memory_order_acquire);
+    if (!reg)
+        return nullptr;
+    if (tlsRing.generation == reg->generation && tlsRing.ring)
+        return tlsRing.ring;
+    return attachThreadRing(*reg);
+}
+
+void detail::flushThreadLog() noexcept
+{
+    RingRegistry *reg = gActiveRegistry.load(std::memory_order_acquire);
+    if (!reg || tlsRing.generation != reg->generation || !tlsRing.ring)
+        return;
+
+    // 로거 스레드를 깨우고, 지금까지 실은 레코드가 소비될 때까지 기다린다. (FATAL 뒤 abort 대비)
+    const detail::LogRing &ring = *tlsRing.ring;
+    const std::uint64_t target = ring.published();
+    reg->wakeRequested.store(true, std::memory_order_release);
+    if (reg->wake)
+        reg->wake->notify_all();
+    const auto deadline = std::chrono::steady_clock::now() + kFatalFlushTimeout;
+    while (ring.released() < target && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
+
+Logger::Logger(std::ostream &os, std::size_t threadRingBytes)
+    : impl_(std::make_unique<Impl>(os, nullptr, threadRingBytes))
+{
+}
+
+Logger::Logger(std::shared_ptr<std::ostream> os, std::size_t threadRingBytes)
+    : impl_(std::make_unique<Impl>(*os, os, threadRingBytes))
+{
+}
+
+Logger::~Logger()
+{
+    deactivate();
+}
 
 void Logger::log(LogLevel level, std::string_view message)
 {
@@ -221,14 +597,40 @@ LogLevel Logger::minLevel() const noexcept
 
 void Logger::stopAndJoin()
 {
+    deactivate();
     impl_->stop();
 }
 
+std::uint64_t Logger::droppedRecords() const noexcept
+{
+    return impl_->droppedRecords();
+}
+
+int Logger::pinConsumerThread(int cpu) noexcept
+{
+    return impl_->pinConsumerThread(cpu);
+}
+
+void Logger::activate() noexcept
+{
+    impl_->activate();
+}
+
+void Logger::deactivate() noexcept
+{
+    impl_->deactivate();
+}
+
 // ===== Global Instance Management =====
 
 static std::shared_ptr<ILogger> &globalLoggerStorage()
 {
-    static std::shared_ptr<ILogger> logger = std::make_shared<Logger>();
+    static std::shared_ptr<ILogger> logger = []
+    {
+        auto l = std::make_shared<Logger>();
+        l->activate();
+        return l;
+    }();
     return logger;
 }
 
@@ -237,7 +639,9 @@ ILogger &getLogger()
     auto &instance = globalLoggerStorage();
     if (!instance)
     {
-        instance = std::make_shared<Logger>();
+        auto l = std::make_shared<Logger>();
+        l->activate();
+        instance = std::move(l);
     }
     return *instance;
 }
@@ -253,7 +657,18 @@ void setLogger(std::shared_ptr<ILogger> logger) noexcept
     {
         detail::fastMinLevel().store(static_cast<int>(LogLevel::Info), std::memory_order_relaxed);
     }
-    globalLoggerStorage() = std::move(logger);
+
+    // SLOG 바이너리 경로는 기본 Logger 일 때만 쓴다. (사용자 ILogger 는 문자열 경로)
+    auto &storage = globalLoggerStorage();
+    if (auto *prev = dynamic_cast<Logger *>(storage.get()))
+    {
+        prev->deactivate();
+    }
+    if (auto *next = dynamic_cast<Logger *>(logger.get()))
+    {
+        next->activate();
+    }
+    storage = std::move(logger);
 }
 
 void shutdownLogger() noexcept
@@ -1,32 +1,102 @@
 #include <hypernet/core/TaskQueue.hpp>
-// SpinLockGuard 정의를 위해 필요하다면 아래 헤더도 확인 (TaskQueue.hpp에 포함되어 있다면 생략 가능)
-#include <hypernet/util/SpinLock.hpp>
+
+#include <chrono>
 
 namespace hypernet::core
 {
 
+TaskQueue::~TaskQueue()
+{
+    // 실행되지 못한 작업은 그대로 파괴한다. (종료 시점: producer 가 더 없어야 함)
+    // takeBatch_ 는 pending_ 과 head_ 를 한 번에 하나씩 내주므로 빌 때까지 반복한다.
+    for (Node *node = takeBatch_(); node; node = takeBatch_())
+    {
+        while (node)
+        {
+            Node *next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+    while (freeList_)
+    {
+        Node *next = freeList_->next;
+        delete freeList_;
+        freeList_ = next;
+    }
+}
+
 void TaskQueue::push(Task &&task)
 {
-    // [중요] 여러 워커가 동시에 push하므로 반드시 잠금이 필요합니다.
-    // 스핀락 가드를 생성하여 스코프 내에서 잠금을 유지합니다.
-    hypernet::util::SpinLockGuard guard(lock_);
+    const auto postedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now().time_since_epoch())
+                              .count();
+    link_(new Node{std::move(task), nullptr, postedNs});
+}
 
-    queue_.push(std::move(task));
+void TaskQueue::pushLocal(Task &&task)
+{
+    Node *node = freeList_;
+    if (!node)
+    {
+        link_(new Node{std::move(task), nullptr, 0});
+        return;
+    }
+    freeList_ = node->next;
+    --freeCount_;
+    node->task = std::move(task);
+    node->next = nullptr;
+    node->postedNs = 0;
+    link_(node);
 }
 
-bool TaskQueue::tryPop(Task &outTask)
+void TaskQueue::link_(Node *node) noexcept
 {
-    // 뮤텍스 대신 스핀락 가드 사용
-    hypernet::util::SpinLockGuard guard(lock_);
+    // seq_cst: EventLoop 의 sleeping 플래그와 Dekker 식으로 짝을 이룬다.
+    // (consumer 가 잠들기 직전 empty() 를 다시 보고, producer 는 push 뒤 플래그를 본다)
+    Node *head = head_.load(std::memory_order_relaxed);
+    do
+    {
+        node->next = head;
+    } while (!head_.compare_exchange_weak(head, node, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed));
+}
 
-    if (queue_.empty())
+bool TaskQueue::tryPop(Task &outTask)
+{
+    Node *node = takeBatch_();
+    if (!node)
     {
         return false;
     }
 
-    outTask = std::move(queue_.front());
-    queue_.pop();
+    pending_ = node->next;
+    outTask = std::move(node->task);
+    recycle_(node);
     return true;
 }
 
+TaskQueue::Node *TaskQueue::takeBatch_() noexcept
+{
+    if (pending_)
+    {
+        Node *batch = pending_;
+        pending_ = nullptr;
+        return batch;
+    }
+
+    Node *lifo = head_.exchange(nullptr, std::memory_order_acquire);
+
+    // push 순서(FIFO)로 뒤집는다.
+    Node *fifo = nullptr;
+    while (lifo)
+    {
+        Node *next = lifo->next;
+        lifo->next = fifo;
+        fifo = lifo;
+        lifo = next;
+    }
+    return fifo;
+}
+
 } // namespace hypernet::core
@@ -1,5 +1,8 @@
 #include <hypernet/core/TimerWheel.hpp>
 
+#include <algorithm>
+#include <bit>
+#include <limits>
 #include <stdexcept>
 #include <utility>
 
@@ -7,19 +10,39 @@ namespace hypernet::core
 {
 
 TimerWheel::TimerWheel(Duration tickResolution, std::size_t slotCount)
-    : tickResolution_(tickResolution), slotCount_(slotCount), slots_(slotCount),
-      lastTickTime_(Clock::now())
+    : tickResolution_(tickResolution), lastTickTime_(Clock::now())
 {
     if (tickResolution_ <= Duration::zero())
     {
         throw std::invalid_argument("TimerWheel tickResolution must be > 0");
     }
-    if (slotCount_ == 0)
+    if (slotCount == 0)
     {
         throw std::invalid_argument("TimerWheel slotCount must be > 0");
     }
+
+    // level 0 슬롯 수는 2의 거듭제곱으로 올림(슬롯 계산을 mask 로 하기 위함)
+    slotCount_ = 1;
+    while (slotCount_ < slotCount)
+    {
+        slotCount_ <<= 1;
+        ++level0Bits_;
+    }
+
+    // level 0 + 64 슬롯 level 들로 64bit tick 범위 전체를 덮는다.
+    levels_ = 1;
+    for (unsigned bits = level0Bits_; bits < 64; bits += kUpperBits)
+    {
+        ++levels_;
+    }
+
+    buckets_.assign(slotCount_ + (levels_ - 1) * kUpperSlots, kNil);
+    level0Occupied_.assign((slotCount_ + 63) / 64, 0);
+    upperOccupied_.assign(levels_ - 1, 0);
 }
 
+TimerWheel::~TimerWheel() = default;
+
 TimerWheel::TimerId TimerWheel::addTimer(Duration delay, Callback callback)
 {
     if (!callback)
@@ -27,24 +50,160 @@ TimerWheel::TimerId TimerWheel::addTimer(Duration delay, Callback callback)
         throw std::invalid_argument("TimerWheel::addTimer requires a valid callback");
     }
 
-    const auto ticks = durationToTicks(delay);
-    // 최소 1 tick 뒤에 실행되도록 강제한다.
-    const std::uint64_t delayTicks = (ticks == 0) ? 1 : ticks;
+    const std::uint32_t index = allocNode_();
+    Node &n = node_(index);
+    n.callback = std::move(callback);
+    n.expirationTick = currentTick_ + durationToTicks(delay);
+    n.state = NodeState::Pending;
+    link_(index);
+    ++activeTimers_;
 
-    const auto expirationTick = currentTick_ + delayTicks;
-    const auto slotIndex = static_cast<std::size_t>(expirationTick % slotCount_);
+    return (static_cast<TimerId>(n.generation) << 32) | index;
+}
 
-    const TimerId id = nextTimerId();
-    slots_[slotIndex].push_back(Timer{id, expirationTick, std::move(callback)});
-    ++activeTimers_;
+bool TimerWheel::cancelTimer(TimerId id) noexcept
+{
+    std::uint32_t index = 0;
+    Node *n = lookup_(id, index);
+    if (!n)
+    {
+        return false;
+    }
+
+    if (n->state == NodeState::Pending)
+    {
+        unlink_(index);
+        --activeTimers_;
+    }
+    if (index == firingIndex_)
+    {
+        // 콜백 실행 중(자기 자신 재예약 후 취소 포함): processCurrentTick 이 실행 후 해제한다.
+        n->state = NodeState::Cancelled;
+        return true;
+    }
+
+    freeNode_(index);
+    return true;
+}
+
+bool TimerWheel::reschedule(TimerId id, Duration delay) noexcept
+{
+    std::uint32_t index = 0;
+    Node *n = lookup_(id, index);
+    if (!n)
+    {
+        return false;
+    }
+
+    if (n->state == NodeState::Pending)
+    {
+        unlink_(index);
+    }
+    else
+    {
+        // Firing: 실행이 끝나도 해제하지 않고 다시 대기 상태로 둔다.
+        n->state = NodeState::Pending;
+        ++activeTimers_;
+    }
+
+    n->expirationTick = currentTick_ + durationToTicks(delay);
+    link_(index);
+    return true;
+}
+
+std::uint64_t TimerWheel::ticksUntilNextExpiry() const noexcept
+{
+    if (activeTimers_ == 0)
+    {
+        return 0;
+    }
+
+    std::uint64_t best = std::numeric_limits<std::uint64_t>::max();
+
+    // level 0: 현재 슬롯 다음부터 한 바퀴를 비트맵으로 훑는다.
+    // (현재 슬롯은 이번 tick 에 이미 비웠으므로 다시 보이면 한 바퀴 뒤)
+    const std::size_t mask = slotCount_ - 1;
+    const auto cur = static_cast<std::size_t>(currentTick_ & mask);
+    std::size_t pos = (cur + 1) & mask;
+    for (std::size_t scanned = 0; scanned < slotCount_;)
+    {
+        const std::size_t bit = pos & 63;
+        const std::uint64_t word = level0Occupied_[pos >> 6] >> bit;
+        if (word != 0)
+        {
+            const std::size_t slot = pos + static_cast<std::size_t>(std::countr_zero(word));
+            const std::size_t dist = (slot - cur) & mask;
+            best = dist != 0 ? dist : slotCount_;
+            break;
+        }
+        const std::size_t step = std::min<std::size_t>(64 - bit, slotCount_ - pos);
+        scanned += step;
+        pos = (pos + step) & mask;
+    }
+
+    // level 1+: 비어 있지 않은 가장 가까운 슬롯이 cascade 되는 경계 tick
+    for (unsigned level = 1; level < levels_; ++level)
+    {
+        const std::uint64_t word = upperOccupied_[level - 1];
+        if (word == 0)
+        {
+            continue;
+        }
 
-    return id;
+        const unsigned shift = level0Bits_ + kUpperBits * (level - 1);
+        const std::uint64_t base = currentTick_ >> shift;
+        const auto curSlot = static_cast<int>(base & (kUpperSlots - 1));
+        // 현재 슬롯 바로 다음이 bit 0 이 되도록 회전 → 거리 1..64
+        const auto dist =
+            static_cast<std::uint64_t>(std::countr_zero(std::rotr(word, curSlot + 1))) + 1;
+        if (dist > (std::numeric_limits<std::uint64_t>::max() >> shift) - base)
+        {
+            continue; // 64bit tick 범위 밖(사실상 무한)
+        }
+        best = std::min(best, ((base + dist) << shift) - currentTick_);
+    }
+
+    return best;
+}
+
+TimerWheel::Clock::time_point TimerWheel::nextDeadline() const noexcept
+{
+    const std::uint64_t ticks = ticksUntilNextExpiry();
+    if (ticks == 0)
+    {
+        return Clock::time_point::max();
+    }
+
+    const auto tickNs = std::chrono::duration_cast<Clock::duration>(tickResolution_).count();
+    const auto headroom = Clock::time_point::max() - lastTickTime_;
+    if (ticks > static_cast<std::uint64_t>(headroom.count() / tickNs))
+    {
+        return Clock::time_point::max();
+    }
+    return lastTickTime_ + Clock::duration{tickNs * static_cast<Clock::rep>(ticks)};
 }
 
 void TimerWheel::tick()
 {
     // 논리 tick 한 번 진행
     ++currentTick_;
+
+    // level 0 이 한 바퀴 돌 때마다 상위 level 의 현재 슬롯을 아래로 내려보낸다.
+    // (level l 슬롯 index 가 0 이면 level l+1 도 경계에 도달한 것)
+    if ((currentTick_ & (slotCount_ - 1)) == 0)
+    {
+        for (unsigned level = 1; level < levels_; ++level)
+        {
+            const unsigned shift = level0Bits_ + kUpperBits * (level - 1);
+            const auto slot = static_cast<std::size_t>((currentTick_ >> shift) & (kUpperSlots - 1));
+            cascade_(level, slot);
+            if (slot != 0)
+            {
+                break;
+            }
+        }
+    }
+
     processCurrentTick();
 }
 
@@ -55,22 +214,32 @@ void TimerWheel::tick(Clock::time_point now)
         return; // 시간 변화 없음(또는 역행): 아무 것도 하지 않는다.
     }
 
-    const auto elapsed = now - lastTickTime_;
-    const auto elapsedMs = std::chrono::duration_cast<Duration>(elapsed);
+    const auto elapsed = std::chrono::duration_cast<Duration>(now - lastTickTime_);
 
-    if (elapsedMs < tickResolution_)
+    if (elapsed < tickResolution_)
     {
         // 아직 한 tick 을 진행할 만큼의 시간이 지나지 않았다.
         return;
     }
 
-    const auto totalMs = static_cast<std::uint64_t>(elapsedMs.count());
-    const auto tickMs = static_cast<std::uint64_t>(tickResolution_.count());
-    const auto ticksToAdvance = totalMs / tickMs;
+    const auto totalUs = static_cast<std::uint64_t>(elapsed.count());
+    const auto tickUs = static_cast<std::uint64_t>(tickResolution_.count());
+    const auto ticksToAdvance = totalUs / tickUs;
 
-    for (std::uint64_t i = 0; i < ticksToAdvance; ++i)
+    // 다음 만료/cascade tick 직전까지는 슬롯이 비어 있으므로 한 번에 건너뛰고,
+    // 그 tick 만 tick() 으로 처리한다. (타이머가 없으면 ticksUntilNextExpiry() == 0)
+    std::uint64_t remaining = ticksToAdvance;
+    while (remaining > 0)
     {
+        const std::uint64_t next = ticksUntilNextExpiry();
+        if (next == 0 || next > remaining)
+        {
+            currentTick_ += remaining;
+            break;
+        }
+        currentTick_ += next - 1;
         tick();
+        remaining -= next;
     }
 
     // lastTickTime_ 을 tickResolution * ticksToAdvance 만큼 앞으로 이동시켜,
@@ -78,74 +247,169 @@ void TimerWheel::tick(Clock::time_point now)
     lastTickTime_ += tickResolution_ * static_cast<int64_t>(ticksToAdvance);
 }
 
-std::uint64_t TimerWheel::durationToTicks(Duration delay) const noexcept
+TimerWheel::Node *TimerWheel::lookup_(TimerId id, std::uint32_t &index) noexcept
 {
-    if (delay <= Duration::zero())
+    index = static_cast<std::uint32_t>(id & 0xFFFF'FFFFu);
+    const auto generation = static_cast<std::uint32_t>(id >> 32);
+    if (index >= nodeCount_)
     {
-        return 0;
+        return nullptr;
     }
 
-    const auto delayMs = static_cast<std::uint64_t>(delay.count());
-    const auto tickMs = static_cast<std::uint64_t>(tickResolution_.count());
+    Node &n = node_(index);
+    if (n.generation != generation ||
+        (n.state != NodeState::Pending && n.state != NodeState::Firing))
+    {
+        return nullptr;
+    }
+    return &n;
+}
 
-    // 올림(ceil) 연산: (delayMs + tickMs - 1) / tickMs
-    const auto ticks = (delayMs + tickMs - 1) / tickMs;
-    return ticks;
+std::uint32_t TimerWheel::allocNode_()
+{
+    if (freeHead_ != kNil)
+    {
+        const std::uint32_t index = freeHead_;
+        freeHead_ = node_(index).next;
+        node_(index).next = kNil;
+        return index;
+    }
+
+    if ((nodeCount_ & (kChunkSize - 1)) == 0)
+    {
+        // 청크 단위 할당: 기존 노드 주소는 바뀌지 않는다.
+        chunks_.push_back(std::make_unique<Node[]>(kChunkSize));
+    }
+    return nodeCount_++;
 }
 
-TimerWheel::TimerId TimerWheel::nextTimerId() noexcept
+void TimerWheel::freeNode_(std::uint32_t index) noexcept
 {
-    TimerId id = nextId_;
-    ++nextId_;
-    if (nextId_ == 0)
+    Node &n = node_(index);
+    n.callback.reset();
+    n.state = NodeState::Free;
+    n.bucket = kNil;
+    n.prev = kNil;
+    if (++n.generation == 0)
     {
-        // 0은 "invalid" 로 예약
-        nextId_ = 1;
+        n.generation = 1; // id 0 은 invalid 로 예약
     }
-    return id;
+    n.next = freeHead_;
+    freeHead_ = index;
 }
 
-void TimerWheel::processCurrentTick()
+void TimerWheel::link_(std::uint32_t index) noexcept
 {
-    const auto slotIndex = static_cast<std::size_t>(currentTick_ % slotCount_);
-    auto &bucket = slots_[slotIndex];
+    Node &n = node_(index);
+    const std::uint64_t expires = n.expirationTick;
+    const std::uint64_t delta = (expires > currentTick_) ? (expires - currentTick_) : 0;
 
-    if (bucket.empty())
+    std::size_t bucket = 0;
+    if (delta < slotCount_)
     {
-        return;
+        bucket = static_cast<std::size_t>(expires & (slotCount_ - 1));
+    }
+    else
+    {
+        // delta 를 담을 수 있는 가장 낮은 level 을 고른다.
+        unsigned level = 1;
+        while (level + 1 < levels_ && (delta >> (level0Bits_ + kUpperBits * level)) != 0)
+        {
+            ++level;
+        }
+        const unsigned shift = level0Bits_ + kUpperBits * (level - 1);
+        bucket = slotCount_ + (level - 1) * kUpperSlots +
+                 static_cast<std::size_t>((expires >> shift) & (kUpperSlots - 1));
     }
 
-    // 현재 슬롯의 타이머들을 scratch_ 로 옮긴 뒤, bucket 을 비워둔다.
-    // 이렇게 하면 콜백 실행 도중 addTimer() 가 같은 슬롯에 타이머를 추가해도
-    // 이번 tick 에서 처리 중인 목록이 깨지지 않는다.
-    scratch_.clear();
-    scratch_.reserve(bucket.size());
-    scratch_.swap(bucket); // scratch_ <- 기존 bucket, bucket 은 비워짐
+    const std::uint32_t head = buckets_[bucket];
+    occupiedWord_(bucket) |= occupiedBit_(bucket);
+    n.bucket = static_cast<std::uint32_t>(bucket);
+    n.prev = kNil;
+    n.next = head;
+    if (head != kNil)
+    {
+        node_(head).prev = index;
+    }
+    buckets_[bucket] = index;
+}
 
-    for (auto &timer : scratch_)
+void TimerWheel::unlink_(std::uint32_t index) noexcept
+{
+    Node &n = node_(index);
+    if (n.prev != kNil)
+    {
+        node_(n.prev).next = n.next;
+    }
+    else
     {
-        if (timer.expirationTick <= currentTick_)
+        buckets_[n.bucket] = n.next;
+        if (n.next == kNil)
         {
-            // 만료된 타이머: 콜백 실행
-            if (timer.callback)
-            {
-                timer.callback();
-            }
-            if (activeTimers_ > 0)
-            {
-                --activeTimers_;
-            }
+            occupiedWord_(n.bucket) &= ~occupiedBit_(n.bucket);
         }
-        else
+    }
+    if (n.next != kNil)
+    {
+        node_(n.next).prev = n.prev;
+    }
+    n.prev = kNil;
+    n.next = kNil;
+    n.bucket = kNil;
+}
+
+void TimerWheel::cascade_(unsigned level, std::size_t slot) noexcept
+{
+    const std::size_t bucket = slotCount_ + (level - 1) * kUpperSlots + slot;
+    std::uint32_t index = buckets_[bucket];
+    buckets_[bucket] = kNil;
+    occupiedWord_(bucket) &= ~occupiedBit_(bucket);
+
+    while (index != kNil)
+    {
+        const std::uint32_t next = node_(index).next;
+        link_(index); // 남은 시간이 이 level 의 슬롯 폭보다 작으므로 아래 level 로 간다.
+        index = next;
+    }
+}
+
+std::uint64_t TimerWheel::durationToTicks(Duration delay) const noexcept
+{
+    if (delay <= Duration::zero())
+    {
+        return 1; // 최소 1 tick 뒤에 실행되도록 강제한다.
+    }
+
+    const auto delayUs = static_cast<std::uint64_t>(delay.count());
+    const auto tickUs = static_cast<std::uint64_t>(tickResolution_.count());
+
+    // 올림(ceil) 연산: (delayUs + tickUs - 1) / tickUs
+    return (delayUs + tickUs - 1) / tickUs;
+}
+
+void TimerWheel::processCurrentTick()
+{
+    const auto slot = static_cast<std::size_t>(currentTick_ & (slotCount_ - 1));
+
+    // 하나씩 떼어 실행한다. 콜백 안에서 add/cancel/reschedule 이 와도 리스트가 깨지지 않고,
+    // 새 타이머는 최소 1 tick 뒤이므로 이 슬롯에 다시 들어오지 않는다.
+    while (buckets_[slot] != kNil)
+    {
+        const std::uint32_t index = buckets_[slot];
+        unlink_(index);
+        --activeTimers_;
+
+        Node &n = node_(index); // 청크 할당이라 콜백 중 add 가 와도 주소가 유지된다.
+        n.state = NodeState::Firing;
+        firingIndex_ = index;
+        n.callback();
+        firingIndex_ = kNil;
+
+        if (n.state != NodeState::Pending)
         {
-            // 아직 만료되지 않은 타이머: 원래 예정된 슬롯으로 다시 배치
-            const auto idx = static_cast<std::size_t>(timer.expirationTick % slotCount_);
-            slots_[idx].push_back(std::move(timer));
+            freeNode_(index); // reschedule 되지 않았으면 one-shot 으로 해제
         }
     }
-
-    // scratch_ 내용은 다음 tick 에서 재사용될 수 있도록 그대로 두되,
-    // 다음 processCurrentTick 호출 시 clear() 로 비우게 된다.
 }
 
 } // namespace hypernet::core
@@ -1,14 +1,23 @@
 #include <hypernet/core/WorkerContext.hpp>
 
+#include <hypernet/buffer/PacketBuffer.hpp>
+#include <hypernet/buffer/PageMemory.hpp>
 #include <hypernet/core/AppCallbacks.hpp>
+#include <hypernet/core/CpuTopology.hpp>
 #include <hypernet/core/Logger.hpp>
 #include <hypernet/core/ThreadContext.hpp>
+#include <hypernet/monitoring/Metrics.hpp>
 #include <hypernet/net/Acceptor.hpp>
+#include <hypernet/net/ConnectionSteering.hpp>
 #include <hypernet/net/EpollReactor.hpp>
 #include <hypernet/net/SessionManager.hpp>
+#include <hypernet/net/SessionMigration.hpp>
 #include <hypernet/net/WorkerLocal.hpp>
+#include <hypernet/net/WorkerMesh.hpp>
+#include <algorithm>
 #include <cassert>
 #include <cerrno>
+#include <chrono>
 #include <cstring>
 #include <future>
 #include <thread>
@@ -48,24 +57,209 @@ void WorkerContext::initialize()
         SLOG_ERROR("WorkerContext", "InitFailed", "reason=NullApplication");
         return;
     }
-    eventLoop_ = std::make_unique<net::EventLoop>(options_.timer.tickResolution, options_.timer.slotCount, options_.eventLoop.maxEpollEvents);
 
-    bufferPool_ = std::make_unique<buffer::BufferPool>(options_.bufferPool.blockSize, options_.bufferPool.blockCount);
+    // 워커 스레드를 먼저 띄워 CPU/NUMA 배치를 적용한 뒤, 그 스레드에서 EventLoop/버퍼 풀/SessionManager 를 만든다.
+    // (first-touch 페이지가 워커가 도는 노드에 붙도록) 스레드는 start() 가 gate 를 열 때까지 기다린다.
+    std::promise<void> builtPromise;
+    auto builtFuture = builtPromise.get_future();
+    std::promise<bool> readyPromise;
+    ready_ = readyPromise.get_future();
+    startGate_ = std::promise<bool>{};
+    startGateReleased_ = false;
+
+    thread_ = std::thread(
+        [this, built = std::move(builtPromise), gate = startGate_.get_future(), ready = std::move(readyPromise)]() mutable
+        { threadMain_(std::move(built), std::move(gate), std::move(ready)); });
 
-    // per-worker SessionManager 생성 (+ rings/framer 정책 전달)
-    sessionManager_ = std::make_unique<net::SessionManager>(id_, eventLoop_.get(), options_.rings.recvCapacity, options_.rings.sendCapacity, options_.protocol.maxPayloadLen);
+    try
+    {
+        builtFuture.get();
+    }
+    catch (...)
+    {
+        join();
+        eventLoop_.reset();
+        bufferPool_.reset();
+        sessionManager_.reset();
+        throw;
+    }
 
     initialized_ = true;
 
     SLOG_INFO("WorkerContext", "Initialized",
-              "tick_ms={} slots={} epoll_max={} block_size={} block_cnt={} recv_cap={} send_cap={} "
-              "max_payload={}",
-              options_.timer.tickResolution.count(), options_.timer.slotCount, options_.eventLoop.maxEpollEvents, options_.bufferPool.blockSize, options_.bufferPool.blockCount,
-              options_.rings.recvCapacity, options_.rings.sendCapacity, options_.protocol.maxPayloadLen);
+              "tick_us={} slots={} epoll_max={} backend={} block_size={} block_cnt={} recv_cap={} send_cap={} "
+              "max_payload={} cpu={}",
+              options_.timer.tickResolution.count(), options_.timer.slotCount, options_.eventLoop.maxEpollEvents, net::toString(eventLoop_->backend()), options_.bufferPool.blockSize, options_.bufferPool.blockCount,
+              options_.rings.recvCapacity, options_.rings.sendCapacity, options_.protocol.maxPayloadLen, options_.placement.cpu);
+}
+
+void WorkerContext::applyPlacementInWorkerThread_() noexcept
+{
+    const ThreadPlacementOptions &pl = options_.placement;
+    if (pl.cpu < 0 && !pl.numaBind && pl.schedFifoPriority == 0)
+    {
+        return;
+    }
+
+    bool pinned = false;
+    if (pl.cpu >= 0)
+    {
+        const int rc = pinCurrentThreadToCpu(pl.cpu);
+        pinned = (rc == 0);
+        if (!pinned)
+        {
+            SLOG_WARN("WorkerContext", "PinFailed", "cpu={} errno={} msg='{}'", pl.cpu, rc, std::strerror(rc));
+        }
+    }
+
+    const int node = pinned ? numaNodeOfCpu(pl.cpu) : -1;
+    bool numaBound = false;
+    if (pl.numaBind)
+    {
+        if (node < 0)
+        {
+            SLOG_WARN("WorkerContext", "NumaBindIgnored", "reason={}", pinned ? "UnknownNode" : "NotPinned");
+        }
+        else if (const int rc = preferNumaNode(node); rc != 0)
+        {
+            SLOG_WARN("WorkerContext", "NumaBindFailed", "node={} errno={} msg='{}'", node, rc, std::strerror(rc));
+        }
+        else
+        {
+            numaBound = true;
+        }
+    }
+
+    bool fifo = false;
+    if (pl.schedFifoPriority != 0)
+    {
+        const int rc = setCurrentThreadFifo(pl.schedFifoPriority);
+        fifo = (rc == 0);
+        if (!fifo)
+        {
+            SLOG_WARN("WorkerContext", "SchedFifoFailed", "priority={} errno={} msg='{}' action=KeepSchedOther", pl.schedFifoPriority, rc,
+                      std::strerror(rc));
+        }
+    }
+
+    SLOG_INFO("WorkerContext", "Placement", "cpu={} node={} numa_bind={} sched={} priority={}", pinned ? pl.cpu : -1, node, numaBound ? "on" : "off",
+              fifo ? "fifo" : "other", fifo ? pl.schedFifoPriority : 0U);
+}
+
+void WorkerContext::threadMain_(std::promise<void> built, std::future<bool> gate, std::promise<bool> ready) noexcept
+{
+    ThreadContext::setCurrentWorkerId(static_cast<int>(id_));
+    applyPlacementInWorkerThread_();
+    // 이후 이 스레드가 만드는 링/풀 저장소는 huge page / prefault 정책을 따른다. (NUMA 우선 노드 지정 뒤라 first-touch 도 로컬)
+    buffer::setThreadPagePolicy(options_.pages);
+
+    try
+    {
+        eventLoop_ = std::make_unique<net::EventLoop>(options_.timer.tickResolution, options_.timer.slotCount, options_.eventLoop);
+        eventLoop_->setLoopMetrics(monitoring::engineMetrics().workerLoop(id_));
+        eventLoop_->setLatencyMetrics(monitoring::engineMetrics().workerLatency(id_));
+
+        bufferPool_ = std::make_unique<buffer::BufferPool>(options_.bufferPool.blockSize, options_.bufferPool.blockCount);
+
+        // per-worker SessionManager 생성 (+ rings/framer 정책 전달)
+        sessionManager_ = std::make_unique<net::SessionManager>(id_, eventLoop_.get(), options_.rings.recvCapacity, options_.rings.sendCapacity, options_.protocol.maxPayloadLen);
+
+        // 세션 풀 prewarm / zerocopy 블록 등 미리 잡는 메모리도 여기서 만든다.
+        sessionManager_->configureTimeouts(options_.idleTimeoutMs, options_.heartbeatIntervalMs);
+        sessionManager_->configureBusyPoll(options_.sessionBusyPollUs);
+        sessionManager_->configureMirroredRings(options_.rings.mirrored);
+        sessionManager_->configureSessionPool(options_.sessionPool.prewarm, options_.sessionPool.maxIdle);
+        sessionManager_->configureRingReclaim(options_.rings.idleReclaimMs);
+        sessionManager_->configureDeferredFlush(options_.sendPath.deferredFlush, options_.sendPath.cork);
+        sessionManager_->configureZeroCopy(options_.sendPath.zeroCopyThreshold, options_.sendPath.zeroCopyBufferCount);
+        sessionManager_->configureSendQueue(options_.sendPath.sendQueueLimit, options_.sendPath.sendQueueHighWatermark, options_.sendPath.sendQueueLowWatermark);
+        if (options_.pages.prefault)
+        {
+            sessionManager_->prefaultWorkingSet();
+        }
+        SLOG_INFO("WorkerContext", "TimeoutsConfigured", "idle_ms={} heartbeat_ms={}", options_.idleTimeoutMs, options_.heartbeatIntervalMs);
+    }
+    catch (...)
+    {
+        built.set_exception(std::current_exception());
+        return;
+    }
+    built.set_value();
+
+    // start() 전에 엔진이 포기하면(stop/shutdown) false 또는 broken promise 로 깨어난다.
+    bool go = false;
+    try
+    {
+        go = gate.get();
+    }
+    catch (...)
+    {
+        go = false;
+    }
+    if (!go)
+    {
+        return;
+    }
+
+    // 이 워커에서 만드는 routed payload 는 워커 전용 슬랩에서 꺼낸다.
+    buffer::PacketBufferPool::bindCurrentThread();
+
+    // registerHandlers 는 앱의 워커별 컨트롤러 표를 채우므로 Engine 이 scheduler/router 를 주입한 뒤(start)에 부른다.
+    sessionManager_->setApplication(app_);
+    SLOG_INFO("WorkerContext", "ThreadStarted", "");
+
+    eventLoop_->bindToCurrentThread();
+    hypernet::net::WorkerLocal::set(sessionManager_.get());
+
+    const bool installed = installListenerInWorkerThread_();
+
+    try
+    {
+        ready.set_value(installed);
+    }
+    catch (...)
+    {
+    }
+
+    if (!installed)
+    {
+        running_.store(false, std::memory_order_release);
+        cleanupListenerInWorkerThread_();
+        SLOG_FATAL("WorkerContext", "ListenerInstallFailed", "action=WorkerExiting");
+        buffer::PacketBufferPool::unbindCurrentThread();
+        return;
+    }
+
+    if (id_ == 0 && migrator_ && options_.rebalance.intervalMs != 0)
+    {
+        SLOG_INFO("WorkerContext", "RebalanceEnabled", "interval_ms={} threshold_pct={} workers={}", options_.rebalance.intervalMs, options_.rebalance.thresholdPct,
+                  migrator_->workerCount());
+        rebalanceTimerId_ = eventLoop_->addTimer(std::chrono::milliseconds(options_.rebalance.intervalMs), [this]() noexcept { rebalanceSessions_(); });
+    }
+
+    eventLoop_->run(running_);
+
+    if (rebalanceTimerId_ != 0)
+    {
+        (void)eventLoop_->cancelTimer(rebalanceTimerId_);
+        rebalanceTimerId_ = 0;
+    }
+
+    if (sessionManager_)
+    {
+        sessionManager_->shutdownInOwnerThread();
+    }
+
+    cleanupListenerInWorkerThread_();
+    SLOG_INFO("WorkerContext", "ThreadExiting", "");
+    hypernet::net::WorkerLocal::set(static_cast<hypernet::net::SessionManager *>(nullptr));
+    hypernet::net::WorkerLocal::set(static_cast<hypernet::net::ConnectorManager *>(nullptr));
+    buffer::PacketBufferPool::unbindCurrentThread();
 }
+
 void WorkerContext::configureListener(std::string listenAddress, std::uint16_t listenPort, int backlog, bool reusePort)
 {
-    if (running_.load(std::memory_order_acquire) || thread_.joinable())
+    if (running_.load(std::memory_order_acquire) || startGateReleased_)
     {
         SLOG_ERROR("WorkerContext", "ConfigListenerIgnored", "reason=AlreadyRunning");
         return;
@@ -86,6 +280,62 @@ void WorkerContext::setAppCallbackInvoker(std::shared_ptr<AppCallbackInvoker> in
     appCallbacks_ = std::move(invoker);
 }
 
+void WorkerContext::attachHandoffMesh(std::shared_ptr<net::WorkerMesh> mesh) noexcept
+{
+    if (!initialized_ || !mesh)
+    {
+        SLOG_WARN("WorkerContext", "HandoffMeshIgnored", "reason={}", initialized_ ? "NullMesh" : "NotInitialized");
+        return;
+    }
+    if (running_.load(std::memory_order_acquire) || startGateReleased_)
+    {
+        SLOG_WARN("WorkerContext", "HandoffMeshIgnored", "reason=AlreadyRunning");
+        return;
+    }
+
+    handoffMesh_ = std::move(mesh);
+    net::SessionManager *sm = sessionManager_.get();
+    handoffMesh_->attach(static_cast<int>(id_), eventLoop_.get(),
+                         [sm](SessionHandle::Id sid, std::uint16_t opcode, const void *body, std::size_t len) noexcept
+                         { return sm->sendPacketU16(sid, opcode, body, len); });
+    eventLoop_->attachMesh(handoffMesh_.get(), static_cast<int>(id_));
+}
+
+void WorkerContext::attachAcceptHandoff(std::shared_ptr<net::AcceptHandoff> handoff) noexcept
+{
+    if (!initialized_ || !handoff)
+    {
+        SLOG_WARN("WorkerContext", "AcceptHandoffIgnored", "reason={}", initialized_ ? "NullHandoff" : "NotInitialized");
+        return;
+    }
+    if (running_.load(std::memory_order_acquire) || startGateReleased_)
+    {
+        SLOG_WARN("WorkerContext", "AcceptHandoffIgnored", "reason=AlreadyRunning");
+        return;
+    }
+
+    acceptHandoff_ = std::move(handoff);
+    acceptHandoff_->attach(id_, eventLoop_.get(), sessionManager_.get());
+}
+
+void WorkerContext::attachSessionMigrator(std::shared_ptr<net::SessionMigrator> migrator) noexcept
+{
+    if (!initialized_ || !migrator)
+    {
+        SLOG_WARN("WorkerContext", "SessionMigratorIgnored", "reason={}", initialized_ ? "NullMigrator" : "NotInitialized");
+        return;
+    }
+    if (running_.load(std::memory_order_acquire) || startGateReleased_)
+    {
+        SLOG_WARN("WorkerContext", "SessionMigratorIgnored", "reason=AlreadyRunning");
+        return;
+    }
+
+    migrator_ = std::move(migrator);
+    migrator_->attach(id_, eventLoop_.get(), sessionManager_.get());
+    sessionManager_->attachMigrator(migrator_.get());
+}
+
 bool WorkerContext::installListenerInWorkerThread_() noexcept
 {
     // const long tid = hypernet::core::ThreadContext::currentTid(); // Logger handles TID
@@ -95,6 +345,12 @@ bool WorkerContext::installListenerInWorkerThread_() noexcept
         SLOG_INFO("WorkerContext", "ListenerDisabled", "reason=PortZero");
         return true;
     }
+    if (acceptHandoff_ && id_ != 0)
+    {
+        // least_loaded: 워커 0 이 accept 해서 넘겨 준다.
+        SLOG_INFO("WorkerContext", "ListenerDisabled", "reason=AcceptHandoff acceptor=0");
+        return true;
+    }
 
     try
     {
@@ -120,8 +376,15 @@ bool WorkerContext::installListenerInWorkerThread_() noexcept
                 SLOG_FATAL("WorkerContext", "OnAcceptBug", "reason=SessionManagerNull");
                 std::abort();
             }
-            auto h = sessionManager_->onAccepted(std::move(client), peer);
-            (void)h;
+            if (acceptHandoff_)
+            {
+                acceptHandoff_->dispatch(id_, std::move(client), peer);
+                return;
+            }
+            if (sessionManager_->onAccepted(std::move(client), peer))
+            {
+                monitoring::engineMetrics().onSessionAccepted();
+            }
         });
 
     const auto acceptMask = net::EpollReactor::makeEventMask({
@@ -134,7 +397,17 @@ bool WorkerContext::installListenerInWorkerThread_() noexcept
 
     const int listenFd = acceptor_->nativeHandle();
 
-    const bool ok = eventLoop_->addFd(listenFd, acceptMask, acceptor_.get());
+    // io_uring: listen fd 는 multishot accept 로만 구동한다(poll 미사용).
+    const bool completion = eventLoop_->completionIoEnabled();
+    bool ok = eventLoop_->addFd(listenFd, completion ? 0U : acceptMask, acceptor_.get());
+    if (ok && completion)
+    {
+        ok = eventLoop_->armAccept(listenFd);
+        if (!ok)
+        {
+            (void)eventLoop_->removeFd(listenFd);
+        }
+    }
     if (!ok)
     {
         SLOG_FATAL("WorkerContext", "RegisterListenFdFailed", "fd={}", listenFd);
@@ -145,9 +418,161 @@ bool WorkerContext::installListenerInWorkerThread_() noexcept
 
     SLOG_INFO("WorkerContext", "ListenerInstalled", "addr={} port={} fd={} reuse_port={}", listenerConfig_.address, listenerConfig_.port, listenFd, listenerConfig_.reusePort ? "on" : "off");
 
+    // 프로그램은 reuseport 그룹 전체에 걸리므로 첫 리스너(워커 0)에서 한 번만 붙인다.
+    // (워커는 start() 에서 id 순서대로 리스너를 열므로 그룹 안 index = 워커 id)
+    if (id_ == 0)
+    {
+        applySteeringInWorkerThread_();
+    }
     return true;
 }
 
+void WorkerContext::applySteeringInWorkerThread_() noexcept
+{
+    const net::SteeringMode mode = options_.steering.mode;
+    if (mode != net::SteeringMode::IncomingCpu && mode != net::SteeringMode::Weighted)
+    {
+        return;
+    }
+    if (!listenerConfig_.reusePort)
+    {
+        SLOG_WARN("WorkerContext", "SteeringIgnored", "mode={} reason=ReusePortOff", net::toString(mode));
+        return;
+    }
+
+    int rc = 0;
+    try
+    {
+        if (mode == net::SteeringMode::IncomingCpu)
+        {
+            rc = net::attachReuseportProgram(acceptor_->nativeHandle(), net::buildIncomingCpuProgram(options_.steering.listenerCpus));
+        }
+        else
+        {
+            steeringWeights_.assign(options_.steering.listenerCpus.size(), 1U);
+            rc = net::attachReuseportProgram(acceptor_->nativeHandle(), net::buildWeightedProgram(steeringWeights_));
+        }
+    }
+    catch (const std::exception &e)
+    {
+        SLOG_WARN("WorkerContext", "SteeringAttachFailed", "mode={} what='{}' action=KernelHash", net::toString(mode), e.what());
+        return;
+    }
+    if (rc != 0)
+    {
+        SLOG_WARN("WorkerContext", "SteeringAttachFailed", "mode={} errno={} msg='{}' action=KernelHash", net::toString(mode), rc, std::strerror(rc));
+        return;
+    }
+
+    SLOG_INFO("WorkerContext", "SteeringAttached", "mode={} listeners={} update_ms={}", net::toString(mode), options_.steering.listenerCpus.size(),
+              mode == net::SteeringMode::Weighted ? options_.steering.updateMs : 0U);
+    if (mode == net::SteeringMode::Weighted)
+    {
+        steeringTimerId_ = eventLoop_->addTimer(std::chrono::milliseconds(options_.steering.updateMs), [this]() noexcept { refreshSteeringWeights_(); });
+    }
+}
+
+void WorkerContext::refreshSteeringWeights_() noexcept
+{
+    steeringTimerId_ = 0;
+    if (!acceptor_)
+    {
+        return; // 리스너를 닫았으면 멈춘다.
+    }
+
+    try
+    {
+        const auto &metrics = monitoring::engineMetrics();
+        std::vector<std::int64_t> loads(steeringWeights_.size(), 0);
+        for (std::size_t i = 0; i < loads.size(); ++i)
+        {
+            if (const auto *core = metrics.workerCore(static_cast<unsigned int>(i)))
+            {
+                loads[i] = core->connections.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::vector<std::uint32_t> weights = net::steeringWeights(loads);
+        if (weights != steeringWeights_)
+        {
+            if (const int rc = net::attachReuseportProgram(acceptor_->nativeHandle(), net::buildWeightedProgram(weights)); rc != 0)
+            {
+                SLOG_WARN("WorkerContext", "SteeringUpdateFailed", "errno={} msg='{}' action=KeepPrevious", rc, std::strerror(rc));
+            }
+            else
+            {
+                steeringWeights_ = std::move(weights);
+            }
+        }
+    }
+    catch (const std::exception &e)
+    {
+        SLOG_WARN("WorkerContext", "SteeringUpdateFailed", "what='{}' action=KeepPrevious", e.what());
+    }
+
+    steeringTimerId_ = eventLoop_->addTimer(std::chrono::milliseconds(options_.steering.updateMs), [this]() noexcept { refreshSteeringWeights_(); });
+}
+
+void WorkerContext::rebalanceSessions_() noexcept
+{
+    rebalanceTimerId_ = 0;
+    if (!running_.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    try
+    {
+        auto &metrics = monitoring::engineMetrics();
+        const std::size_t n = migrator_->workerCount();
+        const auto now = std::chrono::steady_clock::now();
+        const auto elapsedNs = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - rebalanceSampledAt_).count());
+
+        std::vector<std::uint64_t> idleNs(n, 0);
+        std::vector<std::int64_t> sessions(n, 0);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const auto wid = static_cast<unsigned int>(i);
+            if (const auto *loop = metrics.workerLoop(wid))
+            {
+                idleNs[i] = loop->spinNsTotal.load(std::memory_order_relaxed) + loop->blockNsTotal.load(std::memory_order_relaxed);
+            }
+            if (const auto *core = metrics.workerCore(wid))
+            {
+                sessions[i] = core->connections.load(std::memory_order_relaxed);
+            }
+        }
+
+        // 첫 샘플은 기준점만 잡는다.
+        if (rebalanceIdleNs_.size() == n)
+        {
+            std::vector<std::uint32_t> util(n, 0);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                util[i] = net::workerUtilizationPct(idleNs[i] - std::min(idleNs[i], rebalanceIdleNs_[i]), elapsedNs);
+            }
+
+            const net::RebalanceMove move = net::planRebalance(util, sessions, options_.rebalance.thresholdPct);
+            if (move.from >= 0)
+            {
+                const auto residency = std::chrono::milliseconds(options_.rebalance.intervalMs) * defaults::kRebalanceResidencyTicks;
+                SLOG_DEBUG("WorkerContext", "Rebalance", "from={} to={} util_from={} util_to={}", move.from, move.to, util[static_cast<std::size_t>(move.from)],
+                           util[static_cast<std::size_t>(move.to)]);
+                (void)migrator_->rebalance(static_cast<unsigned int>(move.from), static_cast<unsigned int>(move.to), residency);
+            }
+        }
+
+        rebalanceIdleNs_ = std::move(idleNs);
+        rebalanceSampledAt_ = now;
+    }
+    catch (const std::exception &e)
+    {
+        SLOG_WARN("WorkerContext", "RebalanceFailed", "what='{}' action=Skip", e.what());
+    }
+
+    rebalanceTimerId_ = eventLoop_->addTimer(std::chrono::milliseconds(options_.rebalance.intervalMs), [this]() noexcept { rebalanceSessions_(); });
+}
+
 void WorkerContext::requestStopAccepting() noexcept
 {
     if (!eventLoop_)
@@ -236,6 +661,12 @@ void WorkerContext::cleanupListenerInWorkerThread_() noexcept
     acceptor_->close();
     acceptor_.reset();
 
+    if (steeringTimerId_ != 0)
+    {
+        (void)eventLoop_->cancelTimer(steeringTimerId_);
+        steeringTimerId_ = 0;
+    }
+
     SLOG_INFO("WorkerContext", "ListenerCleanedUp", "fd={}", fd);
 }
 void WorkerContext::start()
@@ -264,82 +695,21 @@ void WorkerContext::start()
         return;
     }
 
-    // 메인스레드가 워커스레드를 생성하기 전에 joinable 상태 즉 스레드가 join 가능한 상태라면
-    // 결함이므로 에러 처리
-    if (thread_.joinable())
-    {
-        SLOG_ERROR("WorkerContext", "StartFailed", "reason=ThreadJoinable action=ForcingJoin");
-        join();
-    }
-
-    // readyPromise 를 생성해서 이후 생성될 워커스레드에게 넘긴다
-    // 워커스레드가 이 readyPromise 에 신호를 보내면 메인스레드는
-    // readyFuture 로 대기하다가 깨어난다.
-    std::promise<bool> readyPromise;
-    auto readyFuture = readyPromise.get_future();
-
-    try
-    {
-        thread_ = std::thread(
-            [this, p = std::move(readyPromise)]() mutable
-            {
-                ThreadContext::setCurrentWorkerId(static_cast<int>(id_));
-
-                if (sessionManager_ && app_)
-                {
-                    sessionManager_->setApplication(app_);
-                }
-                sessionManager_->configureTimeouts(options_.idleTimeoutMs, options_.heartbeatIntervalMs);
-                SLOG_INFO("WorkerContext", "TimeoutsConfigured", "idle_ms={} heartbeat_ms={}", options_.idleTimeoutMs, options_.heartbeatIntervalMs);
-                SLOG_INFO("WorkerContext", "ThreadStarted", "");
-
-                if (eventLoop_)
-                {
-                    eventLoop_->bindToCurrentThread();
-                    hypernet::net::WorkerLocal::set(sessionManager_.get());
-                }
-
-                const bool installed = installListenerInWorkerThread_();
-
-                try
-                {
-                    p.set_value(installed);
-                }
-                catch (...)
-                {
-                }
-
-                if (!installed)
-                {
-                    running_.store(false, std::memory_order_release);
-                    cleanupListenerInWorkerThread_();
-                    SLOG_FATAL("WorkerContext", "ListenerInstallFailed", "action=WorkerExiting");
-                    return;
-                }
-
-                eventLoop_->run(running_);
-
-                if (sessionManager_)
-                {
-                    sessionManager_->shutdownInOwnerThread();
-                }
-
-                cleanupListenerInWorkerThread_();
-                SLOG_INFO("WorkerContext", "ThreadExiting", "");
-                hypernet::net::WorkerLocal::set(static_cast<hypernet::net::SessionManager *>(nullptr));
-                hypernet::net::WorkerLocal::set(static_cast<hypernet::net::ConnectorManager *>(nullptr));
-            });
-    }
-    catch (...)
+    // 워커 스레드는 initialize() 에서 이미 떠서 gate 를 기다리고 있어야 한다.
+    if (!thread_.joinable() || startGateReleased_)
     {
+        SLOG_ERROR("WorkerContext", "StartFailed", "reason={}", startGateReleased_ ? "AlreadyStarted" : "ThreadMissing");
         running_.store(false, std::memory_order_release);
-        throw;
+        return;
     }
 
+    startGateReleased_ = true;
+    startGate_.set_value(true);
+
     bool ok = false;
     try
     {
-        ok = readyFuture.get();
+        ok = ready_.get();
     }
     catch (...)
     {
@@ -374,6 +744,22 @@ void WorkerContext::join() noexcept
 void WorkerContext::stop() noexcept
 {
     running_.store(false, std::memory_order_release);
+    if (thread_.joinable() && !startGateReleased_)
+    {
+        // start() 전이면 gate 를 닫힌 채로 열어 워커 스레드를 그냥 끝낸다.
+        startGateReleased_ = true;
+        try
+        {
+            startGate_.set_value(false);
+        }
+        catch (...)
+        {
+        }
+    }
+    if (eventLoop_)
+    {
+        eventLoop_->wakeup(); // 타이머가 없으면 루프가 무한 대기 중일 수 있다.
+    }
     join();
 }
 
@@ -388,6 +774,17 @@ void WorkerContext::shutdown()
 
     SLOG_INFO("WorkerContext", "ShuttingDown", "");
 
+    // 다른 워커가 파괴될 루프로 handoff 하지 않도록 먼저 떼어 낸다. (이후 그쪽은 TaskQueue 경로)
+    if (handoffMesh_)
+    {
+        handoffMesh_->detach(static_cast<int>(id_));
+        if (eventLoop_)
+        {
+            eventLoop_->attachMesh(nullptr, -1);
+        }
+        handoffMesh_.reset();
+    }
+
     // sessionManager_의 내부 세션들은 start()의 worker thread 종료 경로에서
     // shutdownInOwnerThread()로 이미 정리되어 있어야 한다.
     sessionManager_.reset();
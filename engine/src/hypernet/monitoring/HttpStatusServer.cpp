@@ -1,5 +1,6 @@
 #include <hypernet/monitoring/HttpStatusServer.hpp>
 
+#include <hypernet/core/CpuTopology.hpp>
 #include <hypernet/core/Logger.hpp>
 #include <hypernet/monitoring/Metrics.hpp>
 
@@ -27,8 +28,8 @@ inline bool startsWith(std::string_view s, std::string_view prefix) noexcept
 }
 } // namespace
 
-HttpStatusServer::HttpStatusServer(std::string bindIp, std::uint16_t port) noexcept
-    : bindIp_(std::move(bindIp)), port_(port)
+HttpStatusServer::HttpStatusServer(std::string bindIp, std::uint16_t port, int cpu) noexcept
+    : bindIp_(std::move(bindIp)), port_(port), cpu_(cpu)
 {
 }
 
@@ -108,6 +109,14 @@ void HttpStatusServer::closeWakeupPipe_() noexcept
 
 void HttpStatusServer::threadMain_() noexcept
 {
+    if (cpu_ >= 0)
+    {
+        if (const int rc = hypernet::core::pinCurrentThreadToCpu(cpu_); rc != 0)
+        {
+            SLOG_WARN("MetricsHTTP", "PinFailed", "cpu={} errno={} msg='{}'", cpu_, rc, std::strerror(rc));
+        }
+    }
+
     listenSock_ = hypernet::net::Socket::createTcpIPv4();
     if (!listenSock_.isValid())
     {
@@ -324,6 +333,14 @@ void HttpStatusServer::handleClient_(hypernet::net::Socket &&conn) noexcept
         return;
     }
 
+    // /metrics/latency: 워커별 엔진 내부 지연 분위수 (JSON)
+    if (target == "/metrics/latency" || startsWith(target, "/metrics/latency?"))
+    {
+        std::string body = hypernet::monitoring::engineMetrics().toLatencyJson();
+        sendTextResponse_(conn, 200, "OK", "application/json; charset=utf-8", std::move(body));
+        return;
+    }
+
     sendTextResponse_(conn, 404, "Not Found", "text/plain; charset=utf-8", "not found\n");
 }
 
@@ -2,7 +2,14 @@
 
 #include <algorithm>
 #include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <new>
 #include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace hypernet::monitoring
 {
@@ -19,6 +26,89 @@ constexpr const char *kMConnectorSuccessTotal = "hypernet_connector_success_tota
 constexpr const char *kMConnectorTimeoutTotal = "hypernet_connector_timeout_total";
 constexpr const char *kMConnectorFailureTotal = "hypernet_connector_failure_total";
 
+constexpr const char *kMWorkerConnections = "hypernet_worker_current_connections";
+constexpr const char *kMWorkerRxMessagesTotal = "hypernet_worker_rx_messages_total";
+constexpr const char *kMWorkerTxMessagesTotal = "hypernet_worker_tx_messages_total";
+constexpr const char *kMWorkerErrorsTotal = "hypernet_worker_errors_total";
+constexpr const char *kMWorkerAcceptedTotal = "hypernet_worker_sessions_accepted_total";
+constexpr const char *kMWorkerSessionImbalance = "hypernet_worker_session_imbalance";
+constexpr const char *kMWorkerMigratedInTotal = "hypernet_worker_sessions_migrated_in_total";
+
+constexpr const char *kMWorkerPollSpinSeconds = "hypernet_worker_poll_spin_seconds_total";
+constexpr const char *kMWorkerPollBlockSeconds = "hypernet_worker_poll_block_seconds_total";
+constexpr const char *kMWorkerPollSpinRatio = "hypernet_worker_poll_spin_ratio";
+
+constexpr const char *kMWorkerSessionPoolIdle = "hypernet_worker_session_pool_idle";
+constexpr const char *kMWorkerRingPoolIdle = "hypernet_worker_ring_pool_idle";
+constexpr const char *kMWorkerSessionPoolHits = "hypernet_worker_session_pool_hits_total";
+constexpr const char *kMWorkerSessionPoolMisses = "hypernet_worker_session_pool_misses_total";
+constexpr const char *kMWorkerRingPoolHits = "hypernet_worker_ring_pool_hits_total";
+constexpr const char *kMWorkerRingPoolMisses = "hypernet_worker_ring_pool_misses_total";
+constexpr const char *kMWorkerRingsInUse = "hypernet_worker_session_rings_in_use";
+constexpr const char *kMWorkerRingReclaims = "hypernet_worker_ring_reclaims_total";
+constexpr const char *kMWorkerSendQueueBytes = "hypernet_worker_send_queue_overflow_bytes";
+constexpr const char *kMWorkerSendQueueCongested = "hypernet_worker_send_queue_congested_sessions";
+constexpr const char *kMWorkerSendBackpressure = "hypernet_worker_send_backpressure_events_total";
+constexpr const char *kMWorkerSendQueueLimitCloses = "hypernet_worker_send_queue_limit_closes_total";
+constexpr const char *kMWorkerSendQueueHeapBlocks = "hypernet_worker_send_queue_heap_blocks_total";
+constexpr const char *kMWorkerPageFaults = "hypernet_worker_page_faults_total";
+
+constexpr const char *kMWorkerDispatchDelay = "hypernet_worker_dispatch_delay_seconds";
+constexpr const char *kMWorkerTaskQueueDelay = "hypernet_worker_task_queue_delay_seconds";
+constexpr const char *kMWorkerSendCompletion = "hypernet_worker_send_completion_seconds";
+constexpr const char *kMWorkerLoopIteration = "hypernet_worker_loop_iteration_seconds";
+
+// Prometheus histogram 의 le 경계: 2^8 ns(256ns) ~ 2^30 ns(약 1.07s)
+// - 2의 거듭제곱은 LatencyHistogram 의 bucket 경계와 정확히 맞으므로 누적 개수에 근사가 없습니다.
+constexpr unsigned kLatencyLeFirstBit = 8;
+constexpr unsigned kLatencyLeLastBit = 30;
+
+/// /proc/self/task/<tid>/stat 의 minflt(10번째), majflt(12번째) 필드를 읽습니다. (워커 스레드 단위 누적)
+bool readThreadPageFaults(long tid, std::uint64_t &minor, std::uint64_t &major)
+{
+    std::ifstream in("/proc/self/task/" + std::to_string(tid) + "/stat");
+    std::string line;
+    if (tid <= 0 || !std::getline(in, line))
+    {
+        return false;
+    }
+    // comm 에 공백/괄호가 들어갈 수 있으므로 마지막 ')' 뒤부터 센다. (그 뒤 첫 필드가 3번째 state)
+    const std::size_t close = line.rfind(')');
+    if (close == std::string::npos)
+    {
+        return false;
+    }
+    std::istringstream fields(line.substr(close + 1));
+    std::string skip;
+    for (int f = 3; f < 10; ++f)
+    {
+        fields >> skip;
+    }
+    std::uint64_t cminflt = 0;
+    fields >> minor >> cminflt >> major;
+    return static_cast<bool>(fields);
+}
+
+struct LatencySeries
+{
+    const char *metric;
+    const char *jsonKey;
+    const char *help;
+    LatencyHistogram WorkerLatencyMetrics::*field;
+};
+
+constexpr LatencySeries kLatencySeries[] = {
+    {kMWorkerDispatchDelay, "dispatch_delay", "Delay from the reactor wait returning to the fd handler running.",
+     &WorkerLatencyMetrics::dispatchDelay},
+    {kMWorkerTaskQueueDelay, "task_queue_delay", "Delay from a cross-thread post to the task running on the worker.",
+     &WorkerLatencyMetrics::taskQueueDelay},
+    {kMWorkerSendCompletion, "send_completion",
+     "Delay from message dispatch to the response bytes being handed to the kernel.",
+     &WorkerLatencyMetrics::sendCompletion},
+    {kMWorkerLoopIteration, "loop_iteration", "Busy event loop iteration time, excluding the reactor wait.",
+     &WorkerLatencyMetrics::loopIteration},
+};
+
 inline std::uint64_t clampNonNegative(std::int64_t v) noexcept
 {
     return static_cast<std::uint64_t>(std::max<std::int64_t>(0, v));
@@ -39,15 +129,83 @@ inline void appendCounter(std::ostringstream &os, const char *name, const char *
     os << "# TYPE " << name << " counter\n";
     os << name << " " << value << "\n";
 }
+inline void appendHeader(std::ostringstream &os, const char *name, const char *help,
+                         const char *type)
+{
+    os << "# HELP " << name << " " << help << "\n";
+    os << "# TYPE " << name << " " << type << "\n";
+}
+
+/// ns 정수를 초 단위 10진수로 정확히 씁니다. (double 기본 6자리 출력은 le 경계를 반올림함)
+inline void appendSecondsFromNs(std::ostringstream &os, std::uint64_t ns)
+{
+    char frac[10];
+    std::snprintf(frac, sizeof(frac), "%09" PRIu64, ns % 1000000000u);
+    std::size_t len = 9;
+    while (len > 0 && frac[len - 1] == '0')
+    {
+        --len;
+    }
+    os << ns / 1000000000u;
+    if (len != 0)
+    {
+        os << "." << std::string_view(frac, len);
+    }
+}
 } // namespace
 
+EngineMetrics::~EngineMetrics()
+{
+    for (auto &l : latencies_)
+    {
+        delete l.exchange(nullptr, std::memory_order_acq_rel);
+    }
+}
+
+WorkerLatencyMetrics *EngineMetrics::workerLatency(unsigned int workerId) noexcept
+{
+    if (workerId >= kMaxWorkerSlots)
+    {
+        return nullptr;
+    }
+    std::atomic<WorkerLatencyMetrics *> &slot = latencies_[workerId];
+    if (WorkerLatencyMetrics *m = slot.load(std::memory_order_acquire))
+    {
+        return m;
+    }
+
+    // 워커 초기화 때 한 번: 같은 슬롯을 동시에 만들면 먼저 게시한 쪽을 쓴다.
+    auto *created = new (std::nothrow) WorkerLatencyMetrics{};
+    if (!created)
+    {
+        return nullptr;
+    }
+    WorkerLatencyMetrics *expected = nullptr;
+    if (!slot.compare_exchange_strong(expected, created, std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+        delete created;
+        return expected;
+    }
+    return created;
+}
+
 EngineMetricsSnapshot EngineMetrics::snapshot() const noexcept
 {
     EngineMetricsSnapshot s{};
-    s.currentConnections = clampNonNegative(currentConnections_.load(std::memory_order_relaxed));
-    s.rxMessagesTotal = rxMessagesTotal_.load(std::memory_order_relaxed);
-    s.txMessagesTotal = txMessagesTotal_.load(std::memory_order_relaxed);
-    s.errorsTotal = errorsTotal_.load(std::memory_order_relaxed);
+
+    // 워커 shard 합산 (읽기 쪽에서만 비용을 낸다)
+    std::int64_t connections = sharedCore_.connections.load(std::memory_order_relaxed);
+    s.rxMessagesTotal = sharedCore_.rxMessagesTotal.load(std::memory_order_relaxed);
+    s.txMessagesTotal = sharedCore_.txMessagesTotal.load(std::memory_order_relaxed);
+    s.errorsTotal = sharedCore_.errorsTotal.load(std::memory_order_relaxed);
+    for (const WorkerCoreMetrics &c : workerCores_)
+    {
+        connections += c.connections.load(std::memory_order_relaxed);
+        s.rxMessagesTotal += c.rxMessagesTotal.load(std::memory_order_relaxed);
+        s.txMessagesTotal += c.txMessagesTotal.load(std::memory_order_relaxed);
+        s.errorsTotal += c.errorsTotal.load(std::memory_order_relaxed);
+    }
+    s.currentConnections = clampNonNegative(connections);
 
     s.connectorPending = clampNonNegative(connectorPending_.load(std::memory_order_relaxed));
     s.connectorTotal = connectorTotal_.load(std::memory_order_relaxed);
@@ -83,6 +241,235 @@ std::string EngineMetrics::toPrometheusText() const
     appendCounter(os, kMConnectorFailureTotal, "Total failed connector attempts.",
                   s.connectorFailureTotal);
 
+    // Worker-level (EventLoop polling)
+    struct PollRow
+    {
+        std::size_t wid;
+        std::uint64_t spinNs;
+        std::uint64_t blockNs;
+    };
+    std::array<PollRow, kMaxWorkerSlots> rows{};
+    std::size_t rowCount = 0;
+    for (std::size_t i = 0; i < workerLoops_.size(); ++i)
+    {
+        const WorkerLoopMetrics &w = workerLoops_[i];
+        if (!w.active.load(std::memory_order_relaxed))
+        {
+            continue;
+        }
+        rows[rowCount++] = PollRow{i, w.spinNsTotal.load(std::memory_order_relaxed),
+                                   w.blockNsTotal.load(std::memory_order_relaxed)};
+    }
+
+    if (rowCount > 0)
+    {
+        appendHeader(os, kMWorkerPollSpinSeconds,
+                     "Time spent in zero-timeout polls that returned no events.", "counter");
+        for (std::size_t i = 0; i < rowCount; ++i)
+        {
+            os << kMWorkerPollSpinSeconds << "{worker=\"" << rows[i].wid << "\"} "
+               << static_cast<double>(rows[i].spinNs) / 1e9 << "\n";
+        }
+        appendHeader(os, kMWorkerPollBlockSeconds, "Time spent blocked in the reactor wait.",
+                     "counter");
+        for (std::size_t i = 0; i < rowCount; ++i)
+        {
+            os << kMWorkerPollBlockSeconds << "{worker=\"" << rows[i].wid << "\"} "
+               << static_cast<double>(rows[i].blockNs) / 1e9 << "\n";
+        }
+        appendHeader(os, kMWorkerPollSpinRatio, "spin / (spin + block) since start.", "gauge");
+        for (std::size_t i = 0; i < rowCount; ++i)
+        {
+            const std::uint64_t idle = rows[i].spinNs + rows[i].blockNs;
+            const double ratio =
+                idle == 0 ? 0.0 : static_cast<double>(rows[i].spinNs) / static_cast<double>(idle);
+            os << kMWorkerPollSpinRatio << "{worker=\"" << rows[i].wid << "\"} " << ratio
+               << "\n";
+        }
+
+        // Worker-level (message path shards)
+        const auto appendCoreSeries = [&](const char *name, const char *help, const char *type,
+                                          auto WorkerCoreMetrics::*field)
+        {
+            appendHeader(os, name, help, type);
+            for (std::size_t i = 0; i < rowCount; ++i)
+            {
+                const WorkerCoreMetrics &c = workerCores_[rows[i].wid];
+                os << name << "{worker=\"" << rows[i].wid << "\"} "
+                   << (c.*field).load(std::memory_order_relaxed) << "\n";
+            }
+        };
+        appendCoreSeries(kMWorkerConnections, "Sessions opened minus closed on the worker.", "gauge",
+                         &WorkerCoreMetrics::connections);
+        appendCoreSeries(kMWorkerRxMessagesTotal, "Framed messages received on the worker.", "counter",
+                         &WorkerCoreMetrics::rxMessagesTotal);
+        appendCoreSeries(kMWorkerTxMessagesTotal, "Framed messages sent from the worker.", "counter",
+                         &WorkerCoreMetrics::txMessagesTotal);
+        appendCoreSeries(kMWorkerErrorsTotal, "Engine/network errors on the worker.", "counter",
+                         &WorkerCoreMetrics::errorsTotal);
+        appendCoreSeries(kMWorkerAcceptedTotal, "Listener sessions opened on the worker (connection steering).",
+                         "counter", &WorkerCoreMetrics::acceptedTotal);
+        appendCoreSeries(kMWorkerMigratedInTotal, "Sessions migrated onto the worker from another worker.",
+                         "counter", &WorkerCoreMetrics::migratedInTotal);
+
+        // 세션 분배 균형: 가장 많은 워커 / 평균 (1 이면 고름, 세션이 없으면 1)
+        std::int64_t maxSessions = 0;
+        std::int64_t sumSessions = 0;
+        for (std::size_t i = 0; i < rowCount; ++i)
+        {
+            const std::int64_t c =
+                std::max<std::int64_t>(workerCores_[rows[i].wid].connections.load(std::memory_order_relaxed), 0);
+            maxSessions = std::max(maxSessions, c);
+            sumSessions += c;
+        }
+        appendHeader(os, kMWorkerSessionImbalance, "Max worker sessions divided by the mean (1 = balanced).",
+                     "gauge");
+        os << kMWorkerSessionImbalance << " "
+           << (sumSessions == 0 ? 1.0
+                                : static_cast<double>(maxSessions) * static_cast<double>(rowCount) /
+                                      static_cast<double>(sumSessions))
+           << "\n";
+
+        // Worker-level (SessionPool occupancy)
+        const auto appendPoolSeries = [&](const char *name, const char *help, const char *type,
+                                          std::atomic<std::uint64_t> WorkerSessionPoolMetrics::*field)
+        {
+            appendHeader(os, name, help, type);
+            for (std::size_t i = 0; i < rowCount; ++i)
+            {
+                const WorkerSessionPoolMetrics &p = sessionPools_[rows[i].wid];
+                os << name << "{worker=\"" << rows[i].wid << "\"} "
+                   << (p.*field).load(std::memory_order_relaxed) << "\n";
+            }
+        };
+        appendPoolSeries(kMWorkerSessionPoolIdle, "Session slots parked in the worker session pool.", "gauge",
+                         &WorkerSessionPoolMetrics::idleSessions);
+        appendPoolSeries(kMWorkerRingPoolIdle, "Recv/send rings parked in the worker session pool.", "gauge",
+                         &WorkerSessionPoolMetrics::idleRings);
+        appendPoolSeries(kMWorkerSessionPoolHits, "Session slots served from the pool.", "counter",
+                         &WorkerSessionPoolMetrics::sessionHitsTotal);
+        appendPoolSeries(kMWorkerSessionPoolMisses, "Session slots allocated because the pool was empty.",
+                         "counter", &WorkerSessionPoolMetrics::sessionMissesTotal);
+        appendPoolSeries(kMWorkerRingPoolHits, "Rings served from the pool.", "counter",
+                         &WorkerSessionPoolMetrics::ringHitsTotal);
+        appendPoolSeries(kMWorkerRingPoolMisses, "Rings allocated because the pool was empty.", "counter",
+                         &WorkerSessionPoolMetrics::ringMissesTotal);
+        appendPoolSeries(kMWorkerRingsInUse, "Recv/send rings currently held by sessions.", "gauge",
+                         &WorkerSessionPoolMetrics::ringsInUse);
+        appendPoolSeries(kMWorkerRingReclaims, "Idle session rings returned to the pool.", "counter",
+                         &WorkerSessionPoolMetrics::ringReclaimsTotal);
+
+        // Worker-level (send overflow queue)
+        const auto appendSendQueueSeries = [&](const char *name, const char *help, const char *type,
+                                               std::atomic<std::uint64_t> WorkerSendQueueMetrics::*field)
+        {
+            appendHeader(os, name, help, type);
+            for (std::size_t i = 0; i < rowCount; ++i)
+            {
+                const WorkerSendQueueMetrics &q = sendQueues_[rows[i].wid];
+                os << name << "{worker=\"" << rows[i].wid << "\"} "
+                   << (q.*field).load(std::memory_order_relaxed) << "\n";
+            }
+        };
+        appendSendQueueSeries(kMWorkerSendQueueBytes, "Bytes queued beyond the session send rings.", "gauge",
+                              &WorkerSendQueueMetrics::overflowBytes);
+        appendSendQueueSeries(kMWorkerSendQueueCongested, "Sessions above the send queue high watermark.",
+                              "gauge", &WorkerSendQueueMetrics::congestedSessions);
+        appendSendQueueSeries(kMWorkerSendBackpressure, "Send queue high watermark crossings.", "counter",
+                              &WorkerSendQueueMetrics::backpressureEventsTotal);
+        appendSendQueueSeries(kMWorkerSendQueueLimitCloses, "Sessions closed at the send queue limit.",
+                              "counter", &WorkerSendQueueMetrics::limitClosesTotal);
+        appendSendQueueSeries(kMWorkerSendQueueHeapBlocks,
+                              "Overflow blocks taken from the heap because the worker block pool was empty.",
+                              "counter", &WorkerSendQueueMetrics::heapBlocksTotal);
+
+        // Worker-level (page faults: 링/풀 prefault, huge page 효과 확인용)
+        appendHeader(os, kMWorkerPageFaults, "Page faults taken by the worker thread.", "counter");
+        for (std::size_t i = 0; i < rowCount; ++i)
+        {
+            std::uint64_t minor = 0;
+            std::uint64_t major = 0;
+            if (!readThreadPageFaults(workerLoops_[rows[i].wid].tid.load(std::memory_order_relaxed), minor, major))
+            {
+                continue; // 워커가 이미 끝났거나 /proc 이 없음
+            }
+            os << kMWorkerPageFaults << "{worker=\"" << rows[i].wid << "\",kind=\"minor\"} " << minor << "\n";
+            os << kMWorkerPageFaults << "{worker=\"" << rows[i].wid << "\",kind=\"major\"} " << major << "\n";
+        }
+
+        // Worker-level (engine internal latency histograms)
+        const auto snap = std::make_unique<LatencyHistogram::Snapshot>();
+        for (const LatencySeries &series : kLatencySeries)
+        {
+            appendHeader(os, series.metric, series.help, "histogram");
+            for (std::size_t i = 0; i < rowCount; ++i)
+            {
+                const WorkerLatencyMetrics *m = latencies_[rows[i].wid].load(std::memory_order_acquire);
+                if (!m)
+                {
+                    continue;
+                }
+                (m->*series.field).snapshotInto(*snap);
+                for (unsigned bit = kLatencyLeFirstBit; bit <= kLatencyLeLastBit; ++bit)
+                {
+                    const std::uint64_t bound = std::uint64_t{1} << bit;
+                    os << series.metric << "_bucket{worker=\"" << rows[i].wid << "\",le=\"";
+                    appendSecondsFromNs(os, bound);
+                    os << "\"} " << snap->countBelow(bound) << "\n";
+                }
+                os << series.metric << "_bucket{worker=\"" << rows[i].wid << "\",le=\"+Inf\"} " << snap->count
+                   << "\n";
+                os << series.metric << "_sum{worker=\"" << rows[i].wid << "\"} ";
+                appendSecondsFromNs(os, snap->sumNs);
+                os << "\n";
+                os << series.metric << "_count{worker=\"" << rows[i].wid << "\"} " << snap->count << "\n";
+            }
+        }
+    }
+
+    return os.str();
+}
+
+std::string EngineMetrics::toLatencyJson() const
+{
+    constexpr std::size_t kSeriesCount = std::size(kLatencySeries);
+    std::vector<LatencyHistogram::Snapshot> totals(kSeriesCount);
+    const auto snap = std::make_unique<LatencyHistogram::Snapshot>();
+
+    std::ostringstream os;
+    const auto appendSummary = [&os](const LatencyHistogram::Snapshot &s)
+    {
+        os << "{\"count\":" << s.count << ",\"p50\":" << s.percentile(0.50) << ",\"p99\":" << s.percentile(0.99)
+           << ",\"p999\":" << s.percentile(0.999) << ",\"max\":" << s.maxNs << "}";
+    };
+
+    os << "{\"unit\":\"ns\",\"workers\":[";
+    bool first = true;
+    for (std::size_t wid = 0; wid < kMaxWorkerSlots; ++wid)
+    {
+        const WorkerLatencyMetrics *m = latencies_[wid].load(std::memory_order_acquire);
+        if (!m || !workerLoops_[wid].active.load(std::memory_order_relaxed))
+        {
+            continue;
+        }
+        os << (first ? "" : ",") << "{\"worker\":" << wid;
+        first = false;
+        for (std::size_t k = 0; k < kSeriesCount; ++k)
+        {
+            (m->*kLatencySeries[k].field).snapshotInto(*snap);
+            totals[k].merge(*snap);
+            os << ",\"" << kLatencySeries[k].jsonKey << "\":";
+            appendSummary(*snap);
+        }
+        os << "}";
+    }
+    os << "],\"total\":{";
+    for (std::size_t k = 0; k < kSeriesCount; ++k)
+    {
+        os << (k == 0 ? "" : ",") << "\"" << kLatencySeries[k].jsonKey << "\":";
+        appendSummary(totals[k]);
+    }
+    os << "}}\n";
     return os.str();
 }
 
@@ -100,6 +100,12 @@ Socket Acceptor::acceptOne(PeerEndpoint *outPeer) noexcept
 
 void Acceptor::handleEvent(EventLoop &loop, const EpollReactor::ReadyEvent &ev)
 {
+    if (ev.completion == EpollReactor::Completion::Accept)
+    {
+        onAcceptCompleted_(loop, ev);
+        return;
+    }
+
     if (ev.events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP))
     {
         onError_(loop, ev);
@@ -140,21 +146,60 @@ void Acceptor::onReadable_()
         SLOG_INFO("Acceptor", "Accepted", "peer_ip={} peer_port={} fd={}", peer.ip, peer.port,
                   client.nativeHandle());
 
-        if (onAccept_)
+        deliverAccepted_(std::move(client), peer);
+    }
+}
+
+void Acceptor::onAcceptCompleted_(EventLoop &loop, const EpollReactor::ReadyEvent &ev) noexcept
+{
+    if (ev.result >= 0)
+    {
+        // multishot accept 는 SOCK_NONBLOCK|SOCK_CLOEXEC 로 생성되므로 peer 정보만 조회한다.
+        Socket client(ev.result);
+        PeerEndpoint peer{};
+        ::sockaddr_storage ss{};
+        ::socklen_t slen = sizeof(ss);
+        if (::getpeername(client.nativeHandle(), reinterpret_cast<::sockaddr *>(&ss), &slen) == 0)
         {
-            try
-            {
-                onAccept_(std::move(client), peer);
-            }
-            catch (const std::exception &e)
-            {
-                SLOG_ERROR("Acceptor", "OnAcceptException", "what='{}'", e.what());
-            }
-            catch (...)
-            {
-                SLOG_ERROR("Acceptor", "OnAcceptException", "type=unknown");
-            }
+            fillPeerEndpoint(reinterpret_cast<::sockaddr *>(&ss), slen, peer);
         }
+
+        SLOG_INFO("Acceptor", "Accepted", "peer_ip={} peer_port={} fd={}", peer.ip, peer.port,
+                  client.nativeHandle());
+
+        deliverAccepted_(std::move(client), peer);
+    }
+    else if (ev.result != -ECANCELED)
+    {
+        SLOG_ERROR("Acceptor", "AcceptFailed", "errno={} msg='{}'", -ev.result,
+                   std::strerror(-ev.result));
+    }
+
+    // multishot 이 끝났으면(에러/CQ 오버플로) 리스너가 살아있는 한 재무장한다.
+    if (!ev.more && isValid() && !loop.armAccept(nativeHandle()))
+    {
+        SLOG_ERROR("Acceptor", "AcceptRearmFailed", "fd={}", nativeHandle());
+    }
+}
+
+void Acceptor::deliverAccepted_(Socket &&client, const PeerEndpoint &peer) noexcept
+{
+    if (!onAccept_)
+    {
+        return;
+    }
+
+    try
+    {
+        onAccept_(std::move(client), peer);
+    }
+    catch (const std::exception &e)
+    {
+        SLOG_ERROR("Acceptor", "OnAcceptException", "what='{}'", e.what());
+    }
+    catch (...)
+    {
+        SLOG_ERROR("Acceptor", "OnAcceptException", "type=unknown");
     }
 }
 
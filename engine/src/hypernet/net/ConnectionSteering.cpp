@@ -0,0 +1,230 @@
+#include <hypernet/net/ConnectionSteering.hpp>
+
+#include <hypernet/core/Logger.hpp>
+#include <hypernet/monitoring/Metrics.hpp>
+#include <hypernet/net/EventLoop.hpp>
+#include <hypernet/net/SessionManager.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <limits>
+#include <map>
+#include <utility>
+
+#include <sys/socket.h>
+
+#ifndef SO_ATTACH_REUSEPORT_CBPF
+#define SO_ATTACH_REUSEPORT_CBPF 51 // Linux 4.5
+#endif
+
+namespace hypernet::net
+{
+
+namespace
+{
+/// 그룹 크기보다 큰 index → 커널이 해시 선택으로 폴백
+constexpr std::uint32_t kNoListener = std::numeric_limits<std::uint32_t>::max();
+/// 보조 데이터 load 오프셋 (음수 오프셋을 k 필드의 u32 로 표현)
+constexpr auto kLoadCpu = static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU);
+constexpr auto kLoadRandom = static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_RANDOM);
+/// 가중치 1개의 상한 (합이 32bit 난수 범위를 넘지 않도록)
+constexpr std::uint32_t kMaxWeight = 0xFFFF;
+} // namespace
+
+ReuseportProgram buildIncomingCpuProgram(const std::vector<int> &listenerCpus)
+{
+    ReuseportProgram prog;
+    prog.push_back(BPF_STMT(BPF_LD | BPF_W | BPF_ABS, kLoadCpu));
+
+    // 같은 CPU 에 워커가 여럿이면(워커 > CPU) 먼저 온 워커가 받는다.
+    std::map<int, std::uint32_t> indexOfCpu;
+    for (std::size_t i = 0; i < listenerCpus.size(); ++i)
+    {
+        if (listenerCpus[i] >= 0)
+        {
+            indexOfCpu.emplace(listenerCpus[i], static_cast<std::uint32_t>(i));
+        }
+    }
+
+    if (indexOfCpu.empty())
+    {
+        const auto n = static_cast<std::uint32_t>(std::max<std::size_t>(listenerCpus.size(), 1));
+        prog.push_back(BPF_STMT(BPF_ALU | BPF_MOD | BPF_K, n));
+        prog.push_back(BPF_STMT(BPF_RET | BPF_A, 0));
+        return prog;
+    }
+
+    for (const auto &[cpu, index] : indexOfCpu)
+    {
+        prog.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, static_cast<std::uint32_t>(cpu), 0, 1));
+        prog.push_back(BPF_STMT(BPF_RET | BPF_K, index));
+    }
+    prog.push_back(BPF_STMT(BPF_RET | BPF_K, kNoListener));
+    return prog;
+}
+
+ReuseportProgram buildWeightedProgram(const std::vector<std::uint32_t> &weights)
+{
+    ReuseportProgram prog;
+    if (weights.empty())
+    {
+        prog.push_back(BPF_STMT(BPF_RET | BPF_K, kNoListener));
+        return prog;
+    }
+
+    std::vector<std::uint32_t> w(weights.size());
+    std::uint32_t total = 0;
+    for (std::size_t i = 0; i < weights.size(); ++i)
+    {
+        w[i] = std::min(weights[i], kMaxWeight);
+        total += w[i];
+    }
+    if (total == 0)
+    {
+        std::fill(w.begin(), w.end(), 1U);
+        total = static_cast<std::uint32_t>(w.size());
+    }
+
+    // A = random % total 을 누적 가중치 구간 [cum_{i-1}, cum_i) 로 찾는다.
+    prog.push_back(BPF_STMT(BPF_LD | BPF_W | BPF_ABS, kLoadRandom));
+    prog.push_back(BPF_STMT(BPF_ALU | BPF_MOD | BPF_K, total));
+    std::uint32_t cum = 0;
+    for (std::size_t i = 0; i + 1 < w.size(); ++i)
+    {
+        if (w[i] == 0)
+        {
+            continue;
+        }
+        cum += w[i];
+        prog.push_back(BPF_JUMP(BPF_JMP | BPF_JGE | BPF_K, cum, 1, 0));
+        prog.push_back(BPF_STMT(BPF_RET | BPF_K, static_cast<std::uint32_t>(i)));
+    }
+    prog.push_back(BPF_STMT(BPF_RET | BPF_K, static_cast<std::uint32_t>(w.size() - 1)));
+    return prog;
+}
+
+std::vector<std::uint32_t> steeringWeights(const std::vector<std::int64_t> &loads)
+{
+    std::int64_t maxLoad = 0;
+    for (const std::int64_t l : loads)
+    {
+        maxLoad = std::max(maxLoad, l);
+    }
+
+    std::vector<std::uint32_t> out;
+    out.reserve(loads.size());
+    for (const std::int64_t l : loads)
+    {
+        const std::int64_t gap = maxLoad - std::max<std::int64_t>(l, 0);
+        out.push_back(static_cast<std::uint32_t>(std::min<std::int64_t>(1 + gap, kMaxWeight)));
+    }
+    return out;
+}
+
+int attachReuseportProgram(int fd, const ReuseportProgram &prog) noexcept
+{
+    if (prog.empty() || prog.size() > BPF_MAXINSNS)
+    {
+        return EINVAL;
+    }
+    ::sock_fprog fprog{};
+    fprog.len = static_cast<unsigned short>(prog.size());
+    fprog.filter = const_cast<::sock_filter *>(prog.data());
+    if (::setsockopt(fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &fprog, sizeof(fprog)) != 0)
+    {
+        return errno;
+    }
+    return 0;
+}
+
+AcceptHandoff::AcceptHandoff(std::size_t workerCount)
+    : count_(workerCount), targets_(std::make_unique<Target[]>(workerCount))
+{
+}
+
+void AcceptHandoff::attach(unsigned int wid, EventLoop *loop, SessionManager *sessions) noexcept
+{
+    if (wid >= count_)
+    {
+        return;
+    }
+    targets_[wid].loop = loop;
+    targets_[wid].sessions = sessions;
+}
+
+unsigned int AcceptHandoff::pick() noexcept
+{
+    if (count_ == 0)
+    {
+        return 0;
+    }
+    const auto &metrics = hypernet::monitoring::engineMetrics();
+
+    std::size_t best = cursor_ % count_;
+    std::int64_t bestLoad = std::numeric_limits<std::int64_t>::max();
+    for (std::size_t k = 0; k < count_; ++k)
+    {
+        const std::size_t i = (cursor_ + k) % count_;
+        const Target &t = targets_[i];
+        const auto *core = metrics.workerCore(static_cast<unsigned int>(i));
+        if (!t.sessions || !core)
+        {
+            continue;
+        }
+        const std::int64_t load = core->connections.load(std::memory_order_relaxed) + t.inFlight.load(std::memory_order_relaxed);
+        if (load < bestLoad)
+        {
+            best = i;
+            bestLoad = load;
+        }
+    }
+    cursor_ = best + 1;
+    return static_cast<unsigned int>(best);
+}
+
+void AcceptHandoff::dispatch(unsigned int fromWid, Socket &&client, const Acceptor::PeerEndpoint &peer) noexcept
+{
+    if (count_ == 0)
+    {
+        return;
+    }
+    const unsigned int to = pick();
+    Target &t = targets_[to];
+    if (to == fromWid || !t.loop || !t.sessions)
+    {
+        if (fromWid < count_ && targets_[fromWid].sessions)
+        {
+            deliver_(targets_[fromWid], std::move(client), peer);
+        }
+        return;
+    }
+
+    // 세션 수에 반영되기 전까지 in-flight 로 세어 burst accept 가 한 워커로 몰리지 않게 한다.
+    t.inFlight.fetch_add(1, std::memory_order_relaxed);
+    try
+    {
+        t.loop->post(
+            [&t, sock = std::move(client), peer]() mutable
+            {
+                deliver_(t, std::move(sock), peer);
+                t.inFlight.fetch_sub(1, std::memory_order_relaxed);
+            });
+    }
+    catch (const std::exception &e)
+    {
+        // task 와 함께 소켓도 닫혔다. (할당 실패 정도라 재시도하지 않음)
+        t.inFlight.fetch_sub(1, std::memory_order_relaxed);
+        hypernet::monitoring::engineMetrics().onError();
+        SLOG_ERROR("AcceptHandoff", "PostFailed", "to={} what='{}' action=Dropped", to, e.what());
+    }
+}
+
+void AcceptHandoff::deliver_(Target &t, Socket &&client, const Acceptor::PeerEndpoint &peer) noexcept
+{
+    if (t.sessions->onAccepted(std::move(client), peer))
+    {
+        hypernet::monitoring::engineMetrics().onSessionAccepted();
+    }
+}
+
+} // namespace hypernet::net
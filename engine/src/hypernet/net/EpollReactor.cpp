@@ -5,8 +5,11 @@
 #include <algorithm>
 #include <cerrno>
 #include <cstring>
+#include <limits>
 #include <system_error>
+#include <ctime>
 #include <unistd.h>
+#include <sys/syscall.h>
 
 namespace hypernet::net
 {
@@ -40,7 +43,7 @@ EpollReactor::~EpollReactor() noexcept
     }
 }
 
-bool EpollReactor::registerFd(Fd fd, std::uint32_t events) noexcept
+bool EpollReactor::registerFd(Fd fd, std::uint32_t events, std::uint32_t generation) noexcept
 {
     if (epollFd_ < 0 || fd < 0)
     {
@@ -52,7 +55,7 @@ bool EpollReactor::registerFd(Fd fd, std::uint32_t events) noexcept
 
     ::epoll_event ev{};
     ev.events = events;
-    ev.data.fd = fd;
+    ev.data.u64 = (static_cast<std::uint64_t>(generation) << 32) | static_cast<std::uint32_t>(fd);
 
     if (::epoll_ctl(epollFd_, EPOLL_CTL_ADD, fd, &ev) == -1)
     {
@@ -65,7 +68,7 @@ bool EpollReactor::registerFd(Fd fd, std::uint32_t events) noexcept
     return true;
 }
 
-bool EpollReactor::modifyFd(Fd fd, std::uint32_t events) noexcept
+bool EpollReactor::modifyFd(Fd fd, std::uint32_t events, std::uint32_t generation) noexcept
 {
     if (epollFd_ < 0 || fd < 0)
     {
@@ -77,7 +80,7 @@ bool EpollReactor::modifyFd(Fd fd, std::uint32_t events) noexcept
 
     ::epoll_event ev{};
     ev.events = events;
-    ev.data.fd = fd;
+    ev.data.u64 = (static_cast<std::uint64_t>(generation) << 32) | static_cast<std::uint32_t>(fd);
 
     if (::epoll_ctl(epollFd_, EPOLL_CTL_MOD, fd, &ev) == -1)
     {
@@ -119,7 +122,7 @@ bool EpollReactor::unregisterFd(Fd fd) noexcept
     return true;
 }
 
-int EpollReactor::wait(ReadyEvent *outEvents, int maxEvents, int timeoutMs) noexcept
+int EpollReactor::waitNs(ReadyEvent *outEvents, int maxEvents, std::int64_t timeoutNs) noexcept
 {
     if (epollFd_ < 0)
     {
@@ -137,7 +140,39 @@ int EpollReactor::wait(ReadyEvent *outEvents, int maxEvents, int timeoutMs) noex
 
     const int maxPollEvents = std::min(maxEvents, maxEvents_);
 
-    int n = ::epoll_wait(epollFd_, eventBuffer_.data(), maxPollEvents, timeoutMs);
+    int n = -1;
+    bool waited = false;
+#ifdef SYS_epoll_pwait2
+    if (timeoutNs > 0 && !pwait2Unsupported_)
+    {
+        ::timespec ts{};
+        ts.tv_sec = static_cast<::time_t>(timeoutNs / 1'000'000'000);
+        ts.tv_nsec = static_cast<long>(timeoutNs % 1'000'000'000);
+        n = static_cast<int>(::syscall(SYS_epoll_pwait2, epollFd_, eventBuffer_.data(),
+                                       maxPollEvents, &ts, nullptr, 0));
+        if (n < 0 && (errno == ENOSYS || errno == EPERM))
+        {
+            pwait2Unsupported_ = true;
+            SLOG_WARN("EpollReactor", "EpollPwait2Unavailable", "errno={} fallback=epoll_wait_ms",
+                      errno);
+        }
+        else
+        {
+            waited = true;
+        }
+    }
+#endif
+    if (!waited)
+    {
+        int timeoutMs = -1;
+        if (timeoutNs >= 0)
+        {
+            const std::int64_t ms = (timeoutNs + 999'999) / 1'000'000;
+            timeoutMs = static_cast<int>(std::min<std::int64_t>(ms, std::numeric_limits<int>::max()));
+        }
+        n = ::epoll_wait(epollFd_, eventBuffer_.data(), maxPollEvents, timeoutMs);
+    }
+
     if (n < 0)
     {
         if (errno == EINTR)
@@ -155,8 +190,10 @@ int EpollReactor::wait(ReadyEvent *outEvents, int maxEvents, int timeoutMs) noex
     for (int i = 0; i < n; ++i)
     {
         const auto &ev = eventBuffer_[i];
-        outEvents[i].fd = ev.data.fd;
+        outEvents[i] = ReadyEvent{};
+        outEvents[i].fd = static_cast<Fd>(static_cast<std::uint32_t>(ev.data.u64));
         outEvents[i].events = ev.events;
+        outEvents[i].generation = static_cast<std::uint32_t>(ev.data.u64 >> 32);
     }
 
     return n;
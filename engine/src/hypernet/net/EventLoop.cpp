@@ -3,11 +3,14 @@
 
 #include <hypernet/core/Logger.hpp>
 #include <hypernet/core/ThreadContext.hpp>
+#include <hypernet/monitoring/Metrics.hpp>
+#include <hypernet/net/IoUringReactor.hpp>
+#include <hypernet/net/WorkerMesh.hpp>
 
+#include <algorithm>
 #include <cerrno>
 #include <cstdlib>
 #include <cstring>
-#include <limits>
 #include <system_error>
 #include <thread>
 
@@ -47,11 +50,25 @@ namespace
 {
     throw std::system_error(errno, std::generic_category(), what);
 }
+
+inline std::int64_t toNs(core::TimerWheel::Clock::time_point t) noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+}
 } // namespace
 
 EventLoop::EventLoop(Duration tickResolution, std::size_t timerSlots, int maxEpollEvents)
-    : reactor_(maxEpollEvents), taskQueue_{}, timerWheel_(tickResolution, timerSlots)
+    : EventLoop(tickResolution, timerSlots, core::EventLoopOptions{maxEpollEvents})
+{
+}
+
+EventLoop::EventLoop(Duration tickResolution, std::size_t timerSlots,
+                     const core::EventLoopOptions &options)
+    : reactor_(options.maxEpollEvents), taskQueue_{}, timerWheel_(tickResolution, timerSlots),
+      now_(core::TimerWheel::Clock::now()), pollMode_(options.pollMode),
+      spinBudgetNs_(static_cast<std::int64_t>(options.pollSpinUs) * 1000)
 {
+    int maxEpollEvents = options.maxEpollEvents;
     if (maxEpollEvents <= 0)
     {
         maxEpollEvents = 64;
@@ -65,9 +82,26 @@ EventLoop::EventLoop(Duration tickResolution, std::size_t timerSlots, int maxEpo
     }
     wakeupHandler_ = std::make_unique<WakeupHandler>(this);
 
-    SLOG_INFO("EventLoop", "Created", "tick_ms={} timer_slots={} max_epoll_events={} wakeup_fd={}",
+    if (options.backend == IoBackend::IoUring)
+    {
+        try
+        {
+            uring_ = std::make_unique<IoUringReactor>(
+                options.uringEntries, options.uringRecvBufferCount, options.uringRecvBufferSize);
+        }
+        catch (const std::exception &e)
+        {
+            // 커널/권한(seccomp 등) 문제로 io_uring 을 못 쓰는 환경: epoll 로 계속 동작
+            SLOG_WARN("EventLoop", "IoUringFallback", "reason='{}' backend=epoll", e.what());
+            uring_.reset();
+        }
+    }
+
+    SLOG_INFO("EventLoop", "Created",
+              "tick_us={} timer_slots={} max_epoll_events={} wakeup_fd={} backend={} "
+              "poll_mode={} poll_spin_us={}",
               timerWheel_.tickResolution().count(), timerWheel_.slotCount(), maxEpollEvents,
-              wakeupFd_);
+              wakeupFd_, toString(backend()), toString(pollMode_), options.pollSpinUs);
 }
 
 EventLoop::~EventLoop()
@@ -287,27 +321,36 @@ bool EventLoop::addFd(int fd, std::uint32_t events, IFdHandler *handler) noexcep
         return false;
     }
 
-    if (!reactor_.registerFd(fd, events))
+    if (static_cast<std::size_t>(fd) >= fdContexts_.size())
+    {
+        fdContexts_.resize(static_cast<std::size_t>(fd) + 1);
+    }
+    FdContext &slot = fdContexts_[static_cast<std::size_t>(fd)];
+    const std::uint32_t generation = slot.generation;
+
+    const bool registered = uring_ ? uring_->registerFd(fd, events)
+                                   : reactor_.registerFd(fd, events, generation);
+    if (!registered)
     {
         SLOG_ERROR("EventLoop", "AddFdReactorRegisterFailed", "fd={} events=0x{:x}", fd, events);
         return false;
     }
 
     auto ctx = makeContext_(fd, events, handler);
+    ctx.generation = generation;
 
     // fd context 단일화
-    auto [it, inserted] = fdContexts_.emplace(fd, ctx);
-    if (!inserted)
+    if (slot.handler)
     {
         // 같은 fd가 이미 존재하는 것은 일반적으로 버그지만,
         // 운영 안전을 위해 overwrite 한다(로그로 남겨 추적).
         SLOG_WARN("EventLoop", "FdContextOverwrite", "fd={} tag={} id={}", fd, ctx.tag,
                   ctx.debugId);
-        it->second = ctx;
     }
+    slot = ctx;
 
-    SLOG_INFO("EventLoop", "FdRegistered", "fd={} tag={} id={} owner=0x{:x} events=0x{:x}", fd,
-              ctx.tag, ctx.debugId, ctx.ownerPtr, ctx.registeredEvents);
+    SLOG_DEBUG("EventLoop", "FdRegistered", "fd={} tag={} id={} owner=0x{:x} events=0x{:x} gen={}",
+               fd, ctx.tag, ctx.debugId, ctx.ownerPtr, ctx.registeredEvents, ctx.generation);
 
     return true;
 }
@@ -323,21 +366,24 @@ bool EventLoop::updateFd(int fd, std::uint32_t events) noexcept
         return false;
     }
 
-    auto it = fdContexts_.find(fd);
-    if (it == fdContexts_.end() || !it->second.handler)
+    FdContext *ctx = findContext_(fd);
+    if (!ctx)
     {
         errno = ENOENT;
         SLOG_ERROR("EventLoop", "UpdateFdMissingContext", "fd={}", fd);
         return false;
     }
 
-    if (!reactor_.modifyFd(fd, events))
+    // EPOLL_CTL_MOD 는 data 도 덮어쓰므로 같은 generation 을 다시 싣는다.
+    const bool modified = uring_ ? uring_->modifyFd(fd, events)
+                                 : reactor_.modifyFd(fd, events, ctx->generation);
+    if (!modified)
     {
         SLOG_ERROR("EventLoop", "UpdateFdReactorModifyFailed", "fd={} events=0x{:x}", fd, events);
         return false;
     }
 
-    it->second.registeredEvents = events;
+    ctx->registeredEvents = events;
     SLOG_DEBUG("EventLoop", "UpdateFdOk", "fd={} events=0x{:x}", fd, events);
     return true;
 }
@@ -353,17 +399,21 @@ bool EventLoop::removeFd(int fd) noexcept
         return false;
     }
 
-    // 로그를 위해 컨텍스트를 복사해둔다(erase 이후에도 안전)
-    FdContext ctxCopy{};
-    if (auto it = fdContexts_.find(fd); it != fdContexts_.end())
+    const bool ok = uring_ ? uring_->unregisterFd(fd) : reactor_.unregisterFd(fd);
+
+    // registry 단일 소유: 여기서 비우고 generation 을 올려 이번 배치의 지연 이벤트를 무효화한다.
+    if (FdContext *ctx = findContext_(fd))
     {
-        ctxCopy = it->second;
+        SLOG_DEBUG("EventLoop", "FdUnregistered", "fd={} tag={} id={} owner=0x{:x} gen={}", fd,
+                   ctx->tag, ctx->debugId, ctx->ownerPtr, ctx->generation);
+        const std::uint32_t nextGeneration = ctx->generation + 1;
+        *ctx = FdContext{};
+        ctx->generation = nextGeneration;
+    }
+    else
+    {
+        SLOG_DEBUG("EventLoop", "FdUnregistered", "fd={} context=missing", fd);
     }
-
-    const bool ok = reactor_.unregisterFd(fd);
-
-    // registry 단일 소유: 여기서 제거
-    (void)fdContexts_.erase(fd);
 
     if (!ok)
     {
@@ -371,102 +421,325 @@ bool EventLoop::removeFd(int fd) noexcept
         return false;
     }
 
-    if (ctxCopy.fd == fd && ctxCopy.handler)
+    return true;
+}
+
+void EventLoop::post(core::TaskQueue::Task task)
+{
+    // owner thread 자신: 깨어 있으므로 깨울 필요가 없고, 실행이 끝난 노드를 재사용한다.
+    if (isInOwnerThread())
     {
-        SLOG_INFO("EventLoop", "FdUnregistered", "fd={} tag={} id={} owner=0x{:x}", fd, ctxCopy.tag,
-                  ctxCopy.debugId, ctxCopy.ownerPtr);
+        taskQueue_.pushLocal(std::move(task));
+        return;
     }
-    else
+
+    // 다른 워커 스레드에서 온 작업은 (src, 이 워커) 전용 채널로 보낸다. (채널 안에서 FIFO)
+    if (mesh_)
     {
-        SLOG_INFO("EventLoop", "FdUnregistered", "fd={} context=missing", fd);
+        const int src = core::ThreadContext::currentWorkerId();
+        if (src >= 0 && src != meshWorkerId_ && mesh_->post(src, meshWorkerId_, task))
+        {
+            return; // mesh 가 dst 를 깨움
+        }
     }
 
+    taskQueue_.push(std::move(task));
+
+    // 루프가 깨어 있으면(owner thread 자신 포함) 이번/다음 drain 에서 처리되므로 쓰지 않는다.
+    wakeIfSleeping_();
+}
+
+void EventLoop::notifyInbound() noexcept
+{
+    // 링 tail 게시(release) 뒤 sleeping_ 을 읽는 순서를 보장한다. (잠들기 직전 hasInbound 와 짝)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    wakeIfSleeping_();
+}
+
+core::TimerWheel::TimerId EventLoop::addTimer(Duration delay, core::TimerWheel::Callback cb)
+{
+    assertInOwnerThread_("addTimer");
+    return timerWheel_.addTimer(delay, std::move(cb));
+}
+
+bool EventLoop::cancelTimer(core::TimerWheel::TimerId id) noexcept
+{
+    assertInOwnerThread_("cancelTimer");
+    return timerWheel_.cancelTimer(id);
+}
+
+bool EventLoop::rescheduleTimer(core::TimerWheel::TimerId id, Duration delay) noexcept
+{
+    assertInOwnerThread_("rescheduleTimer");
+    return timerWheel_.reschedule(id, delay);
+}
+
+bool EventLoop::armAccept(int fd) noexcept
+{
+    assertInOwnerThread_("armAccept");
+    if (!uring_)
+    {
+        errno = ENOTSUP;
+        return false;
+    }
+    if (!uring_->armAccept(fd))
+    {
+        SLOG_ERROR("EventLoop", "ArmAcceptFailed", "fd={} errno={}", fd, errno);
+        return false;
+    }
     return true;
 }
 
-void EventLoop::post(core::TaskQueue::Task task)
+bool EventLoop::armRecv(int fd) noexcept
 {
-    taskQueue_.push(std::move(task));
+    assertInOwnerThread_("armRecv");
+    if (!uring_)
+    {
+        errno = ENOTSUP;
+        return false;
+    }
+    if (!uring_->armRecv(fd))
+    {
+        SLOG_ERROR("EventLoop", "ArmRecvFailed", "fd={} errno={}", fd, errno);
+        return false;
+    }
+    return true;
+}
 
-    if (!isInOwnerThread())
+bool EventLoop::submitSend(int fd, const ::iovec *iov, int iovcnt,
+                           std::shared_ptr<void> keepAlive) noexcept
+{
+    assertInOwnerThread_("submitSend");
+    if (!uring_)
     {
-        signalWakeup_();
+        errno = ENOTSUP;
+        return false;
     }
+    return uring_->submitSend(fd, iov, iovcnt, std::move(keepAlive));
 }
 
-core::TimerWheel::TimerId EventLoop::addTimer(Duration delay, core::TimerWheel::Callback cb)
+std::int64_t EventLoop::computePollTimeoutNs_(std::int64_t nowNs) const noexcept
 {
-    assertInOwnerThread_("addTimer");
-    return timerWheel_.addTimer(delay, std::move(cb));
+    const auto deadline = timerWheel_.nextDeadline();
+    if (deadline == core::TimerWheel::Clock::time_point::max())
+    {
+        return -1; // 타이머 없음: I/O 나 wakeup(eventfd) 이 올 때까지 잔다.
+    }
+    return std::max<std::int64_t>(0, toNs(deadline) - nowNs);
 }
 
-int EventLoop::computePollTimeoutMs() const noexcept
+std::size_t EventLoop::drainTasks() noexcept
 {
-    const auto ms64 = timerWheel_.tickResolution().count();
-    if (ms64 <= 0)
+    monitoring::LatencyHistogram *taskDelay = latencyMetrics_ ? &latencyMetrics_->taskQueueDelay : nullptr;
+
+    // 쌓인 목록을 한 번에 떼어 온다. 실행 중 post 된 작업은 다음 drain 으로 넘어간다.
+    std::size_t ran = taskQueue_.drain(
+        [taskDelay](core::TaskQueue::Task &task, std::int64_t postedNs) noexcept
+        {
+            // 다른 스레드에서 push 된 작업만 post 시각이 있다. (자기 자신의 pushLocal 은 0)
+            if (taskDelay && postedNs != 0)
+            {
+                taskDelay->record(monitoring::latencyNowNs() - postedNs);
+            }
+            if (!task)
+            {
+                return;
+            }
+            try
+            {
+                task();
+            }
+            catch (const std::exception &e)
+            {
+                SLOG_ERROR("EventLoop", "TaskException", "what='{}'", e.what());
+            }
+            catch (...)
+            {
+                SLOG_ERROR("EventLoop", "TaskUnknownException");
+            }
+        });
+
+    // 다른 워커들이 전용 채널로 넘긴 packet/task descriptor
+    if (mesh_)
     {
-        return 1;
+        ran += mesh_->poll(meshWorkerId_, taskDelay);
     }
-    if (ms64 > static_cast<long long>(std::numeric_limits<int>::max()))
+    return ran;
+}
+
+void EventLoop::setLoopMetrics(monitoring::WorkerLoopMetrics *metrics) noexcept
+{
+    loopMetrics_ = metrics;
+    if (loopMetrics_)
     {
-        return std::numeric_limits<int>::max();
+        loopMetrics_->tid.store(core::tid(), std::memory_order_relaxed); // 워커 스레드에서 만든다
+        loopMetrics_->active.store(true, std::memory_order_relaxed);
     }
-    return static_cast<int>(ms64);
 }
 
-void EventLoop::drainTasks() noexcept
+void EventLoop::setIterationEndHook(IterationEndHook hook) noexcept
 {
-    core::TaskQueue::Task task;
-    while (taskQueue_.tryPop(task))
+    iterationEndHook_ = std::move(hook);
+}
+
+bool EventLoop::shouldSpin_(std::int64_t nowNs) const noexcept
+{
+    switch (pollMode_)
     {
-        if (!task)
+    case PollMode::Block:
+        return false;
+    case PollMode::BusyPoll:
+        return true;
+    case PollMode::SpinThenBlock:
+        return nowNs - lastActivityNs_ < spinBudgetNs_;
+    case PollMode::Adaptive:
+        // 최근 이벤트 간격이 spin 예산 안일 때만, 다음 도착 예상 시점(간격의 2배)까지 spin
+        if (ewmaGapNs_ > spinBudgetNs_)
         {
-            continue;
+            return false;
         }
-        try
+        return nowNs - lastActivityNs_ < std::min(spinBudgetNs_, 2 * ewmaGapNs_);
+    }
+    return false;
+}
+
+int EventLoop::pollReady_(int maxEvents) noexcept
+{
+    const std::int64_t t0 = toNs(core::TimerWheel::Clock::now());
+    std::int64_t timeoutNs = shouldSpin_(t0) ? 0 : computePollTimeoutNs_(t0);
+    if (timeoutNs != 0)
+    {
+        // 잠들기 전에 플래그를 세우고 큐/inbound 채널을 다시 본다. (push 와 seq_cst 로 짝: 둘 중 하나는 상대를 봄)
+        sleeping_.store(true, std::memory_order_seq_cst);
+        if (!taskQueue_.empty() || (mesh_ && mesh_->hasInbound(meshWorkerId_)))
         {
-            task();
+            timeoutNs = 0;
         }
-        catch (const std::exception &e)
+    }
+
+    // io_uring: 이번 iteration 동안 쌓인 SQE(recv 재무장/send/cancel)를 wait 과 함께 1회 submit
+    const int n = uring_ ? uring_->waitNs(readyEvents_.data(), maxEvents, timeoutNs)
+                         : reactor_.waitNs(readyEvents_.data(), maxEvents, timeoutNs);
+
+    sleeping_.store(false, std::memory_order_relaxed);
+
+    // 이번 iteration 의 기준 시각: handler/타이머가 clock 을 다시 읽지 않도록 캐시한다.
+    now_ = core::TimerWheel::Clock::now();
+    const std::int64_t t1 = toNs(now_);
+    pollWaitNs_ = t1 - t0;
+    if (n > 0)
+    {
+        // EWMA(1/8): 활동 간격이 짧을수록 Adaptive 가 spin 을 유지한다.
+        // - 첫 이벤트는 간격이 없으므로(기준 시각 0 → uptime 전체) 시각만 기록한다.
+        if (lastActivityNs_ != 0)
         {
-            SLOG_ERROR("EventLoop", "TaskException", "what='{}'", e.what());
+            const std::int64_t gap = t1 - lastActivityNs_;
+            ewmaGapNs_ += (gap - ewmaGapNs_) / 8;
         }
-        catch (...)
+        lastActivityNs_ = t1;
+    }
+
+    if (loopMetrics_)
+    {
+        if (timeoutNs != 0)
+        {
+            monitoring::WorkerLoopMetrics::add(loopMetrics_->blockNsTotal,
+                                               static_cast<std::uint64_t>(t1 - t0));
+        }
+        else if (n == 0)
         {
-            SLOG_ERROR("EventLoop", "TaskUnknownException");
+            monitoring::WorkerLoopMetrics::add(loopMetrics_->spinNsTotal,
+                                               static_cast<std::uint64_t>(t1 - t0));
+        }
+    }
+    return n;
+}
+
+void EventLoop::prefetchDispatch_(int index, int count) const noexcept
+{
+    // 2단계 prefetch: index 의 슬롯은 직전 호출에서 당겨 두었으므로 handler 주소를 읽어
+    // 객체(vptr/상태)를 당기고, index+1 의 슬롯을 새로 당긴다.
+    if (index < count)
+    {
+        const int fd = readyEvents_[static_cast<std::size_t>(index)].fd;
+        if (fd >= 0 && static_cast<std::size_t>(fd) < fdContexts_.size())
+        {
+            if (const IFdHandler *handler = fdContexts_[static_cast<std::size_t>(fd)].handler)
+            {
+                __builtin_prefetch(handler);
+            }
+        }
+    }
+    if (index + 1 < count)
+    {
+        const int fd = readyEvents_[static_cast<std::size_t>(index + 1)].fd;
+        if (fd >= 0 && static_cast<std::size_t>(fd) < fdContexts_.size())
+        {
+            __builtin_prefetch(&fdContexts_[static_cast<std::size_t>(fd)]);
         }
     }
 }
 
 void EventLoop::runOnce() noexcept
 {
-    drainTasks();
-    timerWheel_.tick(core::TimerWheel::Clock::now());
+    const std::int64_t iterStartNs = latencyMetrics_ ? monitoring::latencyNowNs() : 0;
 
-    const int timeoutMs = computePollTimeoutMs();
-    const int maxEvents = static_cast<int>(readyEvents_.size());
+    std::size_t tasks = drainTasks();
+    now_ = core::TimerWheel::Clock::now();
+    timerWheel_.tick(now_);
 
-    int n = reactor_.wait(readyEvents_.data(), maxEvents, timeoutMs);
+    // 위 task/타이머가 적재한 송신(다른 워커의 send, heartbeat 등)은 잠들기 전에 내보낸다.
+    // (pollReady_ 는 타이머가 없으면 무기한 대기하므로 iteration 끝까지 미루면 다음 I/O 까지 묶임)
+    if (iterationEndHook_)
+    {
+        iterationEndHook_();
+    }
+
+    const int maxEvents = static_cast<int>(readyEvents_.size());
+    const int n = pollReady_(maxEvents);
     if (n > 0)
     {
+        const std::int64_t pollReturnNs = toNs(now_);
+        prefetchDispatch_(0, n);
         for (int i = 0; i < n; ++i)
         {
+            prefetchDispatch_(i + 1, n);
             const auto &ev = readyEvents_[i];
 
-            auto it = fdContexts_.find(ev.fd);
-            if (it == fdContexts_.end() || !it->second.handler)
+            if (uring_ && !uring_->isCurrent(ev.fd, ev.generation))
+            {
+                continue; // 앞선 이벤트 처리 중 해제(또는 재사용)된 fd
+            }
+
+            FdContext *ctx = (ev.fd >= 0 && static_cast<std::size_t>(ev.fd) < fdContexts_.size())
+                                 ? &fdContexts_[static_cast<std::size_t>(ev.fd)]
+                                 : nullptr;
+            if (ctx && !uring_ && ctx->generation != ev.generation)
+            {
+                // 앞선 이벤트 처리 중 해제(또는 재사용)된 fd 의 지연 이벤트
+                SLOG_TRACE("EventLoop", "StaleEvent", "fd={} gen={} current_gen={}", ev.fd,
+                           ev.generation, ctx->generation);
+                continue;
+            }
+            if (!ctx || !ctx->handler)
             {
                 SLOG_WARN("EventLoop", "EventWithoutContext", "fd={} events=0x{:x}", ev.fd,
                           ev.events);
                 continue;
             }
 
-            const FdContext ctx = it->second;
-            IFdHandler *handler = ctx.handler;
+            // handler 안에서 addFd 가 vector 를 키울 수 있으므로 참조를 들고 호출하지 않는다.
+            IFdHandler *handler = ctx->handler;
+            const char *tag = ctx->tag;
 
             SLOG_TRACE("EventLoop", "Dispatch",
                        "fd={} tag={} id={} owner=0x{:x} reg_events=0x{:x} ready_events=0x{:x}",
-                       ev.fd, ctx.tag, ctx.debugId, ctx.ownerPtr, ctx.registeredEvents, ev.events);
+                       ev.fd, tag, ctx->debugId, ctx->ownerPtr, ctx->registeredEvents, ev.events);
+
+            if (latencyMetrics_)
+            {
+                latencyMetrics_->dispatchDelay.record(monitoring::latencyNowNs() - pollReturnNs);
+            }
 
             try
             {
@@ -474,12 +747,12 @@ void EventLoop::runOnce() noexcept
             }
             catch (const std::exception &e)
             {
-                SLOG_ERROR("EventLoop", "HandlerException", "fd={} tag={} what='{}'", ev.fd,
-                           ctx.tag, e.what());
+                SLOG_ERROR("EventLoop", "HandlerException", "fd={} tag={} what='{}'", ev.fd, tag,
+                           e.what());
             }
             catch (...)
             {
-                SLOG_ERROR("EventLoop", "HandlerUnknownException", "fd={} tag={}", ev.fd, ctx.tag);
+                SLOG_ERROR("EventLoop", "HandlerUnknownException", "fd={} tag={}", ev.fd, tag);
             }
         }
     }
@@ -491,8 +764,19 @@ void EventLoop::runOnce() noexcept
         }
     }
 
-    timerWheel_.tick(core::TimerWheel::Clock::now());
-    drainTasks();
+    timerWheel_.tick(now_);
+    tasks += drainTasks();
+
+    if (iterationEndHook_)
+    {
+        iterationEndHook_();
+    }
+
+    // 일을 한 iteration 만 잰다. (빈 spin/timeout 이 분포를 덮지 않도록, reactor 대기 시간은 뺌)
+    if (latencyMetrics_ && (n > 0 || tasks > 0))
+    {
+        latencyMetrics_->loopIteration.record(monitoring::latencyNowNs() - iterStartNs - pollWaitNs_);
+    }
 }
 
 void EventLoop::run(std::atomic_bool &runningFlag) noexcept
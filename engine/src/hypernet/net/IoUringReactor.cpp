@@ -0,0 +1,769 @@
+#include <hypernet/net/IoUringReactor.hpp>
+
+#include <hypernet/core/Logger.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <system_error>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace hypernet::net
+{
+
+namespace
+{
+
+constexpr std::uint16_t kRecvBufGroup = 0;
+constexpr std::uint32_t kGenMask = 0x00FF'FFFFU; // user_data 상위 24bit
+constexpr unsigned int kMaxBufRingEntries = 32768;
+
+// poll 을 걸어야 하는 readiness 비트 (ERR/HUP 는 커널이 항상 보고)
+constexpr std::uint32_t kReadinessMask = EPOLLIN | EPOLLOUT | EPOLLPRI | EPOLLRDHUP;
+// multishot poll 에 의미 없는 epoll 전용 비트
+constexpr std::uint32_t kEpollOnlyBits = EPOLLET | EPOLLONESHOT;
+
+int sysSetup(unsigned int entries, ::io_uring_params *p) noexcept
+{
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+}
+
+int sysEnter(int fd, unsigned int toSubmit, unsigned int minComplete, unsigned int flags,
+             const void *arg, std::size_t argSize) noexcept
+{
+    return static_cast<int>(
+        ::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, arg, argSize));
+}
+
+int sysRegister(int fd, unsigned int opcode, const void *arg, unsigned int nrArgs) noexcept
+{
+    return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, arg, nrArgs));
+}
+
+template <typename T> T loadAcquire(T *p) noexcept
+{
+    return std::atomic_ref<T>(*p).load(std::memory_order_acquire);
+}
+
+template <typename T> void storeRelease(T *p, T v) noexcept
+{
+    std::atomic_ref<T>(*p).store(v, std::memory_order_release);
+}
+
+constexpr std::uint8_t kindBit(std::uint8_t kind) noexcept
+{
+    return static_cast<std::uint8_t>(1U << kind);
+}
+
+[[noreturn]] void throwSysError(int err, const char *what)
+{
+    throw std::system_error(err, std::generic_category(), what);
+}
+
+} // namespace
+
+IoUringReactor::IoUringReactor(unsigned int entries, std::size_t recvBufferCount,
+                               std::size_t recvBufferSize)
+    : recvBufferSize_(recvBufferSize)
+{
+    if (entries == 0)
+    {
+        entries = 256;
+    }
+    if (recvBufferCount == 0 || recvBufferCount > kMaxBufRingEntries ||
+        (recvBufferCount & (recvBufferCount - 1)) != 0)
+    {
+        throwSysError(EINVAL, "IoUringReactor: recvBufferCount must be a power of two <= 32768");
+    }
+    if (recvBufferSize_ == 0 || recvBufferSize_ > std::numeric_limits<std::uint32_t>::max())
+    {
+        throwSysError(EINVAL, "IoUringReactor: invalid recvBufferSize");
+    }
+
+    ::io_uring_params p{};
+    p.flags = IORING_SETUP_CQSIZE | IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN |
+              IORING_SETUP_TASKRUN_FLAG;
+    p.cq_entries = entries * 4;
+    ringFd_ = sysSetup(entries, &p);
+    if (ringFd_ < 0 && errno == EINVAL)
+    {
+        // 구형 커널: SUBMIT_ALL/COOP_TASKRUN 미지원 → 최소 플래그로 재시도
+        p = ::io_uring_params{};
+        p.flags = IORING_SETUP_CQSIZE;
+        p.cq_entries = entries * 4;
+        ringFd_ = sysSetup(entries, &p);
+    }
+    if (ringFd_ < 0)
+    {
+        throwSysError(errno, "IoUringReactor: io_uring_setup failed");
+    }
+
+    if (!(p.features & IORING_FEAT_SINGLE_MMAP) || !(p.features & IORING_FEAT_EXT_ARG) ||
+        !(p.features & IORING_FEAT_NODROP))
+    {
+        release_();
+        throwSysError(ENOSYS, "IoUringReactor: kernel lacks SINGLE_MMAP/EXT_ARG/NODROP");
+    }
+
+    // ===== SQ/CQ ring mmap (SINGLE_MMAP) =====
+    const std::size_t sqSize = p.sq_off.array + p.sq_entries * sizeof(unsigned int);
+    const std::size_t cqSize = p.cq_off.cqes + p.cq_entries * sizeof(::io_uring_cqe);
+    ringMemSize_ = std::max(sqSize, cqSize);
+    ringMem_ = ::mmap(nullptr, ringMemSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ringFd_, IORING_OFF_SQ_RING);
+    if (ringMem_ == MAP_FAILED)
+    {
+        const int e = errno;
+        ringMem_ = nullptr;
+        release_();
+        throwSysError(e, "IoUringReactor: mmap(SQ/CQ ring) failed");
+    }
+
+    auto *base = static_cast<std::byte *>(ringMem_);
+    sqHead_ = reinterpret_cast<unsigned int *>(base + p.sq_off.head);
+    sqTail_ = reinterpret_cast<unsigned int *>(base + p.sq_off.tail);
+    sqFlags_ = reinterpret_cast<unsigned int *>(base + p.sq_off.flags);
+    sqMask_ = *reinterpret_cast<unsigned int *>(base + p.sq_off.ring_mask);
+    sqEntries_ = p.sq_entries;
+    auto *sqArray = reinterpret_cast<unsigned int *>(base + p.sq_off.array);
+    for (unsigned int i = 0; i < sqEntries_; ++i)
+    {
+        sqArray[i] = i; // SQE 슬롯과 1:1 고정 매핑
+    }
+    sqLocalTail_ = sqSubmitted_ = *sqTail_;
+
+    cqHead_ = reinterpret_cast<unsigned int *>(base + p.cq_off.head);
+    cqTail_ = reinterpret_cast<unsigned int *>(base + p.cq_off.tail);
+    cqMask_ = *reinterpret_cast<unsigned int *>(base + p.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<::io_uring_cqe *>(base + p.cq_off.cqes);
+
+    sqesSize_ = p.sq_entries * sizeof(::io_uring_sqe);
+    void *sqes = ::mmap(nullptr, sqesSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        ringFd_, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED)
+    {
+        const int e = errno;
+        release_();
+        throwSysError(e, "IoUringReactor: mmap(SQEs) failed");
+    }
+    sqes_ = static_cast<::io_uring_sqe *>(sqes);
+
+    // ===== provided buffer ring (multishot recv 용) =====
+    bufCount_ = static_cast<std::uint16_t>(recvBufferCount);
+    bufRingSize_ = recvBufferCount * sizeof(::io_uring_buf);
+    void *ring = ::mmap(nullptr, bufRingSize_, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+    if (ring == MAP_FAILED)
+    {
+        const int e = errno;
+        release_();
+        throwSysError(e, "IoUringReactor: mmap(buf ring) failed");
+    }
+    bufRing_ = static_cast<::io_uring_buf_ring *>(ring);
+
+    ::io_uring_buf_reg reg{};
+    reg.ring_addr = reinterpret_cast<std::uint64_t>(bufRing_);
+    reg.ring_entries = static_cast<std::uint32_t>(recvBufferCount);
+    reg.bgid = kRecvBufGroup;
+    if (sysRegister(ringFd_, IORING_REGISTER_PBUF_RING, &reg, 1) < 0)
+    {
+        const int e = errno;
+        release_();
+        throwSysError(e, "IoUringReactor: IORING_REGISTER_PBUF_RING failed");
+    }
+
+    try
+    {
+        recvBuffers_.resize(recvBufferCount * recvBufferSize_);
+        pendingRecycle_.reserve(recvBufferCount);
+        for (std::size_t bid = 0; bid < recvBufferCount; ++bid)
+        {
+            pendingRecycle_.push_back(static_cast<std::uint16_t>(bid));
+        }
+    }
+    catch (...)
+    {
+        release_();
+        throw;
+    }
+    recycleBuffers_();
+
+    SLOG_INFO("IoUringReactor", "Created",
+              "fd={} sq_entries={} cq_entries={} features=0x{:x} recv_bufs={} recv_buf_size={}",
+              ringFd_, p.sq_entries, p.cq_entries, p.features, recvBufferCount, recvBufferSize_);
+}
+
+IoUringReactor::~IoUringReactor() noexcept
+{
+    const int fd = ringFd_;
+    release_();
+    SLOG_INFO("IoUringReactor", "Closed", "fd={} orphan_sends={}", fd, orphanSends_.size());
+}
+
+void IoUringReactor::release_() noexcept
+{
+    // ring fd 를 먼저 닫아 커널의 남은 요청을 정리한 뒤 매핑을 해제한다.
+    if (ringFd_ >= 0)
+    {
+        ::close(ringFd_);
+        ringFd_ = -1;
+    }
+    if (bufRing_)
+    {
+        ::munmap(bufRing_, bufRingSize_);
+        bufRing_ = nullptr;
+    }
+    if (sqes_)
+    {
+        ::munmap(sqes_, sqesSize_);
+        sqes_ = nullptr;
+    }
+    if (ringMem_)
+    {
+        ::munmap(ringMem_, ringMemSize_);
+        ringMem_ = nullptr;
+    }
+}
+
+std::uint64_t IoUringReactor::makeUserData_(Fd fd, OpKind kind, std::uint32_t gen) noexcept
+{
+    return (static_cast<std::uint64_t>(gen & kGenMask) << 40) |
+           (static_cast<std::uint64_t>(kind) << 32) |
+           static_cast<std::uint64_t>(static_cast<std::uint32_t>(fd));
+}
+
+IoUringReactor::FdSlot *IoUringReactor::slot_(Fd fd, bool create) noexcept
+{
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+    const auto idx = static_cast<std::size_t>(fd);
+    if (idx >= slots_.size())
+    {
+        if (!create)
+        {
+            return nullptr;
+        }
+        try
+        {
+            slots_.resize(std::max(idx + 1, slots_.size() * 2));
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+    return &slots_[idx];
+}
+
+::io_uring_sqe *IoUringReactor::getSqe_() noexcept
+{
+    if (sqLocalTail_ - loadAcquire(sqHead_) >= sqEntries_)
+    {
+        // SQ 가득 참: 누적분을 즉시 submit 해서 슬롯을 비운다.
+        (void)submitPending_(0, 0, nullptr);
+        if (sqLocalTail_ - loadAcquire(sqHead_) >= sqEntries_)
+        {
+            errno = EBUSY;
+            SLOG_ERROR("IoUringReactor", "SqFull", "entries={}", sqEntries_);
+            return nullptr;
+        }
+    }
+
+    ::io_uring_sqe *sqe = &sqes_[sqLocalTail_ & sqMask_];
+    std::memset(sqe, 0, sizeof(*sqe));
+    ++sqLocalTail_;
+    return sqe;
+}
+
+int IoUringReactor::submitPending_(unsigned int minComplete, unsigned int flags,
+                                   const void *arg) noexcept
+{
+    const unsigned int toSubmit = sqLocalTail_ - sqSubmitted_;
+    storeRelease(sqTail_, sqLocalTail_);
+
+    if (toSubmit == 0 && !(flags & IORING_ENTER_GETEVENTS))
+    {
+        return 0;
+    }
+
+    if (arg)
+    {
+        flags |= IORING_ENTER_EXT_ARG;
+    }
+
+    const int r = sysEnter(ringFd_, toSubmit, minComplete, flags, arg,
+                           arg ? sizeof(::io_uring_getevents_arg) : 0);
+    if (r < 0)
+    {
+        return -1;
+    }
+    sqSubmitted_ += static_cast<unsigned int>(r);
+    return r;
+}
+
+bool IoUringReactor::armPoll_(Fd fd, FdSlot &s) noexcept
+{
+    ::io_uring_sqe *sqe = getSqe_();
+    if (!sqe)
+    {
+        return false;
+    }
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->len = IORING_POLL_ADD_MULTI;
+    sqe->poll32_events = s.pollEvents & ~kEpollOnlyBits;
+    sqe->user_data = makeUserData_(fd, OpKind::Poll, s.gen);
+    s.armed |= kindBit(static_cast<std::uint8_t>(OpKind::Poll));
+    return true;
+}
+
+void IoUringReactor::prepCancel_(std::uint64_t target) noexcept
+{
+    ::io_uring_sqe *sqe = getSqe_();
+    if (!sqe)
+    {
+        SLOG_ERROR("IoUringReactor", "CancelPrepFailed", "target=0x{:x}", target);
+        return;
+    }
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = target;
+    sqe->flags = IOSQE_CQE_SKIP_SUCCESS;
+    sqe->user_data = makeUserData_(0, OpKind::Cancel, 0);
+}
+
+bool IoUringReactor::registerFd(Fd fd, std::uint32_t events) noexcept
+{
+    FdSlot *s = slot_(fd, /*create=*/true);
+    if (!s)
+    {
+        errno = (fd < 0) ? EBADF : ENOMEM;
+        SLOG_ERROR("IoUringReactor", "RegisterFdFailed", "fd={} errno={}", fd, errno);
+        return false;
+    }
+    if (s->registered)
+    {
+        errno = EEXIST;
+        SLOG_ERROR("IoUringReactor", "RegisterFdFailed", "reason=AlreadyRegistered fd={}", fd);
+        return false;
+    }
+
+    s->registered = true;
+    s->pollEvents = events;
+    s->armed = 0;
+
+    if (events & kReadinessMask)
+    {
+        return armPoll_(fd, *s);
+    }
+    return true;
+}
+
+bool IoUringReactor::modifyFd(Fd fd, std::uint32_t events) noexcept
+{
+    FdSlot *s = slot_(fd, /*create=*/false);
+    if (!s || !s->registered)
+    {
+        errno = ENOENT;
+        SLOG_ERROR("IoUringReactor", "ModifyFdFailed", "reason=NotRegistered fd={}", fd);
+        return false;
+    }
+
+    s->pollEvents = events;
+
+    if (s->armed & kindBit(static_cast<std::uint8_t>(OpKind::Poll)))
+    {
+        // 살아있는 multishot poll 의 마스크만 교체한다(취소/재등록 CQE 경합 없음).
+        ::io_uring_sqe *sqe = getSqe_();
+        if (!sqe)
+        {
+            return false;
+        }
+        sqe->opcode = IORING_OP_POLL_REMOVE;
+        sqe->fd = -1;
+        sqe->addr = makeUserData_(fd, OpKind::Poll, s->gen);
+        sqe->len = IORING_POLL_UPDATE_EVENTS | IORING_POLL_ADD_MULTI;
+        sqe->poll32_events = events & ~kEpollOnlyBits;
+        sqe->flags = IOSQE_CQE_SKIP_SUCCESS;
+        sqe->user_data = makeUserData_(fd, OpKind::Cancel, s->gen);
+        return true;
+    }
+
+    if (events & kReadinessMask)
+    {
+        return armPoll_(fd, *s);
+    }
+    return true;
+}
+
+bool IoUringReactor::unregisterFd(Fd fd) noexcept
+{
+    FdSlot *s = slot_(fd, /*create=*/false);
+    if (!s || !s->registered)
+    {
+        errno = ENOENT;
+        SLOG_WARN("IoUringReactor", "UnregisterFdFailed", "reason=NotRegistered fd={}", fd);
+        return false;
+    }
+
+    for (const OpKind kind : {OpKind::Poll, OpKind::Accept, OpKind::Recv})
+    {
+        if (s->armed & kindBit(static_cast<std::uint8_t>(kind)))
+        {
+            prepCancel_(makeUserData_(fd, kind, s->gen));
+        }
+    }
+
+    if (s->sendInFlight)
+    {
+        try
+        {
+            orphanSends_.push_back(OrphanSend{makeUserData_(fd, OpKind::Send, s->gen),
+                                              std::move(s->sendKeepAlive), std::move(s->sendMsg)});
+        }
+        catch (...)
+        {
+            // 보관 실패 시 keepAlive/msghdr 를 의도적으로 누수시켜 커널이 읽을 메모리를 보존한다.
+            new (std::nothrow) std::shared_ptr<void>(std::move(s->sendKeepAlive));
+            (void)s->sendMsg.release();
+            SLOG_ERROR("IoUringReactor", "OrphanSendStoreFailed", "fd={}", fd);
+        }
+    }
+
+    s->sendInFlight = false;
+    s->sendKeepAlive.reset();
+    s->armed = 0;
+    s->pollEvents = 0;
+    s->registered = false;
+    s->gen = (s->gen + 1) & kGenMask;
+    return true;
+}
+
+bool IoUringReactor::armAccept(Fd fd) noexcept
+{
+    FdSlot *s = slot_(fd, /*create=*/false);
+    if (!s || !s->registered)
+    {
+        errno = ENOENT;
+        return false;
+    }
+    ::io_uring_sqe *sqe = getSqe_();
+    if (!sqe)
+    {
+        return false;
+    }
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = fd;
+    sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+    sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+    sqe->user_data = makeUserData_(fd, OpKind::Accept, s->gen);
+    s->armed |= kindBit(static_cast<std::uint8_t>(OpKind::Accept));
+    return true;
+}
+
+bool IoUringReactor::armRecv(Fd fd) noexcept
+{
+    FdSlot *s = slot_(fd, /*create=*/false);
+    if (!s || !s->registered)
+    {
+        errno = ENOENT;
+        return false;
+    }
+    ::io_uring_sqe *sqe = getSqe_();
+    if (!sqe)
+    {
+        return false;
+    }
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = fd;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = kRecvBufGroup;
+    sqe->user_data = makeUserData_(fd, OpKind::Recv, s->gen);
+    s->armed |= kindBit(static_cast<std::uint8_t>(OpKind::Recv));
+    return true;
+}
+
+bool IoUringReactor::submitSend(Fd fd, const ::iovec *iov, int iovcnt,
+                                std::shared_ptr<void> keepAlive) noexcept
+{
+    FdSlot *s = slot_(fd, /*create=*/false);
+    if (!s || !s->registered)
+    {
+        errno = ENOENT;
+        return false;
+    }
+    if (!iov || iovcnt <= 0 || iovcnt > kMaxSendIov)
+    {
+        errno = EINVAL;
+        return false;
+    }
+    if (s->sendInFlight)
+    {
+        errno = EBUSY; // fd 당 SENDMSG 는 1개만 허용(순서 보장)
+        return false;
+    }
+    if (!s->sendMsg)
+    {
+        s->sendMsg.reset(new (std::nothrow) SendMsg{});
+        if (!s->sendMsg)
+        {
+            errno = ENOMEM;
+            return false;
+        }
+    }
+    ::io_uring_sqe *sqe = getSqe_();
+    if (!sqe)
+    {
+        return false;
+    }
+
+    // SQE 는 wait() 에서 submit 되므로 msghdr/iovec 은 CQE 까지 슬롯(해제 후엔 OrphanSend)에 둔다.
+    SendMsg &m = *s->sendMsg;
+    std::copy(iov, iov + iovcnt, m.iov);
+    m.hdr = ::msghdr{};
+    m.hdr.msg_iov = m.iov;
+    m.hdr.msg_iovlen = static_cast<std::size_t>(iovcnt);
+
+    sqe->opcode = IORING_OP_SENDMSG;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<std::uint64_t>(&m.hdr);
+    sqe->len = 1;
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = makeUserData_(fd, OpKind::Send, s->gen);
+
+    s->sendInFlight = true;
+    s->sendKeepAlive = std::move(keepAlive);
+    return true;
+}
+
+void IoUringReactor::onSendCompleted_(Fd fd, std::uint32_t gen, FdSlot *s) noexcept
+{
+    if (s)
+    {
+        s->sendInFlight = false;
+        s->sendKeepAlive.reset();
+        return;
+    }
+
+    const std::uint64_t key = makeUserData_(fd, OpKind::Send, gen);
+    for (std::size_t i = 0; i < orphanSends_.size(); ++i)
+    {
+        if (orphanSends_[i].key != key)
+        {
+            continue;
+        }
+        orphanSends_[i] = std::move(orphanSends_.back());
+        orphanSends_.pop_back();
+        return;
+    }
+}
+
+void IoUringReactor::recycleBuffers_() noexcept
+{
+    if (pendingRecycle_.empty())
+    {
+        return;
+    }
+
+    // 주의: C++ 에서 uapi 의 __DECLARE_FLEX_ARRAY(bufs) 는 빈 struct 때문에 8byte 밀려 배치된다.
+    //       ring 은 io_uring_buf 배열 그 자체이므로 bufs 멤버 대신 직접 인덱싱한다.
+    auto *bufs = reinterpret_cast<::io_uring_buf *>(bufRing_);
+    const std::uint16_t mask = static_cast<std::uint16_t>(bufCount_ - 1);
+    for (const std::uint16_t bid : pendingRecycle_)
+    {
+        ::io_uring_buf &b = bufs[bufTail_ & mask];
+        b.addr = reinterpret_cast<std::uint64_t>(recvBuffers_.data() +
+                                                 static_cast<std::size_t>(bid) * recvBufferSize_);
+        b.len = static_cast<std::uint32_t>(recvBufferSize_);
+        b.bid = bid;
+        ++bufTail_;
+    }
+    pendingRecycle_.clear();
+    storeRelease(&bufRing_->tail, bufTail_);
+}
+
+int IoUringReactor::waitNs(ReadyEvent *outEvents, int maxEvents, std::int64_t timeoutNs) noexcept
+{
+    if (ringFd_ < 0)
+    {
+        errno = EBADF;
+        SLOG_ERROR("IoUringReactor", "WaitFailed", "reason=InvalidRingFd");
+        return -1;
+    }
+    if (!outEvents || maxEvents <= 0)
+    {
+        errno = EINVAL;
+        SLOG_ERROR("IoUringReactor", "WaitFailed", "reason=InvalidArgs");
+        return -1;
+    }
+
+    // 직전 wait() 에서 넘긴 recv 데이터는 디스패치가 끝났으므로 이제 반납한다.
+    recycleBuffers_();
+
+    const bool cqReady = (*cqHead_ != loadAcquire(cqTail_));
+    int r = 0;
+    if (cqReady)
+    {
+        r = submitPending_(0, 0, nullptr);
+    }
+    else if (timeoutNs == 0)
+    {
+        // busy-poll: COOP_TASKRUN 에서는 커널 진입 없이 완료가 게시되지 않으므로,
+        // 커널이 task work(또는 CQ overflow)를 알린 경우에만 GETEVENTS 로 진입한다.
+        const unsigned int sqFlags = loadAcquire(sqFlags_);
+        const bool needEnter = (sqFlags & (IORING_SQ_TASKRUN | IORING_SQ_CQ_OVERFLOW)) != 0;
+        r = submitPending_(0, needEnter ? IORING_ENTER_GETEVENTS : 0U, nullptr);
+    }
+    else
+    {
+        ::__kernel_timespec ts{};
+        ::io_uring_getevents_arg arg{};
+        if (timeoutNs > 0)
+        {
+            ts.tv_sec = timeoutNs / 1'000'000'000;
+            ts.tv_nsec = timeoutNs % 1'000'000'000;
+            arg.ts = reinterpret_cast<std::uint64_t>(&ts);
+        }
+        r = submitPending_(1, IORING_ENTER_GETEVENTS, &arg);
+    }
+
+    if (r < 0)
+    {
+        if (errno == EINTR)
+        {
+            SLOG_DEBUG("IoUringReactor", "WaitInterrupted", "reason=EINTR");
+            return -1;
+        }
+        if (errno != ETIME && errno != EBUSY && errno != EAGAIN)
+        {
+            SLOG_ERROR("IoUringReactor", "EnterFailed", "errno={} msg='{}'", errno,
+                       std::strerror(errno));
+            return -1;
+        }
+        // ETIME: 타임아웃, EBUSY/EAGAIN: CQ 적체 → 아래에서 CQE 를 수거하면 해소된다.
+    }
+
+    unsigned int head = *cqHead_;
+    const unsigned int tail = loadAcquire(cqTail_);
+    int n = 0;
+
+    while (head != tail && n < maxEvents)
+    {
+        const ::io_uring_cqe &cqe = cqes_[head & cqMask_];
+        ++head;
+
+        const std::uint64_t ud = cqe.user_data;
+        const Fd fd = static_cast<Fd>(static_cast<std::uint32_t>(ud));
+        const auto kind = static_cast<OpKind>((ud >> 32) & 0xFFU);
+        const auto gen = static_cast<std::uint32_t>(ud >> 40);
+        const bool more = (cqe.flags & IORING_CQE_F_MORE) != 0;
+
+        const bool hasBuffer = (cqe.flags & IORING_CQE_F_BUFFER) != 0;
+        const auto bid = static_cast<std::uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+        if (hasBuffer)
+        {
+            pendingRecycle_.push_back(bid);
+        }
+
+        if (kind == OpKind::Cancel)
+        {
+            continue;
+        }
+
+        FdSlot *s = slot_(fd, /*create=*/false);
+        const bool live = s && s->registered && s->gen == gen;
+
+        ReadyEvent &ev = outEvents[n];
+        ev = ReadyEvent{};
+        ev.fd = fd;
+        ev.generation = gen;
+        ev.more = more;
+        ev.result = cqe.res;
+
+        switch (kind)
+        {
+        case OpKind::Poll:
+            if (!live)
+            {
+                continue;
+            }
+            if (!more)
+            {
+                s->armed &= static_cast<std::uint8_t>(~kindBit(static_cast<std::uint8_t>(kind)));
+                if (cqe.res != -ECANCELED)
+                {
+                    (void)armPoll_(fd, *s); // multishot 종료(오버플로 등) → 재무장
+                }
+            }
+            if (cqe.res == -ECANCELED)
+            {
+                continue;
+            }
+            ev.events = (cqe.res < 0) ? static_cast<std::uint32_t>(EPOLLERR)
+                                      : static_cast<std::uint32_t>(cqe.res);
+            break;
+
+        case OpKind::Accept:
+            if (!live)
+            {
+                if (cqe.res >= 0)
+                {
+                    ::close(cqe.res); // 리스너 해제 이후 도착한 연결
+                }
+                continue;
+            }
+            if (!more)
+            {
+                s->armed &= static_cast<std::uint8_t>(~kindBit(static_cast<std::uint8_t>(kind)));
+            }
+            ev.completion = Completion::Accept;
+            break;
+
+        case OpKind::Recv:
+            if (!live)
+            {
+                continue;
+            }
+            if (!more)
+            {
+                s->armed &= static_cast<std::uint8_t>(~kindBit(static_cast<std::uint8_t>(kind)));
+            }
+            ev.completion = Completion::Recv;
+            if (hasBuffer && cqe.res > 0)
+            {
+                ev.data = recvBuffers_.data() + static_cast<std::size_t>(bid) * recvBufferSize_;
+            }
+            break;
+
+        case OpKind::Send:
+            onSendCompleted_(fd, gen, live ? s : nullptr);
+            if (!live)
+            {
+                continue;
+            }
+            ev.completion = Completion::Send;
+            break;
+
+        default:
+            continue;
+        }
+
+        ++n;
+    }
+
+    storeRelease(cqHead_, head);
+    return n;
+}
+
+} // namespace hypernet::net
@@ -2,11 +2,16 @@
 #include <hypernet/net/Session.hpp>
 #include <hypernet/monitoring/Metrics.hpp>
 #include <hypernet/buffer/RingBuffer.hpp>
+#include <hypernet/core/Defaults.hpp>
 #include <hypernet/core/Logger.hpp>
 #include <hypernet/core/ThreadContext.hpp>
 #include <hypernet/net/EventLoop.hpp>
 #include <hypernet/net/SessionManager.hpp>
+#include <hypernet/net/SessionMigration.hpp>
+#include <hypernet/net/SessionPool.hpp>
 #include <hypernet/protocol/BuiltinOpcodes.hpp>
+#include <linux/errqueue.h> // sock_extended_err, SO_EE_ORIGIN_ZEROCOPY
+#include <netinet/in.h>       // IP_RECVERR, IPV6_RECVERR
 #include <sys/socket.h> // recvmsg
 #include <sys/uio.h>    // iovec
 #include <cerrno>
@@ -38,6 +43,7 @@ Session::Session(PrivateTag, SessionHandle handle, int ownerWorkerId, Socket &&s
       sendRingCapacity_(sendRingCapacity)
 {
     lastRxAt_ = std::chrono::steady_clock::now();
+    residentSince_ = lastRxAt_;
 }
 
 Session::~Session()
@@ -50,42 +56,43 @@ Session::~Session()
                   socket_.nativeHandle(), handle_.id());
         socket_.close();
     }
+
+    // 링은 풀로 돌려보낸다. (다른 스레드에서 파괴되면 풀이 그냥 해제)
+    releaseRing_(recvRing_, recvRingCapacity_);
+    releaseRing_(sendRing_, sendRingCapacity_);
+
+    // overflow 큐는 close 경로에서 반납된다. 닫히지 않고 파괴된 경우엔 힙 블록만 해제한다.
+    // (풀 블록은 SessionManager 풀 저장소 소유)
+    for (const auto &b : sendQueue_)
+    {
+        if (!b.pooled)
+            ::operator delete(b.mem);
+    }
 }
 std::shared_ptr<Session> Session::create(SessionHandle handle, int ownerWorkerId, Socket &&socket,
                                          SessionManager *ownerManager, std::size_t recvRingCapacity,
-                                         std::size_t sendRingCapacity)
+                                         std::size_t sendRingCapacity, bool mirroredRings,
+                                         const std::shared_ptr<SessionPool> &pool)
 {
     // 생성 경로에서의 예외는 accept 핫패스를 죽이지 않도록 "로그 + 소켓 close + nullptr"로
     // 처리한다.
     try
     {
-        auto s = std::make_shared<Session>(PrivateTag{}, handle, ownerWorkerId, std::move(socket),
-                                           ownerManager, recvRingCapacity, sendRingCapacity);
-        try
+        std::shared_ptr<Session> s;
+        if (pool)
         {
-            s->recvRing_ = std::make_unique<hypernet::buffer::RingBuffer>(recvRingCapacity);
-            s->sendRing_ = std::make_unique<hypernet::buffer::RingBuffer>(sendRingCapacity);
+            s = std::allocate_shared<Session>(SessionPoolAllocator<Session>(pool), PrivateTag{}, handle,
+                                              ownerWorkerId, std::move(socket), ownerManager, recvRingCapacity,
+                                              sendRingCapacity);
         }
-        catch (const std::exception &e)
+        else
         {
-            SLOG_ERROR("Session", "AllocRingsFailed", "sid={} fd={} what='{}'", handle.id(),
-                       s->socket_.nativeHandle(), e.what());
-            s->socket_.close();
-            s->state_ = SessionState::Closed;
-            s->recvRing_.reset();
-            s->sendRing_.reset();
-            return {};
-        }
-        catch (...)
-        {
-            SLOG_ERROR("Session", "AllocRingsFailed", "sid={} fd={} what=unknown", handle.id(),
-                       s->socket_.nativeHandle());
-            s->socket_.close();
-            s->state_ = SessionState::Closed;
-            s->recvRing_.reset();
-            s->sendRing_.reset();
-            return {};
+            s = std::make_shared<Session>(PrivateTag{}, handle, ownerWorkerId, std::move(socket), ownerManager,
+                                          recvRingCapacity, sendRingCapacity);
         }
+        // 링은 여기서 만들지 않는다. (첫 송수신 때 acquireRecvRing_/acquireSendRing_)
+        s->ringsMirrored_ = mirroredRings;
+        s->pool_ = pool;
 
         // 초기 등록 마스크는 SessionManager가 baseEpollMask_()로 등록하는 것을 전제로 한다.
         s->currentEpollMask_ = baseEpollMask_();
@@ -120,7 +127,40 @@ void Session::handleEvent(EventLoop &loop, const EpollReactor::ReadyEvent &ev)
 
     auto self = shared_from_this();
     (void)self;
-    const std::uint32_t events = ev.events;
+
+    // io_uring 백엔드: readiness 가 아니라 완료(recv 데이터/send 바이트 수)가 들어온다.
+    if (ev.completion == EpollReactor::Completion::Recv)
+    {
+        onRecvCompleted_(loop, ev);
+        return;
+    }
+    if (ev.completion == EpollReactor::Completion::Send)
+    {
+        onSendCompleted_(loop, ev);
+        return;
+    }
+
+    std::uint32_t events = ev.events;
+
+    // MSG_ZEROCOPY 완료 통지는 error queue 로 들어와 EPOLLERR 를 올린다.
+    // 통지를 수거한 뒤 실제 소켓 에러(SO_ERROR)가 없으면 EPOLLERR 를 지운다.
+    if ((events & EPOLLERR) && (!zcQueue_.empty() || !zcInFlight_.empty()))
+    {
+        reapZeroCopy_();
+
+        int soErr = 0;
+        ::socklen_t slen = sizeof(soErr);
+        if (::getsockopt(socket_.nativeHandle(), SOL_SOCKET, SO_ERROR, &soErr, &slen) == 0 &&
+            soErr == 0)
+        {
+            events &= ~static_cast<std::uint32_t>(EPOLLERR);
+        }
+        else if (soErr != 0)
+        {
+            beginClose_(loop, "socket_error", soErr);
+            return;
+        }
+    }
 
     // - EPOLLIN|EPOLLRDHUP 동시 발생 시, close/hup 경로보다 onReadable_()를 먼저 호출한다.
     // - ET(EPOLLET)에서는 onReadable_()가 반드시 EAGAIN까지 drain해야 하므로,
@@ -155,41 +195,43 @@ void Session::handleEvent(EventLoop &loop, const EpollReactor::ReadyEvent &ev)
     constexpr std::uint32_t kAfterDrainCloseMask = (EPOLLERR | EPOLLHUP | EPOLLRDHUP);
     if (events & kAfterDrainCloseMask)
     {
-        onError_(loop, ev);
+        EpollReactor::ReadyEvent closeEv = ev;
+        closeEv.events = events;
+        onError_(loop, closeEv);
     }
 }
 
-bool Session::processRecvFrames_(EventLoop &loop) noexcept
+bool Session::processRecvFrames_(EventLoop &loop, hypernet::buffer::RingBuffer &ring) noexcept
 {
     auto &framer = ownerManager_->framer();
-    hypernet::protocol::MessageView msgView{};
+    auto &frames = ownerManager_->frameBatch_;
 
-    for (;;)
-    {
-        const auto r = framer.tryFrame(*recvRing_, msgView);
-
-        if (r == hypernet::protocol::FrameResult::NeedMore)
-        {
-            return true;
-        }
-
-        if (r == hypernet::protocol::FrameResult::Invalid)
-        {
-            const char *reason = ownerManager_->lastFramerErrorReason();
-            SLOG_WARN("Session", "InvalidFrameClose", "sid={} reason='{}'", handle_.id(),
-                      reason ? reason : "(null)");
-            beginClose_(loop, "framer_invalid", 0);
-            return false;
-        }
+    // 링에 있는 완성 프레임을 한 번에 뽑아 배치로 dispatch 한다. (프레임당 owner 확인/메트릭/조회 없음)
+    frames.clear();
+    const auto r = framer.tryFrameBatch(ring, frames);
 
-        // Framed
-        ownerManager_->dispatchOnMessage(handle_, msgView);
+    if (!frames.empty())
+    {
+        ownerManager_->dispatchBatch(*this, frames);
+        frames.clear();
 
         if (state_ != SessionState::Connected)
         {
             return false;
         }
     }
+
+    if (r == hypernet::protocol::FrameResult::Invalid)
+    {
+        const char *reason = ownerManager_->lastFramerErrorReason();
+        SLOG_WARN("Session", "InvalidFrameClose", "sid={} reason='{}'", handle_.id(),
+                  reason ? reason : "(null)");
+        beginClose_(loop, "framer_invalid", 0);
+        return false;
+    }
+
+    // NeedMore/Framed: 완성 프레임은 모두 소비됨
+    return true;
 }
 
 void Session::onReadable_(EventLoop &loop) noexcept
@@ -202,13 +244,6 @@ void Session::onReadable_(EventLoop &loop) noexcept
         return;
     }
 
-    if (!recvRing_)
-    {
-        SLOG_ERROR("Session", "RecvRingNull", "sid={} reason=OOM?", handle_.id());
-        beginClose_(loop, "recv_ring_null", 0);
-        return;
-    }
-
     if (!ownerManager_)
     {
         SLOG_FATAL("Session", "OwnerManagerNull", "sid={} reason=BUG", handle_.id());
@@ -220,15 +255,21 @@ void Session::onReadable_(EventLoop &loop) noexcept
     // EPOLLET 규약: EAGAIN이 나올 때까지 반복해서 읽는다(drain).
     for (;;)
     {
-        // 1. 링버퍼의 가용 공간(tail 부분)을 1~2개의 조각(iovec)으로 가져온다.
+        // 1. 수신 링(세션 링이 없으면 워커 공용 staging 링)의 가용 공간을 1~2개의 iovec 으로 가져온다.
+        hypernet::buffer::RingBuffer *ring = recvTarget_();
+        if (!ring)
+        {
+            beginClose_(loop, "recv_ring_alloc_failed", 0);
+            return;
+        }
         ::iovec iov[2]{};
-        const int iovcnt = recvRing_->writeIov(iov, recvRing_->freeSpace());
+        const int iovcnt = ring->writeIov(iov, ring->freeSpace());
 
         // 링버퍼가 꽉 찬 경우
         if (iovcnt == 0)
         {
             SLOG_WARN("Session", "RecvOverflow", "sid={} fd={} cap={} size={}", handle_.id(), fd,
-                      recvRing_->capacity(), recvRing_->size());
+                      ring->capacity(), ring->size());
             beginClose_(loop, "recv_overflow", 0);
             return;
         }
@@ -246,9 +287,9 @@ void Session::onReadable_(EventLoop &loop) noexcept
             const std::size_t bytes = static_cast<std::size_t>(n);
 
             //  실제로 수신한 바이트 수만큼 링버퍼의 tail 포인터를 이동시킨다.
-            recvRing_->commitWrite(bytes);
-            touchRx_();
-            if (!processRecvFrames_(loop))
+            ring->commitWrite(bytes);
+            rxBytes_ += bytes;
+            if (!consumeRecv_(loop, *ring))
             {
                 return;
             }
@@ -282,18 +323,150 @@ void Session::onReadable_(EventLoop &loop) noexcept
     }
 }
 
-void Session::onWritable_(EventLoop &loop) noexcept
+void Session::onRecvCompleted_(EventLoop &loop, const EpollReactor::ReadyEvent &ev) noexcept
+{
+    if (state_ != SessionState::Connected)
+    {
+        return;
+    }
+
+    const int fd = socket_.nativeHandle();
+    const int res = ev.result;
+
+    if (res == 0)
+    {
+        SLOG_INFO("Session", "PeerClosed", "sid={} fd={}", handle_.id(), fd);
+        beginClose_(loop, "peer_close", 0);
+        return;
+    }
+
+    if (res < 0)
+    {
+        // ENOBUFS: provided buffer 고갈로 multishot 이 끊긴 것 → 재무장(버퍼는 다음 wait 에서 반납)
+        if (res != -ENOBUFS && res != -EAGAIN && res != -EINTR)
+        {
+            SLOG_ERROR("Session", "RecvFailed", "sid={} fd={} errno={} msg='{}'", handle_.id(), fd,
+                       -res, std::strerror(-res));
+            beginClose_(loop, "recv_error", -res);
+            return;
+        }
+    }
+    else if (ev.data)
+    {
+        // provided buffer → 수신 링(없으면 staging) 복사 후 프레이밍. 링이 차면 프레임을 소비하며 나눠 넣는다.
+        const std::byte *p = ev.data;
+        std::size_t remain = static_cast<std::size_t>(res);
+        rxBytes_ += remain;
+        while (remain > 0)
+        {
+            hypernet::buffer::RingBuffer *ring = recvTarget_();
+            if (!ring)
+            {
+                beginClose_(loop, "recv_ring_alloc_failed", 0);
+                return;
+            }
+            const std::size_t wrote = ring->write(p, remain);
+            if (wrote == 0)
+            {
+                SLOG_WARN("Session", "RecvOverflow", "sid={} fd={} cap={} size={}", handle_.id(),
+                          fd, ring->capacity(), ring->size());
+                beginClose_(loop, "recv_overflow", 0);
+                return;
+            }
+            p += wrote;
+            remain -= wrote;
+
+            if (!consumeRecv_(loop, *ring))
+            {
+                return;
+            }
+        }
+    }
+
+    if (!ev.more && state_ == SessionState::Connected && !loop.armRecv(fd))
+    {
+        beginClose_(loop, "recv_arm_failed", errno);
+    }
+}
+
+bool Session::submitSend_(EventLoop &loop) noexcept
 {
     if (state_ != SessionState::Connected)
     {
+        return false;
+    }
+    if (sendOpsInFlight_ > 0 || !sendRing_ || sendRing_->empty())
+    {
+        return true; // 진행 중 체인이 끝나면 onSendCompleted_ 에서 이어서 제출
+    }
+
+    ::iovec iov[2]{};
+    const int iovcnt = sendRing_->peekIov(iov, sendRing_->available());
+    if (iovcnt == 0)
+    {
+        return true;
+    }
+
+    const int fd = socket_.nativeHandle();
+    // keepAlive: close 이후에도 커널이 sendRing_ 메모리를 읽는 동안 세션을 살려둔다.
+    if (!loop.submitSend(fd, iov, iovcnt, shared_from_this()))
+    {
+        const int e = errno;
+        SLOG_ERROR("Session", "SendSubmitFailed", "sid={} fd={} errno={} msg='{}'", handle_.id(),
+                   fd, e, std::strerror(e));
+        beginClose_(loop, "send_submit_failed", e);
+        return false;
+    }
+
+    sendOpsInFlight_ = 1; // SENDMSG 1개 (완료 이벤트 1개)
+    return true;
+}
+
+void Session::onSendCompleted_(EventLoop &loop, const EpollReactor::ReadyEvent &ev) noexcept
+{
+    if (sendOpsInFlight_ > 0)
+    {
+        --sendOpsInFlight_;
+    }
+
+    if (state_ != SessionState::Connected || !sendRing_)
+    {
+        return;
+    }
+
+    const int res = ev.result;
+    if (res > 0)
+    {
+        // 완료된 바이트만큼만 head 이동 (제출 시점에는 소비하지 않는다)
+        // - short send 면 남은 구간은 아래에서 다시 제출한다.
+        consumeSendRing_(static_cast<std::size_t>(res));
+    }
+    else if (res == 0)
+    {
+        SLOG_ERROR("Session", "SendZero", "sid={} fd={}", handle_.id(), nativeHandle());
+        beginClose_(loop, "send_zero", 0);
         return;
     }
+    else if (res != -ECANCELED && res != -EAGAIN && res != -EINTR)
+    {
+        // ECANCELED: ring 종료 등으로 요청이 취소됨 → 잔여분은 재제출
+        SLOG_ERROR("Session", "SendFailed", "sid={} fd={} errno={} msg='{}'", handle_.id(),
+                   nativeHandle(), -res, std::strerror(-res));
+        beginClose_(loop, "send_failed", -res);
+        return;
+    }
+
+    if (sendOpsInFlight_ == 0)
+    {
+        (void)submitSend_(loop);
+    }
+    notifySendBackpressure_();
+}
 
-    if (!sendRing_)
+void Session::onWritable_(EventLoop &loop) noexcept
+{
+    if (state_ != SessionState::Connected)
     {
-        SLOG_ERROR("Session", "SendRingMissing", "sid={} fd={}", handle_.id(),
-                   socket_.nativeHandle());
-        beginClose_(loop, "send_ring_missing", 0);
         return;
     }
 
@@ -303,7 +476,8 @@ void Session::onWritable_(EventLoop &loop) noexcept
     }
 
     // backlog 있을 때만 EPOLLOUT ON, 비면 OFF (Contract 고정)
-    setWriteInterest_(loop, !sendRing_->empty());
+    setWriteInterest_(loop, hasPendingSend_());
+    notifySendBackpressure_();
 }
 
 void Session::onError_(EventLoop &loop, const EpollReactor::ReadyEvent &ev) noexcept
@@ -356,6 +530,28 @@ void Session::beginClose_(EventLoop &loop, const char *reason, int err) noexcept
         return; // idempotent
     }
 
+    // deferred flush 모드: 이번 iteration 에 쌓인 응답(예: 거절 후 close)을 close 전에
+    // sendmsg 1회로 best-effort 송신한다. 실패는 무시(어차피 닫는 중).
+    if (flushPending_)
+    {
+        flushPending_ = false;
+        if (!loop.completionIoEnabled() && sendRing_ && !sendRing_->empty())
+        {
+            // zero-copy 블록이 대기 중이면 그 앞의 링 구간까지만 보낸다(순서 보존).
+            const std::size_t limit =
+                zcQueue_.empty() ? sendRing_->available() : zcQueue_.front().ringPrefix;
+            ::iovec iov[2]{};
+            const int iovcnt = limit > 0 ? sendRing_->peekIov(iov, limit) : 0;
+            if (iovcnt > 0)
+            {
+                ::msghdr m{};
+                m.msg_iov = iov;
+                m.msg_iovlen = static_cast<decltype(m.msg_iovlen)>(iovcnt);
+                (void)::sendmsg(socket_.nativeHandle(), &m, MSG_NOSIGNAL | MSG_DONTWAIT);
+            }
+        }
+    }
+
     // self 보유: 아래에서 manager->erase로 인해 refcount가 0이 될 수 있으므로
     // 이 함수 종료까지 객체 수명을 보장한다(UAF 방지).
     auto self = shared_from_this();
@@ -373,6 +569,9 @@ void Session::beginClose_(EventLoop &loop, const char *reason, int err) noexcept
         (void)loop.removeFd(fd);
     }
 
+    cancelTimers_(loop);
+    releaseZeroCopyBlocks_();
+    releaseSendQueue_();
     socket_.close();
     state_ = SessionState::Closed;
     if (err != 0 || !isNormalCloseReason(reason))
@@ -419,6 +618,9 @@ void Session::closeFromManager_(EventLoop &loop, const char *reason, int err) no
         (void)loop.removeFd(fd);
     }
 
+    cancelTimers_(loop);
+    releaseZeroCopyBlocks_();
+    releaseSendQueue_();
     socket_.close();
     state_ = SessionState::Closed;
 }
@@ -441,15 +643,47 @@ bool Session::enqueueSendNoFlush_(EventLoop &loop, const void *data, std::size_t
         return true;
     }
 
-    if (!sendRing_)
+    if (!sendRing_ && !acquireSendRing_())
     {
-        SLOG_ERROR("Session", "SendRingMissing", "sid={} fd={}", handle_.id(),
-                   socket_.nativeHandle());
-        beginClose_(loop, "send_ring_missing", 0);
+        beginClose_(loop, "send_ring_alloc_failed", 0);
         return false;
     }
+    lastTxAt_ = loop.now();
+    if (sendMarkNs_ == 0 && ownerManager_)
+    {
+        sendMarkNs_ = ownerManager_->dispatchStartNs_;
+    }
 
     const std::size_t free = sendRing_->freeSpace();
+    const std::size_t limit = ownerManager_ ? ownerManager_->sendQueueLimit_ : 0;
+    if ((free < len || sendQueueBytes_ != 0) && limit != 0)
+    {
+        // overflow 큐: 링을 먼저 채우고(순서 보존) 나머지를 블록 체인에 잇는다.
+        const std::size_t queued = sendRing_->size() + sendQueueBytes_;
+        if (queued + len > limit)
+        {
+            SLOG_WARN("Session", "SendQueueLimitClose", "sid={} fd={} queued={} enqueue_len={} limit={}",
+                      handle_.id(), socket_.nativeHandle(), queued, len, limit);
+            if (auto *m = ownerManager_->sendQueueMetrics_)
+                m->limitClosesTotal.fetch_add(1, std::memory_order_relaxed);
+            beginClose_(loop, "send_queue_limit", 0);
+            return false;
+        }
+
+        const auto *bytes = static_cast<const std::byte *>(data);
+        std::size_t toRing = 0;
+        if (sendQueueBytes_ == 0)
+        {
+            toRing = sendRing_->write(bytes, free < len ? free : len);
+        }
+        if (!appendSendQueue_(bytes + toRing, len - toRing))
+        {
+            beginClose_(loop, "send_queue_alloc_failed", 0);
+            return false;
+        }
+        updateSendBackpressure_();
+        return state_ == SessionState::Connected;
+    }
     if (free < len)
     {
         SLOG_ERROR("Session", "SendOverflowClose",
@@ -468,6 +702,10 @@ bool Session::enqueueSendNoFlush_(EventLoop &loop, const void *data, std::size_t
         beginClose_(loop, "send_ring_write_mismatch", 0);
         return false;
     }
+    if (limit != 0)
+    {
+        updateSendBackpressure_();
+    }
 
     return state_ == SessionState::Connected;
 }
@@ -475,6 +713,18 @@ bool Session::enqueueSendNoFlush_(EventLoop &loop, const void *data, std::size_t
 bool Session::enqueuePacketU16Coalesced(EventLoop &loop, const std::uint8_t lenHdr4[4],
                                         const std::uint8_t opHdr2[2], const void *body,
                                         std::size_t bodyLen) noexcept
+{
+    // 새 메시지 세그먼트 구성(주의: bodyLen==0이면 body 세그는 n=0)
+    const hypernet::protocol::BodyPiece segs[] = {
+        {lenHdr4, 4},
+        {opHdr2, 2},
+        {static_cast<const std::uint8_t *>(body), bodyLen},
+    };
+    return enqueueFrameCoalesced(loop, segs, 3);
+}
+
+bool Session::enqueueFrameCoalesced(EventLoop &loop, const hypernet::protocol::BodyPiece *segs,
+                                    int cnt) noexcept
 {
     if (!loop.isInOwnerThread())
     {
@@ -486,41 +736,47 @@ bool Session::enqueuePacketU16Coalesced(EventLoop &loop, const std::uint8_t lenH
     if (state_ != SessionState::Connected)
         return false;
 
-    if (!sendRing_)
-    {
-        beginClose_(loop, "send_ring_missing", 0);
+    if (cnt < 0 || cnt > kMaxFrameSegs || !validSegs_(loop, segs, cnt))
         return false;
-    }
 
-    // 방어: bodyLen > 0 인데 body가 null이면 프로그래밍 에러 취급(혹은 close 정책)
-    if (bodyLen > 0 && body == nullptr)
+    auto enqueueAll = [&]() noexcept -> bool
     {
-        SLOG_FATAL("Session", "EnqueueInvalidBody", "sid={} body_len={} body=null", handle_.id(),
-                   bodyLen);
-        beginClose_(loop, "send_invalid_body", 0);
-        return false;
-    }
-
-    const int fd = socket_.nativeHandle();
+        for (int i = 0; i < cnt; ++i)
+        {
+            if (!enqueueSendNoFlush_(loop, segs[i].p, segs[i].n))
+                return false;
+        }
+        return true;
+    };
 
-    struct Seg
+    // io_uring: 링에 적재 후 linked SEND 로 제출(완료 시 head 이동). 직접 sendmsg 하지 않는다.
+    if (loop.completionIoEnabled())
     {
-        const std::uint8_t *p;
-        std::size_t n;
-    };
+        if (!enqueueAll())
+        {
+            return false;
+        }
+        return submitSend_(loop);
+    }
 
-    auto consumeRing = [&](std::size_t nbytes) noexcept
+    // zero-copy 블록이나 overflow 큐가 대기 중이면 그 뒤에 적재해야 순서가 보존된다.
+    if (!zcQueue_.empty() || sendQueueBytes_ != 0)
     {
-        while (nbytes > 0 && sendRing_ && !sendRing_->empty())
+        if (!enqueueAll())
         {
-            const auto v = sendRing_->readView(nbytes);
-            if (v.empty())
-                break;
-            nbytes -= v.size();
+            return false;
         }
-    };
+        if (!flushSend_(loop))
+            return false;
+        setWriteInterest_(loop, hasPendingSend_());
+        return state_ == SessionState::Connected;
+    }
+
+    const int fd = socket_.nativeHandle();
+
+    auto consumeRing = [&](std::size_t nbytes) noexcept { consumeSendRing_(nbytes); };
 
-    auto enqueueRemainder = [&](std::size_t skip, const Seg *segs, int cnt) noexcept -> bool
+    auto enqueueRemainder = [&](std::size_t skip) noexcept -> bool
     {
         for (int i = 0; i < cnt; ++i)
         {
@@ -543,21 +799,18 @@ bool Session::enqueuePacketU16Coalesced(EventLoop &loop, const std::uint8_t lenH
         return true;
     };
 
-    // 새 메시지 세그먼트 구성(주의: bodyLen==0이면 body 세그는 n=0)
-    const Seg segs[] = {
-        {lenHdr4, 4},
-        {opHdr2, 2},
-        {static_cast<const std::uint8_t *>(body), bodyLen},
-    };
+    std::size_t newTotal = 0;
+    for (int i = 0; i < cnt; ++i)
+        newTotal += segs[i].n;
 
     for (;;)
     {
-        ::iovec iov[5]{};
+        ::iovec iov[2 + kMaxFrameSegs]{};
         int iovcnt = 0;
         std::size_t ringAvail = 0;
 
-        // 1) 기존 backlog (FIFO) 먼저
-        if (!sendRing_->empty())
+        // 1) 기존 backlog (FIFO) 먼저 (링은 처음 backlog 가 생길 때 만들어진다)
+        if (sendRing_ && !sendRing_->empty())
         {
             ::iovec ringIov[2]{};
             const int rcnt = sendRing_->peekIov(ringIov, sendRing_->available());
@@ -570,12 +823,11 @@ bool Session::enqueuePacketU16Coalesced(EventLoop &loop, const std::uint8_t lenH
             }
         }
 
-        // 2) 새 메시지( lenHdr4 + opHdr2 + body ) 추가
-        for (int i = 0; i < 3; ++i)
+        // 2) 새 메시지( lenHdr4 + opHdr2 + body 조각 ) 추가
+        for (int i = 0; i < cnt; ++i)
         {
             if (segs[i].n == 0)
                 continue;
-            // segs[2]는 bodyLen>0이면 body!=null 이미 보장
             iov[iovcnt].iov_base = const_cast<std::uint8_t *>(segs[i].p);
             iov[iovcnt].iov_len = segs[i].n;
             ++iovcnt;
@@ -604,12 +856,10 @@ bool Session::enqueuePacketU16Coalesced(EventLoop &loop, const std::uint8_t lenH
             }
 
             // (B) 새 메시지에서 얼마나 보냈는지
-            const std::size_t newTotal = 4 + 2 + bodyLen;
-
             if (sent < newTotal)
             {
                 // 일부만 보냄 -> 남은 것만 enqueue 후 flush 1회
-                if (!enqueueRemainder(sent, segs, 3))
+                if (!enqueueRemainder(sent))
                     return false;
                 if (!flushSend_(loop))
                     return false;
@@ -617,10 +867,12 @@ bool Session::enqueuePacketU16Coalesced(EventLoop &loop, const std::uint8_t lenH
             else
             {
                 // 새 메시지까지 다 보냄 -> backlog 있으면 best-effort flush 1회
+                if (ownerManager_)
+                    ownerManager_->recordSendCompletion_(ownerManager_->dispatchStartNs_);
                 (void)flushSend_(loop);
             }
 
-            setWriteInterest_(loop, !sendRing_->empty());
+            setWriteInterest_(loop, sendRing_ && !sendRing_->empty());
             return state_ == SessionState::Connected;
         }
 
@@ -637,7 +889,7 @@ bool Session::enqueuePacketU16Coalesced(EventLoop &loop, const std::uint8_t lenH
         if (errno == EAGAIN || errno == EWOULDBLOCK)
         {
             // 못 보냄 -> 새 메시지 전체 큐잉 후 EPOLLOUT
-            if (!enqueueRemainder(0, segs, 3))
+            if (!enqueueRemainder(0))
                 return false;
 
             setWriteInterest_(loop, true);
@@ -649,6 +901,82 @@ bool Session::enqueuePacketU16Coalesced(EventLoop &loop, const std::uint8_t lenH
     }
 }
 
+bool Session::enqueuePacketU16Deferred(EventLoop &loop, const std::uint8_t lenHdr4[4],
+                                       const std::uint8_t opHdr2[2], const void *body,
+                                       std::size_t bodyLen) noexcept
+{
+    const hypernet::protocol::BodyPiece segs[] = {
+        {lenHdr4, 4},
+        {opHdr2, 2},
+        {static_cast<const std::uint8_t *>(body), bodyLen},
+    };
+    return enqueueFrameDeferred(loop, segs, 3);
+}
+
+bool Session::enqueueFrameDeferred(EventLoop &loop, const hypernet::protocol::BodyPiece *segs,
+                                   int cnt) noexcept
+{
+    if (state_ != SessionState::Connected || !validSegs_(loop, segs, cnt))
+        return false;
+
+    for (int i = 0; i < cnt; ++i)
+    {
+        if (!enqueueSendNoFlush_(loop, segs[i].p, segs[i].n))
+            return false;
+    }
+    return true;
+}
+
+bool Session::validSegs_(EventLoop &loop, const hypernet::protocol::BodyPiece *segs, int cnt) noexcept
+{
+    // 방어: n > 0 인데 p 가 null이면 프로그래밍 에러 취급(혹은 close 정책)
+    for (int i = 0; i < cnt; ++i)
+    {
+        if (segs[i].n > 0 && segs[i].p == nullptr)
+        {
+            SLOG_FATAL("Session", "EnqueueInvalidBody", "sid={} body_len={} body=null", handle_.id(),
+                       segs[i].n);
+            beginClose_(loop, "send_invalid_body", 0);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Session::flushDeferred_(EventLoop &loop, bool cork) noexcept
+{
+    if (state_ != SessionState::Connected || !hasPendingSend_())
+    {
+        return state_ == SessionState::Connected;
+    }
+
+    if (loop.completionIoEnabled())
+    {
+        return submitSend_(loop);
+    }
+
+    // 이미 EPOLLOUT 대기 중이면 커널 버퍼가 가득 찬 상태: onWritable_ 이 이어서 보낸다.
+    if (currentEpollMask_ & static_cast<std::uint32_t>(EpollReactor::Event::Write))
+    {
+        return true;
+    }
+
+    if (cork)
+    {
+        (void)socket_.setCork(true);
+    }
+    const bool ok = flushSend_(loop);
+    if (cork && state_ == SessionState::Connected)
+    {
+        (void)socket_.setCork(false);
+    }
+    if (ok)
+    {
+        setWriteInterest_(loop, hasPendingSend_());
+    }
+    return state_ == SessionState::Connected;
+}
+
 bool Session::flushSend_(EventLoop &loop) noexcept
 {
 
@@ -658,6 +986,24 @@ bool Session::flushSend_(EventLoop &loop) noexcept
         return false;
     }
 
+    if (loop.completionIoEnabled())
+    {
+        return submitSend_(loop);
+    }
+
+    // zero-copy 블록이 남아 있으면 "링 prefix → 블록" 순서로 먼저 비운다.
+    if (!zcQueue_.empty())
+    {
+        if (!flushZeroCopy_(loop))
+        {
+            return false;
+        }
+        if (!zcQueue_.empty())
+        {
+            return true; // EAGAIN: EPOLLOUT 에서 이어서 송신
+        }
+    }
+
     const int fd = socket_.nativeHandle();
 
     // EPOLLET(Edge-Triggered) 규약: EAGAIN이 나올 때까지 최대한 쏟아낸다(drain).
@@ -687,18 +1033,8 @@ bool Session::flushSend_(EventLoop &loop) noexcept
             std::size_t totalSent = static_cast<std::size_t>(n);
 
             // 5. [중요] 보낸 바이트 수만큼 링버퍼에서 실제로 제거(head 이동)
-            // readView는 한 번 호출 시 연속된 구간 하나만 반환하므로,
-            // 2개 조각(wrap 발생)을 모두 소비하려면 남은 바이트가 없을 때까지 반복 호출합니다.
-            while (totalSent > 0)
-            {
-                const auto consumed = sendRing_->readView(totalSent);
-                if (consumed.empty())
-                {
-                    // 논리적으로 발생하면 안 되는 상황 (RingBuffer 상태 불일치 시 발생 가능)
-                    break;
-                }
-                totalSent -= consumed.size();
-            }
+            // (overflow 큐가 있으면 빈 만큼 링으로 옮겨져 다음 drain 루프에서 이어서 나간다)
+            consumeSendRing_(totalSent);
 
             // 전송이 성공했으므로 다음 drain 루프로 계속 진행
             continue;
@@ -735,22 +1071,418 @@ bool Session::flushSend_(EventLoop &loop) noexcept
     return state_ == SessionState::Connected;
 }
 
-void Session::setWriteInterest_(EventLoop &loop, bool enable) noexcept
+std::size_t Session::queuedSendBytes() const noexcept
 {
-    if (state_ != SessionState::Connected)
-    {
-        return;
-    }
-
-    const std::uint32_t desired =
-        enable ? (baseEpollMask_() | static_cast<std::uint32_t>(EpollReactor::Event::Write))
-               : baseEpollMask_();
+    return (sendRing_ ? sendRing_->size() : 0) + sendQueueBytes_;
+}
 
-    if (currentEpollMask_ == desired)
+bool Session::appendSendQueue_(const std::byte *data, std::size_t len) noexcept
+{
+    const std::size_t blockBytes = hypernet::core::defaults::kSendQueueBlockBytes;
+    while (len > 0)
     {
-        return; // 중복 epoll_ctl 방지
-    }
-
+        if (sendQueue_.empty() || sendQueue_.back().end == blockBytes)
+        {
+            bool pooled = false;
+            void *mem = ownerManager_->acquireSendQueueBlock_(pooled);
+            if (!mem)
+            {
+                SLOG_ERROR("Session", "SendQueueAllocFailed", "sid={} queued={}", handle_.id(),
+                           sendQueueBytes_);
+                return false;
+            }
+            try
+            {
+                sendQueue_.push_back(SendQueueBlock{static_cast<std::byte *>(mem), 0, 0, pooled});
+            }
+            catch (...)
+            {
+                ownerManager_->releaseSendQueueBlock_(mem, pooled);
+                return false;
+            }
+        }
+
+        SendQueueBlock &tail = sendQueue_.back();
+        const std::size_t room = blockBytes - tail.end;
+        const std::size_t n = len < room ? len : room;
+        std::memcpy(tail.mem + tail.end, data, n);
+        tail.end += static_cast<std::uint32_t>(n);
+        data += n;
+        len -= n;
+        sendQueueBytes_ += n;
+        if (auto *m = ownerManager_->sendQueueMetrics_)
+            m->overflowBytes.fetch_add(n, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+void Session::consumeSendRing_(std::size_t n) noexcept
+{
+    // readView 는 연속 구간 하나만 반환하므로 wrap 된 두 조각을 모두 소비할 때까지 반복한다.
+    while (n > 0 && sendRing_ && !sendRing_->empty())
+    {
+        const auto consumed = sendRing_->readView(n);
+        if (consumed.empty())
+            break;
+        n -= consumed.size();
+    }
+
+    if (sendQueueBytes_ == 0 || !sendRing_)
+    {
+        noteSendDrained_();
+        return;
+    }
+
+    // 링이 비운 만큼 overflow 큐 앞부분을 옮긴다. (링 free 구간에만 쓰므로 진행 중인 SEND 와 겹치지 않음)
+    std::size_t moved = 0;
+    std::size_t drained = 0;
+    while (drained < sendQueue_.size() && !sendRing_->full())
+    {
+        SendQueueBlock &b = sendQueue_[drained];
+        const std::size_t w = sendRing_->write(b.mem + b.begin, b.end - b.begin);
+        b.begin += static_cast<std::uint32_t>(w);
+        moved += w;
+        if (b.begin != b.end)
+            break;
+        ownerManager_->releaseSendQueueBlock_(b.mem, b.pooled);
+        ++drained;
+    }
+    sendQueue_.erase(sendQueue_.begin(), sendQueue_.begin() + static_cast<std::ptrdiff_t>(drained));
+    sendQueueBytes_ -= moved;
+    if (auto *m = ownerManager_->sendQueueMetrics_)
+        m->overflowBytes.fetch_sub(moved, std::memory_order_relaxed);
+
+    updateSendBackpressure_();
+    noteSendDrained_();
+}
+
+void Session::noteSendDrained_() noexcept
+{
+    // 쌓인 응답을 모두 커널에 넘긴 시점: 가장 이른 dispatch 부터의 지연을 한 번 기록한다.
+    if (sendMarkNs_ == 0 || sendQueueBytes_ != 0 || (sendRing_ && !sendRing_->empty()))
+        return;
+    if (ownerManager_)
+        ownerManager_->recordSendCompletion_(sendMarkNs_);
+    sendMarkNs_ = 0;
+}
+
+void Session::updateSendBackpressure_() noexcept
+{
+    if (!ownerManager_ || ownerManager_->sendQueueLimit_ == 0)
+        return;
+
+    const std::size_t queued = queuedSendBytes();
+    auto *m = ownerManager_->sendQueueMetrics_;
+    if (!sendCongested_ && queued >= ownerManager_->sendQueueHigh_)
+    {
+        sendCongested_ = true;
+        if (m)
+        {
+            m->congestedSessions.fetch_add(1, std::memory_order_relaxed);
+            m->backpressureEventsTotal.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    else if (sendCongested_ && queued <= ownerManager_->sendQueueLow_)
+    {
+        sendCongested_ = false;
+        if (m)
+            m->congestedSessions.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+void Session::notifySendBackpressure_() noexcept
+{
+    if (sendCongested_ == sendCongestionNotified_ || state_ != SessionState::Connected || !ownerManager_)
+        return;
+
+    // 앱 콜백 안에서 send/close 가 일어나도 세션 수명을 유지한다.
+    auto self = shared_from_this();
+    sendCongestionNotified_ = sendCongested_;
+    ownerManager_->notifySendBackpressure_(handle_, sendCongested_);
+}
+
+void Session::releaseSendQueue_() noexcept
+{
+    auto *m = ownerManager_ ? ownerManager_->sendQueueMetrics_ : nullptr;
+    for (const auto &b : sendQueue_)
+    {
+        ownerManager_->releaseSendQueueBlock_(b.mem, b.pooled);
+    }
+    sendQueue_.clear();
+    if (m)
+    {
+        m->overflowBytes.fetch_sub(sendQueueBytes_, std::memory_order_relaxed);
+        if (sendCongested_)
+            m->congestedSessions.fetch_sub(1, std::memory_order_relaxed);
+    }
+    sendQueueBytes_ = 0;
+    sendCongested_ = false;
+}
+
+bool Session::hasPendingSend_() const noexcept
+{
+    return (sendRing_ && !sendRing_->empty()) || sendQueueBytes_ != 0 || !zcQueue_.empty();
+}
+
+bool Session::enqueueZeroCopy_(EventLoop &loop, void *block, std::size_t len, bool flush) noexcept
+{
+    if (state_ != SessionState::Connected)
+    {
+        if (ownerManager_)
+            ownerManager_->releaseZeroCopyBlock_(block);
+        return false;
+    }
+
+    // overflow 큐보다 앞질러 나가면 안 되므로 큐 뒤에 복사하고 블록은 바로 반납한다.
+    if (sendQueueBytes_ != 0)
+    {
+        const bool queued = enqueueSendNoFlush_(loop, block, len);
+        if (ownerManager_)
+            ownerManager_->releaseZeroCopyBlock_(block);
+        if (!queued || !flush)
+            return queued;
+        if (!flushSend_(loop))
+            return false;
+        setWriteInterest_(loop, hasPendingSend_());
+        return state_ == SessionState::Connected;
+    }
+
+    ZeroCopyBlock b{};
+    b.mem = block;
+    b.len = len;
+    b.ringPrefix = sendRing_ ? sendRing_->size() : 0;
+    zcQueue_.push_back(b);
+
+    if (!flush)
+    {
+        return true;
+    }
+    if (!flushSend_(loop))
+    {
+        return false;
+    }
+    setWriteInterest_(loop, hasPendingSend_());
+    return state_ == SessionState::Connected;
+}
+
+bool Session::flushZeroCopy_(EventLoop &loop) noexcept
+{
+    const int fd = socket_.nativeHandle();
+
+    while (!zcQueue_.empty())
+    {
+        ZeroCopyBlock &front = zcQueue_.front();
+        ::iovec iov[2]{};
+        int iovcnt = 0;
+        bool zeroCopySend = false;
+
+        // 1) 블록보다 먼저 적재된 링 데이터는 일반 송신(복사)
+        if (front.ringPrefix > 0)
+        {
+            iovcnt = sendRing_->peekIov(iov, front.ringPrefix);
+        }
+        else
+        {
+            iov[0].iov_base = static_cast<std::uint8_t *>(front.mem) + front.sent;
+            iov[0].iov_len = front.len - front.sent;
+            iovcnt = 1;
+            zeroCopySend = !zcCopied_;
+        }
+
+        ::msghdr m{};
+        m.msg_iov = iov;
+        m.msg_iovlen = static_cast<decltype(m.msg_iovlen)>(iovcnt);
+
+        ::ssize_t n = ::sendmsg(fd, &m, MSG_NOSIGNAL | (zeroCopySend ? MSG_ZEROCOPY : 0));
+        if (n < 0 && zeroCopySend && errno == ENOBUFS)
+        {
+            // optmem(통지 메타데이터) 한도 초과: 이번 조각만 복사 송신
+            zeroCopySend = false;
+            n = ::sendmsg(fd, &m, MSG_NOSIGNAL);
+        }
+
+        if (n > 0)
+        {
+            std::size_t sent = static_cast<std::size_t>(n);
+            if (front.ringPrefix > 0)
+            {
+                consumeSendRing_(sent);
+                for (auto &b : zcQueue_)
+                {
+                    b.ringPrefix -= (b.ringPrefix < sent) ? b.ringPrefix : sent;
+                }
+                continue;
+            }
+
+            if (zeroCopySend)
+            {
+                // 성공한 MSG_ZEROCOPY sendmsg 마다 커널 통지 번호가 1씩 증가한다.
+                if (front.seqCount == 0)
+                    front.firstSeq = zcNextSeq_;
+                ++front.seqCount;
+                ++zcNextSeq_;
+            }
+            front.sent += sent;
+            if (front.sent >= front.len)
+            {
+                ZeroCopyBlock done = front;
+                zcQueue_.erase(zcQueue_.begin());
+                if (done.notified >= done.seqCount)
+                {
+                    if (ownerManager_)
+                        ownerManager_->releaseZeroCopyBlock_(done.mem);
+                }
+                else
+                {
+                    zcInFlight_.push_back(done);
+                }
+            }
+            continue;
+        }
+
+        if (n == 0)
+        {
+            beginClose_(loop, "send_zero", 0);
+            return false;
+        }
+        if (errno == EINTR)
+        {
+            continue;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            return true;
+        }
+
+        const int e = errno;
+        SLOG_ERROR("Session", "ZeroCopySendFailed", "sid={} fd={} errno={} msg='{}'", handle_.id(),
+                   fd, e, std::strerror(e));
+        beginClose_(loop, "send_failed", e);
+        return false;
+    }
+
+    return state_ == SessionState::Connected;
+}
+
+void Session::reapZeroCopy_() noexcept
+{
+    const int fd = socket_.nativeHandle();
+    if (fd < 0)
+    {
+        return;
+    }
+
+    // ET 규약: error queue 를 EAGAIN 까지 비워야 다음 통지에서 EPOLLERR 가 다시 올라온다.
+    for (;;)
+    {
+        alignas(::cmsghdr) char control[128];
+        ::msghdr m{};
+        m.msg_control = control;
+        m.msg_controllen = sizeof(control);
+
+        if (::recvmsg(fd, &m, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        for (::cmsghdr *c = CMSG_FIRSTHDR(&m); c != nullptr; c = CMSG_NXTHDR(&m, c))
+        {
+            const bool recvErr = (c->cmsg_level == SOL_IP && c->cmsg_type == IP_RECVERR) ||
+                                 (c->cmsg_level == SOL_IPV6 && c->cmsg_type == IPV6_RECVERR);
+            if (!recvErr)
+                continue;
+
+            ::sock_extended_err ee{};
+            std::memcpy(&ee, CMSG_DATA(c), sizeof(ee));
+            if (ee.ee_errno != 0 || ee.ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+                continue;
+
+            // 커널이 페이지 참조 대신 복사로 폴백(loopback, SG 미지원 NIC 등): 통지 비용만
+            // 남으므로 이 세션은 이후 MSG_ZEROCOPY 플래그 없이 블록을 송신한다.
+            if ((ee.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) && !zcCopied_)
+            {
+                zcCopied_ = true;
+                SLOG_DEBUG("Session", "ZeroCopyDeferredCopy", "sid={} fd={}", handle_.id(), fd);
+            }
+            onZeroCopyNotified_(ee.ee_info, ee.ee_data);
+        }
+    }
+}
+
+void Session::onZeroCopyNotified_(std::uint32_t lo, std::uint32_t hi) noexcept
+{
+    // 통지는 [lo, hi] 구간으로 합쳐서 올 수 있다. (아직 다 못 보낸 블록의 앞 조각 통지 포함)
+    auto credit = [lo, hi](ZeroCopyBlock &b) noexcept { b.notified += zeroCopyCredits(b.firstSeq, b.seqCount, lo, hi); };
+
+    for (auto &b : zcQueue_)
+    {
+        credit(b);
+    }
+
+    std::size_t keep = 0;
+    for (auto &b : zcInFlight_)
+    {
+        credit(b);
+        if (b.notified >= b.seqCount)
+        {
+            if (ownerManager_)
+                ownerManager_->releaseZeroCopyBlock_(b.mem);
+            continue;
+        }
+        zcInFlight_[keep++] = b;
+    }
+    zcInFlight_.resize(keep);
+}
+
+void Session::releaseZeroCopyBlocks_() noexcept
+{
+    if (zcQueue_.empty() && zcInFlight_.empty())
+    {
+        return;
+    }
+
+    // 닫기 전에 도착해 있는 통지는 마저 수거한다.
+    reapZeroCopy_();
+
+    auto drop = [this](const ZeroCopyBlock &b) noexcept
+    {
+        if (!ownerManager_)
+            return;
+        if (b.notified >= b.seqCount)
+            ownerManager_->releaseZeroCopyBlock_(b.mem);
+        else
+            ownerManager_->quarantineZeroCopyBlock_(b.mem);
+    };
+    for (const auto &b : zcQueue_)
+    {
+        drop(b);
+    }
+    for (const auto &b : zcInFlight_)
+    {
+        drop(b);
+    }
+    zcQueue_.clear();
+    zcInFlight_.clear();
+}
+
+void Session::setWriteInterest_(EventLoop &loop, bool enable) noexcept
+{
+    if (state_ != SessionState::Connected)
+    {
+        return;
+    }
+
+    const std::uint32_t desired =
+        enable ? (baseEpollMask_() | static_cast<std::uint32_t>(EpollReactor::Event::Write))
+               : baseEpollMask_();
+
+    if (currentEpollMask_ == desired)
+    {
+        return; // 중복 epoll_ctl 방지
+    }
+
     const int fd = socket_.nativeHandle();
     if (fd < 0)
     {
@@ -772,9 +1504,195 @@ void Session::setWriteInterest_(EventLoop &loop, bool enable) noexcept
                handle_.id(), fd, desired);
 }
 
-void Session::touchRx_() noexcept
+void Session::touchRx_(const EventLoop &loop) noexcept
 {
-    lastRxAt_ = std::chrono::steady_clock::now();
+    lastRxAt_ = loop.now();
+}
+
+namespace
+{
+std::unique_ptr<hypernet::buffer::RingBuffer> acquireSessionRing(const std::shared_ptr<SessionPool> &pool,
+                                                                 std::size_t capacity, bool mirrored)
+{
+    using Layout = hypernet::buffer::RingBuffer::Layout;
+    const Layout layout = mirrored ? Layout::Mirrored : Layout::Flat;
+    if (pool)
+        return pool->acquireRing(capacity, layout);
+    return std::make_unique<hypernet::buffer::RingBuffer>(capacity, layout);
+}
+
+void addRingsInUse(int workerId, bool acquired) noexcept
+{
+    if (workerId < 0)
+        return;
+    if (auto *m = hypernet::monitoring::engineMetrics().workerSessionPool(static_cast<unsigned int>(workerId)))
+    {
+        if (acquired)
+            m->ringsInUse.fetch_add(1, std::memory_order_relaxed);
+        else
+            m->ringsInUse.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+} // namespace
+
+bool Session::acquireRecvRing_() noexcept
+{
+    if (recvRing_)
+        return true;
+    try
+    {
+        recvRing_ = acquireSessionRing(pool_, recvRingCapacity_, ringsMirrored_);
+    }
+    catch (const std::exception &e)
+    {
+        SLOG_ERROR("Session", "AllocRingFailed", "sid={} dir=recv cap={} what='{}'", handle_.id(),
+                   recvRingCapacity_, e.what());
+        return false;
+    }
+    addRingsInUse(ownerWorkerId_, true);
+    return true;
+}
+
+bool Session::acquireSendRing_() noexcept
+{
+    if (sendRing_)
+        return true;
+    try
+    {
+        sendRing_ = acquireSessionRing(pool_, sendRingCapacity_, ringsMirrored_);
+    }
+    catch (const std::exception &e)
+    {
+        SLOG_ERROR("Session", "AllocRingFailed", "sid={} dir=send cap={} what='{}'", handle_.id(),
+                   sendRingCapacity_, e.what());
+        return false;
+    }
+    addRingsInUse(ownerWorkerId_, true);
+    return true;
+}
+
+void Session::releaseRing_(std::unique_ptr<hypernet::buffer::RingBuffer> &ring,
+                           std::size_t capacity) noexcept
+{
+    if (!ring)
+        return;
+    addRingsInUse(ownerWorkerId_, false);
+    if (pool_)
+    {
+        using Layout = hypernet::buffer::RingBuffer::Layout;
+        pool_->releaseRing(capacity, ringsMirrored_ ? Layout::Mirrored : Layout::Flat, std::move(ring));
+    }
+    ring.reset();
+}
+
+void Session::moveOutTo_(MigratingSession &out) noexcept
+{
+    out.socket = std::move(socket_);
+    // 링은 풀로 돌려보내지 않고 그대로 넘긴다. (점유 통계만 워커를 옮김)
+    if (recvRing_)
+    {
+        addRingsInUse(ownerWorkerId_, false);
+        out.recvRing = std::move(recvRing_);
+    }
+    if (sendRing_)
+    {
+        addRingsInUse(ownerWorkerId_, false);
+        out.sendRing = std::move(sendRing_);
+    }
+    out.lastRxAt = lastRxAt_;
+    out.rxBytes = rxBytes_;
+    out.zeroCopy = zeroCopy_;
+    out.zcCopied = zcCopied_;
+    out.zcNextSeq = zcNextSeq_; // 완료 통지 번호는 소켓 단위로 이어진다.
+    out.forwarders = std::move(forwarders_);
+    state_ = SessionState::Closed;
+}
+
+void Session::adoptFrom_(MigratingSession &in) noexcept
+{
+    if (in.recvRing)
+    {
+        recvRing_ = std::move(in.recvRing);
+        addRingsInUse(ownerWorkerId_, true);
+    }
+    if (in.sendRing)
+    {
+        sendRing_ = std::move(in.sendRing);
+        addRingsInUse(ownerWorkerId_, true);
+    }
+    lastRxAt_ = in.lastRxAt;
+    rxBytes_ = in.rxBytes;
+    rxBytesMark_ = in.rxBytes;
+    zeroCopy_ = in.zeroCopy;
+    zcCopied_ = in.zcCopied;
+    zcNextSeq_ = in.zcNextSeq;
+    forwarders_ = std::move(in.forwarders);
+}
+
+hypernet::buffer::RingBuffer *Session::recvTarget_() noexcept
+{
+    if (recvRing_)
+        return recvRing_.get();
+
+    // staging 은 consumeRecv_ 가 항상 비워 두므로 비어 있지 않다면 재진입이다 → 세션 링으로 받는다.
+    if (auto *staging = ownerManager_ ? ownerManager_->recvStaging_() : nullptr; staging && staging->empty())
+        return staging;
+
+    return acquireRecvRing_() ? recvRing_.get() : nullptr;
+}
+
+bool Session::consumeRecv_(EventLoop &loop, hypernet::buffer::RingBuffer &ring) noexcept
+{
+    touchRx_(loop);
+    const bool ok = processRecvFrames_(loop, ring);
+    if (&ring == recvRing_.get())
+        return ok;
+
+    // staging: 완성 프레임은 모두 소비됐다. 남은 부분 프레임만 세션 링으로 옮긴다.
+    // (세션 링과 staging 은 같은 용량/레이아웃이므로 잔여분은 항상 들어간다)
+    bool kept = ok;
+    if (ok && !ring.empty())
+    {
+        if (acquireRecvRing_())
+        {
+            ::iovec iov[2]{};
+            const int n = ring.peekIov(iov, ring.available());
+            for (int i = 0; i < n; ++i)
+            {
+                (void)recvRing_->write(static_cast<const std::byte *>(iov[i].iov_base), iov[i].iov_len);
+            }
+        }
+        else
+        {
+            kept = false;
+        }
+    }
+    ring.clear();
+
+    if (ok && !kept)
+    {
+        beginClose_(loop, "recv_ring_alloc_failed", 0);
+    }
+    return kept;
+}
+
+std::size_t Session::reclaimIdleRings_(std::chrono::steady_clock::time_point now,
+                                       std::chrono::milliseconds idle) noexcept
+{
+    std::size_t released = 0;
+    if (recvRing_ && recvRing_->empty() && now - lastRxAt_ >= idle)
+    {
+        releaseRing_(recvRing_, recvRingCapacity_);
+        ++released;
+    }
+    // io_uring SEND 는 완료 전까지 링 메모리를 참조하고, zero-copy 블록은 ringPrefix 로 링 위치를 기억한다.
+    if (sendRing_ && sendRing_->empty() && sendOpsInFlight_ == 0 && zcQueue_.empty() &&
+        now - lastTxAt_ >= idle)
+    {
+        releaseRing_(sendRing_, sendRingCapacity_);
+        ++released;
+    }
+    return released;
 }
 
 void Session::startTimeouts_(EventLoop &loop, std::uint32_t idleTimeoutMs,
@@ -784,7 +1702,7 @@ void Session::startTimeouts_(EventLoop &loop, std::uint32_t idleTimeoutMs,
     idleTimeoutMs_ = idleTimeoutMs;
     heartbeatIntervalMs_ = heartbeatIntervalMs;
 
-    lastRxAt_ = std::chrono::steady_clock::now();
+    lastRxAt_ = loop.now();
 
     if (idleTimeoutMs_ > 0)
     {
@@ -798,35 +1716,33 @@ void Session::startTimeouts_(EventLoop &loop, std::uint32_t idleTimeoutMs,
 
 void Session::armIdleTimerAfter_(EventLoop &loop, std::chrono::milliseconds delay) noexcept
 {
-    if (idleTimeoutMs_ == 0 || state_ != SessionState::Connected || idleTimerArmed_)
+    if (idleTimeoutMs_ == 0 || state_ != SessionState::Connected)
         return;
 
-    idleTimerArmed_ = true;
+    // 이미 노드가 있으면(대기 중이든 지금 실행 중이든) 만료 시점만 옮긴다.
+    if (idleTimerId_ != 0 && loop.rescheduleTimer(idleTimerId_, delay))
+        return;
 
     // 세션이 먼저 죽어도 안전하게: weak_ptr로 보호
     std::weak_ptr<Session> weak = weak_from_this();
     auto *loopPtr = &loop;
 
-    // EventLoop에 timer API가 이미 존재한다고 가정(기존 TimerWheel 기반 구조)
-    // :contentReference[oaicite:6]{index=6}
-    (void)loop.addTimer(delay,
-                        [weak, loopPtr]()
-                        {
-                            if (auto self = weak.lock())
-                            {
-                                self->onIdleTimer_(*loopPtr);
-                            }
-                        });
+    idleTimerId_ = loop.addTimer(delay,
+                                 [weak, loopPtr]()
+                                 {
+                                     if (auto self = weak.lock())
+                                     {
+                                         self->onIdleTimer_(*loopPtr);
+                                     }
+                                 });
 }
 
 void Session::onIdleTimer_(EventLoop &loop) noexcept
 {
-    idleTimerArmed_ = false;
-
     if (idleTimeoutMs_ == 0 || state_ != SessionState::Connected)
         return;
 
-    const auto now = std::chrono::steady_clock::now();
+    const auto now = loop.now();
     const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastRxAt_);
 
     if (elapsed.count() >= static_cast<long long>(idleTimeoutMs_))
@@ -845,34 +1761,33 @@ void Session::onIdleTimer_(EventLoop &loop) noexcept
 
 void Session::armHeartbeatTimerAfter_(EventLoop &loop, std::chrono::milliseconds delay) noexcept
 {
-    if (heartbeatIntervalMs_ == 0 || state_ != SessionState::Connected || heartbeatTimerArmed_)
+    if (heartbeatIntervalMs_ == 0 || state_ != SessionState::Connected)
         return;
 
-    heartbeatTimerArmed_ = true;
+    if (heartbeatTimerId_ != 0 && loop.rescheduleTimer(heartbeatTimerId_, delay))
+        return;
 
     std::weak_ptr<Session> weak = weak_from_this();
     auto *loopPtr = &loop;
 
-    (void)loop.addTimer(delay,
-                        [weak, loopPtr]()
-                        {
-                            if (auto self = weak.lock())
-                            {
-                                self->onHeartbeatTimer_(*loopPtr);
-                            }
-                        });
+    heartbeatTimerId_ = loop.addTimer(delay,
+                                      [weak, loopPtr]()
+                                      {
+                                          if (auto self = weak.lock())
+                                          {
+                                              self->onHeartbeatTimer_(*loopPtr);
+                                          }
+                                      });
 }
 
 void Session::onHeartbeatTimer_(EventLoop &loop) noexcept
 {
-    heartbeatTimerArmed_ = false;
-
     if (heartbeatIntervalMs_ == 0 || state_ != SessionState::Connected)
         return;
 
     constexpr int kMaxMissed = 2;
 
-    const auto now = std::chrono::steady_clock::now();
+    const auto now = loop.now();
     const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastRxAt_);
 
     const auto interval = std::chrono::milliseconds(heartbeatIntervalMs_);
@@ -911,4 +1826,18 @@ void Session::onHeartbeatTimer_(EventLoop &loop) noexcept
 
     armHeartbeatTimerAfter_(loop, remaining);
 }
+
+void Session::cancelTimers_(EventLoop &loop) noexcept
+{
+    if (idleTimerId_ != 0)
+    {
+        (void)loop.cancelTimer(idleTimerId_);
+        idleTimerId_ = 0;
+    }
+    if (heartbeatTimerId_ != 0)
+    {
+        (void)loop.cancelTimer(heartbeatTimerId_);
+        heartbeatTimerId_ = 0;
+    }
+}
 } // namespace hypernet::net
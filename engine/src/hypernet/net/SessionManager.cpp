@@ -1,21 +1,28 @@
 #include <hypernet/net/SessionManager.hpp>
 
 #include <hypernet/IApplication.hpp>
+#include <hypernet/buffer/BufferPool.hpp>
+#include <hypernet/buffer/PacketBuffer.hpp>
+#include <hypernet/core/Defaults.hpp>
 #include <hypernet/core/Logger.hpp>
 #include <hypernet/core/ThreadContext.hpp>
 #include <hypernet/net/EventLoop.hpp>
 #include <hypernet/net/EpollReactor.hpp>
+#include <hypernet/net/SessionMigration.hpp>
+#include <hypernet/net/SessionPool.hpp>
 #include <hypernet/monitoring/Metrics.hpp>
 #include <hypernet/protocol/BuiltinOpcodes.hpp>
 #include <hypernet/protocol/Endian.hpp>
 #include <hypernet/protocol/OpcodeU16.hpp>
 #include <hypernet/connector/ConnectorManager.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cerrno>
 #include <cstring>
 #include <cstdlib>
 #include <memory>
+#include <new>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -27,6 +34,10 @@ namespace hypernet::net
 namespace
 {
 
+/// zero-copy 블록 앞에 두는 프레임 헤더 (len + opcode)
+constexpr std::size_t kZeroCopyHeaderBytes =
+    hypernet::protocol::MessageHeader::kLengthFieldBytes + hypernet::protocol::MessageHeader::kOpcodeFieldBytes;
+
 inline int wid() noexcept
 {
     return hypernet::core::ThreadContext::currentWorkerId();
@@ -51,19 +62,46 @@ class PerWorkerSessionSender final : public hypernet::ISessionSender
         return owner_->sendPacketU16(static_cast<SessionHandle::Id>(sessionId), opcode, body, bodyLen);
     }
 
+    [[nodiscard]] std::size_t queuedSendBytes(hypernet::ISessionSender::SessionId sessionId) const noexcept override
+    {
+        if (!owner_ || hypernet::core::ThreadContext::currentWorkerId() != static_cast<int>(ownerWorkerId_))
+            return 0;
+        return owner_->queuedSendBytes(static_cast<SessionHandle::Id>(sessionId));
+    }
+
   private:
     unsigned int ownerWorkerId_{0};
     SessionManager *owner_{nullptr};
 };
 
+/// dispatch 동안 시작 시각을 걸어 두고, 끝나면 이전 값으로 되돌립니다. (handler 안의 재진입 dispatch 대비)
+/// - 이 구간에서 송신 링에 실린 응답은 이 시각부터 커널에 넘어갈 때까지를 지연으로 잽니다.
+class DispatchStamp
+{
+  public:
+    DispatchStamp(std::int64_t &slot, bool enabled) noexcept : slot_(slot), prev_(slot)
+    {
+        slot_ = enabled ? hypernet::monitoring::latencyNowNs() : 0;
+    }
+    ~DispatchStamp() { slot_ = prev_; }
+
+    DispatchStamp(const DispatchStamp &) = delete;
+    DispatchStamp &operator=(const DispatchStamp &) = delete;
+
+  private:
+    std::int64_t &slot_;
+    std::int64_t prev_;
+};
+
 } // namespace
 
 // ===== SessionManager =====
 
 SessionManager::SessionManager(unsigned int ownerWorkerId, EventLoop *loop, std::size_t recvRingCapacity, std::size_t sendRingCapacity, std::uint32_t framerMaxPayloadLen) noexcept
-    : ownerWorkerId_(ownerWorkerId), loop_(loop), recvRingCapacity_(recvRingCapacity), sendRingCapacity_(sendRingCapacity), framer_(framerMaxPayloadLen)
+    : ownerWorkerId_(ownerWorkerId), loop_(loop), recvRingCapacity_(recvRingCapacity), sendRingCapacity_(sendRingCapacity), maxPayloadLen_(framerMaxPayloadLen), framer_(framerMaxPayloadLen)
 {
     sender_ = std::make_shared<PerWorkerSessionSender>(ownerWorkerId_, this);
+    latencyMetrics_ = hypernet::monitoring::engineMetrics().workerLatency(ownerWorkerId_);
     if (loop_)
     {
         connectors_ = std::make_unique<hypernet::connector::ConnectorManager>(*loop_, *this);
@@ -76,10 +114,23 @@ SessionManager::~SessionManager()
     {
         connectors_->shutdownDialsInOwnerThread();
     }
+    if (deferredFlush_ && loop_)
+    {
+        loop_->setIterationEndHook({});
+    }
+    if (ringReclaimTimerId_ != 0 && loop_ && loop_->isInOwnerThread())
+    {
+        (void)loop_->cancelTimer(ringReclaimTimerId_);
+    }
 
+    dirty_.clear();
     sessions_.clear();
     sender_.reset();
     connectors_.reset();
+
+    // 보류 중인 블록은 풀과 함께 해제한다. (커널은 송신 중인 페이지를 자체 참조로 유지)
+    zcQuarantine_.clear();
+    zeroCopyPool_.reset();
 }
 
 void SessionManager::setApplication(std::shared_ptr<hypernet::IApplication> app) noexcept
@@ -121,10 +172,28 @@ SessionHandle SessionManager::onAccepted(Socket &&client, const Acceptor::PeerEn
     if (!loop_)
         std::abort();
 
+    // SO_BUSY_POLL 은 best-effort: 권한 부족(EPERM)이어도 세션은 정상 진행한다.
+    if (busyPollUs_ != 0 && !client.setBusyPoll(static_cast<int>(busyPollUs_)) && !busyPollWarned_)
+    {
+        busyPollWarned_ = true;
+        SLOG_WARN("SessionManager", "BusyPollFailed", "usec={} errno={} msg='{}'", busyPollUs_, errno, std::strerror(errno));
+    }
+
+    bool zeroCopy = false;
+    if (zeroCopyPool_)
+    {
+        zeroCopy = client.setZeroCopy(true);
+        if (!zeroCopy && !zeroCopyWarned_)
+        {
+            zeroCopyWarned_ = true;
+            SLOG_WARN("SessionManager", "ZeroCopyUnavailable", "errno={} msg='{}'", errno, std::strerror(errno));
+        }
+    }
+
     const auto id = nextSessionId_();
     auto handle = makeHandle_(id);
 
-    auto session = Session::create(handle, static_cast<int>(ownerWorkerId_), std::move(client), this, recvRingCapacity_, sendRingCapacity_);
+    auto session = Session::create(handle, static_cast<int>(ownerWorkerId_), std::move(client), this, recvRingCapacity_, sendRingCapacity_, mirroredRings_, sessionPool_);
 
     if (!session)
     {
@@ -141,14 +210,26 @@ SessionHandle SessionManager::onAccepted(Socket &&client, const Acceptor::PeerEn
     });
 
     const int fd = session->nativeHandle();
-    if (!loop_->addFd(fd, mask, session.get()))
+
+    // io_uring: readiness poll 대신 multishot recv 완료로 구동한다(에러/종료도 recv 결과로 수신).
+    const bool completion = loop_->completionIoEnabled();
+    if (!loop_->addFd(fd, completion ? 0U : mask, session.get()))
     {
         hypernet::monitoring::engineMetrics().onError();
         return SessionHandle{};
     }
+    if (completion && !loop_->armRecv(fd))
+    {
+        (void)loop_->removeFd(fd);
+        hypernet::monitoring::engineMetrics().onError();
+        return SessionHandle{};
+    }
 
+    session->zeroCopy_ = zeroCopy;
     sessions_.emplace(id, session);
     session->startTimeouts_(*loop_, idleTimeoutMs_, heartbeatIntervalMs_);
+    if (ringReclaimTimerId_ == 0)
+        armRingReclaim_();
     hypernet::monitoring::engineMetrics().onConnectionOpened();
 
     SLOG_INFO("SessionManager", "SessionStart", "sid={} fd={} peer_ip={} peer_port={}", id, fd, peer.ip, peer.port);
@@ -177,6 +258,7 @@ hypernet::connector::ConnectorManager &SessionManager::connectors() noexcept
 void SessionManager::dispatchInjected(SessionHandle session, hypernet::protocol::Dispatcher::OpCode opcode, std::vector<std::uint8_t> body) noexcept
 {
     assertInOwnerThread_("dispatchInjected");
+    const DispatchStamp stamp(dispatchStartNs_, latencyMetrics_ != nullptr);
 
     if (sessions_.find(session.id()) == sessions_.end())
         return;
@@ -204,6 +286,11 @@ void SessionManager::onSessionClosed(SessionHandle::Id id) noexcept
     hypernet::monitoring::engineMetrics().onConnectionClosed();
     SLOG_INFO("SessionManager", "SessionEnd", "sid={}", id);
 
+    if (session && !session->forwarders_.empty())
+    {
+        dropForwards_(id, session->forwarders_);
+    }
+
     if (app_)
     {
         try
@@ -228,6 +315,17 @@ void SessionManager::shutdownInOwnerThread() noexcept
         connectors_->shutdownDialsInOwnerThread();
     }
 
+    // deferred flush 로 남아 있던 송신분을 닫기 전에 내보낸다.
+    flushDirty_();
+    loop_->setIterationEndHook({});
+
+    if (ringReclaimTimerId_ != 0)
+    {
+        (void)loop_->cancelTimer(ringReclaimTimerId_);
+        ringReclaimTimerId_ = 0;
+    }
+    ringReclaimMs_ = 0;
+
     for (auto &kv : sessions_)
     {
         auto &s = kv.second;
@@ -235,6 +333,7 @@ void SessionManager::shutdownInOwnerThread() noexcept
             s->closeFromManager_(*loop_, "worker_shutdown");
     }
     sessions_.clear();
+    forwards_.clear();
 }
 
 void SessionManager::closeByPolicy_(hypernet::SessionHandle::Id id, const char *reason, int err) noexcept
@@ -245,7 +344,26 @@ void SessionManager::closeByPolicy_(hypernet::SessionHandle::Id id, const char *
 
     auto it = sessions_.find(id);
     if (it == sessions_.end())
+    {
+        // 옮겨 간 세션이면 현재 owner 에서 닫는다.
+        // - reason 은 호출자 버퍼일 수 있으므로 (예: hyperapp SessionService::close) 복사해서 넘긴다.
+        if (const auto f = forwards_.find(id); f != forwards_.end() && migrator_)
+        {
+            SessionManager *next = migrator_->sessionsOf(f->second);
+            if (!next)
+                return;
+            try
+            {
+                (void)migrator_->post(f->second, [next, id, why = std::string(reason ? reason : "policy_close"), err]()
+                                      { next->closeByPolicy_(id, why.c_str(), err); });
+            }
+            catch (const std::bad_alloc &)
+            {
+                SLOG_WARN("SessionManager", "ForwardCloseDropped", "sid={} to={}", id, f->second);
+            }
+        }
         return;
+    }
 
     if (auto &sess = it->second)
         sess->beginClose_(*loop_, reason ? reason : "policy_close", err);
@@ -266,6 +384,7 @@ void SessionManager::closeAllByPolicy(const char *reason, int err) noexcept
 void SessionManager::dispatchOnMessage(SessionHandle session, const hypernet::protocol::MessageView &message) noexcept
 {
     assertInOwnerThread_("dispatchOnMessage");
+    const DispatchStamp stamp(dispatchStartNs_, latencyMetrics_ != nullptr);
     hypernet::monitoring::engineMetrics().onRxMessage();
 
     std::uint16_t opcode = 0;
@@ -291,6 +410,64 @@ void SessionManager::dispatchOnMessage(SessionHandle session, const hypernet::pr
     }
 }
 
+void SessionManager::dispatchBatch(const Session &session, std::span<const hypernet::protocol::MessageView> frames) noexcept
+{
+    assertInOwnerThread_("dispatchBatch");
+    if (frames.empty())
+        return;
+    const DispatchStamp stamp(dispatchStartNs_, latencyMetrics_ != nullptr);
+    hypernet::monitoring::engineMetrics().onRxMessages(frames.size());
+
+    const SessionHandle handle = session.handle();
+    const auto closed = [&session] { return session.state() != SessionState::Connected; };
+
+    std::size_t i = 0;
+    while (i < frames.size())
+    {
+        std::uint16_t opcode = 0;
+        hypernet::protocol::MessageView body{};
+        if (!hypernet::protocol::splitOpcodeU16Be(frames[i], opcode, body))
+        {
+            closeByPolicy_(handle.id(), "invalid_opcode_prefix");
+            return;
+        }
+
+        if (opcode == hypernet::protocol::kOpcodePing)
+        {
+            (void)sendPacketU16(handle.id(), hypernet::protocol::kOpcodePong, nullptr, 0);
+            ++i;
+            continue;
+        }
+        if (opcode == hypernet::protocol::kOpcodePong)
+        {
+            ++i;
+            continue;
+        }
+
+        // 같은 opcode 가 이어지는 구간을 모아 handler 조회 1회로 넘긴다.
+        bodyRun_.clear();
+        bodyRun_.push_back(body);
+        std::size_t j = i + 1;
+        for (; j < frames.size(); ++j)
+        {
+            std::uint16_t nextOpcode = 0;
+            hypernet::protocol::MessageView nextBody{};
+            if (!hypernet::protocol::splitOpcodeU16Be(frames[j], nextOpcode, nextBody) || nextOpcode != opcode)
+                break;
+            bodyRun_.push_back(nextBody);
+        }
+
+        if (!dispatcher_.dispatchBatch(opcode, handle, bodyRun_, closed))
+        {
+            closeByPolicy_(handle.id(), "unknown_opcode");
+            return;
+        }
+        if (closed())
+            return;
+        i = j;
+    }
+}
+
 void SessionManager::configureTimeouts(std::uint32_t idleTimeoutMs, std::uint32_t heartbeatIntervalMs) noexcept
 {
     assertInOwnerThread_("configureTimeouts");
@@ -298,6 +475,346 @@ void SessionManager::configureTimeouts(std::uint32_t idleTimeoutMs, std::uint32_
     heartbeatIntervalMs_ = heartbeatIntervalMs;
 }
 
+void SessionManager::configureBusyPoll(std::uint32_t busyPollUs) noexcept
+{
+    assertInOwnerThread_("configureBusyPoll");
+    busyPollUs_ = busyPollUs;
+}
+
+void SessionManager::configureMirroredRings(bool enable) noexcept
+{
+    assertInOwnerThread_("configureMirroredRings");
+    mirroredRings_ = enable;
+    stagingRing_.reset(); // 다음 recvStaging_() 에서 새 레이아웃으로 다시 만든다
+    stagingFailed_ = false;
+}
+
+void SessionManager::configureSessionPool(std::size_t prewarm, std::size_t maxIdle) noexcept
+{
+    assertInOwnerThread_("configureSessionPool");
+    sessionPool_.reset();
+    if (maxIdle == 0)
+        return;
+
+    const std::size_t target = prewarm < maxIdle ? prewarm : maxIdle;
+    try
+    {
+        sessionPool_ = std::make_shared<SessionPool>(static_cast<int>(ownerWorkerId_), maxIdle, hypernet::monitoring::engineMetrics().workerSessionPool(ownerWorkerId_));
+
+        // 빈 소켓으로 세션을 만들었다가 한꺼번에 놓아 슬롯을 풀에 채운다.
+        // 링은 세션이 lazy 로 꺼내므로 세션과 같은 수만큼 따로 꺼냈다가 돌려놓는다.
+        using Layout = hypernet::buffer::RingBuffer::Layout;
+        const Layout layout = mirroredRings_ ? Layout::Mirrored : Layout::Flat;
+        std::vector<std::shared_ptr<Session>> warm;
+        std::vector<std::unique_ptr<hypernet::buffer::RingBuffer>> recvRings;
+        std::vector<std::unique_ptr<hypernet::buffer::RingBuffer>> sendRings;
+        warm.reserve(target);
+        recvRings.reserve(target);
+        sendRings.reserve(target);
+        for (std::size_t i = 0; i < target; ++i)
+        {
+            auto s = Session::create(SessionHandle{}, static_cast<int>(ownerWorkerId_), Socket{}, nullptr, recvRingCapacity_, sendRingCapacity_, mirroredRings_, sessionPool_);
+            if (!s)
+                break;
+            warm.push_back(std::move(s));
+            recvRings.push_back(sessionPool_->acquireRing(recvRingCapacity_, layout));
+            sendRings.push_back(sessionPool_->acquireRing(sendRingCapacity_, layout));
+        }
+        warm.clear();
+        for (auto &r : recvRings)
+            sessionPool_->releaseRing(recvRingCapacity_, layout, std::move(r));
+        for (auto &r : sendRings)
+            sessionPool_->releaseRing(sendRingCapacity_, layout, std::move(r));
+        sessionPool_->prefaultIdleRings();
+        sessionPool_->resetStats();
+    }
+    catch (const std::exception &e)
+    {
+        SLOG_ERROR("SessionManager", "SessionPoolPrewarmFailed", "prewarm={} what='{}'", target, e.what());
+    }
+
+    if (sessionPool_)
+    {
+        SLOG_INFO("SessionManager", "SessionPoolConfigured", "prewarm={} max_idle={} idle_sessions={} idle_rings={}", target, maxIdle, sessionPool_->idleSessions(), sessionPool_->idleRings());
+    }
+}
+
+void SessionManager::prefaultWorkingSet() noexcept
+{
+    assertInOwnerThread_("prefaultWorkingSet");
+    // staging 링은 생성 스레드의 페이지 정책으로 만들어지므로 여기서 만들면 prefault 까지 끝난다.
+    (void)recvStaging_();
+    try
+    {
+        framer_.prefaultScratch();
+    }
+    catch (const std::exception &e)
+    {
+        SLOG_WARN("SessionManager", "ScratchPrefaultFailed", "what='{}'", e.what());
+    }
+}
+
+void SessionManager::configureRingReclaim(std::uint32_t idleMs) noexcept
+{
+    assertInOwnerThread_("configureRingReclaim");
+    // 타이머는 루프 bind 이후 첫 세션이 붙을 때 건다. (armRingReclaim_)
+    ringReclaimMs_ = idleMs;
+    SLOG_INFO("SessionManager", "RingReclaimConfigured", "idle_ms={}", idleMs);
+}
+
+void SessionManager::armRingReclaim_() noexcept
+{
+    if (ringReclaimMs_ == 0 || !loop_)
+        return;
+
+    const auto period = std::chrono::milliseconds(ringReclaimMs_ / 2 != 0 ? ringReclaimMs_ / 2 : 1);
+    // 실행 중인 노드도 reschedule 로 재사용한다. (할당 없음)
+    if (ringReclaimTimerId_ != 0 && loop_->rescheduleTimer(ringReclaimTimerId_, period))
+        return;
+    ringReclaimTimerId_ = loop_->addTimer(period, [this]() noexcept { reclaimIdleRings_(); });
+}
+
+hypernet::buffer::RingBuffer *SessionManager::recvStaging_() noexcept
+{
+    if (stagingRing_ || stagingFailed_)
+        return stagingRing_.get();
+
+    try
+    {
+        using Layout = hypernet::buffer::RingBuffer::Layout;
+        stagingRing_ = std::make_unique<hypernet::buffer::RingBuffer>(recvRingCapacity_, mirroredRings_ ? Layout::Mirrored : Layout::Flat);
+    }
+    catch (const std::exception &e)
+    {
+        // staging 없이도 동작한다. (세션마다 링을 바로 꺼냄)
+        stagingFailed_ = true;
+        SLOG_WARN("SessionManager", "RecvStagingAllocFailed", "cap={} what='{}'", recvRingCapacity_, e.what());
+    }
+    return stagingRing_.get();
+}
+
+void SessionManager::reclaimIdleRings_() noexcept
+{
+    if (ringReclaimMs_ == 0 || !loop_)
+    {
+        ringReclaimTimerId_ = 0;
+        return;
+    }
+
+    const auto idle = std::chrono::milliseconds(ringReclaimMs_);
+    const auto now = loop_->now();
+    std::size_t released = 0;
+    for (auto &kv : sessions_)
+    {
+        if (auto &s = kv.second)
+            released += s->reclaimIdleRings_(now, idle);
+    }
+
+    if (released != 0)
+    {
+        if (auto *m = hypernet::monitoring::engineMetrics().workerSessionPool(ownerWorkerId_))
+            m->ringReclaimsTotal.fetch_add(released, std::memory_order_relaxed);
+        SLOG_DEBUG("SessionManager", "RingsReclaimed", "count={} sessions={}", released, sessions_.size());
+    }
+
+    // 세션이 없으면 멈췄다가 다음 onAccepted 에서 다시 건다. (유휴 워커를 깨우지 않음)
+    if (sessions_.empty())
+    {
+        ringReclaimTimerId_ = 0;
+        return;
+    }
+    armRingReclaim_();
+}
+
+void SessionManager::configureDeferredFlush(bool enable, bool cork) noexcept
+{
+    assertInOwnerThread_("configureDeferredFlush");
+    if (!loop_)
+        return;
+
+    deferredFlush_ = enable;
+    deferredCork_ = enable && cork;
+    if (enable)
+        loop_->setIterationEndHook([this] { flushDirty_(); });
+    else
+        loop_->setIterationEndHook({});
+}
+
+void SessionManager::configureZeroCopy(std::size_t threshold, std::size_t blockCount) noexcept
+{
+    assertInOwnerThread_("configureZeroCopy");
+    zeroCopyThreshold_ = 0;
+    zeroCopyPool_.reset();
+    if (!loop_ || threshold == 0 || blockCount == 0)
+        return;
+
+    // io_uring 백엔드는 SEND 체인이 링을 직접 참조하므로 복사 경로를 유지한다.
+    if (loop_->completionIoEnabled())
+    {
+        SLOG_WARN("SessionManager", "ZeroCopyDisabled", "reason='io_uring backend'");
+        return;
+    }
+
+    const std::size_t blockSize = hypernet::protocol::MessageHeader::kLengthFieldBytes + hypernet::protocol::MessageHeader::kOpcodeFieldBytes + maxPayloadLen_;
+    try
+    {
+        zeroCopyPool_ = std::make_unique<hypernet::buffer::BufferPool>(blockSize, blockCount);
+    }
+    catch (const std::exception &e)
+    {
+        SLOG_ERROR("SessionManager", "ZeroCopyPoolAllocFailed", "block_size={} blocks={} what='{}'", blockSize, blockCount, e.what());
+        return;
+    }
+    zeroCopyThreshold_ = threshold;
+    SLOG_INFO("SessionManager", "ZeroCopyConfigured", "threshold={} block_size={} blocks={}", threshold, blockSize, blockCount);
+}
+
+void SessionManager::recordSendCompletion_(std::int64_t sinceNs) noexcept
+{
+    if (latencyMetrics_ && sinceNs != 0)
+    {
+        latencyMetrics_->sendCompletion.record(hypernet::monitoring::latencyNowNs() - sinceNs);
+    }
+}
+
+void SessionManager::configureSendQueue(std::size_t limitBytes, std::size_t highWatermark, std::size_t lowWatermark) noexcept
+{
+    assertInOwnerThread_("configureSendQueue");
+    sendQueueLimit_ = 0;
+    sendQueuePool_.reset();
+    sendQueueMetrics_ = hypernet::monitoring::engineMetrics().workerSendQueue(ownerWorkerId_);
+    if (limitBytes == 0)
+        return;
+
+    try
+    {
+        sendQueuePool_ = std::make_unique<hypernet::buffer::BufferPool>(hypernet::core::defaults::kSendQueueBlockBytes, hypernet::core::defaults::kSendQueuePoolBlocks);
+    }
+    catch (const std::exception &e)
+    {
+        // 풀 없이도 동작한다. (블록을 매번 힙에서 꺼냄)
+        SLOG_WARN("SessionManager", "SendQueuePoolAllocFailed", "what='{}'", e.what());
+    }
+
+    sendQueueLimit_ = limitBytes;
+    sendQueueHigh_ = std::clamp<std::size_t>(highWatermark, 1, limitBytes);
+    sendQueueLow_ = std::min(lowWatermark, sendQueueHigh_ - 1);
+    SLOG_INFO("SessionManager", "SendQueueConfigured", "limit={} high={} low={} block_size={} pool_blocks={}", sendQueueLimit_, sendQueueHigh_, sendQueueLow_, hypernet::core::defaults::kSendQueueBlockBytes,
+              sendQueuePool_ ? sendQueuePool_->capacity() : 0);
+}
+
+std::size_t SessionManager::queuedSendBytes(SessionHandle::Id id) const noexcept
+{
+    auto it = sessions_.find(id);
+    if (it == sessions_.end() || !it->second)
+        return 0;
+    return it->second->queuedSendBytes();
+}
+
+void *SessionManager::acquireSendQueueBlock_(bool &pooled) noexcept
+{
+    if (sendQueuePool_)
+    {
+        if (void *block = sendQueuePool_->allocate())
+        {
+            pooled = true;
+            return block;
+        }
+    }
+
+    pooled = false;
+    void *block = ::operator new(hypernet::core::defaults::kSendQueueBlockBytes, std::nothrow);
+    if (block && sendQueueMetrics_)
+        sendQueueMetrics_->heapBlocksTotal.fetch_add(1, std::memory_order_relaxed);
+    return block;
+}
+
+void SessionManager::releaseSendQueueBlock_(void *block, bool pooled) noexcept
+{
+    if (pooled)
+    {
+        if (sendQueuePool_)
+            sendQueuePool_->deallocate(block);
+        return;
+    }
+    ::operator delete(block);
+}
+
+void SessionManager::notifySendBackpressure_(SessionHandle handle, bool congested) noexcept
+{
+    SLOG_INFO("SessionManager", "SendBackpressure", "sid={} congested={} queued={}", handle.id(), congested, queuedSendBytes(handle.id()));
+    if (!app_)
+        return;
+
+    try
+    {
+        app_->onSendBackpressure(handle, congested);
+    }
+    catch (...)
+    {
+        SLOG_ERROR("SessionManager", "OnSendBackpressureThrew", "sid={}", handle.id());
+    }
+}
+
+void SessionManager::releaseZeroCopyBlock_(void *block) noexcept
+{
+    if (zeroCopyPool_)
+        zeroCopyPool_->deallocate(block);
+}
+
+void SessionManager::quarantineZeroCopyBlock_(void *block) noexcept
+{
+    if (!zeroCopyPool_ || !block)
+        return;
+
+    const auto delay = std::chrono::milliseconds(hypernet::core::defaults::kZeroCopyQuarantineMs);
+    zcQuarantine_.push_back(QuarantinedBlock{block, std::chrono::steady_clock::now() + delay});
+    if (!zcQuarantineArmed_ && loop_)
+    {
+        zcQuarantineArmed_ = true;
+        loop_->addTimer(delay, [this]() noexcept { releaseQuarantined_(); });
+    }
+}
+
+void SessionManager::releaseQuarantined_() noexcept
+{
+    zcQuarantineArmed_ = false;
+
+    const auto now = std::chrono::steady_clock::now();
+    std::size_t n = 0;
+    while (n < zcQuarantine_.size() && zcQuarantine_[n].releaseAt <= now)
+    {
+        releaseZeroCopyBlock_(zcQuarantine_[n].block);
+        ++n;
+    }
+    zcQuarantine_.erase(zcQuarantine_.begin(), zcQuarantine_.begin() + static_cast<std::ptrdiff_t>(n));
+
+    if (!zcQuarantine_.empty() && loop_)
+    {
+        zcQuarantineArmed_ = true;
+        const auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(zcQuarantine_.front().releaseAt - now) + std::chrono::milliseconds(1);
+        loop_->addTimer(delay, [this]() noexcept { releaseQuarantined_(); });
+    }
+}
+
+void SessionManager::flushDirty_() noexcept
+{
+    if (dirty_.empty())
+        return;
+
+    // flush 중 close → app 콜백 → send 로 dirty_ 가 다시 채워질 수 있으므로 swap 후 순회한다.
+    flushing_.swap(dirty_);
+    for (auto &s : flushing_)
+    {
+        if (!s->flushPending_)
+            continue; // beginClose_ 가 이미 처리
+        s->flushPending_ = false;
+        (void)s->flushDeferred_(*loop_, deferredCork_);
+        s->notifySendBackpressure_();
+    }
+    flushing_.clear();
+}
+
 bool SessionManager::sendPacketU16(SessionHandle::Id id, std::uint16_t opcode, const void *body, std::size_t bodyLen) noexcept
 {
     assertInOwnerThread_("sendPacketU16");
@@ -308,8 +825,47 @@ bool SessionManager::sendPacketU16(SessionHandle::Id id, std::uint16_t opcode, c
 
     auto it = sessions_.find(id);
     if (it == sessions_.end() || !it->second)
+        return forwardPacket_(id, opcode, body, bodyLen);
+
+    const hypernet::protocol::MessageHeader hdr{
+        static_cast<std::uint32_t>(payloadLen),
+        opcode,
+    };
+
+    std::uint8_t lenHdr[hypernet::protocol::MessageHeader::kLengthFieldBytes];
+    hdr.encodeLen(lenHdr);
+
+    std::uint8_t opHdr[hypernet::protocol::MessageHeader::kOpcodeFieldBytes];
+    hdr.encodeOpcode(opHdr);
+
+    const hypernet::protocol::BodyPiece segs[] = {
+        {lenHdr, sizeof(lenHdr)},
+        {opHdr, sizeof(opHdr)},
+        {static_cast<const std::uint8_t *>(body), bodyLen},
+    };
+    return sendFrame_(id, it->second, segs, 3, bodyLen);
+}
+
+bool SessionManager::relayPacketU16(SessionHandle::Id id, std::uint16_t opcode, const void *body, std::size_t bodyLen,
+                                    std::span<const hypernet::protocol::FieldPatch> patches) noexcept
+{
+    assertInOwnerThread_("relayPacketU16");
+
+    if (patches.empty())
+        return sendPacketU16(id, opcode, body, bodyLen);
+
+    const std::size_t payloadLen = hypernet::protocol::MessageHeader::payloadLenForBody(bodyLen);
+    if (payloadLen > hypernet::protocol::MessageHeader::kMaxPayloadLenU64)
         return false;
 
+    hypernet::protocol::PatchedBody patched;
+    if (!hypernet::protocol::splitPatched(body, bodyLen, patches, patched))
+        return false;
+
+    auto it = sessions_.find(id);
+    if (it == sessions_.end() || !it->second)
+        return forwardPacket_(id, opcode, body, bodyLen, patches);
+
     const hypernet::protocol::MessageHeader hdr{
         static_cast<std::uint32_t>(payloadLen),
         opcode,
@@ -321,7 +877,150 @@ bool SessionManager::sendPacketU16(SessionHandle::Id id, std::uint16_t opcode, c
     std::uint8_t opHdr[hypernet::protocol::MessageHeader::kOpcodeFieldBytes];
     hdr.encodeOpcode(opHdr);
 
-    return it->second->enqueuePacketU16Coalesced(*loop_, lenHdr, opHdr, body, bodyLen);
+    hypernet::protocol::BodyPiece segs[Session::kMaxFrameSegs];
+    segs[0] = {lenHdr, sizeof(lenHdr)};
+    segs[1] = {opHdr, sizeof(opHdr)};
+    int cnt = 2;
+    for (std::size_t i = 0; i < patched.count; ++i)
+        segs[cnt++] = patched.pieces[i];
+
+    return sendFrame_(id, it->second, segs, cnt, bodyLen);
+}
+
+bool SessionManager::sendFrame_(SessionHandle::Id id, const std::shared_ptr<Session> &session,
+                                const hypernet::protocol::BodyPiece *segs, int cnt, std::size_t bodyLen) noexcept
+{
+    if (!enqueuePacket_(session, segs, cnt, bodyLen))
+        return false;
+
+    // 패킷을 다 적재한 뒤에만 watermark 전이를 앱에 알린다. (조각 적재 도중 재진입 방지)
+    // 송신 중 세션이 닫혀 map 에서 빠졌을 수 있으므로 다시 찾는다.
+    if (sendQueueLimit_ != 0)
+    {
+        if (auto again = sessions_.find(id); again != sessions_.end() && again->second)
+            again->second->notifySendBackpressure_();
+    }
+    return true;
+}
+
+bool SessionManager::enqueueZeroCopyBlock_(const std::shared_ptr<Session> &session, void *block, std::size_t frameLen) noexcept
+{
+    if (!deferredFlush_)
+        return session->enqueueZeroCopy_(*loop_, block, frameLen, /*flush=*/true);
+
+    if (!session->enqueueZeroCopy_(*loop_, block, frameLen, /*flush=*/false))
+        return false;
+    if (!session->flushPending_)
+    {
+        session->flushPending_ = true;
+        dirty_.push_back(session);
+    }
+    return true;
+}
+
+std::span<std::uint8_t> SessionManager::acquireZeroCopyBody() noexcept
+{
+    assertInOwnerThread_("acquireZeroCopyBody");
+    if (zeroCopyThreshold_ == 0 || !zeroCopyPool_)
+        return {};
+
+    void *block = zeroCopyPool_->allocate();
+    if (!block)
+        return {};
+    return {static_cast<std::uint8_t *>(block) + kZeroCopyHeaderBytes, zeroCopyPool_->blockSize() - kZeroCopyHeaderBytes};
+}
+
+bool SessionManager::sendZeroCopyBody(SessionHandle::Id id, std::uint16_t opcode, std::span<std::uint8_t> body, std::size_t bodyLen) noexcept
+{
+    assertInOwnerThread_("sendZeroCopyBody");
+    if (body.empty())
+        return false;
+
+    void *block = body.data() - kZeroCopyHeaderBytes;
+    if (bodyLen > body.size())
+    {
+        releaseZeroCopyBlock_(block);
+        return false;
+    }
+
+    // 옮겨 간 세션(forward 는 PacketBuffer 로 복사)이나 SO_ZEROCOPY 를 못 켠 소켓: 일반 경로로 보낸다.
+    auto it = sessions_.find(id);
+    if (it == sessions_.end() || !it->second || !it->second->zeroCopy_)
+    {
+        const bool ok = sendPacketU16(id, opcode, body.data(), bodyLen);
+        releaseZeroCopyBlock_(block);
+        return ok;
+    }
+
+    const hypernet::protocol::MessageHeader hdr{
+        static_cast<std::uint32_t>(hypernet::protocol::MessageHeader::payloadLenForBody(bodyLen)),
+        opcode,
+    };
+    auto *p = static_cast<std::uint8_t *>(block);
+    hdr.encodeLen(p);
+    hdr.encodeOpcode(p + hypernet::protocol::MessageHeader::kLengthFieldBytes);
+
+    if (!enqueueZeroCopyBlock_(it->second, block, kZeroCopyHeaderBytes + bodyLen))
+        return false;
+
+    // sendFrame_ 과 같이 적재 뒤에만 watermark 전이를 알린다.
+    if (sendQueueLimit_ != 0)
+    {
+        if (auto again = sessions_.find(id); again != sessions_.end() && again->second)
+            again->second->notifySendBackpressure_();
+    }
+    return true;
+}
+
+void SessionManager::releaseZeroCopyBody(std::span<std::uint8_t> body) noexcept
+{
+    assertInOwnerThread_("releaseZeroCopyBody");
+    if (!body.empty())
+        releaseZeroCopyBlock_(body.data() - kZeroCopyHeaderBytes);
+}
+
+std::size_t SessionManager::zeroCopyBlocksInUse() const noexcept
+{
+    return zeroCopyPool_ ? zeroCopyPool_->capacity() - zeroCopyPool_->freeBlocks() : 0;
+}
+
+bool SessionManager::enqueuePacket_(const std::shared_ptr<Session> &session, const hypernet::protocol::BodyPiece *segs, int cnt,
+                                    std::size_t bodyLen) noexcept
+{
+    constexpr std::size_t kLenBytes = hypernet::protocol::MessageHeader::kLengthFieldBytes;
+    constexpr std::size_t kOpBytes = hypernet::protocol::MessageHeader::kOpcodeFieldBytes;
+
+    // 큰 body: 풀 블록에 프레임 전체를 1회 적재하고 MSG_ZEROCOPY 로 송신한다.
+    // - 풀 고갈/블록 초과 시에는 아래 복사 경로로 내려간다.
+    // - 이 1회 복사도 피하려면 호출자가 acquireZeroCopyBody 로 받은 블록에 body 를 직접 쓴다.
+    if (zeroCopyThreshold_ != 0 && bodyLen >= zeroCopyThreshold_ && session->zeroCopy_ && kLenBytes + kOpBytes + bodyLen <= zeroCopyPool_->blockSize())
+    {
+        if (void *block = zeroCopyPool_->allocate())
+        {
+            auto *p = static_cast<std::uint8_t *>(block);
+            std::size_t frameLen = 0;
+            for (int i = 0; i < cnt; ++i)
+            {
+                if (segs[i].n == 0)
+                    continue;
+                std::memcpy(p + frameLen, segs[i].p, segs[i].n);
+                frameLen += segs[i].n;
+            }
+            return enqueueZeroCopyBlock_(session, block, frameLen);
+        }
+    }
+
+    if (!deferredFlush_)
+        return session->enqueueFrameCoalesced(*loop_, segs, cnt);
+
+    if (!session->enqueueFrameDeferred(*loop_, segs, cnt))
+        return false;
+    if (!session->flushPending_)
+    {
+        session->flushPending_ = true;
+        dirty_.push_back(session);
+    }
+    return true;
 }
 
 void SessionManager::beginClose(SessionHandle::Id id, const char *reason, int err) noexcept
@@ -330,4 +1029,256 @@ void SessionManager::beginClose(SessionHandle::Id id, const char *reason, int er
     closeByPolicy_(id, reason, err);
 }
 
+// ===== 워커 간 세션 이관 =====
+bool SessionManager::migrateOut(SessionHandle::Id id, unsigned int target) noexcept
+{
+    assertInOwnerThread_("migrateOut");
+    if (!loop_ || !migrator_ || !migrator_->sessionsOf(target))
+        return false;
+
+    auto it = sessions_.find(id);
+    if (it == sessions_.end() || !it->second)
+    {
+        // 이미 옮겨 간 세션: 요청을 현재 owner 쪽으로 넘긴다. (이 워커로 되돌리는 요청 포함)
+        const auto f = forwards_.find(id);
+        if (f == forwards_.end())
+            return false;
+        SessionManager *next = migrator_->sessionsOf(f->second);
+        return next && migrator_->post(f->second, [next, id, target]() { (void)next->migrateOut(id, target); });
+    }
+    if (target == ownerWorkerId_)
+        return false;
+
+    const std::shared_ptr<Session> session = it->second;
+    const char *refused = nullptr;
+    if (loop_->completionIoEnabled())
+    {
+        // io_uring 은 진행 중인 multishot recv/SEND 를 다른 링으로 옮길 수 없다.
+        refused = "CompletionIo";
+    }
+    else if (session->state_ == SessionState::Connected && session->flushPending_)
+    {
+        // 이번 iteration 에 쌓인 응답은 옮기기 전에 내보낸다.
+        session->flushPending_ = false;
+        (void)session->flushDeferred_(*loop_, deferredCork_);
+    }
+    if (!refused && session->state_ != SessionState::Connected)
+        refused = "NotConnected";
+    if (!refused && (session->hasPendingSend_() || !session->zcInFlight_.empty()))
+        refused = "PendingSend";
+    if (refused)
+    {
+        SLOG_DEBUG("SessionManager", "MigrateRefused", "sid={} to={} reason={}", id, target, refused);
+        return false;
+    }
+
+    std::unique_ptr<MigratingSession> parcel;
+    std::vector<unsigned int> forwarders;
+    try
+    {
+        parcel = std::make_unique<MigratingSession>();
+        forwarders = session->forwarders_;
+        if (std::find(forwarders.begin(), forwarders.end(), ownerWorkerId_) == forwarders.end())
+            forwarders.push_back(ownerWorkerId_);
+        forwards_.reserve(forwards_.size() + 1);
+    }
+    catch (const std::exception &e)
+    {
+        SLOG_ERROR("SessionManager", "MigrateRefused", "sid={} to={} reason=AllocFailed what='{}'", id, target, e.what());
+        return false;
+    }
+
+    // 앱 상태는 이 워커 스레드에서 떼어 내서 대상 워커로 함께 넘긴다. (동의하지 않으면 그대로 둠)
+    const SessionHandle handle = session->handle();
+    bool agreed = false;
+    if (app_)
+    {
+        try
+        {
+            agreed = app_->onSessionMigrateOut(handle, static_cast<int>(target), parcel->appContext);
+        }
+        catch (...)
+        {
+            SLOG_ERROR("SessionManager", "OnSessionMigrateOutThrew", "sid={}", id);
+            agreed = false;
+        }
+    }
+    if (!agreed)
+    {
+        SLOG_DEBUG("SessionManager", "MigrateRefused", "sid={} to={} reason=AppDeclined", id, target);
+        return false;
+    }
+
+    (void)loop_->removeFd(session->nativeHandle());
+    session->cancelTimers_(*loop_);
+    session->moveOutTo_(*parcel);
+    parcel->id = id;
+    parcel->forwarders = forwarders;
+
+    sessions_.erase(id);
+    hypernet::monitoring::engineMetrics().onConnectionClosed();
+
+    if (!migrator_->deliver(target, std::move(parcel)))
+    {
+        // 연결은 이미 닫혔다. 이 워커에서 끝난 세션으로 정리한다.
+        dropForwards_(id, forwarders);
+        if (app_)
+        {
+            try
+            {
+                app_->onSessionEnd(handle);
+            }
+            catch (...)
+            {
+                SLOG_ERROR("SessionManager", "OnSessionEndThrew", "");
+            }
+        }
+        return false;
+    }
+
+    forwards_[id] = target;
+    SLOG_INFO("SessionManager", "SessionMigratedOut", "sid={} to={}", id, target);
+    return true;
+}
+
+void SessionManager::adoptMigrated(std::unique_ptr<MigratingSession> parcel) noexcept
+{
+    assertInOwnerThread_("adoptMigrated");
+    if (!loop_ || !parcel)
+        return;
+
+    const auto id = parcel->id;
+    // 다시 돌아온 세션이면 이 워커의 forward 엔트리는 필요 없다.
+    forwards_.erase(id);
+    std::erase(parcel->forwarders, ownerWorkerId_);
+
+    auto handle = makeHandle_(id);
+    auto session = Session::create(handle, static_cast<int>(ownerWorkerId_), std::move(parcel->socket), this, recvRingCapacity_, sendRingCapacity_, mirroredRings_, sessionPool_);
+
+    // epoll 에 다시 등록하면 ET 라도 지금 쌓여 있는 수신분이 한 번 통지된다.
+    const int fd = session ? session->nativeHandle() : -1;
+    if (!session || !loop_->addFd(fd, Session::baseEpollMask_(), session.get()))
+    {
+        hypernet::monitoring::engineMetrics().onError();
+        SLOG_ERROR("SessionManager", "AdoptFailed", "sid={} action=Closed", id);
+        if (session)
+            session->socket_.close();
+        dropForwards_(id, parcel->forwarders);
+        if (app_)
+        {
+            try
+            {
+                app_->onSessionEnd(handle);
+            }
+            catch (...)
+            {
+                SLOG_ERROR("SessionManager", "OnSessionEndThrew", "");
+            }
+        }
+        return;
+    }
+
+    session->adoptFrom_(*parcel);
+    sessions_.emplace(id, session);
+    session->startTimeouts_(*loop_, idleTimeoutMs_, heartbeatIntervalMs_);
+    if (ringReclaimTimerId_ == 0)
+        armRingReclaim_();
+    hypernet::monitoring::engineMetrics().onConnectionOpened();
+    hypernet::monitoring::engineMetrics().onSessionMigratedIn();
+
+    SLOG_INFO("SessionManager", "SessionMigratedIn", "sid={} fd={} forwarders={}", id, fd, session->forwarders_.size());
+
+    if (app_)
+    {
+        try
+        {
+            app_->onSessionMigrateIn(handle, std::move(parcel->appContext));
+        }
+        catch (...)
+        {
+            SLOG_ERROR("SessionManager", "OnSessionMigrateInThrew", "sid={}", id);
+        }
+    }
+}
+
+bool SessionManager::migrateBusiest(unsigned int target, std::chrono::milliseconds minResidency) noexcept
+{
+    assertInOwnerThread_("migrateBusiest");
+    if (!loop_ || sessions_.size() < 2)
+        return false;
+
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<std::pair<std::uint64_t, SessionHandle::Id>> candidates;
+    std::uint64_t total = 0;
+    try
+    {
+        candidates.reserve(sessions_.size());
+        for (auto &[id, s] : sessions_)
+        {
+            if (!s)
+                continue;
+            const std::uint64_t delta = s->rxBytes_ - s->rxBytesMark_;
+            s->rxBytesMark_ = s->rxBytes_;
+            total += delta;
+            if (delta != 0 && now - s->residentSince_ >= minResidency)
+                candidates.emplace_back(delta, id);
+        }
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+
+    // 큰 세션부터 시도하되, 워커 수신량의 절반을 넘는 세션은 옮기면 상대 워커가 더 바빠진다.
+    std::sort(candidates.begin(), candidates.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+    for (const auto &[delta, id] : candidates)
+    {
+        if (delta * 2 > total)
+            continue;
+        if (migrateOut(id, target))
+            return true;
+    }
+    return false;
+}
+
+bool SessionManager::forwardPacket_(SessionHandle::Id id, std::uint16_t opcode, const void *body, std::size_t bodyLen,
+                                    std::span<const hypernet::protocol::FieldPatch> patches) noexcept
+{
+    const auto f = forwards_.find(id);
+    if (f == forwards_.end() || !migrator_)
+        return false;
+    SessionManager *next = migrator_->sessionsOf(f->second);
+    if (!next)
+        return false;
+
+    hypernet::buffer::PacketBuffer copy;
+    try
+    {
+        copy = hypernet::buffer::PacketBuffer::copyOf(body, bodyLen);
+    }
+    catch (const std::bad_alloc &)
+    {
+        return false;
+    }
+    if (!patches.empty())
+        hypernet::protocol::applyFieldPatches(copy.exclusiveData(), patches);
+    return migrator_->post(f->second, [next, id, opcode, copy = std::move(copy)]() { (void)next->sendPacketU16(id, opcode, copy.data(), copy.size()); });
+}
+
+void SessionManager::dropForwards_(SessionHandle::Id id, const std::vector<unsigned int> &forwarders) noexcept
+{
+    if (!migrator_)
+        return;
+    for (const unsigned int w : forwarders)
+    {
+        if (w == ownerWorkerId_)
+        {
+            forwards_.erase(id);
+            continue;
+        }
+        if (SessionManager *prev = migrator_->sessionsOf(w))
+            (void)migrator_->post(w, [prev, id]() { prev->forwards_.erase(id); });
+    }
+}
+
 } // namespace hypernet::net
@@ -0,0 +1,131 @@
+#include <hypernet/net/SessionMigration.hpp>
+
+#include <hypernet/core/Logger.hpp>
+#include <hypernet/monitoring/Metrics.hpp>
+#include <hypernet/net/EventLoop.hpp>
+#include <hypernet/net/SessionManager.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+namespace hypernet::net
+{
+
+SessionMigrator::SessionMigrator(std::size_t workerCount)
+    : count_(workerCount), targets_(std::make_unique<Target[]>(workerCount))
+{
+}
+
+void SessionMigrator::attach(unsigned int wid, EventLoop *loop, SessionManager *sessions) noexcept
+{
+    if (wid >= count_)
+    {
+        return;
+    }
+    targets_[wid].loop = loop;
+    targets_[wid].sessions = sessions;
+}
+
+bool SessionMigrator::post(unsigned int wid, core::Task task) noexcept
+{
+    if (wid >= count_ || !targets_[wid].loop || !targets_[wid].sessions)
+    {
+        return false;
+    }
+    try
+    {
+        targets_[wid].loop->post(std::move(task));
+        return true;
+    }
+    catch (const std::exception &e)
+    {
+        hypernet::monitoring::engineMetrics().onError();
+        SLOG_ERROR("SessionMigrator", "PostFailed", "to={} what='{}'", wid, e.what());
+        return false;
+    }
+}
+
+bool SessionMigrator::request(SessionHandle::Id sid, unsigned int target) noexcept
+{
+    if (target >= count_ || !targets_[target].sessions)
+    {
+        return false;
+    }
+    // 이벤트 처리 도중(예: 핸들러 안) 요청이어도 fd 는 다음 task drain 에서 뺀다.
+    const auto origin = static_cast<unsigned int>(SessionHandle::ownerWorkerFromId(sid));
+    SessionManager *sm = origin < count_ ? targets_[origin].sessions : nullptr;
+    return sm && post(origin, [sm, sid, target]() { (void)sm->migrateOut(sid, target); });
+}
+
+bool SessionMigrator::rebalance(unsigned int from, unsigned int to, std::chrono::milliseconds minResidency) noexcept
+{
+    if (from == to || from >= count_ || to >= count_ || !targets_[to].sessions)
+    {
+        return false;
+    }
+    SessionManager *sm = targets_[from].sessions;
+    return sm && post(from, [sm, to, minResidency]() { (void)sm->migrateBusiest(to, minResidency); });
+}
+
+bool SessionMigrator::deliver(unsigned int target, std::unique_ptr<MigratingSession> session) noexcept
+{
+    if (!session)
+    {
+        return false;
+    }
+    SessionManager *sm = target < count_ ? targets_[target].sessions : nullptr;
+    const SessionHandle::Id sid = session->id;
+    if (sm && post(target, [sm, s = std::move(session)]() mutable { sm->adoptMigrated(std::move(s)); }))
+    {
+        return true;
+    }
+    // task 와 함께 소켓도 닫혔다. (owner 쪽 세션은 이미 빠졌으므로 끊긴 연결로 끝남)
+    SLOG_ERROR("SessionMigrator", "DeliverFailed", "sid={} to={} action=Dropped", sid, target);
+    return false;
+}
+
+std::uint32_t workerUtilizationPct(std::uint64_t idleNs, std::uint64_t elapsedNs) noexcept
+{
+    if (elapsedNs == 0)
+    {
+        return 0;
+    }
+    const std::uint64_t idle = std::min(idleNs, elapsedNs);
+    return static_cast<std::uint32_t>(((elapsedNs - idle) * 100) / elapsedNs);
+}
+
+RebalanceMove planRebalance(const std::vector<std::uint32_t> &utilPct, const std::vector<std::int64_t> &sessions,
+                            std::uint32_t thresholdPct)
+{
+    RebalanceMove move{};
+    const std::size_t n = std::min(utilPct.size(), sessions.size());
+    if (n < 2)
+    {
+        return move;
+    }
+
+    std::size_t hot = 0;
+    std::size_t cold = 0;
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        if (utilPct[i] > utilPct[hot])
+        {
+            hot = i;
+        }
+        if (utilPct[i] < utilPct[cold])
+        {
+            cold = i;
+        }
+    }
+
+    if (hot == cold || sessions[hot] < 2 || utilPct[hot] - utilPct[cold] < thresholdPct)
+    {
+        return move;
+    }
+    move.from = static_cast<int>(hot);
+    move.to = static_cast<int>(cold);
+    return move;
+}
+
+} // namespace hypernet::net
@@ -0,0 +1,173 @@
+#include <hypernet/net/SessionPool.hpp>
+
+#include <hypernet/core/ThreadContext.hpp>
+#include <hypernet/monitoring/Metrics.hpp>
+
+#include <sys/uio.h> // iovec
+#include <cstring>   // std::memset
+
+namespace hypernet::net
+{
+
+SessionPool::SessionPool(int ownerWorkerId, std::size_t maxIdle,
+                         hypernet::monitoring::WorkerSessionPoolMetrics *metrics) noexcept
+    : ownerWorkerId_(ownerWorkerId), maxIdle_(maxIdle), metrics_(metrics)
+{
+}
+
+SessionPool::~SessionPool()
+{
+    for (void *p : idleSlots_)
+    {
+        ::operator delete(p);
+    }
+}
+
+bool SessionPool::onOwnerThread_() const noexcept
+{
+    return hypernet::core::ThreadContext::currentWorkerId() == ownerWorkerId_;
+}
+
+void *SessionPool::allocateSlot_(std::size_t bytes)
+{
+    if (onOwnerThread_())
+    {
+        if (slotBytes_ == 0)
+        {
+            slotBytes_ = bytes;
+            idleSlots_.reserve(maxIdle_);
+        }
+        if (bytes == slotBytes_ && !idleSlots_.empty())
+        {
+            void *p = idleSlots_.back();
+            idleSlots_.pop_back();
+            ++stats_.sessionHits;
+            publish_();
+            return p;
+        }
+        ++stats_.sessionMisses;
+        publish_();
+    }
+    return ::operator new(bytes);
+}
+
+void SessionPool::deallocateSlot_(void *p, std::size_t bytes) noexcept
+{
+    if (p == nullptr)
+    {
+        return;
+    }
+    // reserve 해 둔 용량 안에서만 보관한다. (push_back 이 재할당하지 않음)
+    // - owner 확인이 먼저: 다른 스레드가 idleSlots_ 를 읽으면 owner 의 push/pop 과 경쟁한다.
+    if (bytes == slotBytes_ && onOwnerThread_() && idleSlots_.size() < maxIdle_)
+    {
+        idleSlots_.push_back(p);
+        publish_();
+        return;
+    }
+    ::operator delete(p);
+}
+
+SessionPool::RingClass *SessionPool::findClass_(std::size_t capacity, Layout layout) noexcept
+{
+    for (auto &c : ringClasses_)
+    {
+        if (c.capacity == capacity && c.layout == layout)
+        {
+            return &c;
+        }
+    }
+    return nullptr;
+}
+
+std::unique_ptr<hypernet::buffer::RingBuffer> SessionPool::acquireRing(std::size_t capacity, Layout layout)
+{
+    if (onOwnerThread_() && maxIdle_ != 0)
+    {
+        RingClass *c = findClass_(capacity, layout);
+        if (c == nullptr)
+        {
+            RingClass fresh{};
+            fresh.capacity = capacity;
+            fresh.layout = layout;
+            fresh.idle.reserve(maxIdle_);
+            ringClasses_.push_back(std::move(fresh));
+            c = &ringClasses_.back();
+        }
+        if (!c->idle.empty())
+        {
+            auto ring = std::move(c->idle.back());
+            c->idle.pop_back();
+            --idleRingCount_;
+            ++stats_.ringHits;
+            publish_();
+            return ring;
+        }
+        ++stats_.ringMisses;
+        publish_();
+    }
+    return std::make_unique<hypernet::buffer::RingBuffer>(capacity, layout);
+}
+
+void SessionPool::releaseRing(std::size_t capacity, Layout layout,
+                              std::unique_ptr<hypernet::buffer::RingBuffer> ring) noexcept
+{
+    if (!ring || !onOwnerThread_())
+    {
+        return;
+    }
+    RingClass *c = findClass_(capacity, layout);
+    if (c == nullptr || c->idle.size() >= maxIdle_)
+    {
+        return;
+    }
+    // 내용은 지우지 않는다. (head/tail 만 초기화)
+    ring->clear();
+    c->idle.push_back(std::move(ring));
+    ++idleRingCount_;
+    publish_();
+}
+
+void SessionPool::prefaultIdleRings() noexcept
+{
+    for (auto &c : ringClasses_)
+    {
+        for (auto &ring : c.idle)
+        {
+            ::iovec iov[2]{};
+            const int n = ring->writeIov(iov, ring->capacity());
+            for (int i = 0; i < n; ++i)
+            {
+                std::memset(iov[i].iov_base, 0, iov[i].iov_len);
+            }
+        }
+    }
+}
+
+void SessionPool::resetStats() noexcept
+{
+    stats_ = Stats{};
+    publish_();
+}
+
+std::size_t SessionPool::idleRings() const noexcept
+{
+    return idleRingCount_;
+}
+
+void SessionPool::publish_() noexcept
+{
+    if (metrics_ == nullptr)
+    {
+        return;
+    }
+    using M = hypernet::monitoring::WorkerSessionPoolMetrics;
+    M::set(metrics_->idleSessions, idleSlots_.size());
+    M::set(metrics_->idleRings, idleRingCount_);
+    M::set(metrics_->sessionHitsTotal, stats_.sessionHits);
+    M::set(metrics_->sessionMissesTotal, stats_.sessionMisses);
+    M::set(metrics_->ringHitsTotal, stats_.ringHits);
+    M::set(metrics_->ringMissesTotal, stats_.ringMisses);
+}
+
+} // namespace hypernet::net
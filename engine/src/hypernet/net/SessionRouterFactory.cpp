@@ -2,6 +2,7 @@
 
 #include <hypernet/core/Logger.hpp>
 #include <hypernet/core/ThreadContext.hpp>
+#include <hypernet/net/WorkerMesh.hpp>
 
 namespace
 {
@@ -11,8 +12,8 @@ using namespace hypernet;
 class GlobalSessionRouter final : public ISessionRouter
 {
   public:
-    explicit GlobalSessionRouter(std::vector<net::EventLoop *> loops) noexcept
-        : loops_(std::move(loops))
+    GlobalSessionRouter(std::vector<net::EventLoop *> loops, std::shared_ptr<net::WorkerMesh> mesh) noexcept
+        : loops_(std::move(loops)), mesh_(std::move(mesh))
     {
     }
 
@@ -27,11 +28,18 @@ class GlobalSessionRouter final : public ISessionRouter
             return false;
 
         // [최적화] 같은 워커라면: 복사 없이 즉시 로컬 송신
-        if (core::ThreadContext::currentWorkerId() == owner)
+        const int cw = core::ThreadContext::currentWorkerId();
+        if (cw == owner)
         {
             return target.sendLocalPacketU16(opcode, body);
         }
 
+        // [최적화] 워커→워커: 작은 body 는 전용 채널 descriptor 에 inline 복사 (할당 없음)
+        if (handoff_(cw, owner, target, opcode, body.data(), body.size()))
+        {
+            return true;
+        }
+
         // 다른 워커라면: 생명주기 안전을 위해 패킷 복사 후 큐잉 (아래 오버로딩 호출)
         return send(target, RoutedPacketU16::copy(opcode, body));
     }
@@ -46,12 +54,21 @@ class GlobalSessionRouter final : public ISessionRouter
             return false;
 
         // [최적화] 우연히 현재 스레드가 타겟 워커라면 즉시 전송
-        if (core::ThreadContext::currentWorkerId() == owner)
+        const int cw = core::ThreadContext::currentWorkerId();
+        if (cw == owner)
         {
             const auto view = packet.view();
             return target.sendLocalPacketU16(packet.opcode, view);
         }
 
+        {
+            const auto view = packet.view();
+            if (handoff_(cw, owner, target, packet.opcode, view.data(), view.size()))
+            {
+                return true;
+            }
+        }
+
         auto *loop = loops_[owner];
         if (!loop)
             return false;
@@ -137,14 +154,22 @@ class GlobalSessionRouter final : public ISessionRouter
 
   private:
     std::vector<net::EventLoop *> loops_;
+    std::shared_ptr<net::WorkerMesh> mesh_; ///< nullptr 이면 항상 post 경로
+
+    bool handoff_(int cw, int owner, const SessionHandle &target, std::uint16_t opcode,
+                  const void *body, std::size_t len) noexcept
+    {
+        return mesh_ && cw >= 0 && mesh_->sendPacket(cw, owner, target.id(), opcode, body, len);
+    }
 };
 
 } // namespace
 
 namespace hypernet::net
 {
-std::shared_ptr<ISessionRouter> makeGlobalSessionRouter(std::vector<EventLoop *> loops) noexcept
+std::shared_ptr<ISessionRouter> makeGlobalSessionRouter(std::vector<EventLoop *> loops,
+                                                        std::shared_ptr<WorkerMesh> mesh) noexcept
 {
-    return std::make_shared<::GlobalSessionRouter>(std::move(loops));
+    return std::make_shared<::GlobalSessionRouter>(std::move(loops), std::move(mesh));
 }
 } // namespace hypernet::net
@@ -5,7 +5,7 @@
 #include <cstring>       // std::memset
 #include <fcntl.h>       // fcntl, O_NONBLOCK
 #include <netinet/in.h>  // sockaddr_in, AF_INET, AF_INET6
-#include <netinet/tcp.h> // TCP_NODELAY
+#include <netinet/tcp.h> // TCP_NODELAY, TCP_CORK
 #include <unistd.h>      // close, read, write
 
 namespace hypernet::net
@@ -152,6 +152,65 @@ bool Socket::setNoDelay(bool enable) noexcept
     return true;
 }
 
+bool Socket::setBusyPoll(int usec) noexcept
+{
+    if (!isValid())
+    {
+        errno = EBADF;
+        return false;
+    }
+
+#ifdef SO_BUSY_POLL
+    if (::setsockopt(fd_, SOL_SOCKET, SO_BUSY_POLL, &usec, sizeof(usec)) == -1)
+    {
+        return false;
+    }
+    return true;
+#else
+    (void)usec;
+    errno = ENOTSUP;
+    return false;
+#endif
+}
+
+bool Socket::setCork(bool enable) noexcept
+{
+    if (!isValid())
+    {
+        errno = EBADF;
+        return false;
+    }
+
+    const int opt = enable ? 1 : 0;
+    if (::setsockopt(fd_, IPPROTO_TCP, TCP_CORK, &opt, sizeof(opt)) == -1)
+    {
+        return false;
+    }
+    return true;
+}
+
+bool Socket::setZeroCopy(bool enable) noexcept
+{
+    if (!isValid())
+    {
+        errno = EBADF;
+        return false;
+    }
+
+#ifdef SO_ZEROCOPY
+    const int opt = enable ? 1 : 0;
+    if (::setsockopt(fd_, SOL_SOCKET, SO_ZEROCOPY, &opt, sizeof(opt)) == -1)
+    {
+        return false;
+    }
+    return true;
+#else
+    (void)enable;
+    errno = ENOTSUP;
+    return false;
+#endif
+}
+
 bool Socket::bind(const ::sockaddr *addr, ::socklen_t len) noexcept
 {
     if (!isValid())
@@ -0,0 +1,363 @@
+#include <hypernet/net/WorkerMesh.hpp>
+
+#include <hypernet/core/Logger.hpp>
+#include <hypernet/monitoring/LatencyHistogram.hpp>
+#include <hypernet/net/EventLoop.hpp>
+
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace hypernet::net
+{
+
+namespace
+{
+/// body 안에 생성된 Task 를 가리킵니다.
+[[nodiscard]] core::Task *taskIn(HandoffDescriptor &desc) noexcept
+{
+    return std::launder(reinterpret_cast<core::Task *>(desc.body));
+}
+} // namespace
+
+WorkerMesh::WorkerMesh(int workerCount, std::size_t ringSlots)
+    : workerCount_(workerCount > 0 ? workerCount : 0),
+      endpoints_(std::make_unique<Endpoint[]>(static_cast<std::size_t>(workerCount_)))
+{
+    const std::size_t n = static_cast<std::size_t>(workerCount_);
+    channels_.reserve(n * n);
+    for (std::size_t i = 0; i < n * n; ++i)
+    {
+        channels_.push_back(std::make_unique<Channel>(ringSlots));
+    }
+    ringSlots_ = channels_.empty() ? 0 : channels_.front()->ring.capacity();
+
+    SLOG_INFO("WorkerMesh", "Created", "workers={} channels={} ring_slots={} descriptor_bytes={} inline_bytes={}",
+              workerCount_, channels_.size(), ringSlots_, sizeof(HandoffDescriptor),
+              HandoffDescriptor::kInlineBytes);
+}
+
+WorkerMesh::~WorkerMesh()
+{
+    // 실행되지 못한 Task 는 제자리에서 파괴한다. (종료 시점: 워커 스레드가 모두 멈춘 뒤)
+    std::size_t dropped = 0;
+    for (auto &ch : channels_)
+    {
+        dropped += ch->ring.consume([](HandoffDescriptor &desc) noexcept { destroy_(desc); },
+                                    std::numeric_limits<std::size_t>::max());
+        for (auto &pending : ch->backlog)
+        {
+            destroy_(pending);
+            ++dropped;
+        }
+    }
+    if (dropped != 0)
+    {
+        SLOG_WARN("WorkerMesh", "DroppedOnDestroy", "descriptors={}", dropped);
+    }
+}
+
+void WorkerMesh::attach(int wid, EventLoop *loop, PacketSink sink)
+{
+    if (wid < 0 || wid >= workerCount_)
+    {
+        SLOG_ERROR("WorkerMesh", "AttachFailed", "reason=InvalidWorker wid={} workers={}", wid, workerCount_);
+        return;
+    }
+    Endpoint &ep = endpoints_[static_cast<std::size_t>(wid)];
+    ep.sink = std::move(sink);
+    ep.loop.store(loop, std::memory_order_release);
+}
+
+void WorkerMesh::detach(int wid) noexcept
+{
+    if (wid < 0 || wid >= workerCount_)
+    {
+        return;
+    }
+    endpoints_[static_cast<std::size_t>(wid)].loop.store(nullptr, std::memory_order_release);
+}
+
+bool WorkerMesh::isProducerThread(int src) const noexcept
+{
+    if (src < 0 || src >= workerCount_)
+    {
+        return false;
+    }
+    const EventLoop *loop = endpoints_[static_cast<std::size_t>(src)].loop.load(std::memory_order_acquire);
+    return loop && loop->isInOwnerThread();
+}
+
+bool WorkerMesh::canSend_(int src, int dst) const noexcept
+{
+    if (dst < 0 || dst >= workerCount_ || src == dst)
+    {
+        return false;
+    }
+    // SPSC 전제: 채널 (src, dst) 에 쓰는 스레드는 src 루프의 owner 하나뿐이어야 한다.
+    if (!isProducerThread(src))
+    {
+        return false;
+    }
+    return endpoints_[static_cast<std::size_t>(dst)].loop.load(std::memory_order_acquire) != nullptr;
+}
+
+bool WorkerMesh::sendPacket(int src, int dst, SessionHandle::Id sid, std::uint16_t opcode, const void *body,
+                            std::size_t len, std::span<const protocol::FieldPatch> patches) noexcept
+{
+    if (len > HandoffDescriptor::kInlineBytes || !canSend_(src, dst))
+    {
+        return false;
+    }
+
+    return enqueue_(src, dst,
+                    [&](HandoffDescriptor &desc) noexcept
+                    {
+                        desc.kind = HandoffDescriptor::Kind::Packet;
+                        desc.opcode = opcode;
+                        desc.len = static_cast<std::uint32_t>(len);
+                        desc.sid = sid;
+                        if (len != 0 && body != nullptr)
+                        {
+                            std::memcpy(desc.body, body, len);
+                            protocol::applyFieldPatches(desc.body, patches);
+                        }
+                    });
+}
+
+bool WorkerMesh::post(int src, int dst, Task &task) noexcept
+{
+    if (!canSend_(src, dst))
+    {
+        return false;
+    }
+
+    return enqueue_(src, dst,
+                    [&task](HandoffDescriptor &desc) noexcept
+                    {
+                        desc.kind = HandoffDescriptor::Kind::Task;
+                        desc.sid = static_cast<SessionHandle::Id>(monitoring::latencyNowNs());
+                        ::new (static_cast<void *>(desc.body)) Task(std::move(task));
+                    });
+}
+
+void WorkerMesh::relocate_(HandoffDescriptor &dst, HandoffDescriptor &src) noexcept
+{
+    dst.kind = src.kind;
+    dst.opcode = src.opcode;
+    dst.len = src.len;
+    dst.sid = src.sid;
+    if (src.kind == HandoffDescriptor::Kind::Task)
+    {
+        ::new (static_cast<void *>(dst.body)) Task(std::move(*taskIn(src)));
+        taskIn(src)->~Task();
+    }
+    else if (src.len != 0)
+    {
+        std::memcpy(dst.body, src.body, src.len);
+    }
+}
+
+void WorkerMesh::destroy_(HandoffDescriptor &desc) noexcept
+{
+    if (desc.kind == HandoffDescriptor::Kind::Task)
+    {
+        taskIn(desc)->~Task();
+    }
+}
+
+template <typename Fill>
+bool WorkerMesh::enqueue_(int src, int dst, Fill &&fill) noexcept
+{
+    Channel &ch = channel_(src, dst);
+    Endpoint &self = endpoints_[static_cast<std::size_t>(src)];
+
+    if (ch.backlog.empty() && ch.ring.tryPushWith(fill))
+    {
+        if (EventLoop *loop = endpoints_[static_cast<std::size_t>(dst)].loop.load(std::memory_order_acquire))
+        {
+            loop->notifyInbound();
+        }
+        return true;
+    }
+
+    // 링이 꽉 찼거나 앞선 backlog 가 있다: 순서를 지키며 뒤에 붙인다. (유실/블로킹 없음)
+    const bool wasEmpty = ch.backlog.empty();
+    HandoffDescriptor *slot = nullptr;
+    try
+    {
+        slot = &ch.backlog.emplace_back();
+    }
+    catch (const std::bad_alloc &)
+    {
+        // fill 을 부르지 않았으므로 task 는 호출자에게 남아 있다. (호출자가 기존 경로로 보냄)
+        SLOG_WARN("WorkerMesh", "BacklogAllocFailed", "src={} dst={} backlog={}", src, dst, ch.backlog.size());
+        return false;
+    }
+    if (wasEmpty)
+    {
+        ++self.backlogChannels;
+        ch.backlogged.store(true, std::memory_order_seq_cst);
+        SLOG_DEBUG("WorkerMesh", "ChannelBacklogged", "src={} dst={} ring_slots={}", src, dst, ringSlots_);
+    }
+    fill(*slot);
+
+    // dst 가 그사이 링을 비웠을 수 있으므로 한 번 더 밀어 본다.
+    (void)flushBacklog_(ch);
+    if (ch.backlog.empty())
+    {
+        ch.backlogged.store(false, std::memory_order_relaxed);
+        --self.backlogChannels;
+    }
+
+    if (EventLoop *loop = endpoints_[static_cast<std::size_t>(dst)].loop.load(std::memory_order_acquire))
+    {
+        loop->notifyInbound();
+    }
+    return true;
+}
+
+std::size_t WorkerMesh::flushBacklog_(Channel &ch) noexcept
+{
+    std::size_t pushed = 0;
+    while (!ch.backlog.empty() &&
+           ch.ring.tryPushWith([&ch](HandoffDescriptor &slot) noexcept { relocate_(slot, ch.backlog.front()); }))
+    {
+        ch.backlog.pop_front();
+        ++pushed;
+    }
+    return pushed;
+}
+
+void WorkerMesh::dispatch_(int wid, HandoffDescriptor &desc, monitoring::LatencyHistogram *taskDelay) noexcept
+{
+    if (desc.kind == HandoffDescriptor::Kind::Packet)
+    {
+        const PacketSink &sink = endpoints_[static_cast<std::size_t>(wid)].sink;
+        if (sink)
+        {
+            // 세션이 그사이 닫혔으면 sink 가 false 를 반환한다. (기존 post 경로와 같은 의미)
+            (void)sink(desc.sid, desc.opcode, desc.body, desc.len);
+        }
+        return;
+    }
+
+    Task *task = taskIn(desc);
+    if (taskDelay)
+    {
+        taskDelay->record(monitoring::latencyNowNs() - static_cast<std::int64_t>(desc.sid));
+    }
+    if (*task)
+    {
+        try
+        {
+            (*task)();
+        }
+        catch (const std::exception &e)
+        {
+            SLOG_ERROR("WorkerMesh", "TaskException", "what='{}'", e.what());
+        }
+        catch (...)
+        {
+            SLOG_ERROR("WorkerMesh", "TaskUnknownException");
+        }
+    }
+    task->~Task();
+}
+
+std::size_t WorkerMesh::poll(int wid, monitoring::LatencyHistogram *taskDelay) noexcept
+{
+    if (wid < 0 || wid >= workerCount_)
+    {
+        return 0;
+    }
+
+    std::size_t total = 0;
+    for (int src = 0; src < workerCount_; ++src)
+    {
+        if (src == wid)
+        {
+            continue;
+        }
+        Channel &ch = channel_(src, wid);
+        const std::size_t n =
+            ch.ring.consume([this, wid, taskDelay](HandoffDescriptor &desc) noexcept { dispatch_(wid, desc, taskDelay); },
+                            kPollBudgetPerChannel);
+        if (n == 0)
+        {
+            continue;
+        }
+        total += n;
+
+        // 비운 자리를 기다리는 backlog 가 있으면 src 를 깨운다. (src 의 잠들기 직전 확인과 짝)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (ch.backlogged.load(std::memory_order_relaxed))
+        {
+            if (EventLoop *loop = endpoints_[static_cast<std::size_t>(src)].loop.load(std::memory_order_acquire))
+            {
+                loop->notifyInbound();
+            }
+        }
+    }
+
+    // 내가 보낸 것 중 링에 못 들어간 backlog 를 밀어 넣는다.
+    Endpoint &self = endpoints_[static_cast<std::size_t>(wid)];
+    if (self.backlogChannels != 0)
+    {
+        for (int dst = 0; dst < workerCount_; ++dst)
+        {
+            Channel &ch = channel_(wid, dst);
+            if (ch.backlog.empty())
+            {
+                continue;
+            }
+            if (flushBacklog_(ch) != 0)
+            {
+                if (EventLoop *loop = endpoints_[static_cast<std::size_t>(dst)].loop.load(std::memory_order_acquire))
+                {
+                    loop->notifyInbound();
+                }
+            }
+            if (ch.backlog.empty())
+            {
+                ch.backlogged.store(false, std::memory_order_relaxed);
+                --self.backlogChannels;
+            }
+        }
+    }
+    return total;
+}
+
+bool WorkerMesh::hasInbound(int wid) const noexcept
+{
+    if (wid < 0 || wid >= workerCount_)
+    {
+        return false;
+    }
+
+    for (int src = 0; src < workerCount_; ++src)
+    {
+        if (src != wid && !channel_(src, wid).ring.empty())
+        {
+            return true;
+        }
+    }
+
+    // backlog 를 든 채 잠들지 않도록, 링에 자리가 난 outbound 채널도 "할 일"로 본다.
+    if (endpoints_[static_cast<std::size_t>(wid)].backlogChannels != 0)
+    {
+        for (int dst = 0; dst < workerCount_; ++dst)
+        {
+            const Channel &ch = channel_(wid, dst);
+            if (!ch.backlog.empty() && !ch.ring.full())
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace hypernet::net
@@ -1,18 +1,22 @@
 #include <hypernet/net/WorkerSchedulerFactory.hpp>
 #include <hypernet/core/Logger.hpp>
 #include <hypernet/core/ThreadContext.hpp>
+#include <hypernet/net/SessionMigration.hpp>
+#include <hypernet/net/WorkerMesh.hpp>
 
 namespace
 {
 class GlobalWorkerScheduler final : public hypernet::IWorkerScheduler
 {
   public:
-    explicit GlobalWorkerScheduler(std::vector<hypernet::net::EventLoop *> loops) noexcept
-        : loops_(std::move(loops))
+    GlobalWorkerScheduler(std::vector<hypernet::net::EventLoop *> loops,
+                          std::shared_ptr<hypernet::net::WorkerMesh> mesh,
+                          std::shared_ptr<hypernet::net::SessionMigrator> migrator) noexcept
+        : loops_(std::move(loops)), mesh_(std::move(mesh)), migrator_(std::move(migrator))
     {
     }
 
-    bool postToWorker(int workerId, std::function<void()> task) noexcept override
+    bool postToWorker(int workerId, hypernet::core::Task task) noexcept override
     {
         if (workerId < 0 || workerId >= static_cast<int>(loops_.size()))
             return false;
@@ -24,16 +28,51 @@ class GlobalWorkerScheduler final : public hypernet::IWorkerScheduler
 
     int workerCount() const noexcept override { return static_cast<int>(loops_.size()); }
 
+    bool handoffPacket(hypernet::SessionHandle::Id sid, std::uint16_t opcode,
+                       const hypernet::protocol::MessageView &body) noexcept override
+    {
+        if (!mesh_)
+            return false;
+        const int src = hypernet::core::ThreadContext::currentWorkerId();
+        if (src < 0)
+            return false;
+        const int owner = hypernet::SessionHandle::ownerWorkerFromId(sid);
+        return mesh_->sendPacket(src, owner, sid, opcode, body.data(), body.size());
+    }
+
+    bool handoffRelay(hypernet::SessionHandle::Id sid, std::uint16_t opcode, const hypernet::protocol::MessageView &body,
+                      std::span<const hypernet::protocol::FieldPatch> patches) noexcept override
+    {
+        if (!mesh_)
+            return false;
+        const int src = hypernet::core::ThreadContext::currentWorkerId();
+        if (src < 0)
+            return false;
+        const int owner = hypernet::SessionHandle::ownerWorkerFromId(sid);
+        return mesh_->sendPacket(src, owner, sid, opcode, body.data(), body.size(), patches);
+    }
+
+    bool migrateSession(hypernet::SessionHandle::Id sid, int targetWorker) noexcept override
+    {
+        if (!migrator_ || targetWorker < 0)
+            return false;
+        return migrator_->request(sid, static_cast<unsigned int>(targetWorker));
+    }
+
   private:
     std::vector<hypernet::net::EventLoop *> loops_;
+    std::shared_ptr<hypernet::net::WorkerMesh> mesh_; ///< nullptr 이면 handoffPacket 비활성
+    std::shared_ptr<hypernet::net::SessionMigrator> migrator_; ///< nullptr 이면 migrateSession 비활성
 };
 } // namespace
 
 namespace hypernet::net
 {
 std::shared_ptr<hypernet::IWorkerScheduler>
-makeGlobalWorkerScheduler(std::vector<hypernet::net::EventLoop *> loops) noexcept
+makeGlobalWorkerScheduler(std::vector<hypernet::net::EventLoop *> loops,
+                          std::shared_ptr<WorkerMesh> mesh,
+                          std::shared_ptr<SessionMigrator> migrator) noexcept
 {
-    return std::make_shared<::GlobalWorkerScheduler>(std::move(loops));
+    return std::make_shared<::GlobalWorkerScheduler>(std::move(loops), std::move(mesh), std::move(migrator));
 }
 } // namespace hypernet::net
@@ -38,6 +38,12 @@ class AppRuntime
     void onSessionStart(hypernet::SessionHandle session, ScopeId w, TopicId c);
     void onSessionEnd(hypernet::SessionHandle session);
 
+    // 워커 간 세션 이관 (IApplication::onSessionMigrateOut/In, 각각 보내는/받는 워커 스레드)
+    // - detach: 현재 워커 registry 에서 레코드를 떼어 context 로 반환 (없으면 nullptr)
+    // - attach: detach 가 만든 context 를 현재 워커 registry 에 새 핸들로 등록
+    std::shared_ptr<void> detachSession(hypernet::SessionHandle::Id sid);
+    void attachSession(hypernet::SessionHandle session, std::shared_ptr<void> context);
+
     // [FIX] connectTcp 제거 (SessionService로 이동됨)
 
     SessionService &service() noexcept;
@@ -61,30 +67,32 @@ class AppRuntime
 
         recordDeferredAllowed_(opcode, allowedMask);
 
-        dispatcher.registerHandler(opcode,
-                                   [this, opcode, allowedMask, fn = std::forward<HandlerFn>(fn), onBadPacket = std::forward<BadFn>(onBadPacket),
-                                    strict](hypernet::SessionHandle s, const hypernet::protocol::MessageView &raw) mutable
-                                   {
-                                       hyperapp::SessionContext ctx{};
-                                       if (!tryGetContext_(s.id(), ctx))
-                                           return;
-
-                                       if ((allowedMask & stateBit(ctx.state)) == 0)
-                                           return;
-
-                                       hyperapp::protocol::PacketReader r(raw);
-                                       PacketType pkt{};
-
-                                       const bool ok = pkt.read(r) && (!strict || r.expectEnd());
-                                       if (!ok)
-                                       {
-                                           if constexpr (!std::is_same_v<std::decay_t<BadFn>, std::nullptr_t>)
-                                               onBadPacket(s, raw, ctx);
-                                           return;
-                                       }
-
-                                       fn(s, pkt, ctx);
-                                   });
+        dispatcher.registerHandler(
+            opcode,
+            [this, fn = std::forward<HandlerFn>(fn), onBadPacket = std::forward<BadFn>(onBadPacket), strict](hypernet::SessionHandle s, const hypernet::protocol::MessageView &raw,
+                                                                                                                 std::uint32_t mask) mutable
+            {
+                hyperapp::SessionContext ctx{};
+                if (!tryGetContext_(s.id(), ctx))
+                    return;
+
+                if ((mask & stateBit(ctx.state)) == 0)
+                    return;
+
+                hyperapp::protocol::PacketReader r(raw);
+                PacketType pkt{};
+
+                const bool ok = pkt.read(r) && (!strict || r.expectEnd());
+                if (!ok)
+                {
+                    if constexpr (!std::is_same_v<std::decay_t<BadFn>, std::nullptr_t>)
+                        onBadPacket(s, raw, ctx);
+                    return;
+                }
+
+                fn(s, pkt, ctx);
+            },
+            allowedMask);
     }
 
     template <typename PacketType, typename HandlerFn, typename BadFn = std::nullptr_t>
@@ -93,9 +101,37 @@ class AppRuntime
         registerPacketHandlerCtx<PacketType>(dispatcher, PacketType::kOpcode, allowedMask, std::forward<HandlerFn>(fn), std::forward<BadFn>(onBadPacket), strict);
     }
 
-    bool postToSessionOwner(hypernet::SessionHandle::Id sid, std::function<void()> task) noexcept;
-    bool postToSessionOwner(hypernet::SessionHandle session, std::function<void()> task) noexcept;
-    bool postToWorker(int wid, std::function<void()> task) noexcept;
+    // [relay] 디코드 없이 수신 body(view) 를 그대로 받는 핸들러 (상태 가드만 적용)
+    // - fn(SessionHandle, const MessageView&, const SessionContext&): view 는 호출 동안만 유효 (SessionService::relayTo 로 넘김)
+    template <typename HandlerFn> void registerRawHandlerCtx(hypernet::protocol::Dispatcher &dispatcher, std::uint16_t opcode, std::uint32_t allowedMask, HandlerFn &&fn)
+    {
+        if (auto *sh = localOrNull_())
+        {
+            sh->sm.registerGuardedCtx(dispatcher, opcode, allowedMask, std::forward<HandlerFn>(fn));
+            return;
+        }
+
+        recordDeferredAllowed_(opcode, allowedMask);
+
+        dispatcher.registerHandler(
+            opcode,
+            [this, fn = std::forward<HandlerFn>(fn)](hypernet::SessionHandle s, const hypernet::protocol::MessageView &raw, std::uint32_t mask) mutable
+            {
+                hyperapp::SessionContext ctx{};
+                if (!tryGetContext_(s.id(), ctx))
+                    return;
+
+                if ((mask & stateBit(ctx.state)) == 0)
+                    return;
+
+                fn(s, raw, ctx);
+            },
+            allowedMask);
+    }
+
+    bool postToSessionOwner(hypernet::SessionHandle::Id sid, hypernet::core::Task task) noexcept;
+    bool postToSessionOwner(hypernet::SessionHandle session, hypernet::core::Task task) noexcept;
+    bool postToWorker(int wid, hypernet::core::Task task) noexcept;
 
   private:
     struct WorkerShard
@@ -4,29 +4,17 @@
 #include <hypernet/protocol/MessageView.hpp>
 
 #include <cstdint>
-#include <cstring>
-#include <memory>
-#include <vector>
 
 namespace hyperapp::outbound
 {
-using Payload = std::shared_ptr<std::vector<std::uint8_t>>;
+using Payload = hypernet::buffer::PacketBuffer;
 
 /// MessageView -> (수명 보장) payload deep-copy
-/// - size==0 이면 nullptr payload (엔진 RoutedPacketU16::copy와 동일한 의미)
-/// - data()==nullptr 이면 memcpy 생략(0으로 채워진 버퍼 유지)
+/// - size==0 이면 빈 payload (엔진 RoutedPacketU16::copy와 동일한 의미)
+/// - 워커 스레드에서는 워커별 슬랩에서 꺼내므로 전역 할당자를 거치지 않습니다.
 [[nodiscard]] inline Payload copyPayload(const hypernet::protocol::MessageView &body) noexcept
 {
-    if (body.size() == 0)
-        return Payload{};
-
-    auto buf = std::make_shared<std::vector<std::uint8_t>>();
-    buf->resize(body.size());
-
-    if (body.data() != nullptr)
-        std::memcpy(buf->data(), body.data(), body.size());
-
-    return buf;
+    return Payload::copyOf(body.data(), body.size());
 }
 
 /// opcode + payload -> RoutedPacketU16
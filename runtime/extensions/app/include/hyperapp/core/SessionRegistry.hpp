@@ -39,6 +39,15 @@ class SessionRegistry final
     void add(hypernet::SessionHandle session, ScopeId w, TopicId c) noexcept;
     void remove(hypernet::SessionHandle::Id sid) noexcept;
 
+    // 워커 간 세션 이관: 레코드(컨텍스트 + 구독)를 떼어 내 대상 워커 registry 에 새 핸들로 다시 붙임
+    struct DetachedSession
+    {
+        SessionContext ctx{};
+        std::vector<TopicKey> subscriptions{};
+    };
+    [[nodiscard]] bool detach(hypernet::SessionHandle::Id sid, DetachedSession &out) noexcept;
+    void attach(hypernet::SessionHandle session, const DetachedSession &in) noexcept;
+
     // 조회
     std::shared_ptr<hypernet::SessionHandle> tryGetSession(hypernet::SessionHandle::Id sid) noexcept;
     std::shared_ptr<const hypernet::SessionHandle> tryGetSession(hypernet::SessionHandle::Id sid) const noexcept;
@@ -122,6 +131,7 @@ class SessionRegistry final
 
         [[nodiscard]] bool contains(SessionId sid, const TopicKey &key) const noexcept;
         [[nodiscard]] bool empty(SessionId sid) const noexcept;
+        void collect(SessionId sid, std::vector<TopicKey> &out) const noexcept;
 
         [[nodiscard]] const std::unordered_set<SessionId> *tryGetScopeMembers(ScopeId w) const noexcept;
         [[nodiscard]] const std::unordered_set<SessionId> *tryGetTopicMembers(const TopicKey &key) const noexcept;
@@ -8,6 +8,7 @@
 #include <hypernet/ISessionRouter.hpp>
 #include <hypernet/IWorkerScheduler.hpp>
 #include <hypernet/SessionHandle.hpp>
+#include <hypernet/protocol/FieldPatch.hpp>
 #include <hypernet/protocol/MessageView.hpp>
 #include <hypernet/connector/ConnectorManager.hpp>
 
@@ -16,6 +17,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -132,6 +134,14 @@ class SessionService final
 
     [[nodiscard]] bool sendToLocal(SessionId sid, std::uint16_t opcode, const hypernet::protocol::MessageView &body) noexcept { return sendToLocal_(sid, opcode, body); }
 
+    // ---------------------------------------------------------------------
+    // Relay (cut-through)
+    // ---------------------------------------------------------------------
+    // 받은 body 를 디코드/재인코딩 없이 sid 로 보내고 patches 위치만 덮어씀 (body 는 핸들러가 받은 수신 view 그대로)
+    // - owner 워커: 엔진이 원본 조각 + 패치 바이트를 송신 iovec/링에 바로 실음 (중간 버퍼 없음)
+    // - 다른 워커: 워커 쌍 채널 descriptor 또는 PacketBuffer 1개에 한 번 복사해 넘김
+    [[nodiscard]] bool relayTo(SessionId sid, std::uint16_t opcode, const hypernet::protocol::MessageView &body, std::span<const hypernet::protocol::FieldPatch> patches) noexcept;
+
     // ---------------------------------------------------------------------
     // Broadcast / Multicast (도메인 최종 표면)
     // ---------------------------------------------------------------------
@@ -225,6 +235,8 @@ class SessionService final
     [[nodiscard]] bool sendTo(SessionId sid, std::uint16_t opcode, const hypernet::protocol::MessageView &body) noexcept;
 
     [[nodiscard]] bool sendToLocal_(SessionId sid, std::uint16_t opcode, const hypernet::protocol::MessageView &body) noexcept;
+    // 현재 워커 SessionManager 에 id 로 송신 (옮겨 간 세션이면 엔진이 새 owner 로 forward)
+    [[nodiscard]] bool sendViaEngine_(SessionId sid, std::uint16_t opcode, const hypernet::protocol::MessageView &body) noexcept;
     void closeLocal_(SessionId sid, std::string reason, int err) noexcept;
 
     void broadcastTopic(ScopeId w, TopicId c, std::uint16_t opcode, const hypernet::protocol::MessageView &body, SessionId exceptSid = 0) noexcept;
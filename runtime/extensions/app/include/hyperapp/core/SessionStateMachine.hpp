@@ -7,10 +7,10 @@
 #include <hypernet/SessionHandle.hpp>
 #include <hypernet/protocol/Dispatcher.hpp>
 #include <hypernet/protocol/MessageView.hpp>
+#include <hypernet/util/OpcodeTable.hpp>
 
 #include <cstdint>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
 
 namespace hyperapp
@@ -23,37 +23,40 @@ class SessionStateMachine
     // opcode별 허용 상태 마스크 설정
     void setAllowedStates(std::uint16_t opcode, std::uint32_t mask);
 
-    // [수정] Dispatcher에 “가드된 핸들러” 등록 (최적화 적용: tryGetAllowedContext_ 사용)
+    // Dispatcher에 “가드된 핸들러” 등록
+    // - 허용 마스크는 Dispatcher 엔트리에 함께 저장되어 호출 시 넘어온다. (메시지마다 opcode 재조회 없음)
     template <typename Fn> void registerGuarded(hypernet::protocol::Dispatcher &dispatcher, std::uint16_t opcode, std::uint32_t allowedMask, Fn &&fn)
     {
         setAllowedStates(opcode, allowedMask);
 
-        dispatcher.registerHandler(opcode,
-                                   [this, opcode, fn = std::forward<Fn>(fn)](hypernet::SessionHandle from, const hypernet::protocol::MessageView &body) mutable
-                                   {
-                                       // [변경] 내부 헬퍼로 조회+검사 한 번에 수행
-                                       [[maybe_unused]] SessionContext ctx{};
-                                       if (!tryGetAllowedContext_(from.id(), opcode, ctx))
-                                           return;
-                                       fn(from, body);
-                                   });
+        dispatcher.registerHandler(
+            opcode,
+            [this, fn = std::forward<Fn>(fn)](hypernet::SessionHandle from, const hypernet::protocol::MessageView &body, std::uint32_t mask) mutable
+            {
+                [[maybe_unused]] SessionContext ctx{};
+                if (!tryGetContextIn_(from.id(), mask, ctx))
+                    return;
+                fn(from, body);
+            },
+            allowedMask);
     }
 
-    // [수정] Dispatcher에 “가드된 핸들러 + ctx” 등록 (최적화 적용: tryGetAllowedContext_ 사용)
+    // Dispatcher에 “가드된 핸들러 + ctx” 등록
     template <typename Fn> void registerGuardedCtx(hypernet::protocol::Dispatcher &dispatcher, std::uint16_t opcode, std::uint32_t allowedMask, Fn &&fn)
     {
         setAllowedStates(opcode, allowedMask);
 
-        dispatcher.registerHandler(opcode,
-                                   [this, opcode, fn = std::forward<Fn>(fn)](hypernet::SessionHandle from, const hypernet::protocol::MessageView &body) mutable
-                                   {
-                                       // [변경] 내부 헬퍼로 조회+검사 후 ctx 획득
-                                       SessionContext ctx{};
-                                       if (!tryGetAllowedContext_(from.id(), opcode, ctx))
-                                           return;
-
-                                       fn(from, body, ctx);
-                                   });
+        dispatcher.registerHandler(
+            opcode,
+            [this, fn = std::forward<Fn>(fn)](hypernet::SessionHandle from, const hypernet::protocol::MessageView &body, std::uint32_t mask) mutable
+            {
+                SessionContext ctx{};
+                if (!tryGetContextIn_(from.id(), mask, ctx))
+                    return;
+
+                fn(from, body, ctx);
+            },
+            allowedMask);
     }
 
     // ============================================================
@@ -100,7 +103,11 @@ class SessionStateMachine
     // [추가] 패치 핵심: 내부 최적화 헬퍼 함수 선언
     [[nodiscard]] bool tryGetAllowedContext_(hypernet::SessionHandle::Id sid, std::uint16_t opcode, SessionContext &out) const noexcept;
 
+    // 마스크를 이미 알고 있을 때(Dispatcher 엔트리) ctx 조회 + 상태 검사
+    [[nodiscard]] bool tryGetContextIn_(hypernet::SessionHandle::Id sid, std::uint32_t mask, SessionContext &out) const noexcept;
+
     SessionRegistry &reg_;
-    std::unordered_map<std::uint16_t, std::uint32_t> allowed_;
+    // opcode -> 허용 상태 마스크 (0 = 미등록)
+    hypernet::util::OpcodeTable<std::uint32_t> allowed_;
 };
 } // namespace hyperapp
\ No newline at end of file
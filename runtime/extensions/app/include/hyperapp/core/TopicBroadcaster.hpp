@@ -28,6 +28,8 @@ class TopicBroadcaster
     void setRegistries(std::vector<SessionRegistry *> regs) noexcept { regs_ = std::move(regs); }
 
     // sid만으로도 보낼 수 있게: sid로 owner 계산 → owner에서 handle 조회
+    // - 옮겨 간 세션은 id 의 워커 registry 에 없으므로 그 워커 SessionManager 의 forward 로 넘어감
+    // - 현재 워커로 옮겨 온 세션은 현재 워커 registry 에서 바로 찾아 송신
     bool sendTo(hypernet::SessionHandle::Id sid, std::uint16_t opcode, const hypernet::protocol::MessageView &body) noexcept;
 
     // [NEW] 임의 sid 리스트 멀티캐스트 (엔진이 bucketize + thread-hop + handle 확보 + fan-out 전담)
@@ -2,6 +2,8 @@
 
 #include <hypernet/IWorkerScheduler.hpp>
 #include <hypernet/SessionHandle.hpp>
+#include <hypernet/core/Task.hpp>
+#include <hypernet/util/InlineFunction.hpp>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -25,8 +27,11 @@ class JobSystem
     {
         scheduler_ = std::move(s);
     }
-    void submitForSession(hypernet::SessionHandle::Id sid, std::function<void()> jobWork,
-                          std::function<void(hypernet::SessionHandle::Id)> onDone);
+    /// 완료 콜백 (owner worker 에서 실행, move-only)
+    using DoneCallback = hypernet::util::InlineFunction<void(hypernet::SessionHandle::Id), 48,
+                                                        hypernet::util::InlineOverflow::Heap>;
+
+    void submitForSession(hypernet::SessionHandle::Id sid, hypernet::core::Task jobWork, DoneCallback onDone);
 
   private:
     void workerLoop_();
@@ -38,7 +43,7 @@ class JobSystem
     std::condition_variable cv_;
     bool stopping_{false};
 
-    std::queue<std::function<void()>> q_;
+    std::queue<hypernet::core::Task> q_;
     std::vector<std::thread> threads_;
 };
 } // namespace hyperapp::jobs
\ No newline at end of file
@@ -94,7 +94,7 @@ SessionStateMachine &AppRuntime::stateMachine() noexcept
 }
 
 // [수정됨] 최적화 적용: 현재 워커가 Owner라면 큐에 넣지 않고 즉시 실행 (Inline)
-bool AppRuntime::postToSessionOwner(hypernet::SessionHandle::Id sid, std::function<void()> task) noexcept
+bool AppRuntime::postToSessionOwner(hypernet::SessionHandle::Id sid, hypernet::core::Task task) noexcept
 {
     if (!scheduler_)
         return false;
@@ -113,7 +113,7 @@ bool AppRuntime::postToSessionOwner(hypernet::SessionHandle::Id sid, std::functi
 }
 
 // [수정됨] 최적화 적용: 위와 동일 (Overload)
-bool AppRuntime::postToSessionOwner(hypernet::SessionHandle session, std::function<void()> task) noexcept
+bool AppRuntime::postToSessionOwner(hypernet::SessionHandle session, hypernet::core::Task task) noexcept
 {
     if (!scheduler_)
         return false;
@@ -130,7 +130,7 @@ bool AppRuntime::postToSessionOwner(hypernet::SessionHandle session, std::functi
     return scheduler_->postToWorker(owner, std::move(task));
 }
 
-bool AppRuntime::postToWorker(int wid, std::function<void()> task) noexcept
+bool AppRuntime::postToWorker(int wid, hypernet::core::Task task) noexcept
 {
     if (!scheduler_)
         return false;
@@ -194,6 +194,32 @@ void AppRuntime::onSessionEnd(hypernet::SessionHandle session)
                                    });
 }
 
+std::shared_ptr<void> AppRuntime::detachSession(hypernet::SessionHandle::Id sid)
+{
+    auto *sh = localOrNull_();
+    if (!sh)
+        return {};
+
+    auto detached = std::make_shared<SessionRegistry::DetachedSession>();
+    if (!sh->reg.detach(sid, *detached))
+        return {};
+    return detached;
+}
+
+void AppRuntime::attachSession(hypernet::SessionHandle session, std::shared_ptr<void> context)
+{
+    auto *sh = localOrNull_();
+    if (!sh)
+        return;
+
+    if (!context)
+    {
+        sh->reg.add(session, 0, 0);
+        return;
+    }
+    sh->reg.attach(session, *std::static_pointer_cast<SessionRegistry::DetachedSession>(context));
+}
+
 AppRuntime::WorkerShard *AppRuntime::localOrNull_() noexcept
 {
     const int w = hypernet::core::ThreadContext::currentWorkerId();
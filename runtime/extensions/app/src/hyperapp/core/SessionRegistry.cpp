@@ -189,6 +189,14 @@ bool SessionRegistry::SubscriptionIndex::empty(SessionId sid) const noexcept
     return it->second.subscriptions.empty();
 }
 
+void SessionRegistry::SubscriptionIndex::collect(SessionId sid, std::vector<TopicKey> &out) const noexcept
+{
+    auto it = states_.find(sid);
+    if (it == states_.end())
+        return;
+    out.insert(out.end(), it->second.subscriptions.begin(), it->second.subscriptions.end());
+}
+
 const std::unordered_set<SessionRegistry::SessionId> *SessionRegistry::SubscriptionIndex::tryGetScopeMembers(ScopeId w) const noexcept
 {
     auto it = scopeIndex_.find(w);
@@ -254,6 +262,39 @@ void SessionRegistry::remove(hypernet::SessionHandle::Id sid) noexcept
     store_.remove(sid);
 }
 
+bool SessionRegistry::detach(hypernet::SessionHandle::Id sid, DetachedSession &out) noexcept
+{
+    if (!ensureOwnerThread_())
+        return false;
+
+    const auto *rec = store_.find(sid);
+    if (!rec)
+        return false;
+
+    out.ctx = rec->ctx;
+    out.subscriptions.clear();
+    subs_.collect(sid, out.subscriptions);
+
+    subs_.clearAll(sid);
+    store_.remove(sid);
+    return true;
+}
+
+void SessionRegistry::attach(hypernet::SessionHandle session, const DetachedSession &in) noexcept
+{
+    if (!ensureOwnerThread_())
+        return;
+
+    const auto sid = session.id();
+    store_.add(session, in.ctx.scope, in.ctx.topic);
+    if (auto *rec = store_.find(sid))
+        rec->ctx = in.ctx;
+
+    // primary 는 ctx 로 복원, 구독은 집합 그대로 다시 등록
+    for (const auto &key : in.subscriptions)
+        (void)subs_.subscribe(sid, key.scope, key.topic);
+}
+
 std::shared_ptr<hypernet::SessionHandle> SessionRegistry::tryGetSession(hypernet::SessionHandle::Id sid) noexcept
 {
     if (!ensureOwnerThread_())
@@ -91,10 +91,10 @@ bool SessionService::sendToLocal_(hypernet::SessionHandle::Id sid, std::uint16_t
         return false;
 
     const int cw = hypernet::core::ThreadContext::currentWorkerId();
-    const int owner = hypernet::SessionHandle::ownerWorkerFromId(sid);
 
-    // local-only: 현재 서비스의 owner 워커에서, owner 세션만 송신
-    if (cw != ownerWorkerId_ || owner != ownerWorkerId_)
+    // local-only: 현재 서비스의 owner 워커에서, 이 워커 registry 에 있는 세션만 송신
+    // (옮겨 온 세션은 id 의 워커가 이 워커가 아니므로 id 로 owner 를 판단하지 않음)
+    if (cw != ownerWorkerId_)
         return false;
 
     hypernet::SessionHandle h;
@@ -102,9 +102,8 @@ bool SessionService::sendToLocal_(hypernet::SessionHandle::Id sid, std::uint16_t
     if (!reg_.tryGetHandle(sid, h))
         return false;
 
-    // 정책: packet 기반 send로 통일
-    auto payload = outbound::copyPayload(body);
-    return router_->send(h, outbound::makePacket(opcode, std::move(payload)));
+    // owner 스레드이므로 router 가 복사 없이 바로 로컬 송신한다. (payload 수명 보장 불필요)
+    return router_->send(h, opcode, body);
 }
 
 // [수정] 일반 전송 (Local이면 즉시, Remote면 TopicBroadcaster 경유)
@@ -116,14 +115,65 @@ bool SessionService::sendTo(hypernet::SessionHandle::Id sid, std::uint16_t opcod
 
     const int cw = hypernet::core::ThreadContext::currentWorkerId();
 
-    // 최적화: owner 워커면 즉시(local) 송신
-    if (cw == owner)
-        return sendToLocal_(sid, opcode, body);
+    if (cw == ownerWorkerId_)
+    {
+        // 최적화: 이 워커 registry 에 있으면 (원래 owner 든 옮겨 온 세션이든) 즉시(local) 송신
+        hypernet::SessionHandle h;
+        if (reg_.tryGetHandle(sid, h))
+            return router_ && router_->send(h, opcode, body);
+
+        // id 의 워커인데 registry 에 없으면 옮겨 간 세션: 엔진 forward 엔트리가 새 owner 로 넘김
+        if (cw == owner)
+            return sendViaEngine_(sid, opcode, body);
+    }
 
     // cross-worker: TopicBroadcaster 경유 (TopicBroadcaster::sendTo 수정본 사용)
     return bc_.sendTo(sid, opcode, body);
 }
 
+bool SessionService::relayTo(hypernet::SessionHandle::Id sid, std::uint16_t opcode, const hypernet::protocol::MessageView &body,
+                             std::span<const hypernet::protocol::FieldPatch> patches) noexcept
+{
+    const int owner = hypernet::SessionHandle::ownerWorkerFromId(sid);
+    if (owner < 0 || !hypernet::protocol::validFieldPatches(patches, body.size()))
+        return false;
+
+    const int cw = hypernet::core::ThreadContext::currentWorkerId();
+
+    // owner 워커 (또는 옮겨 온 세션): 수신 view 를 그대로 엔진 송신 경로에 (패치는 별도 조각)
+    hypernet::SessionHandle h;
+    if (cw == owner || (cw == ownerWorkerId_ && reg_.tryGetHandle(sid, h)))
+    {
+        auto *sm = hypernet::net::WorkerLocal::sessionManager();
+        return sm && sm->relayPacketU16(sid, opcode, body.data(), body.size(), patches);
+    }
+
+    if (!scheduler_)
+        return false;
+
+    // [fast path] 워커 쌍 전용 채널 descriptor 에 inline 복사 + 패치
+    if (scheduler_->handoffRelay(sid, opcode, body, patches))
+        return true;
+
+    // 복사는 호출 스레드에서 PacketBuffer 1개로 1회, 패치는 그 버퍼에 제자리로
+    auto payload = outbound::copyPayload(body);
+    if (!patches.empty())
+        hypernet::protocol::applyFieldPatches(payload.exclusiveData(), patches);
+
+    return scheduler_->postToWorker(owner,
+                                    [sid, opcode, payload = std::move(payload)]()
+                                    {
+                                        if (auto *sm = hypernet::net::WorkerLocal::sessionManager())
+                                            (void)sm->sendPacketU16(sid, opcode, payload.data(), payload.size());
+                                    });
+}
+
+bool SessionService::sendViaEngine_(hypernet::SessionHandle::Id sid, std::uint16_t opcode, const hypernet::protocol::MessageView &body) noexcept
+{
+    auto *sm = hypernet::net::WorkerLocal::sessionManager();
+    return sm && sm->sendPacketU16(sid, opcode, body.data(), body.size());
+}
+
 void SessionService::broadcastTopic(ScopeId w, TopicId c, std::uint16_t opcode, const hypernet::protocol::MessageView &body, hypernet::SessionHandle::Id exceptSid) noexcept
 {
     bc_.broadcastTopic(w, c, opcode, body, exceptSid);
@@ -136,10 +186,8 @@ void SessionService::broadcastTopic(ScopeId w, TopicId c, std::uint16_t opcode,
 // [신규] 로컬 종료 (Owner Thread 전용)
 void SessionService::closeLocal(hypernet::SessionHandle::Id sid, std::string reason, int err) noexcept
 {
-    const int cw = hypernet::core::ThreadContext::currentWorkerId();
-    const int owner = hypernet::SessionHandle::ownerWorkerFromId(sid);
-
-    if (cw != ownerWorkerId_ || owner != ownerWorkerId_)
+    // 옮겨 온 세션도 이 워커에서 닫는다. (옮겨 간 세션은 엔진 forward 엔트리가 새 owner 로 넘김)
+    if (hypernet::core::ThreadContext::currentWorkerId() != ownerWorkerId_)
         return;
 
     closeLocal_(sid, std::move(reason), err);
@@ -162,14 +210,14 @@ void SessionService::close(hypernet::SessionHandle::Id sid, std::string reason,
     if (owner < 0)
         return;
 
-    if (!scheduler_)
-        return;
-
     const int cw = hypernet::core::ThreadContext::currentWorkerId();
 
-    // owner가 아니면 post
-    if (cw != owner)
+    // owner 가 아니면 post (옮겨 온 세션은 id 의 워커를 거치지 않고 여기서 닫음)
+    hypernet::SessionHandle h;
+    if (cw != owner && !(cw == ownerWorkerId_ && reg_.tryGetHandle(sid, h)))
     {
+        if (!scheduler_)
+            return;
         (void)scheduler_->postToWorker(owner, [this, sid, reason = std::move(reason), err]() mutable { closeLocal_(sid, std::move(reason), err); });
         return;
     }
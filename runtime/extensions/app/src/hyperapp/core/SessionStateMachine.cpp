@@ -4,7 +4,7 @@ namespace hyperapp
 {
 void SessionStateMachine::setAllowedStates(std::uint16_t opcode, std::uint32_t mask)
 {
-    allowed_[opcode] = mask;
+    allowed_.at(opcode) = mask;
 }
 
 // [추가] 내부 최적화 헬퍼 구현
@@ -12,15 +12,20 @@ void SessionStateMachine::setAllowedStates(std::uint16_t opcode, std::uint32_t m
 // - 조회와 상태 검사를 한 곳에서 처리
 bool SessionStateMachine::tryGetAllowedContext_(hypernet::SessionHandle::Id sid, std::uint16_t opcode, SessionContext &out) const noexcept
 {
-    auto it = allowed_.find(opcode);
-    if (it == allowed_.end())
+    const std::uint32_t *mask = allowed_.find(opcode);
+    if (!mask || *mask == 0)
         return false;
 
+    return tryGetContextIn_(sid, *mask, out);
+}
+
+bool SessionStateMachine::tryGetContextIn_(hypernet::SessionHandle::Id sid, std::uint32_t mask, SessionContext &out) const noexcept
+{
     // SessionRegistry에 새로 추가된 API 호출 (SessionContext& out 채우기)
     if (!reg_.tryGetContext(sid, out))
         return false;
 
-    return (it->second & stateBit(out.state)) != 0;
+    return (mask & stateBit(out.state)) != 0;
 }
 
 // [수정] 헬퍼를 재사용하여 코드 중복 제거
@@ -32,10 +37,10 @@ bool SessionStateMachine::isAllowed(hypernet::SessionHandle::Id sid, std::uint16
 
 bool SessionStateMachine::isAllowedCtx(const SessionContext &ctx, std::uint16_t opcode) const noexcept
 {
-    auto it = allowed_.find(opcode);
-    if (it == allowed_.end())
+    const std::uint32_t *mask = allowed_.find(opcode);
+    if (!mask)
         return false;
 
-    return (it->second & stateBit(ctx.state)) != 0;
+    return (*mask & stateBit(ctx.state)) != 0;
 }
 } // namespace hyperapp
\ No newline at end of file
@@ -1,11 +1,25 @@
 #include <hyperapp/core/TopicBroadcaster.hpp>
 #include <hyperapp/core/OutboundPackets.hpp>
 
+#include <hypernet/net/SessionManager.hpp>
+#include <hypernet/net/WorkerLocal.hpp>
+
 #include <utility>
 #include <vector>
 
 namespace hyperapp
 {
+namespace
+{
+// registry 에 없는 sid 는 현재 워커 SessionManager 로 넘긴다.
+// - 이 워커에서 옮겨 간 세션이면 엔진 forward 엔트리가 새 owner 로 보냄 (없으면 조용히 실패)
+bool sendViaEngine(hypernet::SessionHandle::Id sid, std::uint16_t opcode, const outbound::Payload &payload) noexcept
+{
+    auto *sm = hypernet::net::WorkerLocal::sessionManager();
+    return sm && sm->sendPacketU16(sid, opcode, payload.data(), payload.size());
+}
+} // namespace
+
 template <typename MakeTargetsFn>
 void TopicBroadcaster::broadcastImpl_(MakeTargetsFn &&makeTargets, std::uint16_t opcode, const hypernet::protocol::MessageView &body, hypernet::SessionHandle::Id exceptSid) noexcept
 {
@@ -40,6 +54,19 @@ bool TopicBroadcaster::sendTo(hypernet::SessionHandle::Id sid, std::uint16_t opc
     if (owner < 0 || owner >= static_cast<int>(regs_.size()))
         return false;
 
+    // 현재 워커로 옮겨 온 세션이면 id 의 워커를 거치지 않고 바로 송신
+    const int cw = hypernet::core::wid();
+    if (cw >= 0 && cw < static_cast<int>(regs_.size()) && regs_[cw])
+    {
+        hypernet::SessionHandle h;
+        if (regs_[cw]->tryGetHandle(sid, h))
+            return router_->send(h, opcode, body);
+    }
+
+    // [fast path] 워커→워커: 전용 채널 descriptor 에 inline 복사 (owner 에서 sid 로 송신)
+    if (scheduler_->handoffPacket(sid, opcode, body))
+        return true;
+
     // 정책: payload deep-copy는 호출 스레드에서 1회
     auto payload = outbound::copyPayload(body);
 
@@ -53,7 +80,11 @@ bool TopicBroadcaster::sendTo(hypernet::SessionHandle::Id sid, std::uint16_t opc
 
                                         hypernet::SessionHandle h;
                                         if (!reg->tryGetHandle(sid, h))
+                                        {
+                                            // 다른 워커로 옮겨 간 세션
+                                            (void)sendViaEngine(sid, opcode, payload);
                                             return;
+                                        }
 
                                         (void)router_->send(h, outbound::makePacket(opcode, payload));
                                     });
@@ -73,21 +104,27 @@ void TopicBroadcaster::multicast(const std::vector<hypernet::SessionHandle::Id>
     auto payload = outbound::copyPayload(body);
 
     // owner worker별로 SessionId bucketize
+    // (현재 워커로 옮겨 온 세션은 현재 워커 bucket 으로)
+    const int cw = hypernet::core::wid();
+    SessionRegistry *localReg = (cw >= 0 && cw < n) ? regs_[cw] : nullptr;
+
     std::vector<std::vector<hypernet::SessionHandle::Id>> buckets(static_cast<std::size_t>(n));
     for (auto sid : sids)
     {
         if (sid == 0 || sid == exceptSid)
             continue;
 
-        const int owner = hypernet::SessionHandle::ownerWorkerFromId(sid);
+        int owner = hypernet::SessionHandle::ownerWorkerFromId(sid);
         if (owner < 0 || owner >= n)
             continue;
 
+        hypernet::SessionHandle h;
+        if (owner != cw && localReg && localReg->tryGetHandle(sid, h))
+            owner = cw;
+
         buckets[static_cast<std::size_t>(owner)].push_back(sid);
     }
 
-    const int cw = hypernet::core::wid();
-
     for (int owner = 0; owner < n; ++owner)
     {
         auto ids = std::move(buckets[static_cast<std::size_t>(owner)]);
@@ -112,6 +149,8 @@ void TopicBroadcaster::multicast(const std::vector<hypernet::SessionHandle::Id>
                 hypernet::SessionHandle h;
                 if (reg->tryGetHandle(sid, h))
                     targets.push_back(h);
+                else
+                    (void)sendViaEngine(sid, opcode, payload); // 다른 워커로 옮겨 간 세션
             }
 
             if (targets.empty())
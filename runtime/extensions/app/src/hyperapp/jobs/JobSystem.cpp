@@ -33,13 +33,13 @@ void JobSystem::stop()
         q_.pop();
 }
 
-void JobSystem::submitForSession(hypernet::SessionHandle::Id sid, std::function<void()> jobWork,
-                                 std::function<void(hypernet::SessionHandle::Id)> onDone)
+void JobSystem::submitForSession(hypernet::SessionHandle::Id sid, hypernet::core::Task jobWork, DoneCallback onDone)
 {
     // jobWork는 pool thread에서 실행
     // onDone은 owner worker로 post 되어 실행
+    // job 래퍼는 capture(jobWork + onDone)가 커서 명시적으로 힙에 둔다. (완료 post 는 inline)
     std::scoped_lock lk(mu_);
-    q_.push(
+    q_.push(hypernet::core::makeHeapTask(
         [this, sid, jobWork = std::move(jobWork), onDone = std::move(onDone)]() mutable
         {
             // 1. 무거운 작업(DB, AI 등) 수행 (Job Thread)
@@ -62,7 +62,7 @@ void JobSystem::submitForSession(hypernet::SessionHandle::Id sid, std::function<
                                                if (onDone)
                                                    onDone(sid);
                                            });
-        });
+        }));
     cv_.notify_one();
 }
 
@@ -70,7 +70,7 @@ void JobSystem::workerLoop_()
 {
     for (;;)
     {
-        std::function<void()> task;
+        hypernet::core::Task task;
         {
             std::unique_lock lk(mu_);
             cv_.wait(lk, [&] { return stopping_ || !q_.empty(); });
@@ -0,0 +1,145 @@
+#include <hypernet/buffer/PacketBuffer.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using hypernet::buffer::PacketBuffer;
+using hypernet::buffer::PacketBufferPool;
+
+namespace {
+
+bool test_unbound_thread_uses_heap() {
+    // 풀이 붙지 않은 스레드에서는 힙 폴백이어야 한다.
+    const char msg[] = "hello";
+    PacketBuffer b = PacketBuffer::copyOf(msg, sizeof(msg));
+    if (!b || b.isPooled() || b.size() != sizeof(msg) || std::memcmp(b.data(), msg, sizeof(msg)) != 0) {
+        std::cerr << "[heap] unexpected buffer state\n";
+        return false;
+    }
+
+    if (PacketBuffer::copyOf(msg, 0)) {
+        std::cerr << "[heap] zero-length copy must be empty\n";
+        return false;
+    }
+    return true;
+}
+
+bool test_refcount_and_local_reuse() {
+    PacketBufferPool::bindCurrentThread();
+
+    std::vector<unsigned char> payload(100, 0x5A);
+    PacketBuffer a = PacketBuffer::copyOf(payload.data(), payload.size());
+    if (!a.isPooled()) {
+        std::cerr << "[local] expected pooled block\n";
+        return false;
+    }
+
+    const unsigned char *first = a.data();
+    {
+        PacketBuffer b = a;
+        PacketBuffer c = b;
+        if (a.useCount() != 3) {
+            std::cerr << "[local] useCount=" << a.useCount() << " expected 3\n";
+            return false;
+        }
+    }
+    if (a.useCount() != 1) {
+        std::cerr << "[local] useCount=" << a.useCount() << " expected 1\n";
+        return false;
+    }
+
+    a.reset();
+
+    // 같은 size class 는 방금 반환한 블록을 다시 받아야 한다. (로컬 free list LIFO)
+    PacketBuffer again = PacketBuffer::copyOf(payload.data(), 64);
+    if (again.data() != first) {
+        std::cerr << "[local] block was not reused\n";
+        return false;
+    }
+
+    // 가장 큰 class 를 넘으면 힙 폴백
+    std::vector<unsigned char> big(PacketBufferPool::kBlockBytes.back() * 2, 0x11);
+    PacketBuffer huge = PacketBuffer::copyOf(big.data(), big.size());
+    if (huge.isPooled() || huge.size() != big.size()) {
+        std::cerr << "[local] oversized payload must fall back to heap\n";
+        return false;
+    }
+
+    again.reset();
+    huge.reset();
+    PacketBufferPool::unbindCurrentThread();
+    return true;
+}
+
+bool test_remote_release_returns_to_owner() {
+    constexpr int kCount = 2000;
+
+    PacketBufferPool::bindCurrentThread();
+    PacketBufferPool *owner = PacketBufferPool::current();
+
+    std::vector<PacketBuffer> bufs;
+    bufs.reserve(kCount);
+    for (int i = 0; i < kCount; ++i) {
+        const int v = i;
+        bufs.push_back(PacketBuffer::copyOf(&v, sizeof(v)));
+    }
+    const auto before = owner->stats();
+
+    // 다른 스레드에서 마지막 참조를 놓는다.
+    std::thread releaser([moved = std::move(bufs)]() mutable {
+        for (int i = 0; i < kCount; ++i) {
+            int v = -1;
+            std::memcpy(&v, moved[static_cast<std::size_t>(i)].data(), sizeof(v));
+            if (v != i) {
+                std::cerr << "[remote] payload mismatch at i=" << i << "\n";
+                std::abort();
+            }
+        }
+        moved.clear();
+    });
+    releaser.join();
+
+    // 로컬 free list 를 비운 뒤 다음 할당에서 remote 스택을 회수해야 한다.
+    std::vector<PacketBuffer> again;
+    for (int i = 0; i < kCount; ++i) {
+        again.push_back(PacketBuffer::copyOf(&i, sizeof(i)));
+    }
+
+    const auto &after = owner->stats();
+    if (after.remoteReturns - before.remoteReturns != static_cast<std::uint64_t>(kCount)) {
+        std::cerr << "[remote] remoteReturns=" << (after.remoteReturns - before.remoteReturns)
+                  << " expected " << kCount << "\n";
+        return false;
+    }
+    if (after.chunks != before.chunks) {
+        std::cerr << "[remote] slab grew instead of reusing returned blocks\n";
+        return false;
+    }
+
+    again.clear();
+    PacketBufferPool::unbindCurrentThread();
+    return true;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+
+    ok = ok && test_unbound_thread_uses_heap();
+    ok = ok && test_refcount_and_local_reuse();
+    ok = ok && test_remote_release_returns_to_owner();
+
+    if (!ok) {
+        std::cerr << "PacketBuffer tests FAILED\n";
+        return 1;
+    }
+
+    std::cout << "PacketBuffer tests PASSED\n";
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include <hypernet/buffer/BufferPool.hpp>
+#include <hypernet/buffer/PageMemory.hpp>
+#include <hypernet/buffer/RingBuffer.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+using hypernet::buffer::BufferPool;
+using hypernet::buffer::HugePageMode;
+using hypernet::buffer::PageAllocPolicy;
+using hypernet::buffer::PageMemory;
+using hypernet::buffer::RingBuffer;
+
+namespace {
+
+/// THP 모드에서 2 MiB 이상 영역은 2 MiB 경계/배수로 잡히고, prefault 후에도 내용이 0인지 확인합니다.
+bool test_thp_alignment() {
+    const PageAllocPolicy policy{HugePageMode::Transparent, true};
+    PageMemory m = PageMemory::allocate((3U << 20) + 1, policy);
+    if (!m || m.size() != (4U << 20)) {
+        std::cerr << "[thp] size=" << m.size() << "\n";
+        return false;
+    }
+    if (reinterpret_cast<std::uintptr_t>(m.data()) % hypernet::buffer::kHugePageSize != 0) {
+        std::cerr << "[thp] unaligned\n";
+        return false;
+    }
+    for (std::size_t i = 0; i < m.size(); i += 4096) {
+        if (m.data()[i] != std::byte{0}) {
+            std::cerr << "[thp] dirty page at " << i << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+/// hugetlb 예약이 없어도(대부분의 CI) 일반 페이지로 폴백해서 쓸 수 있어야 합니다.
+bool test_hugetlb_falls_back() {
+    PageMemory m = PageMemory::allocate(4096, PageAllocPolicy{HugePageMode::Explicit, false});
+    if (!m || m.size() < 4096) {
+        std::cerr << "[hugetlb] allocation failed\n";
+        return false;
+    }
+    std::memset(m.data(), 0x5a, 4096);
+    PageMemory moved = std::move(m);
+    return !m && moved && moved.data()[4095] == std::byte{0x5a};
+}
+
+/// hugetlb 모드라도 2 MiB 미만 영역은 2 MiB 로 올리지 않고 일반 페이지로 잡아야 합니다.
+bool test_hugetlb_small_stays_small() {
+    PageMemory m = PageMemory::allocate(64U << 10, PageAllocPolicy{HugePageMode::Explicit, true});
+    if (!m || m.size() != (64U << 10) || m.hugeTlb()) {
+        std::cerr << "[hugetlb-small] size=" << m.size() << " hugeTlb=" << m.hugeTlb() << "\n";
+        return false;
+    }
+    return true;
+}
+
+/// 스레드 정책을 정하면 링/풀이 그 정책으로 만들어지고 정상 동작하는지 확인합니다.
+bool test_thread_policy_applies_to_ring_and_pool() {
+    hypernet::buffer::setThreadPagePolicy(PageAllocPolicy{HugePageMode::Transparent, true});
+
+    RingBuffer flat(1U << 16, RingBuffer::Layout::Flat);
+    RingBuffer mirrored(1U << 16, RingBuffer::Layout::Mirrored);
+    BufferPool pool(256, 64);
+
+    hypernet::buffer::setThreadPagePolicy(PageAllocPolicy{});
+
+    const char msg[] = "hypernet";
+    for (RingBuffer *r : {&flat, &mirrored}) {
+        if (r->write(reinterpret_cast<const std::byte *>(msg), sizeof(msg)) != sizeof(msg)) {
+            std::cerr << "[policy] ring write failed\n";
+            return false;
+        }
+        char out[sizeof(msg)]{};
+        if (r->read(reinterpret_cast<std::byte *>(out), sizeof(out)) != sizeof(out) || std::strcmp(out, msg) != 0) {
+            std::cerr << "[policy] ring read mismatch\n";
+            return false;
+        }
+    }
+
+    void *a = pool.allocate();
+    void *b = pool.allocate();
+    if (!a || !b || a == b) {
+        std::cerr << "[policy] pool allocate failed\n";
+        return false;
+    }
+    std::memset(a, 1, 256);
+    pool.deallocate(a);
+    pool.deallocate(b);
+    return true;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = ok && test_thp_alignment();
+    ok = ok && test_hugetlb_falls_back();
+    ok = ok && test_hugetlb_small_stays_small();
+    ok = ok && test_thread_policy_applies_to_ring_and_pool();
+
+    if (!ok) {
+        std::cerr << "PageMemory tests FAILED\n";
+        return 1;
+    }
+    std::cout << "PageMemory tests PASSED\n";
+    return 0;
+}
@@ -307,6 +307,61 @@ bool test_view_wrap_around() {
     return true;
 }
 
+/// Mirrored 레이아웃에서는 랩어라운드 구간도 하나의 연속 뷰/iovec 로 보여야 한다.
+bool test_mirrored_wrap_is_contiguous() {
+    RingBuffer rb(1000, RingBuffer::Layout::Mirrored);
+    if (rb.layout() != RingBuffer::Layout::Mirrored) {
+        // memfd/mmap 을 쓸 수 없는 환경: Flat 폴백이 정상 동작이므로 건너뛴다.
+        std::cerr << "[mirrored] mapping unavailable, skipped\n";
+        return true;
+    }
+
+    const std::size_t cap = rb.capacity();
+    if (cap != RingBuffer::mirroredCapacityFor(1000) || (cap & (cap - 1)) != 0 || cap < 1000) {
+        std::cerr << "[mirrored] capacity=" << cap << " not a page-rounded power of two\n";
+        return false;
+    }
+
+    // head 를 끝 근처로 옮긴 뒤, 끝을 넘어가도록 쓴다.
+    std::string filler(cap - 3, 'x');
+    rb.write(reinterpret_cast<const std::byte *>(filler.data()), filler.size());
+    while (rb.available() > 0) {
+        (void)rb.readView(cap);
+    }
+
+    const std::string msg = "0123456789";
+    if (rb.write(reinterpret_cast<const std::byte *>(msg.data()), msg.size()) != msg.size()) {
+        std::cerr << "[mirrored] write failed\n";
+        return false;
+    }
+
+    ::iovec iov[2];
+    if (rb.peekIov(iov, rb.available()) != 1 || iov[0].iov_len != msg.size()) {
+        std::cerr << "[mirrored] peekIov must expose one iovec\n";
+        return false;
+    }
+
+    auto view = rb.peekView(64);
+    std::string got(reinterpret_cast<const char *>(view.data()), view.size());
+    if (got != msg) {
+        std::cerr << "[mirrored] peekView mismatch: got='" << got << "' expected='" << msg << "'\n";
+        return false;
+    }
+
+    if (rb.writeIov(iov, rb.freeSpace()) != 1 || iov[0].iov_len != rb.freeSpace()) {
+        std::cerr << "[mirrored] writeIov must expose one iovec\n";
+        return false;
+    }
+
+    auto consumed = rb.readView(64);
+    if (consumed.size() != msg.size() || !rb.empty()) {
+        std::cerr << "[mirrored] readView did not consume the whole wrapped span\n";
+        return false;
+    }
+
+    return true;
+}
+
 } // namespace
 
 int main() {
@@ -319,6 +374,7 @@ int main() {
     ok = ok && test_peek_view_basic();
     ok = ok && test_read_view_consumes();
     ok = ok && test_view_wrap_around();
+    ok = ok && test_mirrored_wrap_is_contiguous();
 
     if (!ok) {
         std::cerr << "RingBuffer tests FAILED\n";
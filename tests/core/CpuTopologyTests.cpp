@@ -0,0 +1,112 @@
+#include <hypernet/core/CpuTopology.hpp>
+
+#include <iostream>
+#include <vector>
+
+using hypernet::core::CpuInfo;
+using hypernet::core::parseCpuList;
+using hypernet::core::planWorkerCpus;
+
+namespace {
+
+bool sameList(const std::vector<int> &got, const std::vector<int> &want, const char *tag) {
+    if (got != want) {
+        std::cerr << "[" << tag << "] got:";
+        for (int c : got) {
+            std::cerr << " " << c;
+        }
+        std::cerr << "\n";
+        return false;
+    }
+    return true;
+}
+
+/// 목록/범위 형식을 적힌 순서대로 펼치고, 잘못된 형식은 거부하는지 확인합니다.
+bool test_parse_cpu_list() {
+    const auto a = parseCpuList("0,2,4-7");
+    if (!a || !sameList(*a, {0, 2, 4, 5, 6, 7}, "parse")) {
+        return false;
+    }
+    const auto b = parseCpuList(" 3 , 1-2 ");
+    if (!b || !sameList(*b, {3, 1, 2}, "parse-space")) {
+        return false;
+    }
+    for (const char *bad : {"", "a", "1,", "3-1", "-1", "1-", "1,,2", "99999"}) {
+        if (parseCpuList(bad)) {
+            std::cerr << "[parse] must reject '" << bad << "'\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+/// 2 노드 x 4 코어 x SMT2 (cpu n 과 n+8 이 형제)
+std::vector<CpuInfo> twoNodeSmt() {
+    std::vector<CpuInfo> t;
+    for (int cpu = 0; cpu < 16; ++cpu) {
+        const int core = cpu % 8;
+        t.push_back(CpuInfo{cpu, core % 4, core / 4, core / 4});
+    }
+    return t;
+}
+
+/// 코어가 남으면 cpu0 의 코어를 housekeeping 으로 비우고, 물리 코어를 노드 순으로 먼저 씁니다.
+bool test_plan_prefers_physical_cores() {
+    const auto plan = planWorkerCpus(twoNodeSmt(), 4);
+    if (plan.housekeepingCpu != 0) {
+        std::cerr << "[plan] housekeeping=" << plan.housekeepingCpu << "\n";
+        return false;
+    }
+    return sameList(plan.workerCpus, {1, 2, 3, 4}, "plan-4");
+}
+
+/// 코어보다 워커가 많으면 housekeeping 없이 SMT 형제로 채우고, 그래도 모자라면 반복합니다.
+bool test_plan_fills_siblings_then_wraps() {
+    const auto plan = planWorkerCpus(twoNodeSmt(), 18);
+    if (plan.housekeepingCpu != -1) {
+        std::cerr << "[plan-18] housekeeping=" << plan.housekeepingCpu << "\n";
+        return false;
+    }
+    return sameList(plan.workerCpus, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1}, "plan-18");
+}
+
+/// 실제 머신에서도 허용된 CPU 만 고르는지 확인합니다.
+bool test_plan_on_host() {
+    const auto topo = hypernet::core::scanCpuTopology();
+    if (topo.empty()) {
+        std::cerr << "[host] empty topology\n";
+        return false;
+    }
+    const auto plan = planWorkerCpus(topo, 3);
+    if (plan.workerCpus.size() != 3) {
+        return false;
+    }
+    for (int c : plan.workerCpus) {
+        bool allowed = false;
+        for (const CpuInfo &i : topo) {
+            allowed = allowed || i.cpu == c;
+        }
+        if (!allowed || c == plan.housekeepingCpu) {
+            std::cerr << "[host] bad cpu " << c << "\n";
+            return false;
+        }
+    }
+    return hypernet::core::pinCurrentThreadToCpu(plan.workerCpus[0]) == 0;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = ok && test_parse_cpu_list();
+    ok = ok && test_plan_prefers_physical_cores();
+    ok = ok && test_plan_fills_siblings_then_wraps();
+    ok = ok && test_plan_on_host();
+
+    if (!ok) {
+        std::cerr << "CpuTopology tests FAILED\n";
+        return 1;
+    }
+    std::cout << "CpuTopology tests PASSED\n";
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include <hypernet/core/LogRing.hpp>
+#include <hypernet/core/Logger.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using hypernet::core::detail::LogRecordHeader;
+using hypernet::core::detail::LogRecordKind;
+using hypernet::core::detail::LogRing;
+
+namespace {
+
+std::string decode(const LogRecordHeader &h) {
+    std::string out;
+    if (h.kind == LogRecordKind::Format) {
+        h.decode(std::string_view{h.fmt, h.fmtLen}, h.payload(), h.payloadLen, out);
+    } else {
+        out.assign(reinterpret_cast<const char *>(h.payload()), h.payloadLen);
+    }
+    return out;
+}
+
+/// raw 인자 레코드가 그대로 포맷되고, 링 끝에서 Pad 를 건너 순서대로 읽히는지 확인합니다.
+bool test_ring_wrap_and_decode() {
+    LogRing ring(8192); // 최소 용량 (2 * kMaxLogRecordBytes)
+    const std::string name(700, 'n');
+
+    for (int i = 0; i < 200; ++i) {
+        const int rc = hypernet::core::detail::pushLogFormat(ring, 2, "Comp", "Evt", "i={} name={} ok={}", 0, 1,
+                                                             i, name, true);
+        if (rc != 0) {
+            std::cerr << "[wrap] push failed at " << i << " rc=" << rc << "\n";
+            return false;
+        }
+        const LogRecordHeader *h = ring.front();
+        if (!h || h->comp() != "Comp" || h->evt() != "Evt") {
+            std::cerr << "[wrap] missing record at " << i << "\n";
+            return false;
+        }
+        const std::string expect = "i=" + std::to_string(i) + " name=" + name + " ok=true";
+        if (decode(*h) != expect) {
+            std::cerr << "[wrap] decode mismatch at " << i << ": " << decode(*h).substr(0, 40) << "\n";
+            return false;
+        }
+        ring.pop();
+        ring.release();
+    }
+    return ring.front() == nullptr;
+}
+
+/// 링이 꽉 차면 producer 는 기다리지 않고 drop 으로 셉니다.
+bool test_ring_drop_when_full() {
+    LogRing ring(8192);
+    const std::string text(1000, 't');
+
+    int pushed = 0;
+    while (hypernet::core::detail::pushLogText(ring, LogRecordKind::Text, 2, "C", "E", text, 0, 1)) {
+        ++pushed;
+    }
+    if (pushed == 0 || ring.dropped() != 1) {
+        std::cerr << "[drop] pushed=" << pushed << " dropped=" << ring.dropped() << "\n";
+        return false;
+    }
+
+    // 하나 소비하고 공간을 돌려주면 다시 실을 수 있다.
+    (void)ring.front();
+    ring.pop();
+    ring.release();
+    if (!hypernet::core::detail::pushLogText(ring, LogRecordKind::Text, 2, "C", "E", text, 0, 1)) {
+        std::cerr << "[drop] push after release failed\n";
+        return false;
+    }
+    return true;
+}
+
+/// Logger 를 거친 최종 라인 형식과, 다른 스레드 레코드가 함께 나오는지 확인합니다.
+bool test_logger_lines() {
+    std::ostringstream os;
+    auto logger = std::make_shared<hypernet::core::Logger>(os, 64 * 1024);
+    logger->setMinLevel(hypernet::core::LogLevel::Info);
+    hypernet::core::setLogger(logger);
+
+    SLOG_INFO("Test", "Started");
+    SLOG_INFO("Test", "Values", "n={} hex=0x{:x} s='{}'", 42, 255u, std::string("abc"));
+    SLOG_DEBUG("Test", "Filtered", "n={}", 1);
+    std::thread other([] { SLOG_WARN("Test", "FromThread", "tid_ok={}", true); });
+    other.join();
+    logger->log(hypernet::core::LogLevel::Info, "Legacy | Message | k=v");
+
+    hypernet::core::shutdownLogger();
+
+    const std::string out = os.str();
+    const char *expected[] = {"| INFO  | Test | Started\n", "| INFO  | Test | Values | n=42 hex=0xff s='abc'\n",
+                              "| WARN  | Test | FromThread | tid_ok=true\n", "| INFO  | Legacy | Message | k=v\n"};
+    for (const char *e : expected) {
+        if (out.find(e) == std::string::npos) {
+            std::cerr << "[logger] missing line: " << e << "output:\n" << out;
+            return false;
+        }
+    }
+    if (out.find("Filtered") != std::string::npos) {
+        std::cerr << "[logger] debug line must be filtered\n";
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = ok && test_ring_wrap_and_decode();
+    ok = ok && test_ring_drop_when_full();
+    ok = ok && test_logger_lines();
+
+    if (!ok) {
+        std::cerr << "Logger tests FAILED\n";
+        return 1;
+    }
+    std::cout << "Logger tests PASSED\n";
+    return 0;
+}
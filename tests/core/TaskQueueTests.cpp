@@ -1,8 +1,11 @@
 #include <hypernet/core/TaskQueue.hpp>
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <iostream>
+#include <memory>
 #include <thread>
 #include <vector>
 
@@ -42,6 +45,93 @@ bool test_single_thread_order() {
     return true;
 }
 
+/// drain() 이 쌓인 작업을 FIFO 로 한 번에 실행하고, 실행 중 push 된 작업은 다음 배치로 넘기는지
+/// 확인합니다.
+bool test_drain_batch() {
+    TaskQueue queue;
+    std::vector<int> result;
+
+    for (int i = 0; i < 3; ++i) {
+        queue.push(TaskQueue::Task([&queue, &result, i] {
+            result.push_back(i);
+            if (i == 1) {
+                queue.push(TaskQueue::Task([&result] { result.push_back(100); }));
+            }
+        }));
+    }
+
+    const auto first = queue.drain([](TaskQueue::Task &task) { task(); });
+    if (first != 3 || result != std::vector<int>{0, 1, 2} || queue.empty()) {
+        std::cerr << "[drain] first batch count=" << first << " size=" << result.size() << "\n";
+        return false;
+    }
+
+    const auto second = queue.drain([](TaskQueue::Task &task) { task(); });
+    if (second != 1 || result.back() != 100 || !queue.empty()) {
+        std::cerr << "[drain] second batch count=" << second << "\n";
+        return false;
+    }
+
+    return true;
+}
+
+/// Task 가 move-only capture 를 받고, 작은 capture 는 inline / 큰 capture 는 힙에 두는지 확인합니다.
+bool test_move_only_inline_task() {
+    TaskQueue queue;
+    int sum = 0;
+
+    auto owned = std::make_unique<int>(7);
+    auto small = [&sum, p = std::move(owned)] { sum += *p; };
+    static_assert(TaskQueue::Task::storesInline<decltype(small)>,
+                  "unique_ptr + reference capture must be stored inline");
+
+    TaskQueue::Task inlineTask(std::move(small));
+    if (inlineTask.isHeapAllocated()) {
+        std::cerr << "[task] small capture was heap allocated\n";
+        return false;
+    }
+    queue.push(std::move(inlineTask));
+
+    // 명시적 opt-out: strict 빌드에서도 큰 capture 를 힙에 둘 수 있다.
+    std::array<char, 256> big{};
+    big[0] = 3;
+    queue.push(hypernet::core::makeHeapTask([&sum, big] { sum += big[0]; }));
+
+    // consumer 스레드 자신의 push 는 실행이 끝난 노드를 재사용한다.
+    (void)queue.drain([](TaskQueue::Task &task) { task(); });
+    queue.pushLocal(TaskQueue::Task([&sum] { sum += 100; }));
+    (void)queue.drain([](TaskQueue::Task &task) { task(); });
+
+    if (sum != 110 || !queue.empty()) {
+        std::cerr << "[task] sum=" << sum << " expected=110\n";
+        return false;
+    }
+    return true;
+}
+
+/// push 는 post 시각을 남기고 pushLocal 은 0 을 넘기는지 확인합니다. (drain 의 2인자 fn)
+bool test_drain_posted_stamp() {
+    TaskQueue queue;
+    const auto before = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count();
+    queue.push(TaskQueue::Task([] {}));
+    (void)queue.drain([](TaskQueue::Task &task) { task(); }); // 노드를 free list 로
+    queue.push(TaskQueue::Task([] {}));
+    queue.pushLocal(TaskQueue::Task([] {}));
+
+    std::vector<std::int64_t> stamps;
+    (void)queue.drain([&stamps](TaskQueue::Task &task, std::int64_t postedNs) {
+        stamps.push_back(postedNs);
+        task();
+    });
+    if (stamps.size() != 2 || stamps[0] < before || stamps[1] != 0) {
+        std::cerr << "[stamp] unexpected post stamps\n";
+        return false;
+    }
+    return true;
+}
+
 /// 여러 producer 스레드와 단일 consumer 스레드 간에 작업이 안전하게 전달되는지 확인합니다.
 bool test_multi_producer_single_consumer() {
     TaskQueue queue;
@@ -124,6 +214,9 @@ int main() {
     bool ok = true;
 
     ok = ok && test_single_thread_order();
+    ok = ok && test_drain_batch();
+    ok = ok && test_move_only_inline_task();
+    ok = ok && test_drain_posted_stamp();
     ok = ok && test_multi_producer_single_consumer();
 
     if (!ok) {
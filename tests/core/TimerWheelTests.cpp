@@ -137,6 +137,253 @@ bool test_wrap_around() {
     return true;
 }
 
+/// cancelTimer() 로 취소한 타이머는 실행되지 않고, 같은 id 로 다시 취소하면 false 인지 확인합니다.
+bool test_cancel() {
+    using namespace std::chrono_literals;
+
+    TimerWheel wheel(10ms, 8);
+
+    int firedA = 0;
+    int firedB = 0;
+    const auto idA = wheel.addTimer(30ms, [&]() { ++firedA; });
+    wheel.addTimer(30ms, [&]() { ++firedB; });
+
+    if (!wheel.cancelTimer(idA) || wheel.cancelTimer(idA)) {
+        std::cerr << "[cancel] cancelTimer return value mismatch\n";
+        return false;
+    }
+    if (wheel.pendingTimers() != 1) {
+        std::cerr << "[cancel] pending=" << wheel.pendingTimers() << " (expected 1)\n";
+        return false;
+    }
+
+    for (int i = 0; i < 5; ++i) {
+        wheel.tick();
+    }
+
+    if (firedA != 0 || firedB != 1) {
+        std::cerr << "[cancel] fired counts: A=" << firedA << " B=" << firedB
+                  << " (expected 0/1)\n";
+        return false;
+    }
+
+    // 이미 실행된 타이머의 id 는 더 이상 유효하지 않다.
+    if (wheel.cancelTimer(idA) || wheel.reschedule(idA, 10ms)) {
+        std::cerr << "[cancel] stale id accepted\n";
+        return false;
+    }
+
+    return true;
+}
+
+/// reschedule() 로 만료 시점을 뒤로 미루면 새 시점에 한 번만 실행되는지 확인합니다.
+bool test_reschedule() {
+    using namespace std::chrono_literals;
+
+    TimerWheel wheel(10ms, 8);
+
+    std::uint64_t currentTick = 0;
+    std::uint64_t firedAt = 0;
+    int fired = 0;
+    const auto id = wheel.addTimer(20ms, [&]() {
+        ++fired;
+        firedAt = currentTick;
+    });
+
+    ++currentTick;
+    wheel.tick(); // tick 1
+    if (!wheel.reschedule(id, 50ms)) { // tick 1 + 5 = 6
+        std::cerr << "[resched] reschedule failed\n";
+        return false;
+    }
+
+    for (int i = 0; i < 10; ++i) {
+        ++currentTick;
+        wheel.tick();
+    }
+
+    if (fired != 1 || firedAt != 6) {
+        std::cerr << "[resched] fired=" << fired << " at tick " << firedAt
+                  << " (expected 1 at 6)\n";
+        return false;
+    }
+
+    return true;
+}
+
+/// 콜백 안에서 자기 id 로 reschedule() 하면 같은 노드가 주기적으로 재실행되고,
+/// 콜백 안에서 cancelTimer() 하면 멈추는지 확인합니다.
+bool test_periodic_self_reschedule() {
+    using namespace std::chrono_literals;
+
+    TimerWheel wheel(10ms, 4);
+
+    int fired = 0;
+    TimerWheel::TimerId id = TimerWheel::kInvalidTimerId;
+    id = wheel.addTimer(10ms, [&]() {
+        ++fired;
+        wheel.reschedule(id, 20ms);
+        if (fired == 3) {
+            wheel.cancelTimer(id);
+        }
+    });
+
+    for (int i = 0; i < 20; ++i) {
+        wheel.tick();
+    }
+
+    if (fired != 3 || wheel.pendingTimers() != 0) {
+        std::cerr << "[periodic] fired=" << fired << " pending=" << wheel.pendingTimers()
+                  << " (expected 3/0)\n";
+        return false;
+    }
+
+    return true;
+}
+
+/// 상위 level 로 들어간 먼 미래 타이머가 cascade 를 거쳐 정확한 tick 에 실행되는지 확인합니다.
+bool test_hierarchical_long_delay() {
+    using namespace std::chrono_literals;
+
+    TimerWheel wheel(1ms, 8); // level 0 = 8 tick, level 1 = 512 tick, level 2 = 32768 tick ...
+
+    const std::uint64_t delays[] = {7, 8, 9, 63, 64, 65, 511, 512, 513, 4096, 40000, 300001};
+    constexpr std::size_t kCount = sizeof(delays) / sizeof(delays[0]);
+
+    std::uint64_t currentTick = 0;
+    std::uint64_t firedAt[kCount] = {};
+    for (std::size_t i = 0; i < kCount; ++i) {
+        wheel.addTimer(std::chrono::milliseconds(delays[i]),
+                       [&, i]() { firedAt[i] = currentTick; });
+    }
+
+    while (currentTick < 300010) {
+        ++currentTick;
+        wheel.tick();
+    }
+
+    for (std::size_t i = 0; i < kCount; ++i) {
+        if (firedAt[i] != delays[i]) {
+            std::cerr << "[hier] delay " << delays[i] << " fired at tick " << firedAt[i] << "\n";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// ticksUntilNextExpiry() 가 다음 만료(또는 cascade 경계)를 넘지 않고, 그 전에 아무것도
+/// 실행되지 않는지 확인합니다. (이벤트 루프가 이 값만큼 잠들어도 타이머를 놓치지 않아야 함)
+bool test_next_expiry() {
+    using namespace std::chrono_literals;
+
+    TimerWheel wheel(1ms, 8);
+    if (wheel.ticksUntilNextExpiry() != 0 ||
+        wheel.nextDeadline() != TimerWheel::Clock::time_point::max()) {
+        std::cerr << "[next] empty wheel must report no deadline\n";
+        return false;
+    }
+
+    const std::uint64_t delays[] = {3, 100, 5000};
+    std::uint64_t fired = 0;
+    std::uint64_t firedAt = 0;
+    for (const auto d : delays) {
+        wheel.addTimer(std::chrono::milliseconds(d), [&]() {
+            ++fired;
+            firedAt = wheel.currentTick();
+        });
+    }
+
+    std::uint64_t expectedFired = 0;
+    while (wheel.pendingTimers() != 0) {
+        const std::uint64_t ticks = wheel.ticksUntilNextExpiry();
+        const std::uint64_t nextDue = delays[expectedFired] - wheel.currentTick();
+        if (ticks == 0 || ticks > nextDue) {
+            std::cerr << "[next] tick=" << wheel.currentTick() << " ticks=" << ticks
+                      << " due_in=" << nextDue << "\n";
+            return false;
+        }
+        for (std::uint64_t i = 0; i < ticks; ++i) {
+            if (fired != expectedFired) {
+                std::cerr << "[next] timer fired before reported deadline\n";
+                return false;
+            }
+            wheel.tick();
+        }
+        if (fired != expectedFired) {
+            if (firedAt != delays[expectedFired]) {
+                std::cerr << "[next] delay " << delays[expectedFired] << " fired at " << firedAt
+                          << "\n";
+                return false;
+            }
+            ++expectedFired;
+        }
+    }
+
+    return expectedFired == 3;
+}
+
+/// µs 해상도에서 sub-ms 타이머가 ms 로 뭉개지지 않고 각자 tick 에 실행되는지 확인합니다.
+bool test_sub_ms_delay() {
+    using namespace std::chrono_literals;
+
+    // 생성 전 시각을 기준으로 잡는다. (경과 시간은 base+X 기준으로 X 이하)
+    const auto base = TimerWheel::Clock::now();
+    TimerWheel wheel(100us, 64);
+
+    int firedA = 0;
+    int firedB = 0;
+    wheel.addTimer(250us, [&]() { ++firedA; }); // 3 tick
+    wheel.addTimer(750us, [&]() { ++firedB; }); // 8 tick
+
+    wheel.tick(base + 200us);
+    if (firedA != 0 || firedB != 0) {
+        std::cerr << "[sub-ms] timer fired before 250us\n";
+        return false;
+    }
+
+    wheel.tick(base + 500us);
+    if (firedA != 1 || firedB != 0) {
+        std::cerr << "[sub-ms] expected only the 250us timer at 500us (a=" << firedA << " b=" << firedB
+                  << ")\n";
+        return false;
+    }
+
+    wheel.tick(base + 1ms);
+    if (firedA != 1 || firedB != 1) {
+        std::cerr << "[sub-ms] 750us timer did not fire within 1ms\n";
+        return false;
+    }
+    return true;
+}
+
+/// 1us tick 에서 긴 공백을 tick(now) 한 번으로 넘겨도 타이머가 정확히 한 번씩 실행되는지 확인합니다.
+/// (빈 tick 을 건너뛰는 경로 + 상위 level cascade)
+bool test_fast_forward_fine_tick() {
+    using namespace std::chrono_literals;
+
+    const auto base = TimerWheel::Clock::now();
+    TimerWheel wheel(1us, 64);
+
+    std::uint64_t nearAt = 0;
+    std::uint64_t farAt = 0;
+    wheel.addTimer(5ms, [&]() { nearAt = wheel.currentTick(); });
+    wheel.addTimer(2s, [&]() { farAt = wheel.currentTick(); });
+
+    wheel.tick(base + 10ms);
+    if (nearAt != 5000 || farAt != 0) {
+        std::cerr << "[fast-forward] near fired at " << nearAt << " far=" << farAt << "\n";
+        return false;
+    }
+
+    wheel.tick(base + 3s);
+    if (farAt != 2'000'000 || wheel.pendingTimers() != 0) {
+        std::cerr << "[fast-forward] far fired at " << farAt << " pending=" << wheel.pendingTimers() << "\n";
+        return false;
+    }
+    return true;
+}
+
 } // namespace
 
 int main() {
@@ -145,6 +392,13 @@ int main() {
     ok = ok && test_single_timer_basic();
     ok = ok && test_multiple_timers_order();
     ok = ok && test_wrap_around();
+    ok = ok && test_cancel();
+    ok = ok && test_reschedule();
+    ok = ok && test_periodic_self_reschedule();
+    ok = ok && test_hierarchical_long_delay();
+    ok = ok && test_next_expiry();
+    ok = ok && test_sub_ms_delay();
+    ok = ok && test_fast_forward_fine_tick();
 
     if (!ok) {
         std::cerr << "TimerWheel tests FAILED\n";
@@ -0,0 +1,132 @@
+#include <hypernet/monitoring/LatencyHistogram.hpp>
+#include <hypernet/monitoring/Metrics.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+
+using hypernet::monitoring::LatencyHistogram;
+
+namespace {
+
+/// 모든 값이 자기 bucket 의 [하한, 상한] 안에 들고, bucket 번호가 값에 따라 단조 증가하는지 확인합니다.
+bool test_bucket_bounds() {
+    std::size_t prev = 0;
+    for (std::uint64_t v = 0; v < (std::uint64_t{1} << LatencyHistogram::kMaxValueBits); v = v < 4096 ? v + 1 : v + v / 7) {
+        const std::size_t idx = LatencyHistogram::bucketIndex(v);
+        if (idx < prev || LatencyHistogram::bucketLowerBound(idx) > v || LatencyHistogram::bucketUpperBound(idx) < v) {
+            std::cerr << "[bounds] v=" << v << " idx=" << idx << "\n";
+            return false;
+        }
+        // 상대 오차: bucket 폭 / 하한 <= 1 / kSubBuckets
+        const std::uint64_t lo = LatencyHistogram::bucketLowerBound(idx);
+        const std::uint64_t width = LatencyHistogram::bucketUpperBound(idx) - lo + 1;
+        if (lo >= LatencyHistogram::kSubBuckets && width * LatencyHistogram::kSubBuckets > lo) {
+            std::cerr << "[bounds] bucket too wide at v=" << v << "\n";
+            return false;
+        }
+        prev = idx;
+    }
+    return LatencyHistogram::bucketIndex(~std::uint64_t{0}) == LatencyHistogram::kBucketCount - 1;
+}
+
+/// 1..100000 ns 균등 분포의 분위수가 bucket 오차(6.25%) 안에 들고, max/2의 거듭제곱 누적 개수가 정확한지 확인합니다.
+bool test_percentiles() {
+    auto h = std::make_unique<LatencyHistogram>();
+    for (std::int64_t v = 1; v <= 100000; ++v) {
+        h->record(v);
+    }
+    h->record(-5); // 음수는 0 으로
+
+    auto s = std::make_unique<LatencyHistogram::Snapshot>();
+    h->snapshotInto(*s);
+    if (s->count != 100001 || s->maxNs != 100000) {
+        std::cerr << "[pct] count=" << s->count << " max=" << s->maxNs << "\n";
+        return false;
+    }
+
+    const struct {
+        double q;
+        double expect;
+    } cases[] = {{0.50, 50000}, {0.99, 99000}, {0.999, 99900}};
+    for (const auto &c : cases) {
+        const double got = static_cast<double>(s->percentile(c.q));
+        if (got < c.expect || got > c.expect * 1.0625) {
+            std::cerr << "[pct] q=" << c.q << " got=" << got << " expect~" << c.expect << "\n";
+            return false;
+        }
+    }
+    if (s->percentile(1.0) != 100000) {
+        std::cerr << "[pct] p100 must be clamped to max\n";
+        return false;
+    }
+    if (s->countBelow(1024) != 1024 || s->countBelow(65536) != 65536) {
+        std::cerr << "[pct] countBelow mismatch " << s->countBelow(1024) << " " << s->countBelow(65536) << "\n";
+        return false;
+    }
+
+    h->reset();
+    h->snapshotInto(*s);
+    return s->count == 0 && s->percentile(0.5) == 0;
+}
+
+/// 워커 슬롯이 Prometheus histogram 과 JSON 으로 나가는지 확인합니다.
+bool test_engine_export() {
+    auto &metrics = hypernet::monitoring::engineMetrics();
+    metrics.reset();
+    metrics.workerLoop(3)->active.store(true);
+    auto *lat = metrics.workerLatency(3);
+    if (!lat || metrics.workerLatency(3) != lat || metrics.workerLatency(100000) != nullptr) {
+        std::cerr << "[export] workerLatency slot mismatch\n";
+        return false;
+    }
+    lat->dispatchDelay.record(300);
+    lat->dispatchDelay.record(5000);
+
+    const std::string text = metrics.toPrometheusText();
+    const char *expected[] = {
+        "# TYPE hypernet_worker_dispatch_delay_seconds histogram\n",
+        "hypernet_worker_dispatch_delay_seconds_bucket{worker=\"3\",le=\"0.000000256\"} 0\n",
+        "hypernet_worker_dispatch_delay_seconds_bucket{worker=\"3\",le=\"0.000000512\"} 1\n",
+        // 큰 경계도 반올림 없이 정확한 10진수로 (2^20 ns, 2^30 ns)
+        "hypernet_worker_dispatch_delay_seconds_bucket{worker=\"3\",le=\"0.001048576\"} 2\n",
+        "hypernet_worker_dispatch_delay_seconds_bucket{worker=\"3\",le=\"1.073741824\"} 2\n",
+        "hypernet_worker_dispatch_delay_seconds_bucket{worker=\"3\",le=\"+Inf\"} 2\n",
+        "hypernet_worker_dispatch_delay_seconds_sum{worker=\"3\"} 0.0000053\n",
+        "hypernet_worker_dispatch_delay_seconds_count{worker=\"3\"} 2\n",
+        "hypernet_worker_loop_iteration_seconds_count{worker=\"3\"} 0\n",
+    };
+    for (const char *e : expected) {
+        if (text.find(e) == std::string::npos) {
+            std::cerr << "[export] missing: " << e;
+            return false;
+        }
+    }
+
+    const std::string json = metrics.toLatencyJson();
+    if (json.find("{\"worker\":3,\"dispatch_delay\":{\"count\":2,") == std::string::npos ||
+        json.find("\"max\":5000}") == std::string::npos || json.find("\"total\":{\"dispatch_delay\"") == std::string::npos) {
+        std::cerr << "[export] json: " << json;
+        return false;
+    }
+
+    metrics.reset();
+    return lat->dispatchDelay.count() == 0;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = ok && test_bucket_bounds();
+    ok = ok && test_percentiles();
+    ok = ok && test_engine_export();
+
+    if (!ok) {
+        std::cerr << "LatencyHistogram tests FAILED\n";
+        return 1;
+    }
+    std::cout << "LatencyHistogram tests PASSED\n";
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include <hypernet/core/CpuTopology.hpp>
+#include <hypernet/net/Acceptor.hpp>
+#include <hypernet/net/ConnectionSteering.hpp>
+#include <hypernet/net/Socket.hpp>
+
+#include <array>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using hypernet::net::Acceptor;
+using hypernet::net::Socket;
+
+namespace {
+
+constexpr std::size_t kListeners = 3;
+constexpr int kConnections = 12;
+
+/// 같은 포트에 reuseport 리스너 3개를 bind 순서대로 엽니다. (그룹 index = 벡터 index)
+std::vector<std::unique_ptr<Acceptor>> openGroup() {
+    std::vector<std::unique_ptr<Acceptor>> group;
+    group.push_back(std::make_unique<Acceptor>("127.0.0.1", 0, 128, true));
+    const auto port = group.front()->listenPort();
+    for (std::size_t i = 1; i < kListeners; ++i) {
+        group.push_back(std::make_unique<Acceptor>("127.0.0.1", port, 128, true));
+    }
+    for (auto &a : group) {
+        (void)a->setNonBlocking(true);
+    }
+    return group;
+}
+
+/// kConnections 개를 연결한 뒤 리스너별로 accept 된 수를 셉니다.
+std::array<int, kListeners> connectAndCount(std::vector<std::unique_ptr<Acceptor>> &group) {
+    std::vector<Socket> clients;
+    for (int i = 0; i < kConnections; ++i) {
+        Socket c = Socket::createTcpIPv4();
+        if (c.isValid() && c.connect("127.0.0.1", group.front()->listenPort())) {
+            clients.push_back(std::move(c));
+        }
+    }
+    std::array<int, kListeners> counts{};
+    for (std::size_t i = 0; i < kListeners; ++i) {
+        while (group[i]->acceptOne().isValid()) {
+            ++counts[i];
+        }
+    }
+    return counts;
+}
+
+bool expectCounts(const std::array<int, kListeners> &got, const std::array<int, kListeners> &want,
+                  const char *tag) {
+    if (got != want) {
+        std::cerr << "[" << tag << "] got " << got[0] << "/" << got[1] << "/" << got[2] << "\n";
+        return false;
+    }
+    return true;
+}
+
+/// 가중치는 가장 많이 찬 워커 대비 부족분 + 1 입니다.
+bool test_weights_from_load() {
+    const auto w = hypernet::net::steeringWeights({10, 4, 0, -1});
+    return w == std::vector<std::uint32_t>{1, 7, 11, 11} &&
+           hypernet::net::steeringWeights({3, 3}) == std::vector<std::uint32_t>{1, 1};
+}
+
+/// 가중치 0 인 리스너는 연결을 받지 않습니다.
+bool test_weighted_program_routes() {
+    auto group = openGroup();
+    const int rc = hypernet::net::attachReuseportProgram(group.front()->nativeHandle(),
+                                                         hypernet::net::buildWeightedProgram({0, 0, 5}));
+    if (rc != 0) {
+        std::cerr << "[weighted] attach errno=" << rc << "\n";
+        return false;
+    }
+    return expectCounts(connectAndCount(group), {0, 0, kConnections}, "weighted");
+}
+
+/// loopback 은 SYN 을 보낸 CPU 에서 받으므로, 고정한 CPU 의 리스너로만 가야 합니다.
+bool test_incoming_cpu_program_routes() {
+    const auto topo = hypernet::core::scanCpuTopology();
+    if (topo.empty() || hypernet::core::pinCurrentThreadToCpu(topo.front().cpu) != 0) {
+        std::cerr << "[cpu] cannot pin\n";
+        return false;
+    }
+    auto group = openGroup();
+    const int rc = hypernet::net::attachReuseportProgram(
+        group.front()->nativeHandle(), hypernet::net::buildIncomingCpuProgram({-1, topo.front().cpu, -1}));
+    if (rc != 0) {
+        std::cerr << "[cpu] attach errno=" << rc << "\n";
+        return false;
+    }
+    return expectCounts(connectAndCount(group), {0, kConnections, 0}, "cpu");
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = ok && test_weights_from_load();
+    ok = ok && test_weighted_program_routes();
+    ok = ok && test_incoming_cpu_program_routes();
+
+    if (!ok) {
+        std::cerr << "ConnectionSteering tests FAILED\n";
+        return 1;
+    }
+    std::cout << "ConnectionSteering tests PASSED\n";
+    return 0;
+}
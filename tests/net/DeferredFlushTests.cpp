@@ -0,0 +1,98 @@
+#include "WorkerHarness.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+#include <poll.h>
+#include <sys/socket.h>
+
+using hypernet::net::SessionManager;
+using hypernet::test::TestWorker;
+
+namespace {
+
+constexpr std::uint16_t kOpcode = 0x1234;
+constexpr char kBody[] = "deferred";
+constexpr std::size_t kFrameBytes = 4 + 2 + sizeof(kBody);
+
+/// peer 쪽에서 프레임 1개를 timeout 안에 다 받았는지 확인합니다.
+bool receiveFrame(int peer, std::chrono::milliseconds timeout) {
+    std::uint8_t buf[64]{};
+    std::size_t got = 0;
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (got < kFrameBytes) {
+        const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        if (left.count() <= 0) {
+            return false;
+        }
+        ::pollfd pfd{peer, POLLIN, 0};
+        if (::poll(&pfd, 1, static_cast<int>(left.count())) <= 0) {
+            return false;
+        }
+        const ::ssize_t n = ::recv(peer, buf + got, sizeof(buf) - got, 0);
+        if (n <= 0) {
+            return false;
+        }
+        got += static_cast<std::size_t>(n);
+    }
+    const std::uint16_t opcode = static_cast<std::uint16_t>((buf[4] << 8) | buf[5]);
+    return got == kFrameBytes && opcode == kOpcode && std::memcmp(buf + 6, kBody, sizeof(kBody)) == 0;
+}
+
+/// deferred flush 를 켠 워커 1개 + socketpair 세션 1개를 띄웁니다.
+bool startDeferred(TestWorker &w) {
+    w.start([](SessionManager &sm) { sm.configureDeferredFlush(true, false); });
+    return w.acceptPair();
+}
+
+void sendFrame(TestWorker &w) { (void)w.sm.sendPacketU16(w.sid, kOpcode, kBody, sizeof(kBody)); }
+
+/// 다른 스레드가 post 한 send 는 추가 이벤트 없이 소켓까지 나가야 합니다.
+bool test_cross_thread_post_flushes() {
+    TestWorker w;
+    if (!startDeferred(w)) {
+        std::cerr << "[cross-thread] worker setup failed\n";
+        return false;
+    }
+    w.loop.post([&w]() { sendFrame(w); });
+    const bool ok = receiveFrame(w.peer, std::chrono::milliseconds(1000));
+    w.stop();
+    if (!ok) {
+        std::cerr << "[cross-thread] posted send was not flushed\n";
+    }
+    return ok;
+}
+
+/// iteration 앞쪽 drainTasks 에서 적재된 send (잠들기 직전 경로) 도 대기 전에 flush 되어야 합니다.
+/// - 워커 자신이 post 한 task 는 다음 iteration 의 첫 drain 에서 실행되고, 그 뒤 루프는 깨울 것이 없습니다.
+bool test_first_drain_send_flushes_before_sleep() {
+    TestWorker w;
+    if (!startDeferred(w)) {
+        std::cerr << "[first-drain] worker setup failed\n";
+        return false;
+    }
+    w.loop.post([&w]() { w.loop.post([&w]() { sendFrame(w); }); });
+    const bool ok = receiveFrame(w.peer, std::chrono::milliseconds(1000));
+    w.stop();
+    if (!ok) {
+        std::cerr << "[first-drain] send queued before the poll stayed in the ring\n";
+    }
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = ok && test_cross_thread_post_flushes();
+    ok = ok && test_first_drain_send_flushes_before_sleep();
+
+    if (!ok) {
+        std::cerr << "DeferredFlush tests FAILED\n";
+        return 1;
+    }
+    std::cout << "DeferredFlush tests PASSED\n";
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include <hypernet/net/IoUringReactor.hpp>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using hypernet::net::IoUringReactor;
+
+namespace {
+
+using namespace std::chrono_literals;
+
+/// 여러 iovec 조각을 한 번에 제출했을 때 short send 가 나도 바이트 순서가 유지되는지 확인합니다.
+/// - 송신 버퍼를 작게 잡고 peer 가 천천히 읽어 커널이 조각 일부만 보내고 완료하도록 만듭니다.
+/// - 완료 res 만큼만 앞으로 옮기고 나머지를 다시 제출합니다. (Session::onSendCompleted_ 와 같은 방식)
+bool test_short_send_keeps_order() {
+    int fds[2]{-1, -1};
+    if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds) != 0) {
+        std::cerr << "[short] socketpair failed\n";
+        return false;
+    }
+    const int small = 4096;
+    (void)::setsockopt(fds[0], SOL_SOCKET, SO_SNDBUF, &small, sizeof(small));
+
+    // 조각마다 다른 패턴: 뒤 조각이 앞 조각의 꼬리를 앞지르면 바로 드러난다.
+    constexpr std::size_t kSegBytes = 256 * 1024;
+    constexpr std::size_t kSegs = 3;
+    std::vector<unsigned char> src(kSegBytes * kSegs);
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<unsigned char>((i / kSegBytes) * 64 + (i % 61));
+    }
+
+    std::unique_ptr<IoUringReactor> reactor;
+    try {
+        reactor = std::make_unique<IoUringReactor>(64, 8, 4096);
+    } catch (const std::system_error &e) {
+        std::cout << "[short] io_uring unavailable, skipped (" << e.what() << ")\n";
+        ::close(fds[0]);
+        ::close(fds[1]);
+        return true;
+    }
+    if (!reactor->registerFd(fds[0], 0)) {
+        std::cerr << "[short] registerFd failed\n";
+        return false;
+    }
+
+    std::vector<unsigned char> got;
+    got.reserve(src.size());
+    std::thread peer([&]() {
+        unsigned char buf[1500];
+        while (got.size() < src.size()) {
+            ::pollfd pfd{fds[1], POLLIN, 0};
+            if (::poll(&pfd, 1, 2000) <= 0) {
+                return;
+            }
+            const ::ssize_t n = ::recv(fds[1], buf, sizeof(buf), 0);
+            if (n <= 0) {
+                return;
+            }
+            got.insert(got.end(), buf, buf + n);
+            std::this_thread::sleep_for(20us);
+        }
+    });
+
+    std::size_t sent = 0;
+    int completions = 0;
+    bool ok = true;
+    bool inFlight = false;
+    const auto deadline = std::chrono::steady_clock::now() + 10s;
+    while (ok && sent < src.size()) {
+        if (!inFlight) {
+            ::iovec iov[kSegs]{};
+            int iovcnt = 0;
+            for (std::size_t seg = sent / kSegBytes; seg < kSegs; ++seg) {
+                const std::size_t from = seg == sent / kSegBytes ? sent : seg * kSegBytes;
+                iov[iovcnt].iov_base = src.data() + from;
+                iov[iovcnt].iov_len = (seg + 1) * kSegBytes - from;
+                ++iovcnt;
+            }
+            if (!reactor->submitSend(fds[0], iov, iovcnt, nullptr)) {
+                std::cerr << "[short] submitSend failed errno=" << errno << "\n";
+                ok = false;
+                break;
+            }
+            inFlight = true;
+        }
+        if (std::chrono::steady_clock::now() > deadline) {
+            std::cerr << "[short] timed out after " << sent << " bytes\n";
+            ok = false;
+            break;
+        }
+        IoUringReactor::ReadyEvent evs[8];
+        const int n = reactor->wait(evs, 8, 100);
+        for (int i = 0; i < n; ++i) {
+            if (evs[i].completion != IoUringReactor::Completion::Send) {
+                continue;
+            }
+            ++completions;
+            inFlight = false;
+            if (evs[i].result < 0 && evs[i].result != -EAGAIN && evs[i].result != -EINTR) {
+                std::cerr << "[short] send failed res=" << evs[i].result << "\n";
+                ok = false;
+            } else if (evs[i].result > 0) {
+                sent += static_cast<std::size_t>(evs[i].result);
+            }
+        }
+    }
+
+    peer.join();
+    (void)reactor->unregisterFd(fds[0]);
+    ::close(fds[0]);
+    ::close(fds[1]);
+
+    if (ok && (sent != src.size() || got != src)) {
+        std::size_t at = 0;
+        while (at < got.size() && at < src.size() && got[at] == src[at]) {
+            ++at;
+        }
+        std::cerr << "[short] stream mismatch at byte " << at << " (sent=" << sent << " got=" << got.size() << ")\n";
+        ok = false;
+    }
+    // 송신 버퍼가 작으므로 한 번에 다 나갈 수 없다: short completion 경로를 실제로 탔는지
+    if (ok && completions < 2) {
+        std::cerr << "[short] expected several partial completions, got " << completions << "\n";
+        ok = false;
+    }
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = ok && test_short_send_keeps_order();
+
+    if (!ok) {
+        std::cerr << "IoUringSend tests FAILED\n";
+        return 1;
+    }
+    std::cout << "IoUringSend tests PASSED\n";
+    return 0;
+}
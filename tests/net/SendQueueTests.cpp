@@ -0,0 +1,365 @@
+#include "WorkerHarness.hpp"
+
+#include <hypernet/core/Defaults.hpp>
+#include <hypernet/core/EffectiveOptions.hpp>
+#include <hypernet/monitoring/Metrics.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+
+using hypernet::SessionHandle;
+using hypernet::net::SessionManager;
+using hypernet::test::TestWorker;
+using hypernet::test::waitUntil;
+
+namespace {
+
+using namespace std::chrono_literals;
+
+constexpr std::uint16_t kOpcode = 0x0202;
+constexpr std::size_t kRingCap = 4096;
+constexpr std::uint32_t kMaxPayload = 64 * 1024;
+constexpr std::size_t kHeaderBytes = 4 + 2;
+
+/// watermark 전이와 세션 종료를 기록합니다. (transitions 는 워커 스레드 전용, call() 안에서 읽음)
+class BackpressureApp final : public hypernet::test::TestApp {
+  public:
+    std::vector<bool> transitions;
+    std::atomic_bool ended{false};
+
+    void onSessionEnd(SessionHandle) override { ended.store(true, std::memory_order_release); }
+    void onSendBackpressure(SessionHandle, bool congested) override { transitions.push_back(congested); }
+};
+
+hypernet::monitoring::WorkerSendQueueMetrics &queueMetrics() {
+    return *hypernet::monitoring::engineMetrics().workerSendQueue(0);
+}
+
+/// body = [seq(4B BE)] + (seq + i) & 0xFF 패턴. 받는 쪽에서 순서와 내용을 함께 확인합니다.
+std::string makeBody(std::uint32_t seq, std::size_t len) {
+    std::string body(len < 4 ? 4 : len, '\0');
+    body[0] = static_cast<char>(seq >> 24);
+    body[1] = static_cast<char>(seq >> 16);
+    body[2] = static_cast<char>(seq >> 8);
+    body[3] = static_cast<char>(seq);
+    for (std::size_t i = 4; i < body.size(); ++i) {
+        body[i] = static_cast<char>((seq + i) & 0xFF);
+    }
+    return body;
+}
+
+/// peer 쪽에서 프레임을 읽어 seq 가 0 부터 빠짐없이 이어지는지 확인합니다.
+struct FrameChecker {
+    std::string pending;
+    std::uint32_t nextSeq{0};
+    std::size_t bytes{0};
+    bool broken{false};
+
+    void feed(const char *p, std::size_t n) {
+        bytes += n;
+        pending.append(p, n);
+        std::size_t off = 0;
+        while (!broken && pending.size() - off >= kHeaderBytes) {
+            const auto *h = reinterpret_cast<const unsigned char *>(pending.data() + off);
+            const std::size_t len = (std::size_t{h[0]} << 24) | (std::size_t{h[1]} << 16) | (std::size_t{h[2]} << 8) | h[3];
+            if (pending.size() - off < 4 + len) {
+                break;
+            }
+            const std::uint16_t opcode = static_cast<std::uint16_t>((h[4] << 8) | h[5]);
+            const std::string body = pending.substr(off + kHeaderBytes, len - 2);
+            if (opcode != kOpcode || body != makeBody(nextSeq, body.size())) {
+                std::cerr << "  frame " << nextSeq << " corrupted or out of order\n";
+                broken = true;
+                break;
+            }
+            ++nextSeq;
+            off += 4 + len;
+        }
+        pending.erase(0, off);
+    }
+
+    /// 누적 total 바이트가 될 때까지 읽으며 프레임을 확인합니다.
+    bool read(int fd, std::size_t total, std::chrono::milliseconds timeout) {
+        std::vector<char> buf(64 * 1024);
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!broken && bytes < total) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                std::cerr << "  read " << bytes << " of " << total << " bytes\n";
+                return false;
+            }
+            ::pollfd pfd{fd, POLLIN, 0};
+            if (::poll(&pfd, 1, 10) <= 0) {
+                continue;
+            }
+            const std::size_t want = total - bytes < buf.size() ? total - bytes : buf.size();
+            const ::ssize_t n = ::recv(fd, buf.data(), want, 0);
+            if (n <= 0) {
+                return false;
+            }
+            feed(buf.data(), static_cast<std::size_t>(n));
+        }
+        return !broken;
+    }
+};
+
+/// overflow 큐를 켠 워커 1개를 별도 스레드에서 돌립니다. (세션 = socketpair 한쪽, peer 는 읽기 전까지 막혀 있음)
+struct QueueWorker : TestWorker {
+    std::shared_ptr<BackpressureApp> app = std::make_shared<BackpressureApp>();
+    std::uint32_t nextSeq{0};
+    std::size_t sentBytes{0};
+
+    QueueWorker() : TestWorker(0, kRingCap, kRingCap, kMaxPayload) {}
+
+    bool start(std::size_t limit, std::size_t high, std::size_t low) {
+        TestWorker::start([this, limit, high, low](SessionManager &sm) {
+            sm.setApplication(app);
+            sm.configureSendQueue(limit, high, low);
+        });
+        return acceptPair();
+    }
+
+    /// 다음 seq 프레임 1개를 워커 스레드에서 보냅니다.
+    bool send(std::size_t bodyLen) {
+        const std::string body = makeBody(nextSeq, bodyLen);
+        bool ok = false;
+        call([&]() { ok = sm.sendPacketU16(sid, kOpcode, body.data(), body.size()); });
+        if (ok) {
+            ++nextSeq;
+            sentBytes += kHeaderBytes + body.size();
+        }
+        return ok;
+    }
+
+    std::vector<bool> transitions() {
+        std::vector<bool> out;
+        call([&]() { out = app->transitions; });
+        return out;
+    }
+};
+
+/// watermark 기본값: high = limit 의 3/4, low = limit 의 1/4 (high 가 작으면 high 의 1/2).
+bool test_watermark_defaults() {
+    struct Case {
+        std::size_t limit, high, low, wantHigh, wantLow;
+    };
+    constexpr std::size_t kMiB = 1024 * 1024;
+    const Case cases[] = {
+        {4 * kMiB, 0, 0, 3 * kMiB, 1 * kMiB},
+        {4 * kMiB, 512 * 1024, 0, 512 * 1024, 256 * 1024},
+        {4 * kMiB, 2 * kMiB, 0, 2 * kMiB, 1 * kMiB},
+        {4 * kMiB, 0, 2 * kMiB, 3 * kMiB, 2 * kMiB},
+        {4 * kMiB, 0, 3 * kMiB, 3 * kMiB, 1 * kMiB}, // high 만 기본값인데 low 가 그 이상 → 기본 low
+    };
+    for (const Case &c : cases) {
+        hypernet::EngineConfig cfg{};
+        cfg.sendQueueLimitBytes = c.limit;
+        cfg.sendQueueHighWatermark = c.high;
+        cfg.sendQueueLowWatermark = c.low;
+        const auto sp = hypernet::core::makeEffectiveEngineOptions(cfg).workerDefaults.sendPath;
+        if (sp.sendQueueHighWatermark != c.wantHigh || sp.sendQueueLowWatermark != c.wantLow) {
+            std::cerr << "[defaults] limit=" << c.limit << " high=" << c.high << " low=" << c.low << " -> "
+                      << sp.sendQueueHighWatermark << "/" << sp.sendQueueLowWatermark << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+/// 송신 링을 넘친 바이트는 풀 블록에, 풀이 바닥나면 힙 블록에 이어 붙고 모두 순서대로 나갑니다.
+bool test_spill_pool_then_heap() {
+    hypernet::monitoring::engineMetrics().reset();
+    constexpr std::size_t kPoolBytes =
+        hypernet::core::defaults::kSendQueueBlockBytes * hypernet::core::defaults::kSendQueuePoolBlocks;
+    QueueWorker w;
+    if (!w.start(kPoolBytes * 2, kPoolBytes * 2, 0)) {
+        std::cerr << "[spill] worker setup failed\n";
+        return false;
+    }
+
+    bool ok = true;
+    bool sawPooledOnly = false;
+    while (ok && queueMetrics().heapBlocksTotal.load() == 0 && w.nextSeq < 1000) {
+        ok = w.send(60'000);
+        const std::uint64_t overflow = queueMetrics().overflowBytes.load();
+        if (overflow != 0 && overflow < kPoolBytes / 2) {
+            sawPooledOnly = true; // 풀이 남아 있는 동안은 힙으로 가지 않았다.
+        }
+    }
+    const std::size_t queued = w.queued();
+    if (!ok || !sawPooledOnly || queueMetrics().heapBlocksTotal.load() == 0 || queued <= kPoolBytes) {
+        std::cerr << "[spill] ok=" << ok << " pooled_only=" << sawPooledOnly
+                  << " heap=" << queueMetrics().heapBlocksTotal.load() << " queued=" << queued << "\n";
+        w.stop();
+        return false;
+    }
+
+    FrameChecker checker;
+    ok = checker.read(w.peer, w.sentBytes, 5s) && checker.nextSeq == w.nextSeq &&
+         waitUntil([&]() { return w.queued() == 0 && queueMetrics().overflowBytes.load() == 0; }, 1s) &&
+         !w.app->ended.load();
+    w.stop();
+    if (!ok) {
+        std::cerr << "[spill] drain failed (frames " << checker.nextSeq << "/" << w.nextSeq << ")\n";
+    }
+    return ok;
+}
+
+/// high 를 넘으면 (true), low 아래로 내려오면 (false) 가 한 번씩만 불립니다. (그 사이 오르내림은 통지 없음)
+bool test_watermark_transitions_once() {
+    hypernet::monitoring::engineMetrics().reset();
+    constexpr std::size_t kHigh = 256 * 1024;
+    constexpr std::size_t kLow = 32 * 1024;
+    QueueWorker w;
+    if (!w.start(4 * 1024 * 1024, kHigh, kLow)) {
+        std::cerr << "[watermark] worker setup failed\n";
+        return false;
+    }
+
+    bool ok = true;
+    while (ok && w.queued() < kHigh) {
+        ok = w.send(8000);
+    }
+    // high 위에서 더 쌓아도 다시 부르지 않는다.
+    for (int i = 0; ok && i < 40; ++i) {
+        ok = w.send(8000);
+    }
+    if (!ok || w.transitions() != std::vector<bool>{true}) {
+        std::cerr << "[watermark] expected a single congested=true\n";
+        w.stop();
+        return false;
+    }
+
+    // 조금 비우면 high 아래로 내려가지만 low 위이므로 통지 없음. 다시 high 를 넘겨도 통지 없음.
+    FrameChecker checker;
+    ok = checker.read(w.peer, 128 * 1024, 1s) &&
+         waitUntil([&]() { return w.queued() < w.sentBytes - 128 * 1024; }, 1s);
+    const std::size_t mid = w.queued();
+    while (ok && w.queued() < kHigh + 64 * 1024) {
+        ok = w.send(8000);
+    }
+    if (!ok || mid <= kLow || w.transitions() != std::vector<bool>{true}) {
+        std::cerr << "[watermark] re-notified while above low (mid=" << mid << ")\n";
+        w.stop();
+        return false;
+    }
+
+    ok = checker.read(w.peer, w.sentBytes, 2s) && waitUntil([&]() { return w.queued() == 0; }, 1s) &&
+         waitUntil([&]() { return w.transitions() == std::vector<bool>{true, false}; }, 1s);
+    const std::uint64_t events = queueMetrics().backpressureEventsTotal.load();
+    const std::uint64_t congested = queueMetrics().congestedSessions.load();
+    w.stop();
+    if (!ok || events != 1 || congested != 0) {
+        std::cerr << "[watermark] events=" << events << " congested=" << congested << "\n";
+        return false;
+    }
+    return true;
+}
+
+/// 상한 이하의 송신은 받아 두고, 상한을 넘기는 송신에서만 세션을 닫습니다.
+bool test_close_only_at_limit() {
+    hypernet::monitoring::engineMetrics().reset();
+    constexpr std::size_t kLimit = 256 * 1024;
+    constexpr std::size_t kBody = 6000;
+    QueueWorker w;
+    if (!w.start(kLimit, kLimit / 2, 0)) {
+        std::cerr << "[limit] worker setup failed\n";
+        return false;
+    }
+
+    // 커널 버퍼가 차서 링/overflow 큐에 쌓이기 시작할 때까지 보낸다.
+    bool ok = true;
+    while (ok && w.queued() == 0) {
+        ok = w.send(kBody);
+    }
+    while (ok && w.queued() + kHeaderBytes + kBody <= kLimit) {
+        ok = w.send(kBody);
+        if (!ok || w.app->ended.load() || queueMetrics().limitClosesTotal.load() != 0) {
+            std::cerr << "[limit] closed below the limit (queued=" << w.queued() << ")\n";
+            w.stop();
+            return false;
+        }
+    }
+    const std::size_t before = w.queued();
+
+    // 이번 프레임은 상한을 넘긴다.
+    const bool accepted = w.send(kBody);
+    const bool closed = waitUntil([&]() { return w.app->ended.load(); }, 1s);
+    std::size_t sessions = 1;
+    w.call([&]() { sessions = w.sm.sessionCount(); });
+    const std::uint64_t limitCloses = queueMetrics().limitClosesTotal.load();
+    const std::uint64_t overflowLeft = queueMetrics().overflowBytes.load();
+    w.stop();
+    if (accepted || !closed || sessions != 0 || limitCloses != 1 || overflowLeft != 0) {
+        std::cerr << "[limit] before=" << before << " accepted=" << accepted << " closed=" << closed
+                  << " limit_closes=" << limitCloses << " overflow_left=" << overflowLeft << "\n";
+        return false;
+    }
+    return true;
+}
+
+/// 링 → overflow 큐 → 새 프레임 순서가 부분 drain 중에 보낸 프레임까지 유지됩니다.
+/// - body 길이를 바꿔 가며 블록/링 경계가 프레임 중간에 걸리게 합니다.
+bool test_order_ring_overflow_new() {
+    hypernet::monitoring::engineMetrics().reset();
+    QueueWorker w;
+    if (!w.start(8 * 1024 * 1024, 8 * 1024 * 1024, 0)) {
+        std::cerr << "[order] worker setup failed\n";
+        return false;
+    }
+
+    bool ok = true;
+    std::size_t len = 1;
+    const auto nextLen = [&len]() {
+        len = (len * 7 + 1234) % 20'000 + 4;
+        return len;
+    };
+    while (ok && queueMetrics().overflowBytes.load() < 512 * 1024) {
+        ok = w.send(nextLen());
+    }
+
+    FrameChecker checker;
+    for (int round = 0; ok && round < 8; ++round) {
+        // 일부만 읽어 overflow 큐 앞부분이 링으로 옮겨지는 동안 새 프레임을 뒤에 붙인다.
+        ok = checker.read(w.peer, checker.bytes + 96 * 1024, 1s);
+        for (int i = 0; ok && i < 10; ++i) {
+            ok = w.send(nextLen());
+        }
+        if (ok && queueMetrics().overflowBytes.load() == 0) {
+            std::cerr << "[order] overflow queue drained too early (round " << round << ")\n";
+            ok = false;
+        }
+    }
+
+    ok = ok && checker.read(w.peer, w.sentBytes, 5s) && checker.nextSeq == w.nextSeq;
+    w.stop();
+    if (!ok) {
+        std::cerr << "[order] frames " << checker.nextSeq << "/" << w.nextSeq << "\n";
+    }
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = ok && test_watermark_defaults();
+    ok = ok && test_spill_pool_then_heap();
+    ok = ok && test_watermark_transitions_once();
+    ok = ok && test_close_only_at_limit();
+    ok = ok && test_order_ring_overflow_new();
+
+    if (!ok) {
+        std::cerr << "SendQueue tests FAILED\n";
+        return 1;
+    }
+    std::cout << "SendQueue tests PASSED\n";
+    return 0;
+}
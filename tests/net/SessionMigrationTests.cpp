@@ -0,0 +1,350 @@
+#include "WorkerHarness.hpp"
+
+#include <hypernet/monitoring/Metrics.hpp>
+#include <hypernet/net/SessionMigration.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+
+using hypernet::SessionHandle;
+using hypernet::net::SessionManager;
+using hypernet::net::SessionMigrator;
+using hypernet::net::planRebalance;
+using hypernet::net::workerUtilizationPct;
+using hypernet::test::TestWorker;
+using hypernet::test::waitUntil;
+
+namespace {
+
+using namespace std::chrono_literals;
+
+constexpr std::uint64_t kMs = 1'000'000;
+constexpr std::uint16_t kOpcode = 0x0303;
+constexpr unsigned int kWorkers = 3;
+
+/// idle 이 구간보다 길어도 0% 아래로 내려가지 않습니다.
+bool test_utilization() {
+    return workerUtilizationPct(250 * kMs, 1000 * kMs) == 75 && workerUtilizationPct(0, 1000 * kMs) == 100 &&
+           workerUtilizationPct(2000 * kMs, 1000 * kMs) == 0 && workerUtilizationPct(5, 0) == 0;
+}
+
+/// 가장 바쁜 워커 → 가장 한가한 워커로 하나만 옮깁니다.
+bool test_plan_moves_hot_to_cold() {
+    const auto m = planRebalance({90, 20, 55}, {8, 2, 4}, 25);
+    if (m.from != 0 || m.to != 1) {
+        std::cerr << "[hot-cold] got " << m.from << "->" << m.to << "\n";
+        return false;
+    }
+    return true;
+}
+
+/// 차이가 임계치보다 작거나 바쁜 워커 세션이 1개뿐이면 옮기지 않습니다.
+bool test_plan_holds() {
+    const auto small = planRebalance({60, 40}, {5, 5}, 25);
+    const auto single = planRebalance({95, 5}, {1, 3}, 25);
+    const auto one = planRebalance({95}, {5}, 25);
+    if (small.from >= 0 || single.from >= 0 || one.from >= 0) {
+        std::cerr << "[hold] " << small.from << "/" << single.from << "/" << one.from << "\n";
+        return false;
+    }
+    return true;
+}
+
+/// 연결 전 워커로는 요청을 넘기지 않습니다.
+bool test_unattached_migrator() {
+    hypernet::net::SessionMigrator migrator(2);
+    return !migrator.request(1, 1) && !migrator.rebalance(0, 1, std::chrono::milliseconds(0)) &&
+           !migrator.post(5, [] {});
+}
+
+// ===== 루프 기반 이관 테스트 =====
+
+/// 이관에 동의하고, 받은 메시지/이관/종료를 워커 id 와 함께 기록합니다. (워커 스레드들이 공유)
+class MigratingApp final : public hypernet::test::TestApp {
+  public:
+    struct Received {
+        int worker;
+        std::string body;
+    };
+
+    void registerHandlers(hypernet::protocol::Dispatcher &dispatcher) override {
+        (void)dispatcher.registerHandler(kOpcode, [this](SessionHandle, const hypernet::protocol::MessageView &m) {
+            const std::lock_guard lock(mu_);
+            received_.push_back({hypernet::core::ThreadContext::currentWorkerId(),
+                                 std::string(static_cast<const char *>(m.data()), m.size())});
+        });
+    }
+    void onSessionEnd(SessionHandle) override {
+        endedOn.store(hypernet::core::ThreadContext::currentWorkerId(), std::memory_order_release);
+    }
+    bool onSessionMigrateOut(SessionHandle, int, std::shared_ptr<void> &) override { return true; }
+    void onSessionMigrateIn(SessionHandle, std::shared_ptr<void>) override {
+        migratedIn.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    std::vector<Received> received() {
+        const std::lock_guard lock(mu_);
+        return received_;
+    }
+
+    std::atomic<int> migratedIn{0};
+    std::atomic<int> endedOn{-1};
+
+  private:
+    std::mutex mu_;
+    std::vector<Received> received_;
+};
+
+std::string frame(const std::string &body) { return hypernet::test::encodeFrame(kOpcode, body); }
+
+std::uint64_t ringsInUse(unsigned int wid) {
+    return hypernet::monitoring::engineMetrics().workerSessionPool(wid)->ringsInUse.load(std::memory_order_relaxed);
+}
+
+/// 워커 3개(각자 스레드 + 루프 + SessionManager)를 SessionMigrator 로 묶습니다.
+/// - 세션 1개는 워커 0 이 socketpair 한쪽으로 accept 하고, 테스트는 반대쪽(peer)으로 주고받습니다.
+struct MigrationCluster {
+    SessionMigrator migrator{kWorkers};
+    std::shared_ptr<MigratingApp> app = std::make_shared<MigratingApp>();
+    std::array<std::unique_ptr<TestWorker>, kWorkers> workers;
+    SessionHandle::Id sid{0};
+    int peer{-1}; ///< workers[0] 이 들고 있다가 stop 에서 닫음
+
+    bool start() {
+        hypernet::monitoring::engineMetrics().reset();
+        for (unsigned int w = 0; w < kWorkers; ++w) {
+            workers[w] = std::make_unique<TestWorker>(w);
+            migrator.attach(w, &workers[w]->loop, &workers[w]->sm);
+        }
+        for (auto &w : workers) {
+            w->start([this](SessionManager &sm) {
+                sm.setApplication(app);
+                sm.attachMigrator(&migrator);
+            });
+        }
+        if (!workers[0]->acceptPair()) {
+            return false;
+        }
+        sid = workers[0]->sid;
+        peer = workers[0]->peer;
+        return true;
+    }
+
+    SessionManager &sm(unsigned int w) { return workers[w]->sm; }
+
+    /// fn 을 w 워커 스레드에서 실행하고 끝날 때까지 기다립니다.
+    template <typename Fn> void call(unsigned int w, Fn &&fn) { workers[w]->call(std::forward<Fn>(fn)); }
+
+    std::size_t forwards(unsigned int w) {
+        std::size_t n = 0;
+        call(w, [&]() { n = sm(w).forwardCount(); });
+        return n;
+    }
+
+    std::size_t sessions(unsigned int w) {
+        std::size_t n = 0;
+        call(w, [&]() { n = sm(w).sessionCount(); });
+        return n;
+    }
+
+    /// sid 를 target 으로 옮기고 target 에서 onSessionMigrateIn 이 불릴 때까지 기다립니다.
+    bool migrate(unsigned int target) {
+        const int before = app->migratedIn.load(std::memory_order_acquire);
+        return migrator.request(sid, target) &&
+               waitUntil([&]() { return app->migratedIn.load(std::memory_order_acquire) == before + 1; }) &&
+               sessions(target) == 1;
+    }
+
+    /// via 워커의 SessionManager 로 보내고 peer 가 그 프레임을 받는지 확인합니다. (via 가 옛 owner 면 forward)
+    bool sendVia(unsigned int via, const std::string &body) {
+        bool accepted = false;
+        call(via, [&]() { accepted = sm(via).sendPacketU16(sid, kOpcode, body.data(), body.size()); });
+        const std::string want = frame(body);
+        std::string got;
+        const auto deadline = std::chrono::steady_clock::now() + 1s;
+        while (accepted && got.size() < want.size() && std::chrono::steady_clock::now() < deadline) {
+            char buf[256];
+            ::pollfd pfd{peer, POLLIN, 0};
+            if (::poll(&pfd, 1, 10) <= 0) {
+                continue;
+            }
+            const ::ssize_t n = ::recv(peer, buf, want.size() - got.size(), 0);
+            if (n <= 0) {
+                break;
+            }
+            got.append(buf, static_cast<std::size_t>(n));
+        }
+        return accepted && got == want;
+    }
+
+    /// via 워커에서 닫기를 요청하고 owner 에서 세션이 끝난 뒤 모든 forward 엔트리가 지워졌는지 확인합니다.
+    bool closeVia(unsigned int via, int expectEndedOn) {
+        call(via, [&]() { sm(via).beginClose(sid, "test_close"); });
+        if (!waitUntil([&]() { return app->endedOn.load(std::memory_order_acquire) == expectEndedOn; })) {
+            std::cerr << "  session did not end on worker " << expectEndedOn << "\n";
+            return false;
+        }
+        // dropForwards_ 는 이전 owner 들에게 post 하므로 비동기로 지워진다.
+        const bool cleared = waitUntil([&]() {
+            for (unsigned int w = 0; w < kWorkers; ++w) {
+                if (forwards(w) != 0) {
+                    return false;
+                }
+            }
+            return true;
+        });
+        if (!cleared) {
+            std::cerr << "  forward entries left: " << forwards(0) << "/" << forwards(1) << "/" << forwards(2) << "\n";
+        }
+        char c = 0;
+        const bool eof = waitUntil([&]() { return ::recv(peer, &c, 1, 0) == 0; });
+        return cleared && eof;
+    }
+
+    /// 모든 루프를 먼저 멈춘 뒤 합칩니다. (종료 중 이전 owner 로 가는 post 가 멈춘 루프에 쌓이기만 하도록)
+    void stop() {
+        for (auto &w : workers) {
+            w->running.store(false, std::memory_order_release);
+            w->loop.wakeup();
+        }
+        for (auto &w : workers) {
+            w->stop();
+        }
+    }
+};
+
+/// A→B: 반쯤 받은 프레임이 링째 넘어가 B 에서 완성되고, A 로 보낸 송신/close 는 B 로 넘어갑니다.
+bool test_migrate_partial_frame() {
+    MigrationCluster c;
+    if (!c.start()) {
+        std::cerr << "[partial] cluster setup failed\n";
+        return false;
+    }
+
+    const std::string f = frame("half-received-frame");
+    bool ok = ::send(c.peer, f.data(), 9, 0) == 9 && waitUntil([]() { return ringsInUse(0) == 1; });
+    ok = ok && c.migrate(1) && c.sessions(0) == 0 && ringsInUse(0) == 0 && ringsInUse(1) == 1;
+    if (!ok) {
+        std::cerr << "[partial] migration with a partial frame failed\n";
+        c.stop();
+        return false;
+    }
+
+    ok = ::send(c.peer, f.data() + 9, f.size() - 9, 0) == static_cast<::ssize_t>(f.size() - 9) &&
+         waitUntil([&]() { return c.app->received().size() == 1; });
+    const auto got = c.app->received();
+    if (!ok || got.size() != 1 || got[0].worker != 1 || got[0].body != "half-received-frame") {
+        std::cerr << "[partial] frame not completed on the target\n";
+        c.stop();
+        return false;
+    }
+
+    ok = c.forwards(0) == 1 && c.sendVia(0, "via-old-owner") && c.sendVia(1, "via-new-owner");
+    if (!ok) {
+        std::cerr << "[partial] send through the old owner id was not forwarded\n";
+        c.stop();
+        return false;
+    }
+
+    ok = c.closeVia(1, 1);
+    c.stop();
+    if (!ok) {
+        std::cerr << "[partial] close on target left state behind\n";
+    }
+    return ok;
+}
+
+/// A→B→A: 돌아온 워커는 자기 forward 엔트리를 지우고, B 에 남은 엔트리로 온 송신/close 는 A 로 갑니다.
+bool test_migrate_round_trip() {
+    MigrationCluster c;
+    if (!c.start()) {
+        std::cerr << "[round-trip] cluster setup failed\n";
+        return false;
+    }
+
+    bool ok = c.migrate(1) && c.migrate(0);
+    ok = ok && c.forwards(0) == 0 && c.forwards(1) == 1 && c.sessions(1) == 0;
+    if (!ok) {
+        std::cerr << "[round-trip] forward entries after return: " << c.forwards(0) << "/" << c.forwards(1) << "\n";
+        c.stop();
+        return false;
+    }
+
+    ok = c.sendVia(1, "from-b") && c.sendVia(0, "from-a");
+    if (!ok) {
+        std::cerr << "[round-trip] send via B not forwarded back to A\n";
+        c.stop();
+        return false;
+    }
+
+    // B 에서 요청한 close 는 forward 를 따라 A 에서 실행되고, A 가 끝나면서 B 의 엔트리를 지운다.
+    ok = c.closeVia(1, 0);
+    c.stop();
+    if (!ok) {
+        std::cerr << "[round-trip] close via B failed\n";
+    }
+    return ok;
+}
+
+/// A→B→C: A 의 엔트리는 B 를, B 의 엔트리는 C 를 가리키고, A 로 보낸 송신/close 는 두 번 넘어가 C 에 닿습니다.
+bool test_migrate_chain() {
+    MigrationCluster c;
+    if (!c.start()) {
+        std::cerr << "[chain] cluster setup failed\n";
+        return false;
+    }
+
+    bool ok = c.migrate(1) && c.migrate(2);
+    ok = ok && c.forwards(0) == 1 && c.forwards(1) == 1 && c.forwards(2) == 0 && c.sessions(1) == 0;
+    if (!ok) {
+        std::cerr << "[chain] A->B->C migration failed\n";
+        c.stop();
+        return false;
+    }
+
+    ok = c.sendVia(0, "from-a") && c.sendVia(1, "from-b") && c.sendVia(2, "from-c");
+    if (!ok) {
+        std::cerr << "[chain] chained forward did not reach C\n";
+        c.stop();
+        return false;
+    }
+
+    ok = c.closeVia(0, 2);
+    c.stop();
+    if (!ok) {
+        std::cerr << "[chain] close via A failed\n";
+    }
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = ok && test_utilization();
+    ok = ok && test_plan_moves_hot_to_cold();
+    ok = ok && test_plan_holds();
+    ok = ok && test_unattached_migrator();
+    ok = ok && test_migrate_partial_frame();
+    ok = ok && test_migrate_round_trip();
+    ok = ok && test_migrate_chain();
+
+    if (!ok) {
+        std::cerr << "SessionMigration tests FAILED\n";
+        return 1;
+    }
+    std::cout << "SessionMigration tests PASSED\n";
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include <hypernet/core/ThreadContext.hpp>
+#include <hypernet/monitoring/Metrics.hpp>
+#include <hypernet/net/SessionPool.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+using hypernet::buffer::RingBuffer;
+using hypernet::net::SessionPool;
+using hypernet::net::SessionPoolAllocator;
+
+namespace {
+
+struct Dummy {
+    std::uint64_t payload[8]{};
+};
+
+bool test_slot_recycle() {
+    hypernet::monitoring::WorkerSessionPoolMetrics metrics;
+    auto pool = std::make_shared<SessionPool>(0, 4, &metrics);
+
+    const void *first = nullptr;
+    {
+        auto a = std::allocate_shared<Dummy>(SessionPoolAllocator<Dummy>(pool));
+        first = a.get();
+    }
+    if (pool->idleSessions() != 1) {
+        std::cerr << "[slot] released slot was not parked\n";
+        return false;
+    }
+
+    auto b = std::allocate_shared<Dummy>(SessionPoolAllocator<Dummy>(pool));
+    if (b.get() != first || pool->stats().sessionHits != 1 || pool->stats().sessionMisses != 1) {
+        std::cerr << "[slot] slot was not reused\n";
+        return false;
+    }
+    if (metrics.sessionHitsTotal.load() != 1 || metrics.idleSessions.load() != 0) {
+        std::cerr << "[slot] metrics not published\n";
+        return false;
+    }
+
+    // 다른 스레드에서 놓인 슬롯은 보관하지 않는다.
+    std::thread other([moved = std::move(b)]() mutable { moved.reset(); });
+    other.join();
+    if (pool->idleSessions() != 0) {
+        std::cerr << "[slot] foreign-thread release must not touch the pool\n";
+        return false;
+    }
+    return true;
+}
+
+bool test_ring_recycle_and_cap() {
+    auto pool = std::make_shared<SessionPool>(0, 1);
+
+    auto r1 = pool->acquireRing(4096, SessionPool::Layout::Flat);
+    auto r2 = pool->acquireRing(4096, SessionPool::Layout::Flat);
+    const std::byte data[3]{std::byte{1}, std::byte{2}, std::byte{3}};
+    r1->write(data, sizeof(data));
+    RingBuffer *keep = r1.get();
+
+    pool->releaseRing(4096, SessionPool::Layout::Flat, std::move(r1));
+    pool->releaseRing(4096, SessionPool::Layout::Flat, std::move(r2)); // maxIdle=1 초과 → 해제
+    if (pool->idleRings() != 1) {
+        std::cerr << "[ring] idleRings=" << pool->idleRings() << " expected 1\n";
+        return false;
+    }
+
+    auto again = pool->acquireRing(4096, SessionPool::Layout::Flat);
+    if (again.get() != keep || !again->empty()) {
+        std::cerr << "[ring] ring was not reused or not cleared\n";
+        return false;
+    }
+
+    // 다른 용량은 다른 class 로 취급한다.
+    auto other = pool->acquireRing(8192, SessionPool::Layout::Flat);
+    if (other->capacity() != 8192 || pool->stats().ringHits != 1) {
+        std::cerr << "[ring] unexpected ring class reuse\n";
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    hypernet::core::ThreadContext::setCurrentWorkerId(0);
+
+    bool ok = true;
+    ok = ok && test_slot_recycle();
+    ok = ok && test_ring_recycle_and_cap();
+
+    if (!ok) {
+        std::cerr << "SessionPool tests FAILED\n";
+        return 1;
+    }
+    std::cout << "SessionPool tests PASSED\n";
+    return 0;
+}
@@ -0,0 +1,352 @@
+#include "WorkerHarness.hpp"
+
+#include <hypernet/monitoring/Metrics.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+
+using hypernet::SessionHandle;
+using hypernet::net::SessionManager;
+using hypernet::test::TestWorker;
+using hypernet::test::waitUntil;
+
+namespace {
+
+using namespace std::chrono_literals;
+
+constexpr std::uint16_t kOpcode = 0x0101;
+constexpr std::size_t kRingCap = 4096;
+constexpr std::uint32_t kMaxPayload = 64 * 1024;
+constexpr std::uint32_t kReclaimIdleMs = 20;
+
+/// 받은 body 를 순서대로 모읍니다. (워커 스레드 전용, 테스트는 call() 안에서 읽음)
+class RecordingApp final : public hypernet::test::TestApp {
+  public:
+    std::vector<std::string> bodies;
+
+    void registerHandlers(hypernet::protocol::Dispatcher &dispatcher) override {
+        (void)dispatcher.registerHandler(kOpcode, [this](SessionHandle, const hypernet::protocol::MessageView &m) {
+            bodies.emplace_back(static_cast<const char *>(m.data()), m.size());
+        });
+    }
+};
+
+std::uint64_t ringsInUse() {
+    return hypernet::monitoring::engineMetrics().workerSessionPool(0)->ringsInUse.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ringReclaims() {
+    return hypernet::monitoring::engineMetrics().workerSessionPool(0)->ringReclaimsTotal.load(std::memory_order_relaxed);
+}
+
+std::string frame(const std::string &body) { return hypernet::test::encodeFrame(kOpcode, body); }
+
+bool writeAll(int fd, const std::string &bytes) {
+    std::size_t off = 0;
+    while (off < bytes.size()) {
+        ::pollfd pfd{fd, POLLOUT, 0};
+        if (::poll(&pfd, 1, 1000) <= 0) {
+            return false;
+        }
+        const ::ssize_t n = ::send(fd, bytes.data() + off, bytes.size() - off, MSG_NOSIGNAL);
+        if (n <= 0) {
+            return false;
+        }
+        off += static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+/// peer 에서 want 바이트를 다 읽을 때까지 받습니다.
+bool readBytes(int fd, std::size_t want, std::chrono::milliseconds timeout) {
+    std::vector<char> buf(64 * 1024);
+    std::size_t got = 0;
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (got < want) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            std::cerr << "  read " << got << " of " << want << " bytes\n";
+            return false;
+        }
+        ::pollfd pfd{fd, POLLIN, 0};
+        if (::poll(&pfd, 1, 10) <= 0) {
+            continue;
+        }
+        const ::ssize_t n = ::recv(fd, buf.data(), buf.size(), 0);
+        if (n <= 0) {
+            return false;
+        }
+        got += static_cast<std::size_t>(n);
+    }
+    return got == want;
+}
+
+/// 세션 1개를 가진 워커를 별도 스레드에서 돌립니다. (세션 = 소켓 쌍의 한쪽, peer = 반대쪽)
+struct RingWorker : TestWorker {
+    std::shared_ptr<RecordingApp> app = std::make_shared<RecordingApp>();
+
+    RingWorker() : TestWorker(0, kRingCap, kRingCap, kMaxPayload) {}
+
+    template <typename Setup> void startWith(Setup setup) {
+        start([this, setup](SessionManager &sm) {
+            sm.setApplication(app);
+            setup(sm);
+        });
+    }
+
+    /// AF_UNIX socketpair 세션
+    template <typename Setup> bool startPair(Setup setup) {
+        startWith(setup);
+        return acceptPair();
+    }
+
+    /// 이미 만든 소켓 쌍(fds[0] = 세션, fds[1] = peer)
+    template <typename Setup> bool startFds(const int fds[2], Setup setup) {
+        startWith(setup);
+        return acceptFd(fds[0], fds[1]);
+    }
+
+    std::size_t received() {
+        std::size_t n = 0;
+        call([&]() { n = app->bodies.size(); });
+        return n;
+    }
+};
+
+const auto kNoSetup = [](SessionManager &) {};
+const auto kReclaim = [](SessionManager &sm) { sm.configureRingReclaim(kReclaimIdleMs); };
+
+/// accept 만으로는 링을 만들지 않고, 완성 프레임만 오가는 세션은 staging/직접 송신으로 끝나 링이 없습니다.
+bool test_rings_lazy() {
+    hypernet::monitoring::engineMetrics().reset();
+    RingWorker w;
+    if (!w.startPair(kNoSetup)) {
+        std::cerr << "[lazy] worker setup failed\n";
+        return false;
+    }
+
+    bool ok = ringsInUse() == 0;
+    if (!ok) {
+        std::cerr << "[lazy] accept allocated " << ringsInUse() << " rings\n";
+    }
+
+    // 완성 프레임 2개: staging 링에서 바로 dispatch 되고 남는 것이 없다.
+    ok = ok && writeAll(w.peer, frame("one") + frame("two")) && waitUntil([&]() { return w.received() == 2; }, 1s);
+    if (ok && ringsInUse() != 0) {
+        std::cerr << "[lazy] complete frames pinned a recv ring\n";
+        ok = false;
+    }
+
+    // 소켓이 받아 주는 송신은 링을 거치지 않는다.
+    w.call([&]() { (void)w.sm.sendPacketU16(w.sid, kOpcode, "pong", 4); });
+    ok = ok && readBytes(w.peer, frame("pong").size(), 1s);
+    if (ok && ringsInUse() != 0) {
+        std::cerr << "[lazy] direct send allocated a send ring\n";
+        ok = false;
+    }
+
+    // 부분 프레임이 남을 때 처음으로 recv 링이 생긴다.
+    ok = ok && writeAll(w.peer, frame("three").substr(0, 5)) && waitUntil([]() { return ringsInUse() == 1; }, 1s);
+    if (!ok) {
+        std::cerr << "[lazy] partial frame did not allocate a recv ring\n";
+    }
+    w.stop();
+    return ok && ringsInUse() == 0;
+}
+
+/// staging 링에 완성 프레임 + 부분 프레임이 함께 오면 나머지를 세션 링으로 넘기고 이어서 조립합니다.
+bool test_staging_hands_partial_to_session() {
+    hypernet::monitoring::engineMetrics().reset();
+    RingWorker w;
+    if (!w.startPair(kNoSetup)) {
+        std::cerr << "[staging] worker setup failed\n";
+        return false;
+    }
+
+    const std::string body2(300, 'x');
+    const std::string second = frame(body2);
+    const std::size_t cut = 4 + 2 + 100; // 헤더 + body 일부
+    bool ok = writeAll(w.peer, frame("first") + second.substr(0, cut)) &&
+              waitUntil([&]() { return w.received() == 1 && ringsInUse() == 1; }, 1s);
+    if (!ok) {
+        std::cerr << "[staging] remainder was not moved to a session ring\n";
+    }
+
+    // 나머지 + 다음 프레임을 보내면 세션 링에서 이어 붙여 둘 다 나와야 한다.
+    ok = ok && writeAll(w.peer, second.substr(cut) + frame("third")) &&
+         waitUntil([&]() { return w.received() == 3; }, 1s);
+    std::vector<std::string> got;
+    w.call([&]() { got = w.app->bodies; });
+    w.stop();
+    if (!ok || got != std::vector<std::string>{"first", body2, "third"}) {
+        std::cerr << "[staging] reassembled bodies mismatch (" << got.size() << ")\n";
+        return false;
+    }
+    return true;
+}
+
+/// 비어 있는 채 idle 시간이 지난 링은 풀로 돌아가고, 다시 쓰면 새로 꺼냅니다.
+bool test_reclaim_after_idle() {
+    hypernet::monitoring::engineMetrics().reset();
+    RingWorker w;
+    if (!w.startPair(kReclaim)) {
+        std::cerr << "[reclaim] worker setup failed\n";
+        return false;
+    }
+
+    const std::string f = frame("partial");
+    // 부분 프레임이 남은 동안은 비어 있지 않으므로 idle 이 지나도 유지된다.
+    bool ok = writeAll(w.peer, f.substr(0, 3)) && waitUntil([]() { return ringsInUse() == 1; }, 1s);
+    std::this_thread::sleep_for(std::chrono::milliseconds(kReclaimIdleMs * 4));
+    if (!ok || ringsInUse() != 1) {
+        std::cerr << "[reclaim] recv ring holding a partial frame was reclaimed\n";
+        w.stop();
+        return false;
+    }
+
+    ok = writeAll(w.peer, f.substr(3)) && waitUntil([&]() { return w.received() == 1; }, 1s) &&
+         waitUntil([]() { return ringsInUse() == 0 && ringReclaims() == 1; }, 1s);
+    if (!ok) {
+        std::cerr << "[reclaim] idle recv ring not returned (in_use=" << ringsInUse() << ")\n";
+        w.stop();
+        return false;
+    }
+
+    // 회수된 뒤에도 세션은 계속 동작한다. (필요하면 다시 꺼냄)
+    ok = writeAll(w.peer, f.substr(0, 3)) && waitUntil([]() { return ringsInUse() == 1; }, 1s) &&
+         writeAll(w.peer, f.substr(3)) && waitUntil([&]() { return w.received() == 2; }, 1s);
+    w.stop();
+    if (!ok) {
+        std::cerr << "[reclaim] session unusable after reclaim\n";
+    }
+    return ok;
+}
+
+/// 송신 링에 대기 바이트가 있으면 idle 이 지나도 회수하지 않고, peer 가 다 읽은 뒤에만 회수합니다.
+/// - sendQueueLimit > 0 이면 링 뒤로 overflow 블록까지 쌓은 상태로 확인합니다.
+bool runPendingSendCase(const char *tag, std::size_t sendQueueLimit) {
+    hypernet::monitoring::engineMetrics().reset();
+    RingWorker w;
+    const auto setup = [sendQueueLimit](SessionManager &sm) {
+        sm.configureRingReclaim(kReclaimIdleMs);
+        if (sendQueueLimit != 0) {
+            sm.configureSendQueue(sendQueueLimit, sendQueueLimit, 0);
+        }
+    };
+    if (!w.startPair(setup)) {
+        std::cerr << "[" << tag << "] worker setup failed\n";
+        return false;
+    }
+
+    // peer 가 읽지 않으니 커널 버퍼가 차면 링(그리고 overflow 큐)에 쌓인다.
+    const std::string body(512, 's');
+    const std::size_t frameBytes = frame(body).size();
+    const std::size_t target = sendQueueLimit != 0 ? kRingCap * 2 : 1;
+    std::size_t sent = 0;
+    while (w.queued() < target && sent < 100'000) {
+        bool ok = false;
+        w.call([&]() { ok = w.sm.sendPacketU16(w.sid, kOpcode, body.data(), body.size()); });
+        if (!ok) {
+            std::cerr << "[" << tag << "] send " << sent << " rejected\n";
+            w.stop();
+            return false;
+        }
+        ++sent;
+    }
+    const std::size_t pending = w.queued();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(kReclaimIdleMs * 4));
+    if (ringsInUse() != 1 || w.queued() != pending) {
+        std::cerr << "[" << tag << "] send ring reclaimed with " << pending << " bytes pending\n";
+        w.stop();
+        return false;
+    }
+
+    const bool ok = readBytes(w.peer, sent * frameBytes, 2s) && waitUntil([&]() { return w.queued() == 0; }, 1s) &&
+                    waitUntil([]() { return ringsInUse() == 0; }, 1s);
+    w.stop();
+    if (!ok) {
+        std::cerr << "[" << tag << "] drained send ring not reclaimed\n";
+    }
+    return ok;
+}
+
+bool test_reclaim_keeps_pending_send_ring() { return runPendingSendCase("pending-send", 0); }
+
+bool test_reclaim_keeps_ring_behind_overflow() { return runPendingSendCase("pending-overflow", 256 * 1024); }
+
+/// zero-copy 블록이 링 prefix 를 기억하고 있는 동안에는 링이 비어 있어도 회수하지 않습니다.
+bool test_reclaim_keeps_ring_for_zerocopy() {
+    hypernet::monitoring::engineMetrics().reset();
+    int fds[2]{-1, -1};
+    if (!hypernet::test::makeTcpPair(fds, 4096)) {
+        std::cerr << "[zerocopy] tcp loopback unavailable, skipped\n";
+        return true;
+    }
+    RingWorker w;
+    const auto setup = [](SessionManager &sm) {
+        sm.configureRingReclaim(kReclaimIdleMs);
+        sm.configureDeferredFlush(true, false); // 작은 송신도 링을 거치게 한다.
+        sm.configureZeroCopy(1024, 64);
+    };
+    if (!w.startFds(fds, setup)) {
+        std::cerr << "[zerocopy] worker setup failed\n";
+        return false;
+    }
+
+    // 1) 작은 프레임 1개로 송신 링을 만들고 비운다.
+    w.call([&]() { (void)w.sm.sendPacketU16(w.sid, kOpcode, "hi", 2); });
+    bool ok = readBytes(w.peer, frame("hi").size(), 1s) && ringsInUse() == 1;
+
+    // 2) peer 가 읽지 않는 동안 큰 프레임을 보내 zero-copy 블록을 대기시킨다. (링은 빈 채로)
+    const std::string big(32 * 1024, 'z');
+    std::size_t expect = 0;
+    for (int i = 0; ok && i < 32; ++i) {
+        w.call([&]() { ok = w.sm.sendPacketU16(w.sid, kOpcode, big.data(), big.size()); });
+        expect += frame(big).size();
+    }
+    if (ok && w.queued() != 0) {
+        // 블록 풀이 모자라 복사 경로로 링에 쌓였다면 이 테스트가 보려는 상태가 아니다.
+        std::cerr << "[zerocopy] frames fell back to the ring (" << w.queued() << " bytes)\n";
+        ok = false;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(kReclaimIdleMs * 4));
+    if (ok && ringsInUse() != 1) {
+        std::cerr << "[zerocopy] empty send ring reclaimed while zero-copy blocks were pending\n";
+        ok = false;
+    }
+
+    ok = ok && readBytes(w.peer, expect, 2s) && waitUntil([]() { return ringsInUse() == 0; }, 1s);
+    w.stop();
+    if (!ok) {
+        std::cerr << "[zerocopy] failed (in_use=" << ringsInUse() << ")\n";
+    }
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = ok && test_rings_lazy();
+    ok = ok && test_staging_hands_partial_to_session();
+    ok = ok && test_reclaim_after_idle();
+    ok = ok && test_reclaim_keeps_pending_send_ring();
+    ok = ok && test_reclaim_keeps_ring_behind_overflow();
+    ok = ok && test_reclaim_keeps_ring_for_zerocopy();
+
+    if (!ok) {
+        std::cerr << "SessionRing tests FAILED\n";
+        return 1;
+    }
+    std::cout << "SessionRing tests PASSED\n";
+    return 0;
+}
@@ -0,0 +1,283 @@
+#include "WorkerHarness.hpp"
+
+#include <hyperapp/core/SessionRegistry.hpp>
+#include <hyperapp/core/SessionService.hpp>
+#include <hyperapp/core/TopicBroadcaster.hpp>
+#include <hyperapp/protocol/PacketWriter.hpp>
+
+#include <hypernet/net/SessionMigration.hpp>
+#include <hypernet/net/SessionRouterFactory.hpp>
+#include <hypernet/net/WorkerLocal.hpp>
+#include <hypernet/net/WorkerSchedulerFactory.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+
+using hypernet::SessionHandle;
+using hypernet::net::SessionManager;
+using hypernet::net::SessionMigrator;
+using hypernet::test::TestWorker;
+using hypernet::test::waitUntil;
+
+namespace {
+
+using namespace std::chrono_literals;
+
+constexpr unsigned int kWorkers = 3;
+
+struct Note {
+    static constexpr std::uint16_t kOpcode = 0x0404;
+    std::string body;
+    void write(hyperapp::protocol::PacketWriter &w) const { w.writeBytes(body.data(), body.size()); }
+};
+
+/// 워커마다 SessionRegistry 를 두고, 이관 시 레코드를 떼어 대상 워커 registry 에 다시 붙입니다. (AppRuntime 과 같은 흐름)
+class RegistryApp final : public hypernet::test::TestApp {
+  public:
+    explicit RegistryApp(std::array<std::unique_ptr<hyperapp::SessionRegistry>, kWorkers> &regs) : regs_(regs) {}
+
+    void onSessionStart(SessionHandle session) override { reg_().add(session, 0, 0); }
+    void onSessionEnd(SessionHandle session) override {
+        reg_().remove(session.id());
+        endedOn.store(hypernet::core::ThreadContext::currentWorkerId(), std::memory_order_release);
+    }
+    bool onSessionMigrateOut(SessionHandle session, int, std::shared_ptr<void> &context) override {
+        auto detached = std::make_shared<hyperapp::SessionRegistry::DetachedSession>();
+        if (!reg_().detach(session.id(), *detached)) {
+            return false;
+        }
+        context = detached;
+        return true;
+    }
+    void onSessionMigrateIn(SessionHandle session, std::shared_ptr<void> context) override {
+        reg_().attach(session, *std::static_pointer_cast<hyperapp::SessionRegistry::DetachedSession>(context));
+        migratedIn.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    std::atomic<int> migratedIn{0};
+    std::atomic<int> endedOn{-1};
+
+  private:
+    hyperapp::SessionRegistry &reg_() { return *regs_[hypernet::core::ThreadContext::currentWorkerId()]; }
+
+    std::array<std::unique_ptr<hyperapp::SessionRegistry>, kWorkers> &regs_;
+};
+
+/// 워커 3개 + 워커별 SessionService. 세션은 워커 0 이 받고 워커 1 로 옮깁니다.
+/// - 워커 0: id 의 워커 (registry 에는 없고 엔진 forward 엔트리만 남음)
+/// - 워커 1: 현재 owner
+/// - 워커 2: 제3 워커 (id 만 보고 워커 0 으로 보냄)
+struct RoutingCluster {
+    std::shared_ptr<SessionMigrator> migrator = std::make_shared<SessionMigrator>(kWorkers);
+    std::array<std::unique_ptr<hyperapp::SessionRegistry>, kWorkers> regs;
+    std::shared_ptr<RegistryApp> app = std::make_shared<RegistryApp>(regs);
+    hyperapp::TopicBroadcaster bc;
+    std::array<std::unique_ptr<hyperapp::SessionService>, kWorkers> svcs;
+    std::array<std::unique_ptr<TestWorker>, kWorkers> workers;
+    SessionHandle::Id sid{0};
+    int peer{-1};
+
+    bool start() {
+        std::vector<hypernet::net::EventLoop *> loops;
+        std::vector<hyperapp::SessionRegistry *> regPtrs;
+        for (unsigned int w = 0; w < kWorkers; ++w) {
+            workers[w] = std::make_unique<TestWorker>(w);
+            regs[w] = std::make_unique<hyperapp::SessionRegistry>(static_cast<int>(w));
+            migrator->attach(w, &workers[w]->loop, &workers[w]->sm);
+            loops.push_back(&workers[w]->loop);
+            regPtrs.push_back(regs[w].get());
+        }
+        auto router = hypernet::net::makeGlobalSessionRouter(loops);
+        auto scheduler = hypernet::net::makeGlobalWorkerScheduler(loops, nullptr, migrator);
+        bc.setRouter(router);
+        bc.setScheduler(scheduler);
+        bc.setRegistries(std::move(regPtrs));
+        for (unsigned int w = 0; w < kWorkers; ++w) {
+            svcs[w] = std::make_unique<hyperapp::SessionService>(static_cast<int>(w), *regs[w], bc);
+            svcs[w]->setRouter(router);
+            svcs[w]->setScheduler(scheduler);
+        }
+        for (auto &w : workers) {
+            w->start([this](SessionManager &sm) {
+                sm.setApplication(app);
+                sm.attachMigrator(migrator.get());
+                hypernet::net::WorkerLocal::set(&sm);
+            });
+        }
+        if (!workers[0]->acceptPair()) {
+            return false;
+        }
+        sid = workers[0]->sid;
+        peer = workers[0]->peer;
+        return migrator->request(sid, 1) &&
+               waitUntil([&]() { return app->migratedIn.load(std::memory_order_acquire) == 1; });
+    }
+
+    template <typename Fn> void call(unsigned int w, Fn &&fn) { workers[w]->call(std::forward<Fn>(fn)); }
+    hyperapp::SessionService &svc(unsigned int w) { return *svcs[w]; }
+
+    /// peer 가 body 프레임을 받는지 확인합니다.
+    bool receive(const std::string &body) {
+        const std::string want = hypernet::test::encodeFrame(Note::kOpcode, body);
+        std::string got;
+        const auto deadline = std::chrono::steady_clock::now() + 1s;
+        while (got.size() < want.size() && std::chrono::steady_clock::now() < deadline) {
+            char buf[256];
+            ::pollfd pfd{peer, POLLIN, 0};
+            if (::poll(&pfd, 1, 10) <= 0) {
+                continue;
+            }
+            const ::ssize_t n = ::recv(peer, buf, want.size() - got.size(), 0);
+            if (n <= 0) {
+                break;
+            }
+            got.append(buf, static_cast<std::size_t>(n));
+        }
+        if (got != want) {
+            std::cerr << "  peer did not receive '" << body << "'\n";
+            return false;
+        }
+        return true;
+    }
+
+    /// peer 쪽에서 EOF 를 보면 true.
+    bool peerClosed() {
+        char buf[64];
+        const auto deadline = std::chrono::steady_clock::now() + 1s;
+        while (std::chrono::steady_clock::now() < deadline) {
+            ::pollfd pfd{peer, POLLIN, 0};
+            if (::poll(&pfd, 1, 10) <= 0) {
+                continue;
+            }
+            const ::ssize_t n = ::recv(peer, buf, sizeof(buf), 0);
+            if (n == 0) {
+                return true;
+            }
+            if (n < 0) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    void stop() {
+        for (auto &w : workers) {
+            if (w) {
+                w->stop();
+            }
+        }
+    }
+};
+
+/// 옮긴 뒤에도 sendTo 는 어느 워커에서 부르든 peer 까지 갑니다.
+bool test_send_to_after_migration() {
+    RoutingCluster c;
+    if (!c.start()) {
+        std::cerr << "[send-to] cluster setup failed\n";
+        c.stop();
+        return false;
+    }
+    bool ok = true;
+    for (unsigned int via = 0; via < kWorkers && ok; ++via) {
+        bool accepted = false;
+        const std::string body = "send-via-" + std::to_string(via);
+        c.call(via, [&]() { accepted = c.svc(via).sendTo(c.sid, Note{body}); });
+        ok = accepted && c.receive(body);
+        if (!ok) {
+            std::cerr << "[send-to] via worker " << via << " failed (accepted=" << accepted << ")\n";
+        }
+    }
+    // 현재 owner 에서는 local-only API 도 통한다.
+    if (ok) {
+        bool accepted = false;
+        c.call(1, [&]() { accepted = c.svc(1).sendToLocal(c.sid, Note{"local"}); });
+        ok = accepted && c.receive("local");
+        if (!ok) {
+            std::cerr << "[send-to] sendToLocal on the new owner failed\n";
+        }
+    }
+    c.stop();
+    return ok;
+}
+
+/// multicast 도 옮겨 간 세션을 빠뜨리지 않습니다.
+bool test_multicast_after_migration() {
+    RoutingCluster c;
+    if (!c.start()) {
+        std::cerr << "[multicast] cluster setup failed\n";
+        c.stop();
+        return false;
+    }
+    bool ok = true;
+    for (unsigned int via = 0; via < kWorkers && ok; ++via) {
+        const std::string body = "multi-via-" + std::to_string(via);
+        c.call(via, [&]() { c.svc(via).multicast({c.sid}, Note{body}); });
+        ok = c.receive(body);
+        if (!ok) {
+            std::cerr << "[multicast] via worker " << via << " failed\n";
+        }
+    }
+    c.stop();
+    return ok;
+}
+
+/// 제3 워커에서 sid 로 close 해도 새 owner 에서 닫힙니다. (reason 은 호출자 문자열)
+bool test_close_after_migration() {
+    RoutingCluster c;
+    if (!c.start()) {
+        std::cerr << "[close] cluster setup failed\n";
+        c.stop();
+        return false;
+    }
+    c.call(2, [&]() { c.svc(2).close(c.sid, std::string("routing_test_close")); });
+    const bool ended = waitUntil([&]() { return c.app->endedOn.load(std::memory_order_acquire) == 1; });
+    const bool closed = ended && c.peerClosed();
+    c.stop();
+    if (!closed) {
+        std::cerr << "[close] session did not close on the new owner (ended=" << ended << ")\n";
+    }
+    return closed;
+}
+
+/// 현재 owner 의 closeLocal 도 옮겨 온 세션을 닫습니다.
+bool test_close_local_on_new_owner() {
+    RoutingCluster c;
+    if (!c.start()) {
+        std::cerr << "[close-local] cluster setup failed\n";
+        c.stop();
+        return false;
+    }
+    c.call(1, [&]() { c.svc(1).closeLocal(c.sid, std::string("routing_test_close")); });
+    const bool ended = waitUntil([&]() { return c.app->endedOn.load(std::memory_order_acquire) == 1; });
+    c.stop();
+    if (!ended) {
+        std::cerr << "[close-local] session did not close\n";
+    }
+    return ended;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = ok && test_send_to_after_migration();
+    ok = ok && test_multicast_after_migration();
+    ok = ok && test_close_after_migration();
+    ok = ok && test_close_local_on_new_owner();
+
+    if (!ok) {
+        std::cerr << "SessionServiceRouting tests FAILED\n";
+        return 1;
+    }
+    std::cout << "SessionServiceRouting tests PASSED\n";
+    return 0;
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+// net 테스트 공용: 워커(EventLoop + SessionManager)를 전용 스레드에서 돌리는 하네스입니다.
+
+#include <hypernet/IApplication.hpp>
+#include <hypernet/core/ThreadContext.hpp>
+#include <hypernet/net/EventLoop.hpp>
+#include <hypernet/net/SessionManager.hpp>
+#include <hypernet/protocol/Dispatcher.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace hypernet::test {
+
+/// 핸들러 없이 모든 콜백을 무시하는 IApplication. 테스트 앱은 필요한 콜백만 override 합니다.
+class TestApp : public hypernet::IApplication {
+  public:
+    void registerHandlers(hypernet::protocol::Dispatcher &) override {}
+    void onServerStart() override {}
+    void onServerStop() override {}
+    void onSessionStart(hypernet::SessionHandle) override {}
+    void onSessionEnd(hypernet::SessionHandle) override {}
+};
+
+/// 워커 1개를 별도 스레드에서 돌립니다.
+/// - start(setup): 워커 스레드에서 worker id 설정 → loop bind → setup(sm) 후 loop.run
+/// - call(fn): fn 을 워커 스레드에서 실행하고 끝날 때까지 기다림 (SessionManager 는 owner 스레드 전용)
+/// - 타이머를 걸지 않으면 루프는 I/O 나 post 가 없는 동안 무기한 잠듭니다.
+struct TestWorker {
+    hypernet::net::EventLoop loop{std::chrono::milliseconds{10}, 64, 16};
+    hypernet::net::SessionManager sm;
+    std::atomic_bool running{true};
+    std::thread thread;
+    hypernet::SessionHandle::Id sid{0}; ///< acceptPair/acceptFd 로 만든 세션
+    int peer{-1};                       ///< 그 세션의 반대쪽 fd (stop 에서 닫음)
+
+    explicit TestWorker(unsigned int wid = 0, std::size_t recvRing = 4096, std::size_t sendRing = 4096,
+                        std::uint32_t maxPayload = 1024)
+        : sm(wid, &loop, recvRing, sendRing, maxPayload), wid_(wid) {}
+
+    ~TestWorker() { stop(); }
+
+    TestWorker(const TestWorker &) = delete;
+    TestWorker &operator=(const TestWorker &) = delete;
+
+    template <typename Setup> void start(Setup setup) {
+        std::atomic_bool ready{false};
+        thread = std::thread([this, setup, &ready]() mutable {
+            hypernet::core::ThreadContext::setCurrentWorkerId(static_cast<int>(wid_));
+            loop.bindToCurrentThread();
+            setup(sm);
+            ready.store(true, std::memory_order_release);
+            loop.run(running);
+            sm.shutdownInOwnerThread();
+        });
+        while (!ready.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+
+    void start() {
+        start([](hypernet::net::SessionManager &) {});
+    }
+
+    template <typename Fn> void call(Fn &&fn) {
+        std::atomic_bool done{false};
+        loop.post([&fn, &done]() {
+            fn();
+            done.store(true, std::memory_order_release);
+        });
+        while (!done.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+
+    /// fd 를 이 워커의 세션으로 받습니다. peerFd 는 stop() 에서 닫습니다.
+    bool acceptFd(int fd, int peerFd) {
+        peer = peerFd;
+        call([&]() { sid = sm.onAccepted(hypernet::net::Socket(fd), {"test", 0}).id(); });
+        return sid != 0;
+    }
+
+    /// AF_UNIX socketpair 한쪽을 세션으로 받고 반대쪽을 peer 로 둡니다.
+    bool acceptPair() {
+        int fds[2]{-1, -1};
+        if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds) != 0) {
+            return false;
+        }
+        return acceptFd(fds[0], fds[1]);
+    }
+
+    std::size_t queued() {
+        std::size_t n = 0;
+        call([&]() { n = sm.queuedSendBytes(sid); });
+        return n;
+    }
+
+    /// 루프를 멈추고 스레드를 합친 뒤 peer 를 닫습니다. (여러 번 불러도 됨)
+    void stop() {
+        if (thread.joinable()) {
+            running.store(false, std::memory_order_release);
+            loop.wakeup();
+            thread.join();
+        }
+        if (peer >= 0) {
+            ::close(peer);
+            peer = -1;
+        }
+    }
+
+  private:
+    unsigned int wid_;
+};
+
+template <typename Pred> bool waitUntil(Pred pred, std::chrono::milliseconds timeout = std::chrono::milliseconds{1000}) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    return true;
+}
+
+/// loopback TCP 연결을 만듭니다. (fds[0] = 세션용 non-blocking, fds[1] = peer. SO_ZEROCOPY 는 TCP 에서만 됨)
+/// - sndBuf > 0 이면 fds[0] 의 송신 버퍼를 줄여 peer 가 읽지 않을 때 금방 막히게 합니다.
+///   (peer 수신 버퍼까지 줄이면 window < MSS 가 되어 loopback 송신이 멈추므로 건드리지 않음)
+inline bool makeTcpPair(int fds[2], int sndBuf = 0) {
+    const int lfd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    ::sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ::socklen_t alen = sizeof(addr);
+    bool ok = lfd >= 0 && ::bind(lfd, reinterpret_cast<::sockaddr *>(&addr), sizeof(addr)) == 0 &&
+              ::listen(lfd, 1) == 0 && ::getsockname(lfd, reinterpret_cast<::sockaddr *>(&addr), &alen) == 0;
+    fds[1] = ok ? ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0) : -1;
+    ok = ok && fds[1] >= 0 && ::connect(fds[1], reinterpret_cast<::sockaddr *>(&addr), sizeof(addr)) == 0;
+    fds[0] = ok ? ::accept4(lfd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC) : -1;
+    if (lfd >= 0) {
+        ::close(lfd);
+    }
+    if (fds[0] < 0) {
+        if (fds[1] >= 0) {
+            ::close(fds[1]);
+        }
+        return false;
+    }
+    if (sndBuf > 0) {
+        (void)::setsockopt(fds[0], SOL_SOCKET, SO_SNDBUF, &sndBuf, sizeof(sndBuf));
+    }
+    return true;
+}
+
+/// [len(4B BE) = 2 + body][opcode(2B BE)][body] 프레임을 만듭니다.
+inline std::string encodeFrame(std::uint16_t opcode, const std::string &body) {
+    const std::uint32_t len = static_cast<std::uint32_t>(2 + body.size());
+    std::string out{static_cast<char>(len >> 24), static_cast<char>(len >> 16), static_cast<char>(len >> 8),
+                    static_cast<char>(len), static_cast<char>(opcode >> 8), static_cast<char>(opcode & 0xFF)};
+    return out + body;
+}
+
+} // namespace hypernet::test
@@ -0,0 +1,244 @@
+#include "WorkerHarness.hpp"
+
+#include <hypernet/net/Session.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <span>
+#include <string>
+#include <thread>
+
+#include <poll.h>
+#include <sys/socket.h>
+
+using hypernet::net::SessionManager;
+using hypernet::net::zeroCopyCredits;
+using hypernet::test::TestWorker;
+using hypernet::test::waitUntil;
+
+namespace {
+
+using namespace std::chrono_literals;
+
+constexpr std::uint16_t kOpcode = 0x0505;
+constexpr std::size_t kBodyBytes = 32 * 1024;
+constexpr std::size_t kMaxPayload = 64 * 1024;
+
+/// 통지 구간이 블록 순서와 다르게, 여러 번에 나뉘어, uint32 경계를 넘어 와도 블록별로 정확히 셉니다.
+bool test_credit_out_of_order() {
+    // 블록 A = 통지 번호 10..12 (sendmsg 3회), 블록 B = 13..14
+    std::uint32_t a = 0;
+    std::uint32_t b = 0;
+    const auto notify = [&](std::uint32_t lo, std::uint32_t hi) {
+        a += zeroCopyCredits(10, 3, lo, hi);
+        b += zeroCopyCredits(13, 2, lo, hi);
+    };
+    notify(13, 14); // 뒤 블록이 먼저 끝남
+    const bool bFirst = a == 0 && b == 2;
+    notify(11, 12); // 앞 블록의 뒤 조각
+    const bool aPartial = a == 2;
+    notify(10, 10);
+    const bool aDone = a == 3 && b == 2;
+    notify(20, 30); // 관계없는 구간
+    const bool untouched = a == 3 && b == 2;
+
+    // 번호 wrap: 0xFFFFFFFE, 0xFFFFFFFF, 0
+    const bool wrap = zeroCopyCredits(0xFFFFFFFEu, 3, 0xFFFFFFFFu, 0) == 2 &&
+                      zeroCopyCredits(0xFFFFFFFEu, 3, 0xFFFFFFFEu, 0xFFFFFFFEu) == 1 &&
+                      zeroCopyCredits(0xFFFFFFFEu, 3, 1, 5) == 0;
+
+    if (!(bFirst && aPartial && aDone && untouched && wrap)) {
+        std::cerr << "[credit] a=" << a << " b=" << b << " wrap=" << wrap << "\n";
+        return false;
+    }
+    return true;
+}
+
+std::uint8_t patternAt(std::size_t frame, std::size_t i) { return static_cast<std::uint8_t>(frame * 31 + i % 251); }
+
+/// peer 에서 frames 개 프레임을 읽어 헤더/본문을 확인합니다.
+bool readFrames(int peer, std::size_t frames, std::chrono::milliseconds timeout) {
+    const std::size_t frameBytes = 6 + kBodyBytes;
+    std::string got;
+    got.reserve(frames * frameBytes);
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (got.size() < frames * frameBytes && std::chrono::steady_clock::now() < deadline) {
+        char buf[16 * 1024];
+        ::pollfd pfd{peer, POLLIN, 0};
+        if (::poll(&pfd, 1, 10) <= 0) {
+            continue;
+        }
+        const ::ssize_t n = ::recv(peer, buf, sizeof(buf), 0);
+        if (n <= 0) {
+            break;
+        }
+        got.append(buf, static_cast<std::size_t>(n));
+    }
+    if (got.size() != frames * frameBytes) {
+        std::cerr << "  peer got " << got.size() << " of " << frames * frameBytes << " bytes\n";
+        return false;
+    }
+    for (std::size_t f = 0; f < frames; ++f) {
+        const auto *p = reinterpret_cast<const std::uint8_t *>(got.data() + f * frameBytes);
+        const std::uint32_t len = (std::uint32_t{p[0]} << 24) | (std::uint32_t{p[1]} << 16) | (std::uint32_t{p[2]} << 8) | p[3];
+        const std::uint16_t opcode = static_cast<std::uint16_t>((p[4] << 8) | p[5]);
+        if (len != 2 + kBodyBytes || opcode != kOpcode) {
+            std::cerr << "  frame " << f << " header mismatch (len=" << len << " opcode=" << opcode << ")\n";
+            return false;
+        }
+        for (std::size_t i = 0; i < kBodyBytes; ++i) {
+            if (p[6 + i] != patternAt(f, i)) {
+                std::cerr << "  frame " << f << " body mismatch at " << i << "\n";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::size_t blocksInUse(TestWorker &w) {
+    std::size_t n = 0;
+    w.call([&]() { n = w.sm.zeroCopyBlocksInUse(); });
+    return n;
+}
+
+/// 호출자가 블록에 직접 쓴 body 를 loopback TCP 로 MSG_ZEROCOPY 송신합니다.
+/// - peer 가 읽지 않는 동안에는 블록이 풀로 돌아오지 않고 (완료 통지 전 반납 금지)
+/// - peer 가 다 읽으면 error queue 통지를 수거해 모든 블록이 돌아와야 합니다.
+bool test_owned_body_loopback() {
+    int fds[2]{-1, -1};
+    if (!hypernet::test::makeTcpPair(fds, 4096)) {
+        std::cout << "[loopback] tcp loopback unavailable, skipped\n";
+        return true;
+    }
+    int one = 1;
+    if (::setsockopt(fds[0], SOL_SOCKET, SO_ZEROCOPY, &one, sizeof(one)) != 0) {
+        std::cout << "[loopback] SO_ZEROCOPY unavailable, skipped\n";
+        ::close(fds[0]);
+        ::close(fds[1]);
+        return true;
+    }
+
+    constexpr std::size_t kFrames = 16;
+    TestWorker w(0, 4096, 4096, kMaxPayload);
+    w.start([](SessionManager &sm) { sm.configureZeroCopy(1024, kFrames); });
+    if (!w.acceptFd(fds[0], fds[1])) {
+        std::cerr << "[loopback] accept failed\n";
+        return false;
+    }
+
+    bool ok = true;
+    w.call([&]() {
+        for (std::size_t f = 0; f < kFrames && ok; ++f) {
+            const std::span<std::uint8_t> body = w.sm.acquireZeroCopyBody();
+            if (body.size() < kBodyBytes) {
+                std::cerr << "[loopback] acquire " << f << " returned " << body.size() << " bytes\n";
+                w.sm.releaseZeroCopyBody(body);
+                ok = false;
+                break;
+            }
+            for (std::size_t i = 0; i < kBodyBytes; ++i) {
+                body[i] = patternAt(f, i);
+            }
+            ok = w.sm.sendZeroCopyBody(w.sid, kOpcode, body, kBodyBytes);
+        }
+    });
+    if (!ok) {
+        std::cerr << "[loopback] send failed\n";
+        return false;
+    }
+
+    // peer 수신 버퍼가 찰 때까지는 전달된 만큼 통지가 와서 블록이 돌아온다. 그 뒤로는 peer 가 멈춰 있는 동안
+    // 남은 블록이 커널/송신 큐에 머물러 있으므로 반납되지 않고 그대로 남아야 한다.
+    std::size_t stalled = blocksInUse(w);
+    for (int i = 0; i < 40; ++i) {
+        std::this_thread::sleep_for(50ms);
+        const std::size_t now = blocksInUse(w);
+        if (now == stalled) {
+            break;
+        }
+        stalled = now;
+    }
+    std::this_thread::sleep_for(100ms);
+    const std::size_t stalledLater = blocksInUse(w);
+    if (stalled == 0 || stalledLater != stalled) {
+        std::cerr << "[loopback] blocks released while the peer was stalled (" << stalled << " -> " << stalledLater
+                  << ")\n";
+        ok = false;
+    }
+
+    ok = ok && readFrames(w.peer, kFrames, 2000ms);
+    if (ok && !waitUntil([&]() { return blocksInUse(w) == 0; })) {
+        std::cerr << "[loopback] " << blocksInUse(w) << " blocks never came back after the peer drained\n";
+        ok = false;
+    }
+    return ok;
+}
+
+/// zero-copy 를 못 쓰는 소켓(AF_UNIX)이나 없는 세션에도 블록이 새지 않습니다.
+bool test_owned_body_fallbacks() {
+    TestWorker w(0, 4096, 4096, kMaxPayload);
+    w.start([](SessionManager &sm) { sm.configureZeroCopy(1024, 4); });
+    if (!w.acceptPair()) {
+        std::cerr << "[fallback] accept failed\n";
+        return false;
+    }
+
+    bool sent = false;
+    bool missing = true;
+    std::size_t held = 0;
+    w.call([&]() {
+        // 보내지 않고 돌려주기
+        auto spare = w.sm.acquireZeroCopyBody();
+        held = w.sm.zeroCopyBlocksInUse();
+        w.sm.releaseZeroCopyBody(spare);
+
+        // 없는 세션: 실패해도 블록은 반납
+        auto lost = w.sm.acquireZeroCopyBody();
+        missing = !lost.empty() && w.sm.sendZeroCopyBody(w.sid + 1000, kOpcode, lost, 16);
+
+        // AF_UNIX: 일반 경로로 복사 송신
+        auto body = w.sm.acquireZeroCopyBody();
+        for (std::size_t i = 0; i < kBodyBytes && i < body.size(); ++i) {
+            body[i] = patternAt(0, i);
+        }
+        sent = body.size() >= kBodyBytes && w.sm.sendZeroCopyBody(w.sid, kOpcode, body, kBodyBytes);
+    });
+    const bool received = sent && readFrames(w.peer, 1, 1000ms);
+    const std::size_t left = blocksInUse(w);
+    if (held != 1 || missing || !received || left != 0) {
+        std::cerr << "[fallback] held=" << held << " missing=" << missing << " received=" << received
+                  << " left=" << left << "\n";
+        return false;
+    }
+
+    // zero-copy 를 끄면 블록을 빌려주지 않는다.
+    bool empty = false;
+    w.call([&]() {
+        w.sm.configureZeroCopy(0, 0);
+        empty = w.sm.acquireZeroCopyBody().empty();
+    });
+    if (!empty) {
+        std::cerr << "[fallback] acquire succeeded with zero-copy off\n";
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = ok && test_credit_out_of_order();
+    ok = ok && test_owned_body_loopback();
+    ok = ok && test_owned_body_fallbacks();
+
+    if (!ok) {
+        std::cerr << "ZeroCopySend tests FAILED\n";
+        return 1;
+    }
+    std::cout << "ZeroCopySend tests PASSED\n";
+    return 0;
+}
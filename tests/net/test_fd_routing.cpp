@@ -83,7 +83,7 @@ int main()
     // 단일 스레드 테스트이므로 worker id는 0처럼 설정해 로그 포맷을 맞춘다.
     hypernet::core::ThreadContext::setCurrentWorkerId(0);
 
-    EventLoop loop(EventLoop::Duration{10}, /*timerSlots=*/64, /*maxEpollEvents=*/16);
+    EventLoop loop(std::chrono::milliseconds{10}, /*timerSlots=*/64, /*maxEpollEvents=*/16);
     loop.bindToCurrentThread();
 
     const int efd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
@@ -0,0 +1,173 @@
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <span>
+
+#include <hypernet/SessionHandle.hpp>
+#include <hypernet/protocol/Dispatcher.hpp>
+#include <hypernet/protocol/MessageView.hpp>
+
+using hypernet::SessionHandle;
+using hypernet::protocol::Dispatcher;
+using hypernet::protocol::MessageView;
+
+namespace
+{
+
+struct Counter
+{
+    int hits{0};
+    std::uint32_t lastMask{0};
+    std::size_t lastBytes{0};
+
+    void onMsg(SessionHandle, const MessageView &body)
+    {
+        ++hits;
+        lastBytes = body.size();
+    }
+
+    void onMasked(SessionHandle, const MessageView &, std::uint32_t mask)
+    {
+        ++hits;
+        lastMask = mask;
+    }
+};
+
+void freeHandler(Counter &c, SessionHandle, const MessageView &) { c.hits += 10; }
+
+bool test_dynamic_registration()
+{
+    Dispatcher d;
+    int hits = 0;
+    std::uint32_t seenMask = 0;
+
+    if (!d.registerHandler(0x0100, [&hits](SessionHandle, const MessageView &) { ++hits; }))
+    {
+        std::cerr << "[dynamic] register failed\n";
+        return false;
+    }
+    if (d.registerHandler(0x0100, [](SessionHandle, const MessageView &) {}))
+    {
+        std::cerr << "[dynamic] duplicate opcode must be rejected\n";
+        return false;
+    }
+    if (d.registerHandler(0x0101, Dispatcher::Handler{}))
+    {
+        std::cerr << "[dynamic] empty std::function must be rejected\n";
+        return false;
+    }
+
+    // 마스크를 받는 핸들러는 엔트리의 마스크를 함께 받는다.
+    d.registerHandler(
+        0xF00D, [&seenMask](SessionHandle, const MessageView &, std::uint32_t mask) { seenMask = mask; }, 0x6u);
+
+    const char body[3] = {1, 2, 3};
+    const MessageView view{body, sizeof(body)};
+    const SessionHandle s{7};
+
+    if (!d.dispatch(0x0100, s, view) || hits != 1)
+    {
+        std::cerr << "[dynamic] dispatch did not reach handler\n";
+        return false;
+    }
+    if (!d.dispatch(0xF00D, s, view) || seenMask != 0x6u || d.allowedMask(0xF00D) != 0x6u)
+    {
+        std::cerr << "[dynamic] allowed mask not carried to handler\n";
+        return false;
+    }
+    if (d.dispatch(0x0102, s, view) || d.dispatch(0x7777, s, view))
+    {
+        std::cerr << "[dynamic] unknown opcode must not be handled\n";
+        return false;
+    }
+    if (d.handlerCount() != 2 || !d.unregisterHandler(0x0100) || d.dispatch(0x0100, s, view) ||
+        d.handlerCount() != 1)
+    {
+        std::cerr << "[dynamic] unregister failed\n";
+        return false;
+    }
+    return true;
+}
+
+bool test_static_routes()
+{
+    Counter c;
+    Dispatcher d;
+
+    const bool ok = d.bindRoutes<Dispatcher::Route<0x2000, &Counter::onMsg>,
+                                 Dispatcher::Route<0x2001, &Counter::onMasked, 0x4u>,
+                                 Dispatcher::Route<0x2002, &freeHandler>>(&c);
+    if (!ok || d.handlerCount() != 3)
+    {
+        std::cerr << "[static] bindRoutes failed\n";
+        return false;
+    }
+    if (d.bind<&Counter::onMsg>(0x2000, &c))
+    {
+        std::cerr << "[static] duplicate bind must be rejected\n";
+        return false;
+    }
+
+    const char body[5] = {};
+    const MessageView view{body, sizeof(body)};
+    d.dispatch(0x2000, SessionHandle{1}, view);
+    d.dispatch(0x2001, SessionHandle{1}, view);
+    d.dispatch(0x2002, SessionHandle{1}, view);
+
+    if (c.hits != 12 || c.lastMask != 0x4u || c.lastBytes != sizeof(body))
+    {
+        std::cerr << "[static] hits=" << c.hits << " mask=" << c.lastMask << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool test_batch_and_stop()
+{
+    Dispatcher d;
+    std::size_t batchBodies = 0;
+    int singles = 0;
+
+    d.registerBatchHandler(0x3000, [&batchBodies](SessionHandle, std::span<const MessageView> bodies)
+                           { batchBodies += bodies.size(); });
+    d.registerHandler(0x3001, [&singles](SessionHandle, const MessageView &) { ++singles; });
+
+    const MessageView views[4]{};
+    d.dispatchBatch(0x3000, SessionHandle{1}, views, [] { return false; });
+    d.dispatch(0x3000, SessionHandle{1}, views[0]);
+    if (batchBodies != 5)
+    {
+        std::cerr << "[batch] batchBodies=" << batchBodies << " expected 5\n";
+        return false;
+    }
+
+    // 단건 핸들러 루프는 stop() 에서 멈춘다.
+    d.dispatchBatch(0x3001, SessionHandle{1}, views, [&singles] { return singles == 2; });
+    if (singles != 2)
+    {
+        std::cerr << "[batch] singles=" << singles << " expected 2\n";
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main()
+{
+    bool ok = true;
+
+    ok = ok && test_dynamic_registration();
+    ok = ok && test_static_routes();
+    ok = ok && test_batch_and_stop();
+
+    if (!ok)
+    {
+        std::cerr << "Dispatcher tests FAILED\n";
+        return 1;
+    }
+
+    std::cout << "Dispatcher tests PASSED\n";
+    return 0;
+}
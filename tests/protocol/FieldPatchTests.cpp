@@ -0,0 +1,95 @@
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <hypernet/buffer/PacketBuffer.hpp>
+#include <hypernet/protocol/FieldPatch.hpp>
+
+using hypernet::protocol::FieldPatch;
+
+static bool test_validate()
+{
+    using hypernet::protocol::validFieldPatches;
+
+    const FieldPatch ok[] = {{0, 8, 1}, {24, 8, 2}};
+    const FieldPatch badWidth[] = {{0, 3, 1}};
+    const FieldPatch outOfRange[] = {{44, 8, 1}};
+    const FieldPatch overlap[] = {{0, 8, 1}, {4, 4, 2}};
+    const FieldPatch unsorted[] = {{24, 8, 1}, {0, 8, 2}};
+
+    if (!validFieldPatches(ok, 48) || validFieldPatches(badWidth, 48) || validFieldPatches(outOfRange, 48) ||
+        validFieldPatches(overlap, 48) || validFieldPatches(unsorted, 48) || !validFieldPatches({}, 0))
+    {
+        std::cerr << "[validate] unexpected result\n";
+        return false;
+    }
+    return true;
+}
+
+/// 조각으로 펼친 결과를 이어 붙이면 제자리 패치 결과와 같아야 하고, 원본은 그대로여야 합니다.
+static bool test_split_matches_apply()
+{
+    std::array<std::uint8_t, 48> body{};
+    for (std::size_t i = 0; i < body.size(); ++i)
+        body[i] = static_cast<std::uint8_t>(i);
+    const auto original = body;
+
+    const FieldPatch patches[] = {
+        {0, 8, 0x0102030405060708ULL},
+        {24, 8, 0xAABBCCDDEEFF0011ULL},
+        {46, 2, 0xBEEF},
+    };
+
+    hypernet::protocol::PatchedBody split;
+    if (!hypernet::protocol::splitPatched(body.data(), body.size(), patches, split) || split.total != body.size())
+    {
+        std::cerr << "[split] failed\n";
+        return false;
+    }
+
+    std::vector<std::uint8_t> joined;
+    for (std::size_t i = 0; i < split.count; ++i)
+        joined.insert(joined.end(), split.pieces[i].p, split.pieces[i].p + split.pieces[i].n);
+
+    auto patched = body;
+    hypernet::protocol::applyFieldPatches(patched.data(), patches);
+
+    if (body != original || joined.size() != patched.size() || std::memcmp(joined.data(), patched.data(), patched.size()) != 0)
+    {
+        std::cerr << "[split] mismatch\n";
+        return false;
+    }
+    return patched[0] == 0x01 && patched[7] == 0x08 && patched[24] == 0xAA && patched[46] == 0xBE && patched[47] == 0xEF;
+}
+
+/// 공유된 PacketBuffer 는 고칠 수 없습니다.
+static bool test_exclusive_buffer()
+{
+    const std::uint8_t src[16]{};
+    auto buf = hypernet::buffer::PacketBuffer::copyOf(src, sizeof(src));
+    if (buf.exclusiveData() == nullptr)
+        return false;
+
+    auto shared = buf;
+    const bool blocked = buf.exclusiveData() == nullptr;
+    shared.reset();
+    return blocked && buf.exclusiveData() != nullptr;
+}
+
+int main()
+{
+    bool ok = true;
+    ok = ok && test_validate();
+    ok = ok && test_split_matches_apply();
+    ok = ok && test_exclusive_buffer();
+
+    if (!ok)
+    {
+        std::cerr << "FieldPatch tests FAILED\n";
+        return 1;
+    }
+    std::cout << "FieldPatch tests PASSED\n";
+    return 0;
+}
@@ -55,6 +55,36 @@ int main() {
     assert(framer.tryFrame(rb, mv) == FrameResult::Framed);
     assert(mv.size() == payload3.size());
 
+    // 2-1) tryFrameBatch: 링 끝을 넘는 프레임을 포함해 완성 프레임을 한 번에 추출
+    {
+        RingBuffer small(32); // Flat: 랩어라운드 시 scratch 경로
+        LengthPrefixFramer batchFramer(/*maxPayloadLen=*/64);
+
+        std::vector<std::byte> filler(20, std::byte{0x00});
+        small.write(filler.data(), filler.size());
+        std::vector<std::byte> drain(filler.size());
+        small.read(drain.data(), drain.size()); // head = tail = 20
+
+        std::vector<std::byte> pa(6, std::byte{0x11}); // [20..30) 연속
+        std::vector<std::byte> pb(8, std::byte{0x22}); // [30..42) 랩어라운드
+        auto fa = makeFrameBE(pa);
+        auto fb = makeFrameBE(pb);
+        small.write(fa.data(), fa.size());
+        small.write(fb.data(), fb.size());
+        small.write(frame1.data(), 3); // 미완성 꼬리
+
+        std::vector<MessageView> views;
+        assert(batchFramer.tryFrameBatch(small, views) == FrameResult::Framed);
+        assert(views.size() == 2);
+        assert(views[0].size() == pa.size() && static_cast<const std::byte *>(views[0].data())[0] == std::byte{0x11});
+        assert(views[1].size() == pb.size() && static_cast<const std::byte *>(views[1].data())[7] == std::byte{0x22});
+        assert(small.available() == 3);
+
+        views.clear();
+        assert(batchFramer.tryFrameBatch(small, views) == FrameResult::NeedMore);
+        assert(views.empty());
+    }
+
     // 3) Invalid 길이
     // maxPayloadLen=1024인데 길이를 5000으로 넣기
     std::vector<std::byte> bad(4);
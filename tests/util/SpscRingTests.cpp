@@ -0,0 +1,191 @@
+#include <hypernet/util/SpscRing.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using hypernet::util::SpscRing;
+
+namespace {
+
+/// 용량은 2의 거듭제곱으로 올림되고, 꽉 찬 링/빈 링 경계에서 push/pop 이 거절되는지 확인합니다.
+bool test_full_empty_boundaries() {
+    SpscRing<std::uint32_t> ring(5);
+    if (ring.capacity() != 8 || SpscRing<int>(0).capacity() != 2) {
+        std::cerr << "[bounds] capacity not rounded: " << ring.capacity() << "\n";
+        return false;
+    }
+
+    std::uint32_t out = 0;
+    if (!ring.empty() || ring.full() || ring.tryPop(out)) {
+        std::cerr << "[bounds] new ring must be empty\n";
+        return false;
+    }
+
+    for (std::uint32_t i = 0; i < 8; ++i) {
+        if (!ring.tryPush(i)) {
+            std::cerr << "[bounds] push " << i << " rejected before full\n";
+            return false;
+        }
+    }
+    if (!ring.full() || ring.tryPush(99)) {
+        std::cerr << "[bounds] push accepted on a full ring\n";
+        return false;
+    }
+
+    // 하나 비우면 정확히 하나만 더 들어간다.
+    if (!ring.tryPop(out) || out != 0 || !ring.tryPush(8) || ring.tryPush(9)) {
+        std::cerr << "[bounds] slot reuse after one pop failed\n";
+        return false;
+    }
+
+    for (std::uint32_t expect = 1; expect <= 8; ++expect) {
+        if (!ring.tryPop(out) || out != expect) {
+            std::cerr << "[bounds] pop got " << out << " expected " << expect << "\n";
+            return false;
+        }
+    }
+    if (!ring.empty() || ring.tryPop(out)) {
+        std::cerr << "[bounds] ring not empty after draining\n";
+        return false;
+    }
+    return true;
+}
+
+/// index 가 용량을 여러 바퀴 넘어가도(wrap-around) 순서와 값이 유지되는지 확인합니다.
+bool test_wrap_around() {
+    SpscRing<std::uint64_t> ring(4);
+    std::uint64_t next = 0;
+    std::uint64_t expect = 0;
+
+    // 채우는 양을 1..4 로 바꿔 가며 head/tail 이 슬롯 경계 여기저기서 감기게 한다.
+    for (int round = 0; round < 100; ++round) {
+        const int fill = 1 + round % 4;
+        for (int i = 0; i < fill; ++i) {
+            if (!ring.tryPush(next)) {
+                std::cerr << "[wrap] push rejected at round " << round << "\n";
+                return false;
+            }
+            ++next;
+        }
+        const int drain = round % 2 == 0 ? fill : fill - 1;
+        for (int i = 0; i < drain; ++i) {
+            std::uint64_t out = 0;
+            if (!ring.tryPop(out) || out != expect) {
+                std::cerr << "[wrap] got " << out << " expected " << expect << "\n";
+                return false;
+            }
+            ++expect;
+        }
+        // 남긴 것은 다음 라운드 전에 비운다. (용량 초과 방지)
+        std::uint64_t out = 0;
+        while (ring.tryPop(out)) {
+            if (out != expect) {
+                std::cerr << "[wrap] leftover got " << out << " expected " << expect << "\n";
+                return false;
+            }
+            ++expect;
+        }
+    }
+    return expect == next && next > 4 * 50;
+}
+
+/// consume() 는 maxItems 만큼만 제자리에서 처리하고 나머지는 남겨 둡니다.
+bool test_consume_budget() {
+    SpscRing<int> ring(8);
+    for (int i = 0; i < 6; ++i) {
+        (void)ring.tryPushWith([i](int &slot) noexcept { slot = i * 10; });
+    }
+
+    std::vector<int> seen;
+    const std::size_t first = ring.consume([&seen](int &v) noexcept { seen.push_back(v); }, 4);
+    const std::size_t second =
+        ring.consume([&seen](int &v) noexcept { seen.push_back(v); }, std::numeric_limits<std::size_t>::max());
+    if (first != 4 || second != 2 || seen != std::vector<int>{0, 10, 20, 30, 40, 50} || !ring.empty()) {
+        std::cerr << "[consume] first=" << first << " second=" << second << "\n";
+        return false;
+    }
+    return ring.consume([](int &) noexcept {}, 8) == 0;
+}
+
+/// producer/consumer 스레드 하나씩으로 작은 링을 계속 넘치게 하면서 순서가 유지되는지 확인합니다.
+bool test_two_thread_order_stress() {
+    constexpr std::uint64_t kCount = 1'000'000;
+    SpscRing<std::uint64_t> ring(64);
+
+    std::thread producer([&ring]() {
+        for (std::uint64_t i = 1; i <= kCount; ++i) {
+            while (!ring.tryPush(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    bool ok = true;
+    std::uint64_t expect = 1;
+    while (expect <= kCount) {
+        // tryPop 과 consume 을 섞어 두 경로의 acquire/release 를 모두 탄다.
+        if ((expect & 1) != 0) {
+            std::uint64_t out = 0;
+            if (!ring.tryPop(out)) {
+                std::this_thread::yield();
+                continue;
+            }
+            if (out != expect) {
+                ok = false;
+                break;
+            }
+            ++expect;
+        } else {
+            const std::size_t n = ring.consume(
+                [&](std::uint64_t &v) noexcept {
+                    if (v != expect) {
+                        ok = false;
+                    }
+                    ++expect;
+                },
+                16);
+            if (!ok) {
+                break;
+            }
+            if (n == 0) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    if (!ok) {
+        // producer 가 끝날 수 있도록 남은 것을 비운다.
+        std::uint64_t out = 0;
+        while (expect <= kCount) {
+            if (ring.tryPop(out)) {
+                ++expect;
+            }
+        }
+    }
+    producer.join();
+    if (!ok) {
+        std::cerr << "[stress] order broken near " << expect << "\n";
+        return false;
+    }
+    return ring.empty();
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = ok && test_full_empty_boundaries();
+    ok = ok && test_wrap_around();
+    ok = ok && test_consume_budget();
+    ok = ok && test_two_thread_order_stress();
+
+    if (!ok) {
+        std::cerr << "SpscRing tests FAILED\n";
+        return 1;
+    }
+    std::cout << "SpscRing tests PASSED\n";
+    return 0;
+}